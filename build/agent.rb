@@ -44,7 +44,11 @@
   "#{AGENT_OUTPUT_DIR}TempDirToucherMain.o" =>
     "src/agent/TempDirToucher/TempDirToucherMain.cpp",
   "#{AGENT_OUTPUT_DIR}SpawnPreparerMain.o" =>
-    "src/agent/SpawnPreparer/SpawnPreparerMain.cpp"
+    "src/agent/SpawnPreparer/SpawnPreparerMain.cpp",
+  "#{AGENT_OUTPUT_DIR}LoadGeneratorMain.o" =>
+    "src/agent/LoadGenerator/LoadGeneratorMain.cpp",
+  "#{AGENT_OUTPUT_DIR}StatsReaderMain.o" =>
+    "src/agent/StatsReader/StatsReaderMain.cpp"
 }
 
 # Define compilation tasks for object files.
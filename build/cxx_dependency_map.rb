@@ -8,16 +8,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -27,6 +32,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -38,8 +44,11 @@
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -49,6 +58,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -70,20 +80,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -137,13 +151,17 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/BasicGroupInfo.h"=>
   ["src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -153,7 +171,9 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -161,12 +181,15 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -190,6 +213,7 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
@@ -197,13 +221,17 @@
  "src/agent/Core/ApplicationPool/BasicProcessInfo.h"=>
   ["src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -213,7 +241,9 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -221,12 +251,15 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -251,6 +284,7 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
@@ -258,10 +292,12 @@
  "src/agent/Core/ApplicationPool/Common.h"=>
   ["src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -271,10 +307,13 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -300,13 +339,17 @@
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/ApplicationPool/Context.h"=>
-  ["src/agent/Core/ApplicationPool/Options.h",
+  ["src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -315,7 +358,9 @@
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -323,12 +368,15 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -352,10 +400,21 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/DetachedProcessReaper.h"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
  "src/agent/Core/ApplicationPool/ErrorRenderer.h"=>
   ["src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/UnionStation/Connection.h",
@@ -371,7 +430,9 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -402,16 +463,20 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -421,7 +486,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -432,12 +500,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -480,17 +551,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -500,7 +575,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -511,12 +589,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -559,17 +640,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -579,7 +664,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -590,12 +678,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -638,17 +729,110 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/Group/MemoryRecycling.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -658,7 +842,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -669,12 +856,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -717,17 +907,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -737,7 +931,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -748,12 +945,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -796,17 +996,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -816,7 +1020,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -828,12 +1035,15 @@
    "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -876,17 +1086,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -896,7 +1110,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -907,12 +1124,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -955,17 +1175,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -975,7 +1199,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -986,12 +1213,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1034,17 +1264,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1054,7 +1288,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1065,12 +1302,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1113,17 +1353,22 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1133,7 +1378,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1144,12 +1392,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1192,17 +1443,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1212,7 +1467,10 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1223,12 +1481,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1271,11 +1532,13 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Group/InitializationAndShutdown.cpp",
    "src/agent/Core/ApplicationPool/Group/InternalUtils.cpp",
    "src/agent/Core/ApplicationPool/Group/LifetimeAndBasics.cpp",
+   "src/agent/Core/ApplicationPool/Group/MemoryRecycling.cpp",
    "src/agent/Core/ApplicationPool/Group/Miscellaneous.cpp",
    "src/agent/Core/ApplicationPool/Group/OutOfBandWork.cpp",
    "src/agent/Core/ApplicationPool/Group/ProcessListManagement.cpp",
@@ -1290,18 +1553,23 @@
    "src/agent/Core/ApplicationPool/Pool/GeneralUtils.cpp",
    "src/agent/Core/ApplicationPool/Pool/GroupUtils.cpp",
    "src/agent/Core/ApplicationPool/Pool/InitializationAndShutdown.cpp",
+   "src/agent/Core/ApplicationPool/Pool/MemoryRecycling.cpp",
    "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp",
    "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp",
    "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1312,7 +1580,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1324,13 +1595,16 @@
    "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1385,7 +1659,9 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1415,17 +1691,22 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1436,7 +1717,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1447,13 +1731,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1499,18 +1786,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1521,7 +1813,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1532,13 +1827,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1584,18 +1882,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1606,7 +1909,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1617,13 +1923,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1669,18 +1978,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1691,7 +2005,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1702,13 +2019,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1754,18 +2074,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1776,7 +2101,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1787,13 +2115,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1839,18 +2170,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1861,7 +2197,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1872,13 +2211,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -1918,24 +2260,29 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/MemoryRecycling.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -1946,7 +2293,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -1957,13 +2307,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2003,24 +2356,29 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2031,7 +2389,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -2042,13 +2403,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2088,24 +2452,29 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp"=>
+ "src/agent/Core/ApplicationPool/Pool/ProcessUtils.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2116,7 +2485,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -2127,13 +2499,16 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2173,21 +2548,29 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Process.h"=>
+ "src/agent/Core/ApplicationPool/Pool/StateInspection.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2195,24 +2578,33 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2223,11 +2615,14 @@
    "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
    "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -2243,25 +2638,31 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Session.h"=>
+ "src/agent/Core/ApplicationPool/Process.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2271,7 +2672,9 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -2281,12 +2684,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2306,24 +2712,63 @@
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/Socket.h"=>
-  ["src/agent/Core/ApplicationPool/Common.h",
+ "src/agent/Core/ApplicationPool/RestartFileWatcher.h"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/agent/Core/ApplicationPool/Session.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
@@ -2333,22 +2778,32 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -2357,53 +2812,32 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/ApplicationPool/TestSession.h"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/BufferedIO.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/Controller.h"=>
+ "src/agent/Core/ApplicationPool/Snapshot.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/ErrorRenderer.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/Controller/AppResponse.h",
-   "src/agent/Core/Controller/Client.h",
-   "src/agent/Core/Controller/Request.h",
-   "src/agent/Core/Controller/TurboCaching.h",
-   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2411,33 +2845,214 @@
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
-   "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/CookieUtils.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/Socket.h"=>
+  ["src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/TestSession.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/ApplicationPool/WorkerPool.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/agent/Core/Controller.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/ErrorRenderer.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
@@ -2446,20 +3061,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -2523,6 +3142,7 @@
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
@@ -2553,16 +3173,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -2572,6 +3197,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2582,8 +3208,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -2593,6 +3222,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -2614,20 +3244,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -2676,16 +3310,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -2695,6 +3334,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2705,8 +3345,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -2716,6 +3359,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -2737,20 +3381,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -2799,13 +3447,18 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
@@ -2813,6 +3466,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2823,7 +3477,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -2849,16 +3506,20 @@
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -2904,16 +3565,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -2923,6 +3589,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -2933,8 +3600,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -2944,6 +3614,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -2965,20 +3636,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3027,16 +3702,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3046,6 +3726,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3056,8 +3737,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3067,6 +3751,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3088,20 +3773,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3150,13 +3839,17 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/BufferBody.cpp",
@@ -3167,6 +3860,7 @@
    "src/agent/Core/Controller/InitRequest.cpp",
    "src/agent/Core/Controller/InitializationAndShutdown.cpp",
    "src/agent/Core/Controller/InternalUtils.cpp",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Miscellaneous.cpp",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/SendRequest.cpp",
@@ -3179,6 +3873,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3189,8 +3884,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3200,6 +3898,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3221,20 +3920,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3283,16 +3986,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3302,6 +4010,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3312,8 +4021,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3323,6 +4035,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3344,20 +4057,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3406,16 +4123,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3425,6 +4147,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3435,8 +4158,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3446,6 +4172,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3467,20 +4194,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3529,16 +4260,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3548,6 +4284,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3558,8 +4295,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3569,6 +4309,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3590,20 +4331,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3646,22 +4391,32 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/Controller/Metrics.h"=>
+  ["src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
  "src/agent/Core/Controller/Miscellaneous.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3671,6 +4426,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3681,8 +4437,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3692,6 +4451,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3713,20 +4473,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -3775,19 +4539,25 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3798,7 +4568,10 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3823,16 +4596,20 @@
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -3878,16 +4655,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -3897,6 +4679,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -3907,8 +4690,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -3918,6 +4704,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -3939,20 +4726,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -4001,16 +4792,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -4020,6 +4816,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -4030,8 +4827,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -4041,6 +4841,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -4062,20 +4863,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -4131,6 +4936,7 @@
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
@@ -4163,16 +4969,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/OptionParser.h",
@@ -4183,11 +4994,13 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/StatsSegmentPublisher.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/StopwatchLog.h",
@@ -4195,6 +5008,8 @@
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
    "src/agent/Shared/Base.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.cpp",
@@ -4208,6 +5023,7 @@
    "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -4230,20 +5046,25 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StatsSegment.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -4347,18 +5168,22 @@
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/SpawningKit/Config.h"=>
-  ["src/agent/Core/UnionStation/Connection.h",
+  ["src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
@@ -4385,6 +5210,7 @@
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
@@ -4392,6 +5218,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4399,11 +5226,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4436,6 +5266,7 @@
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
@@ -4443,6 +5274,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4450,11 +5282,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4489,6 +5324,7 @@
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -4498,6 +5334,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4505,11 +5342,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4552,7 +5392,9 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4576,20 +5418,42 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Core/SpawningKit/OutputMultiplexer.h"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
  "src/agent/Core/SpawningKit/PipeWatcher.h"=>
   ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
@@ -4629,6 +5493,7 @@
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Spawner.h",
@@ -4637,6 +5502,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4644,11 +5510,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4681,12 +5550,14 @@
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
    "src/agent/Core/UnionStation/Connection.h",
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -4694,11 +5565,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4742,7 +5616,9 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -4766,125 +5642,37 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/UnionStation/Connection.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/UnionStation/Context.h"=>
-  ["src/agent/Core/UnionStation/Connection.h",
-   "src/agent/Core/UnionStation/Transaction.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/UnionStation/StopwatchLog.h"=>
-  ["src/agent/Core/UnionStation/Connection.h",
-   "src/agent/Core/UnionStation/Transaction.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Core/UnionStation/Transaction.h"=>
-  ["src/agent/Core/UnionStation/Connection.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/ApiServerUtils.h"=>
+ "src/agent/Core/StatsSegmentPublisher.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -4895,8 +5683,11 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
@@ -4904,9 +5695,12 @@
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
@@ -4914,24 +5708,41 @@
    "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StatsSegment.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
@@ -4948,6 +5759,7 @@
    "src/cxx_supportlib/Utils/StringScanning.h",
    "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Template.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
@@ -4968,32 +5780,18 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/ApplicationPoolApiKey.h"=>
+ "src/agent/Core/UnionStation/Connection.h"=>
   ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Base.cpp"=>
-  ["src/agent/Shared/Base.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -5001,23 +5799,28 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Shared/Base.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/agent/Core/UnionStation/Context.h"=>
+  ["src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -5029,24 +5832,26 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/SpawnPreparer/SpawnPreparerMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/agent/Core/UnionStation/StopwatchLog.h"=>
+  ["src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Transaction.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
-   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -5054,24 +5859,25 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/SystemMetrics/SystemMetricsMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/agent/Core/UnionStation/Transaction.h"=>
+  ["src/agent/Core/UnionStation/Connection.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
-   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -5079,64 +5885,20 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/TempDirToucher/TempDirToucherMain.cpp"=>
-  ["src/cxx_supportlib/Constants.h"],
- "src/agent/UstRouter/ApiServer.h"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Options.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/UnionStation/Connection.h",
-   "src/agent/Core/UnionStation/Context.h",
-   "src/agent/Core/UnionStation/StopwatchLog.h",
-   "src/agent/Core/UnionStation/Transaction.h",
-   "src/agent/Shared/ApiServerUtils.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/UstRouter/Client.h",
-   "src/agent/UstRouter/Controller.h",
-   "src/agent/UstRouter/FileSink.h",
-   "src/agent/UstRouter/LogSink.h",
-   "src/agent/UstRouter/RemoteSender.h",
-   "src/agent/UstRouter/RemoteSink.h",
-   "src/agent/UstRouter/Transaction.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppTypes.h",
+ "src/agent/LoadGenerator/LoadGenerator.h"=>
+  ["src/agent/Core/Controller/AppResponse.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/MessageReadersWriters.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
@@ -5146,96 +5908,69 @@
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/BlockingQueue.h",
-   "src/cxx_supportlib/Utils/BufferedIO.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
-   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
-   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/Client.h"=>
-  ["src/agent/UstRouter/Transaction.h",
-   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+ "src/agent/LoadGenerator/LoadGeneratorMain.cpp"=>
+  ["src/agent/Core/Controller/AppResponse.h",
+   "src/agent/LoadGenerator/LoadGenerator.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -5253,22 +5988,56 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/Controller.h"=>
-  ["src/agent/UstRouter/Client.h",
-   "src/agent/UstRouter/FileSink.h",
-   "src/agent/UstRouter/LogSink.h",
-   "src/agent/UstRouter/RemoteSender.h",
-   "src/agent/UstRouter/RemoteSink.h",
-   "src/agent/UstRouter/Transaction.h",
+ "src/agent/Shared/ApiServerUtils.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/MessageReadersWriters.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
@@ -5278,81 +6047,84 @@
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/BlockingQueue.h",
-   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/FileSink.h"=>
-  ["src/agent/UstRouter/LogSink.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
+ "src/agent/Shared/ApplicationPoolApiKey.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/LogSink.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/agent/Shared/Base.cpp"=>
+  ["src/agent/Shared/Base.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -5361,23 +6133,20 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/OptionParser.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/agent/Shared/Base.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
@@ -5392,29 +6161,24 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/RemoteSender.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/agent/SpawnPreparer/SpawnPreparerMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/BlockingQueue.h",
-   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -5422,61 +6186,37 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/RemoteSink.h"=>
-  ["src/agent/UstRouter/LogSink.h",
-   "src/agent/UstRouter/RemoteSender.h",
+ "src/agent/StatsReader/StatsReaderMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/StatsSegment.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/BlockingQueue.h",
-   "src/cxx_supportlib/Utils/Curl.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/Transaction.h"=>
-  ["src/cxx_supportlib/DataStructures/LString.h",
+ "src/agent/SystemMetrics/SystemMetricsMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -5484,24 +6224,32 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/UstRouter/UstRouterMain.cpp"=>
+ "src/agent/TempDirToucher/TempDirToucherMain.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Utils/DirectoryToucher.h"],
+ "src/agent/UstRouter/ApiServer.h"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -5513,16 +6261,15 @@
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApiServerUtils.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/Shared/Base.h",
-   "src/agent/UstRouter/ApiServer.h",
    "src/agent/UstRouter/Client.h",
    "src/agent/UstRouter/Controller.h",
    "src/agent/UstRouter/FileSink.h",
    "src/agent/UstRouter/LogSink.h",
-   "src/agent/UstRouter/OptionParser.h",
    "src/agent/UstRouter/RemoteSender.h",
    "src/agent/UstRouter/RemoteSink.h",
    "src/agent/UstRouter/Transaction.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -5560,6 +6307,7 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/UnionStationFilterSupport.h",
@@ -5568,8 +6316,10 @@
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BlockingQueue.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -5583,7 +6333,6 @@
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -5613,52 +6362,17 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Watchdog/AgentWatcher.cpp"=>
-  [],
- "src/agent/Watchdog/ApiServer.h"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Options.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/UnionStation/Connection.h",
-   "src/agent/Core/UnionStation/Context.h",
-   "src/agent/Core/UnionStation/StopwatchLog.h",
-   "src/agent/Core/UnionStation/Transaction.h",
-   "src/agent/Shared/ApiServerUtils.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
+ "src/agent/UstRouter/Client.h"=>
+  ["src/agent/UstRouter/Transaction.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
@@ -5668,125 +6382,51 @@
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/BufferedIO.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
-   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/agent/Watchdog/CoreWatcher.cpp"=>
-  [],
- "src/agent/Watchdog/InstanceDirToucher.cpp"=>
-  [],
- "src/agent/Watchdog/UstRouterWatcher.cpp"=>
-  [],
- "src/agent/Watchdog/WatchdogMain.cpp"=>
-  ["src/agent/Core/ApplicationPool/AbstractSession.h",
-   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
-   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
-   "src/agent/Core/ApplicationPool/Common.h",
-   "src/agent/Core/ApplicationPool/Context.h",
-   "src/agent/Core/ApplicationPool/Group.h",
-   "src/agent/Core/ApplicationPool/Options.h",
-   "src/agent/Core/ApplicationPool/Pool.h",
-   "src/agent/Core/ApplicationPool/Process.h",
-   "src/agent/Core/ApplicationPool/Session.h",
-   "src/agent/Core/ApplicationPool/Socket.h",
-   "src/agent/Core/OptionParser.h",
-   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
-   "src/agent/Core/SpawningKit/Config.h",
-   "src/agent/Core/SpawningKit/DirectSpawner.h",
-   "src/agent/Core/SpawningKit/DummySpawner.h",
-   "src/agent/Core/SpawningKit/Factory.h",
-   "src/agent/Core/SpawningKit/Options.h",
-   "src/agent/Core/SpawningKit/PipeWatcher.h",
-   "src/agent/Core/SpawningKit/Result.h",
-   "src/agent/Core/SpawningKit/SmartSpawner.h",
-   "src/agent/Core/SpawningKit/Spawner.h",
-   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
-   "src/agent/Core/UnionStation/Connection.h",
-   "src/agent/Core/UnionStation/Context.h",
-   "src/agent/Core/UnionStation/StopwatchLog.h",
-   "src/agent/Core/UnionStation/Transaction.h",
-   "src/agent/Shared/ApiServerUtils.h",
-   "src/agent/Shared/ApplicationPoolApiKey.h",
-   "src/agent/Shared/Base.h",
-   "src/agent/UstRouter/OptionParser.h",
-   "src/agent/Watchdog/AgentWatcher.cpp",
-   "src/agent/Watchdog/ApiServer.h",
-   "src/agent/Watchdog/CoreWatcher.cpp",
-   "src/agent/Watchdog/InstanceDirToucher.cpp",
-   "src/agent/Watchdog/UstRouterWatcher.cpp",
+ "src/agent/UstRouter/Controller.h"=>
+  ["src/agent/UstRouter/Client.h",
+   "src/agent/UstRouter/FileSink.h",
+   "src/agent/UstRouter/LogSink.h",
+   "src/agent/UstRouter/RemoteSender.h",
+   "src/agent/UstRouter/RemoteSink.h",
+   "src/agent/UstRouter/Transaction.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Hooks.h",
-   "src/cxx_supportlib/InstanceDirectory.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/RandomGenerator.h",
-   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Client.h",
@@ -5796,116 +6436,56 @@
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
-   "src/cxx_supportlib/Utils/BufferedIO.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/BlockingQueue.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/MessagePassing.h",
-   "src/cxx_supportlib/Utils/OptionParsing.h",
-   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
-   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/spin_lock.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Bucket.cpp"=>
-  ["src/apache2_module/Bucket.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Bucket.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Configuration.cpp"=>
-  ["src/apache2_module/Configuration.h",
-   "src/apache2_module/Configuration.hpp",
-   "src/apache2_module/ConfigurationCommands.cpp",
-   "src/apache2_module/ConfigurationFields.hpp",
-   "src/apache2_module/ConfigurationSetters.cpp",
-   "src/apache2_module/CreateDirConfig.cpp",
-   "src/apache2_module/MergeDirConfig.cpp",
-   "src/cxx_supportlib/Constants.h",
+ "src/agent/UstRouter/FileSink.h"=>
+  ["src/agent/UstRouter/LogSink.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -5918,24 +6498,20 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Configuration.h"=>
-  [],
- "src/apache2_module/Configuration.hpp"=>
-  ["src/apache2_module/Configuration.h",
-   "src/apache2_module/ConfigurationFields.hpp",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/agent/UstRouter/LogSink.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -5948,37 +6524,21 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/ConfigurationCommands.cpp"=>
-  [],
- "src/apache2_module/ConfigurationFields.hpp"=>
-  [],
- "src/apache2_module/ConfigurationSetters.cpp"=>
-  [],
- "src/apache2_module/CreateDirConfig.cpp"=>
-  [],
- "src/apache2_module/DirectoryMapper.h"=>
-  ["src/apache2_module/Configuration.h",
-   "src/apache2_module/Configuration.hpp",
-   "src/apache2_module/ConfigurationFields.hpp",
-   "src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/Constants.h",
+ "src/agent/UstRouter/OptionParser.h"=>
+  ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -5991,42 +6551,25 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Hooks.cpp"=>
-  ["src/apache2_module/Bucket.h",
-   "src/apache2_module/Configuration.h",
-   "src/apache2_module/Configuration.hpp",
-   "src/apache2_module/ConfigurationFields.hpp",
-   "src/apache2_module/DirectoryMapper.h",
-   "src/apache2_module/Hooks.h",
-   "src/apache2_module/SetHeaders.cpp",
-   "src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/agent/UstRouter/RemoteSender.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MessageClient.h",
-   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/BlockingQueue.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WatchdogLauncher.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6034,36 +6577,31 @@
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/apache2_module/Hooks.h"=>
-  [],
- "src/apache2_module/MergeDirConfig.cpp"=>
-  [],
- "src/apache2_module/SetHeaders.cpp"=>
-  [],
- "src/apache2_module/mod_passenger.c"=>
-  ["src/apache2_module/Configuration.h",
-   "src/apache2_module/Hooks.h"],
- "src/cxx_supportlib/Algorithms/MovingAverage.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/AppTypes.cpp"=>
-  ["src/cxx_supportlib/AppTypes.h",
+ "src/agent/UstRouter/RemoteSink.h"=>
+  ["src/agent/UstRouter/LogSink.h",
+   "src/agent/UstRouter/RemoteSender.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/BlockingQueue.h",
+   "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6075,19 +6613,25 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/AppTypes.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/agent/UstRouter/Transaction.h"=>
+  ["src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6099,18 +6643,717 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/BackgroundEventLoop.cpp"=>
-  ["src/cxx_supportlib/BackgroundEventLoop.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+ "src/agent/UstRouter/UstRouterMain.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Base.h",
+   "src/agent/UstRouter/ApiServer.h",
+   "src/agent/UstRouter/Client.h",
+   "src/agent/UstRouter/Controller.h",
+   "src/agent/UstRouter/FileSink.h",
+   "src/agent/UstRouter/LogSink.h",
+   "src/agent/UstRouter/OptionParser.h",
+   "src/agent/UstRouter/RemoteSender.h",
+   "src/agent/UstRouter/RemoteSink.h",
+   "src/agent/UstRouter/Transaction.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BlockingQueue.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/Curl.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Watchdog/AgentWatcher.cpp"=>
+  [],
+ "src/agent/Watchdog/ApiServer.h"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Watchdog/ChildReaper.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/agent/Watchdog/CoreWatcher.cpp"=>
+  [],
+ "src/agent/Watchdog/InstanceDirToucher.cpp"=>
+  [],
+ "src/agent/Watchdog/UstRouterWatcher.cpp"=>
+  [],
+ "src/agent/Watchdog/WatchdogMain.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/OptionParser.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApiServerUtils.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/agent/Shared/Base.h",
+   "src/agent/UstRouter/OptionParser.h",
+   "src/agent/Watchdog/AgentWatcher.cpp",
+   "src/agent/Watchdog/ApiServer.h",
+   "src/agent/Watchdog/ChildReaper.h",
+   "src/agent/Watchdog/CoreWatcher.cpp",
+   "src/agent/Watchdog/InstanceDirToucher.cpp",
+   "src/agent/Watchdog/UstRouterWatcher.cpp",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/DirectoryToucher.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/OptionParsing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Bucket.cpp"=>
+  ["src/apache2_module/Bucket.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Bucket.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Configuration.cpp"=>
+  ["src/apache2_module/Configuration.h",
+   "src/apache2_module/Configuration.hpp",
+   "src/apache2_module/ConfigurationCommands.cpp",
+   "src/apache2_module/ConfigurationFields.hpp",
+   "src/apache2_module/ConfigurationSetters.cpp",
+   "src/apache2_module/CreateDirConfig.cpp",
+   "src/apache2_module/MergeDirConfig.cpp",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Configuration.h"=>
+  [],
+ "src/apache2_module/Configuration.hpp"=>
+  ["src/apache2_module/Configuration.h",
+   "src/apache2_module/ConfigurationFields.hpp",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/ConfigurationCommands.cpp"=>
+  [],
+ "src/apache2_module/ConfigurationFields.hpp"=>
+  [],
+ "src/apache2_module/ConfigurationSetters.cpp"=>
+  [],
+ "src/apache2_module/CreateDirConfig.cpp"=>
+  [],
+ "src/apache2_module/DirectoryMapper.h"=>
+  ["src/apache2_module/Configuration.h",
+   "src/apache2_module/Configuration.hpp",
+   "src/apache2_module/ConfigurationFields.hpp",
+   "src/apache2_module/DirectoryMapperCache.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/DirectoryMapperCache.h"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Hooks.cpp"=>
+  ["src/apache2_module/Bucket.h",
+   "src/apache2_module/Configuration.h",
+   "src/apache2_module/Configuration.hpp",
+   "src/apache2_module/ConfigurationFields.hpp",
+   "src/apache2_module/DirectoryMapper.h",
+   "src/apache2_module/DirectoryMapperCache.h",
+   "src/apache2_module/Hooks.h",
+   "src/apache2_module/SetHeaders.cpp",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WatchdogLauncher.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/apache2_module/Hooks.h"=>
+  [],
+ "src/apache2_module/MergeDirConfig.cpp"=>
+  [],
+ "src/apache2_module/SetHeaders.cpp"=>
+  [],
+ "src/apache2_module/mod_passenger.c"=>
+  ["src/apache2_module/Configuration.h",
+   "src/apache2_module/Hooks.h"],
+ "src/cxx_supportlib/Algorithms/CoDel.h"=>
+  [],
+ "src/cxx_supportlib/Algorithms/Histogram.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Algorithms/MovingAverage.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/AppTypes.cpp"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/AppTypes.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/BackgroundEventLoop.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -6157,19 +7400,198 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Hooks.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Hooks.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/InstanceDirectory.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Integrations/LibevJsonUtils.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Logging.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Logging.h"=>
+  ["src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/MemoryKit/ObjectSlab.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/mbuf.cpp"=>
+  ["src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/MemoryKit/mbuf.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/palloc.cpp"=>
+  ["src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MemoryKit/palloc.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/MessageClient.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/MessageReadersWriters.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/RandomGenerator.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ResourceLocator.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/SafeLibev.h"=>
+  ["src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/ServerKit/Channel.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -6182,19 +7604,37 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/InstanceDirectory.h"=>
+ "src/cxx_supportlib/ServerKit/Client.h"=>
   ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6202,21 +7642,31 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Integrations/LibevJsonUtils.h"=>
-  ["src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Logging.cpp"=>
+ "src/cxx_supportlib/ServerKit/ClientRef.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/Context.h"=>
   ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6224,41 +7674,42 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Logging.h"=>
-  ["src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/MemoryKit/mbuf.cpp"=>
-  ["src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/MemoryKit/mbuf.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MemoryKit/palloc.cpp"=>
-  ["src/cxx_supportlib/MemoryKit/palloc.h",
+ "src/cxx_supportlib/ServerKit/CookieUtils.h"=>
+  ["src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MemoryKit/palloc.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/MessageClient.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/ServerKit/Errors.h"=>
+  ["src/cxx_supportlib/ServerKit/http_parser.h"],
+ "src/cxx_supportlib/ServerKit/FdSinkChannel.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6266,21 +7717,67 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/MessageReadersWriters.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/ServerKit/FdSourceChannel.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/RandomGenerator.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/ServerKit/FileBufferedChannel.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6288,36 +7785,111 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ResourceLocator.h"=>
+ "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h"=>
   ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/IniFile.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/SafeLibev.h"=>
+ "src/cxx_supportlib/ServerKit/HeaderTable.h"=>
+  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/Hooks.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h"=>
   ["src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/ServerKit/AcceptLoadBalancer.h"=>
+ "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h"=>
+  [],
+ "src/cxx_supportlib/ServerKit/HttpClient.h"=>
   ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6325,18 +7897,37 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Channel.h"=>
+ "src/cxx_supportlib/ServerKit/HttpCompression.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/HttpHeaderParser.h"=>
   ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
@@ -6356,24 +7947,41 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Client.h"=>
+ "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h"=>
+  ["src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/HttpRequest.h"=>
   ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
@@ -6393,20 +8001,49 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/ClientRef.h"=>
+ "src/cxx_supportlib/ServerKit/HttpRequestRef.h"=>
   [],
- "src/cxx_supportlib/ServerKit/Context.h"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/cxx_supportlib/ServerKit/HttpServer.h"=>
+  ["src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -6424,31 +8061,37 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/CookieUtils.h"=>
-  ["src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
+ "src/cxx_supportlib/ServerKit/Implementation.cpp"=>
+  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Errors.h"=>
-  ["src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/FdSinkChannel.h"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/cxx_supportlib/ServerKit/Server.h"=>
+  ["src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
    "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -6466,27 +8109,198 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FdSourceChannel.h"=>
+ "src/cxx_supportlib/ServerKit/TimerWheel.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/ServerKit/http_parser.cpp"=>
+  ["src/cxx_supportlib/ServerKit/http_parser.h"],
+ "src/cxx_supportlib/ServerKit/http_parser.h"=>
+  [],
+ "src/cxx_supportlib/StaticString.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/StatsSegment.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/UnionStationFilterSupport.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/UnionStationFilterSupport.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/AnsiColorConstants.h"=>
+  [],
+ "src/cxx_supportlib/Utils/BlockingQueue.h"=>
+  [],
+ "src/cxx_supportlib/Utils/BufferedIO.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/BufferedMessageReader.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/CachedFileStat.cpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/CachedFileStat.h"=>
+  [],
+ "src/cxx_supportlib/Utils/CachedFileStat.hpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/ClassUtils.h"=>
+  [],
+ "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/Curl.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/DateParsing.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/DirectoryToucher.cpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/DirectoryToucher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/Utils/DirectoryToucher.h"=>
+  [],
+ "src/cxx_supportlib/Utils/FastStringStream.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/FileChangeChecker.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/HashMap.h"=>
+  [],
+ "src/cxx_supportlib/Utils/Hasher.cpp"=>
+  ["src/cxx_supportlib/Utils/Hasher.h"],
+ "src/cxx_supportlib/Utils/Hasher.h"=>
+  [],
+ "src/cxx_supportlib/Utils/HttpConstants.h"=>
+  [],
+ "src/cxx_supportlib/Utils/IOUtils.cpp"=>
   ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6498,33 +8312,13 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FileBufferedChannel.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Utils/IOUtils.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6532,24 +8326,19 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Utils/IniFile.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/JsonUtils.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -6567,62 +8356,27 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HeaderTable.h"=>
-  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Hooks.h"=>
+ "src/cxx_supportlib/Utils/LargeFiles.cpp"=>
+  ["src/cxx_supportlib/Utils/LargeFiles.h"],
+ "src/cxx_supportlib/Utils/LargeFiles.h"=>
   [],
- "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h"=>
-  ["src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h"=>
+ "src/cxx_supportlib/Utils/Lock.h"=>
   [],
- "src/cxx_supportlib/ServerKit/HttpClient.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Utils/MemZeroGuard.h"=>
+  [],
+ "src/cxx_supportlib/Utils/MemoryBarrier.h"=>
+  [],
+ "src/cxx_supportlib/Utils/MessageIO.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6630,35 +8384,14 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpHeaderParser.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Utils/MessagePassing.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
@@ -6676,52 +8409,21 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h"=>
-  ["src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/HttpRequest.h"=>
-  ["src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/Exceptions.h",
+ "src/cxx_supportlib/Utils/OptionParsing.h"=>
+  [],
+ "src/cxx_supportlib/Utils/ProcessMetricsCollector.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/Utils/StringScanning.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6729,54 +8431,97 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/HttpRequestRef.h"=>
+ "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h"=>
   [],
- "src/cxx_supportlib/ServerKit/HttpServer.h"=>
-  ["src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
-   "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/HeaderTable.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
-   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpClient.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
-   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
-   "src/cxx_supportlib/ServerKit/HttpRequest.h",
-   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
-   "src/cxx_supportlib/ServerKit/Server.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+ "src/cxx_supportlib/Utils/ScopeGuard.h"=>
+  ["src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/Utils/SpeedMeter.h"=>
+  ["src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/StrIntUtils.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/StrIntUtils.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/StrIntUtilsNoStrictAliasing.cpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/StringMap.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/StringScanning.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/SystemMetricsCollector.h"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
+ "src/cxx_supportlib/Utils/SystemTime.cpp"=>
+  [],
+ "src/cxx_supportlib/Utils/SystemTime.h"=>
+  ["src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/Template.h"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/oxt/macros.hpp"],
+ "src/cxx_supportlib/Utils/Timer.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/Utils/VariantMap.h"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6788,42 +8533,27 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/Implementation.cpp"=>
-  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/ServerKit/Server.h"=>
-  ["src/cxx_supportlib/Algorithms/MovingAverage.h",
-   "src/cxx_supportlib/Constants.h",
+ "src/cxx_supportlib/WatchdogLauncher.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/SafeLibev.h",
-   "src/cxx_supportlib/ServerKit/Channel.h",
-   "src/cxx_supportlib/ServerKit/Client.h",
-   "src/cxx_supportlib/ServerKit/ClientRef.h",
-   "src/cxx_supportlib/ServerKit/Context.h",
-   "src/cxx_supportlib/ServerKit/Errors.h",
-   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
-   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
-   "src/cxx_supportlib/ServerKit/Hooks.h",
-   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WatchdogLauncher.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6835,50 +8565,30 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/ServerKit/http_parser.cpp"=>
-  ["src/cxx_supportlib/ServerKit/http_parser.h"],
- "src/cxx_supportlib/ServerKit/http_parser.h"=>
-  [],
- "src/cxx_supportlib/StaticString.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/UnionStationFilterSupport.cpp"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/UnionStationFilterSupport.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils.cpp"=>
+ "src/cxx_supportlib/WatchdogLauncher.h"=>
   ["src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MessageClient.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -6886,99 +8596,97 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/AnsiColorConstants.h"=>
+ "src/cxx_supportlib/oxt/backtrace.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp"],
+ "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp"=>
   [],
- "src/cxx_supportlib/Utils/BlockingQueue.h"=>
+ "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp"=>
   [],
- "src/cxx_supportlib/Utils/BufferedIO.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
-   "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
+ "src/cxx_supportlib/oxt/detail/context.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp"],
+ "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp"=>
+  [],
+ "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp"=>
+  [],
+ "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp"=>
+  [],
+ "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/../macros.hpp"],
+ "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp"=>
+  [],
+ "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp"=>
+  [],
+ "src/cxx_supportlib/oxt/dynamic_thread_group.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp"],
+ "src/cxx_supportlib/oxt/implementation.cpp"=>
+  ["src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/CachedFileStat.cpp"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/CachedFileStat.h"=>
+ "src/cxx_supportlib/oxt/initialize.hpp"=>
   [],
- "src/cxx_supportlib/Utils/CachedFileStat.hpp"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/ClassUtils.h"=>
+ "src/cxx_supportlib/oxt/macros.hpp"=>
   [],
- "src/cxx_supportlib/Utils/Curl.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/DateParsing.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
+ "src/cxx_supportlib/oxt/spin_lock.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/../macros.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/FastStringStream.h"=>
+ "src/cxx_supportlib/oxt/system_calls.cpp"=>
+  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp"],
+ "src/cxx_supportlib/oxt/system_calls.hpp"=>
   ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/FileChangeChecker.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
+ "src/cxx_supportlib/oxt/thread.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/HashMap.h"=>
-  [],
- "src/cxx_supportlib/Utils/Hasher.cpp"=>
-  ["src/cxx_supportlib/Utils/Hasher.h"],
- "src/cxx_supportlib/Utils/Hasher.h"=>
-  [],
- "src/cxx_supportlib/Utils/HttpConstants.h"=>
+ "src/cxx_supportlib/oxt/tracable_exception.hpp"=>
+  ["src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp"],
+ "src/nginx_module/CacheLocationConfig.c"=>
   [],
- "src/cxx_supportlib/Utils/IOUtils.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
+ "src/nginx_module/Configuration.c"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -6989,40 +8697,66 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/IOUtils.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "src/nginx_module/CacheLocationConfig.c",
+   "src/nginx_module/Configuration.h",
+   "src/nginx_module/ConfigurationCommands.c",
+   "src/nginx_module/ConfigurationFields.h",
+   "src/nginx_module/ContentHandler.h",
+   "src/nginx_module/CreateLocationConfig.c",
+   "src/nginx_module/MergeLocationConfig.c"],
+ "src/nginx_module/Configuration.h"=>
+  ["src/nginx_module/ConfigurationFields.h"],
+ "src/nginx_module/ConfigurationCommands.c"=>
+  [],
+ "src/nginx_module/ConfigurationFields.h"=>
+  [],
+ "src/nginx_module/ContentHandler.c"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/IniFile.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/JsonUtils.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "src/nginx_module/Configuration.h",
+   "src/nginx_module/ConfigurationFields.h",
+   "src/nginx_module/ContentHandler.h",
+   "src/nginx_module/StaticContentHandler.h"],
+ "src/nginx_module/ContentHandler.h"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -7034,48 +8768,73 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/LargeFiles.cpp"=>
-  ["src/cxx_supportlib/Utils/LargeFiles.h"],
- "src/cxx_supportlib/Utils/LargeFiles.h"=>
-  [],
- "src/cxx_supportlib/Utils/Lock.h"=>
+ "src/nginx_module/CreateLocationConfig.c"=>
   [],
- "src/cxx_supportlib/Utils/MemZeroGuard.h"=>
+ "src/nginx_module/MergeLocationConfig.c"=>
   [],
- "src/cxx_supportlib/Utils/MemoryBarrier.h"=>
+ "src/nginx_module/StaticContentHandler.c"=>
+  ["src/nginx_module/StaticContentHandler.h"],
+ "src/nginx_module/StaticContentHandler.h"=>
   [],
- "src/cxx_supportlib/Utils/MessageIO.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
-   "src/cxx_supportlib/FileDescriptor.h",
+ "src/nginx_module/ngx_http_passenger_module.c"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/IOUtils.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/MessagePassing.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "src/nginx_module/Configuration.h",
+   "src/nginx_module/ConfigurationFields.h",
+   "src/nginx_module/ContentHandler.h"],
+ "src/nginx_module/ngx_http_passenger_module.h"=>
+  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/WatchdogLauncher.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -7087,20 +8846,27 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/OptionParsing.h"=>
+ "src/ruby_native_extension/passenger_native_support.c"=>
   [],
- "src/cxx_supportlib/Utils/ProcessMetricsCollector.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+ "test/cxx/Algorithms/CoDelTest.cpp"=>
+  ["src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
@@ -7108,201 +8874,526 @@
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h"=>
-  [],
- "src/cxx_supportlib/Utils/ScopeGuard.h"=>
-  ["src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/Algorithms/HistogramTest.cpp"=>
+  ["src/agent/Core/Controller/Metrics.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/Utils/SpeedMeter.h"=>
-  ["src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/StrIntUtils.cpp"=>
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/Benchmarks/BenchmarkMain.cpp"=>
   ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/StrIntUtils.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/StrIntUtilsNoStrictAliasing.cpp"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/StringMap.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/StringScanning.h"=>
-  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/BenchmarkSupport.h"=>
+  ["src/cxx_supportlib/oxt/macros.hpp"],
+ "test/cxx/Benchmarks/Core/MetricsBenchmark.cpp"=>
+  ["src/agent/Core/Controller/Metrics.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/SystemMetricsCollector.h"=>
-  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Core/PoolBenchmark.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/Utils/SystemTime.cpp"=>
-  [],
- "src/cxx_supportlib/Utils/SystemTime.h"=>
-  ["src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/Template.h"=>
-  ["src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/Utils/Timer.h"=>
-  ["src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/Utils/VariantMap.h"=>
-  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Core/RequestBenchmark.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/WatchdogLauncher.cpp"=>
-  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Core/ResponseCacheBenchmark.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WatchdogLauncher.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
+   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/WatchdogLauncher.h"=>
-  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Core/ResponseHeaderBenchmark.cpp"=>
+  ["src/agent/Core/ApplicationPool/AbstractSession.h",
+   "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
+   "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
+   "src/agent/Core/ApplicationPool/Common.h",
+   "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/agent/Core/ApplicationPool/ErrorRenderer.h",
+   "src/agent/Core/ApplicationPool/Group.h",
+   "src/agent/Core/ApplicationPool/Options.h",
+   "src/agent/Core/ApplicationPool/Pool.h",
+   "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
+   "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/agent/Core/Controller.h",
+   "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
+   "src/agent/Core/Controller/Request.h",
+   "src/agent/Core/Controller/TurboCaching.h",
+   "src/agent/Core/ResponseCache.h",
+   "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
+   "src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/DirectSpawner.h",
+   "src/agent/Core/SpawningKit/DummySpawner.h",
+   "src/agent/Core/SpawningKit/Factory.h",
+   "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/SpawningKit/Result.h",
+   "src/agent/Core/SpawningKit/SmartSpawner.h",
+   "src/agent/Core/SpawningKit/Spawner.h",
+   "src/agent/Core/SpawningKit/UserSwitchingRules.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/StopwatchLog.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/Algorithms/MovingAverage.h",
+   "src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/Hooks.h",
+   "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/MessageReadersWriters.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/ClientRef.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/CookieUtils.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
+   "src/cxx_supportlib/ServerKit/HttpServer.h",
+   "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/AnsiColorConstants.h",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/HttpConstants.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Lock.h",
    "src/cxx_supportlib/Utils/MemZeroGuard.h",
    "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/MessagePassing.h",
+   "src/cxx_supportlib/Utils/ProcessMetricsCollector.h",
    "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/SpeedMeter.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
+   "src/cxx_supportlib/Utils/StringScanning.h",
+   "src/cxx_supportlib/Utils/SystemMetricsCollector.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Template.h",
    "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
-   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/oxt/backtrace.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp"],
- "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/context.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp"],
- "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/../macros.hpp"],
- "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/dynamic_thread_group.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp",
-   "src/cxx_supportlib/oxt/thread.hpp"],
- "src/cxx_supportlib/oxt/implementation.cpp"=>
-  ["src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../macros.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -7314,60 +9405,53 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/cxx_supportlib/oxt/initialize.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/macros.hpp"=>
-  [],
- "src/cxx_supportlib/oxt/spin_lock.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/../macros.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_darwin.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_gcc_x86.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_portable.hpp",
-   "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
-   "src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/oxt/system_calls.cpp"=>
-  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/DataStructures/StringKeyTableBenchmark.cpp"=>
+  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/oxt/system_calls.hpp"=>
-  ["src/cxx_supportlib/oxt/macros.hpp"],
- "src/cxx_supportlib/oxt/thread.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/MemoryKit/MbufBenchmark.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/oxt/macros.hpp",
-   "src/cxx_supportlib/oxt/system_calls.hpp"],
- "src/cxx_supportlib/oxt/tracable_exception.hpp"=>
-  ["src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp"],
- "src/nginx_module/CacheLocationConfig.c"=>
-  [],
- "src/nginx_module/Configuration.c"=>
-  ["src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/Exceptions.h",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/MemoryKit/PallocBenchmark.cpp"=>
+  ["src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/ServerKit/HeaderTableBenchmark.cpp"=>
+  ["src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/ServerKit/HttpCompressionBenchmark.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
-   "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -7375,34 +9459,45 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "src/nginx_module/CacheLocationConfig.c",
-   "src/nginx_module/Configuration.h",
-   "src/nginx_module/ConfigurationCommands.c",
-   "src/nginx_module/ConfigurationFields.h",
-   "src/nginx_module/ContentHandler.h",
-   "src/nginx_module/CreateLocationConfig.c",
-   "src/nginx_module/MergeLocationConfig.c"],
- "src/nginx_module/Configuration.h"=>
-  ["src/nginx_module/ConfigurationFields.h"],
- "src/nginx_module/ConfigurationCommands.c"=>
-  [],
- "src/nginx_module/ConfigurationFields.h"=>
-  [],
- "src/nginx_module/ContentHandler.c"=>
-  ["src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/Constants.h",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/ServerKit/HttpParserBenchmark.cpp"=>
+  ["src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
    "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
@@ -7414,62 +9509,54 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "src/nginx_module/Configuration.h",
-   "src/nginx_module/ConfigurationFields.h",
-   "src/nginx_module/ContentHandler.h",
-   "src/nginx_module/StaticContentHandler.h"],
- "src/nginx_module/ContentHandler.h"=>
-  ["src/cxx_supportlib/AppTypes.h",
-   "src/cxx_supportlib/Exceptions.h",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Utils/MessageReaderBenchmark.cpp"=>
+  ["src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/Utils.h",
-   "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
-   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
-   "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/nginx_module/CreateLocationConfig.c"=>
-  [],
- "src/nginx_module/MergeLocationConfig.c"=>
-  [],
- "src/nginx_module/StaticContentHandler.c"=>
-  ["src/nginx_module/StaticContentHandler.h"],
- "src/nginx_module/StaticContentHandler.h"=>
-  [],
- "src/nginx_module/ngx_http_passenger_module.c"=>
-  ["src/cxx_supportlib/AppTypes.h",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/Benchmarks/Utils/StrIntUtilsBenchmark.cpp"=>
+  ["src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "test/cxx/Benchmarks/BenchmarkSupport.h"],
+ "test/cxx/BufferedIOTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/BufferedIO.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -7477,51 +9564,40 @@
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
-   "src/nginx_module/Configuration.h",
-   "src/nginx_module/ConfigurationFields.h",
-   "src/nginx_module/ContentHandler.h"],
- "src/nginx_module/ngx_http_passenger_module.h"=>
-  ["src/cxx_supportlib/AppTypes.h",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/CachedFileStatTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MessageClient.h",
+   "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
-   "src/cxx_supportlib/Utils/ClassUtils.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/MemZeroGuard.h",
-   "src/cxx_supportlib/Utils/MessageIO.h",
-   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/WatchdogLauncher.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
-   "src/cxx_supportlib/oxt/tracable_exception.hpp"],
- "src/ruby_native_extension/passenger_native_support.c"=>
-  [],
- "test/cxx/BufferedIOTest.cpp"=>
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/ConcurrentCachedFileStatTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -7533,14 +9609,13 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
@@ -7551,8 +9626,9 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/CachedFileStatTest.cpp"=>
-  ["src/cxx_supportlib/BackgroundEventLoop.h",
+ "test/cxx/Core/ApplicationPool/DetachedProcessReaperTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
@@ -7560,18 +9636,17 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
@@ -7588,16 +9663,20 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -7607,6 +9686,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -7619,12 +9699,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -7655,6 +9738,7 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -7668,18 +9752,23 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -7690,6 +9779,8 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -7704,13 +9795,16 @@
    "src/cxx_supportlib/MessageReadersWriters.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -7758,16 +9852,20 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -7777,6 +9875,7 @@
    "src/agent/Core/UnionStation/Context.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -7789,12 +9888,15 @@
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -7825,6 +9927,7 @@
    "src/cxx_supportlib/oxt/detail/spin_lock_pthreads.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/spin_lock.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
@@ -7832,23 +9935,88 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/Core/ApplicationPool/RestartFileWatcherTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/RestartFileWatcher.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/Core/ApplicationPool/WorkerPoolTest.cpp"=>
+  ["src/agent/Core/ApplicationPool/WorkerPool.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/dynamic_thread_group.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/Core/ControllerTest.cpp"=>
   ["src/agent/Core/ApplicationPool/AbstractSession.h",
    "src/agent/Core/ApplicationPool/BasicGroupInfo.h",
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
    "src/agent/Core/ApplicationPool/TestSession.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -7858,6 +10026,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -7868,6 +10037,8 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -7881,6 +10052,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -7902,20 +10074,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -7966,16 +10142,21 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/ErrorRenderer.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller.h",
    "src/agent/Core/Controller/AppResponse.h",
    "src/agent/Core/Controller/Client.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/Controller/TurboCaching.h",
    "src/agent/Core/ResponseCache.h",
@@ -7985,6 +10166,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -7995,6 +10177,8 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -8008,6 +10192,7 @@
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Integrations/LibevJsonUtils.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/MessageReadersWriters.h",
@@ -8029,20 +10214,24 @@
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
    "src/cxx_supportlib/ServerKit/HttpClient.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -8093,13 +10282,18 @@
    "src/agent/Core/ApplicationPool/BasicProcessInfo.h",
    "src/agent/Core/ApplicationPool/Common.h",
    "src/agent/Core/ApplicationPool/Context.h",
+   "src/agent/Core/ApplicationPool/DetachedProcessReaper.h",
    "src/agent/Core/ApplicationPool/Group.h",
    "src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/ApplicationPool/Pool.h",
    "src/agent/Core/ApplicationPool/Process.h",
+   "src/agent/Core/ApplicationPool/RestartFileWatcher.h",
    "src/agent/Core/ApplicationPool/Session.h",
+   "src/agent/Core/ApplicationPool/Snapshot.h",
    "src/agent/Core/ApplicationPool/Socket.h",
+   "src/agent/Core/ApplicationPool/WorkerPool.h",
    "src/agent/Core/Controller/AppResponse.h",
+   "src/agent/Core/Controller/Metrics.h",
    "src/agent/Core/Controller/Request.h",
    "src/agent/Core/ResponseCache.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
@@ -8108,6 +10302,7 @@
    "src/agent/Core/SpawningKit/DummySpawner.h",
    "src/agent/Core/SpawningKit/Factory.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -8118,6 +10313,8 @@
    "src/agent/Core/UnionStation/StopwatchLog.h",
    "src/agent/Core/UnionStation/Transaction.h",
    "src/agent/Shared/ApplicationPoolApiKey.h",
+   "src/cxx_supportlib/Algorithms/CoDel.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
    "src/cxx_supportlib/AppTypes.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -8146,16 +10343,20 @@
    "src/cxx_supportlib/ServerKit/HeaderTable.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
    "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
    "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/AnsiColorConstants.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/ClassUtils.h",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -8204,6 +10405,7 @@
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/DirectSpawner.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/Spawner.h",
    "src/agent/Core/SpawningKit/UserSwitchingRules.h",
@@ -8220,11 +10422,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -8255,11 +10460,55 @@
    "test/cxx/../tut/tut.h",
    "test/cxx/Core/SpawningKit/SpawnerTestCases.cpp",
    "test/cxx/TestSupport.h"],
+ "test/cxx/Core/SpawningKit/OutputMultiplexerTest.cpp"=>
+  ["src/agent/Core/SpawningKit/Config.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
+   "src/agent/Core/SpawningKit/PipeWatcher.h",
+   "src/agent/Core/UnionStation/Connection.h",
+   "src/agent/Core/UnionStation/Context.h",
+   "src/agent/Core/UnionStation/Transaction.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/Core/SpawningKit/SmartSpawnerTest.cpp"=>
   ["src/agent/Core/ApplicationPool/Options.h",
    "src/agent/Core/SpawningKit/BackgroundIOCapturer.h",
    "src/agent/Core/SpawningKit/Config.h",
    "src/agent/Core/SpawningKit/Options.h",
+   "src/agent/Core/SpawningKit/OutputMultiplexer.h",
    "src/agent/Core/SpawningKit/PipeWatcher.h",
    "src/agent/Core/SpawningKit/Result.h",
    "src/agent/Core/SpawningKit/SmartSpawner.h",
@@ -8278,11 +10527,14 @@
    "src/cxx_supportlib/Logging.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BufferedIO.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/CachedFileStat.hpp",
+   "src/cxx_supportlib/Utils/ConcurrentCachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/Hasher.h",
@@ -8351,12 +10603,14 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/BlockingQueue.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
    "src/cxx_supportlib/Utils/Curl.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/HashMap.h",
@@ -8408,39 +10662,157 @@
    "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
-   "src/cxx_supportlib/Utils/VariantMap.h",
-   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/initialize.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/../tut/tut_reporter.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/DataStructures/LStringTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/DataStructures/StringKeyTableTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/DateParsingTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/DateParsing.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/DirectoryMapperCacheTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
-   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
-   "src/cxx_supportlib/oxt/initialize.hpp",
    "src/cxx_supportlib/oxt/macros.hpp",
    "src/cxx_supportlib/oxt/system_calls.hpp",
    "src/cxx_supportlib/oxt/thread.hpp",
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../../src/apache2_module/DirectoryMapperCache.h",
    "test/cxx/../tut/tut.h",
-   "test/cxx/../tut/tut_reporter.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/DataStructures/LStringTest.cpp"=>
+ "test/cxx/DirectoryToucherTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
-   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/DirectoryToucher.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
@@ -8456,11 +10828,9 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/DataStructures/StringKeyTableTest.cpp"=>
+ "test/cxx/FileChangeCheckerTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
-   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
-   "src/cxx_supportlib/DataStructures/StringKeyTable.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/InstanceDirectory.h",
@@ -8470,12 +10840,15 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/Hasher.h",
+   "src/cxx_supportlib/Utils/FileChangeChecker.h",
+   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
@@ -8487,7 +10860,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/DateParsingTest.cpp"=>
+ "test/cxx/FileDescriptorTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -8499,7 +10872,6 @@
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/DateParsing.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
@@ -8516,7 +10888,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/FileChangeCheckerTest.cpp"=>
+ "test/cxx/FilterSupportTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -8526,17 +10898,15 @@
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
-   "src/cxx_supportlib/Utils/CachedFileStat.hpp",
    "src/cxx_supportlib/Utils/FastStringStream.h",
-   "src/cxx_supportlib/Utils/FileChangeChecker.h",
-   "src/cxx_supportlib/Utils/HashMap.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
-   "src/cxx_supportlib/Utils/StringMap.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
@@ -8548,7 +10918,7 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/FileDescriptorTest.cpp"=>
+ "test/cxx/IOUtilsTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
@@ -8576,27 +10946,58 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/FilterSupportTest.cpp"=>
-  ["src/cxx_supportlib/BackgroundEventLoop.h",
+ "test/cxx/LoadGenerator/LoadGeneratorTest.cpp"=>
+  ["src/agent/Core/Controller/AppResponse.h",
+   "src/agent/LoadGenerator/LoadGenerator.h",
+   "src/cxx_supportlib/Algorithms/Histogram.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/DataStructures/HashedStaticString.h",
+   "src/cxx_supportlib/DataStructures/LString.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/palloc.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/Channel.h",
+   "src/cxx_supportlib/ServerKit/Client.h",
+   "src/cxx_supportlib/ServerKit/Context.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/FdSourceChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
+   "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
+   "src/cxx_supportlib/ServerKit/HeaderTable.h",
+   "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParser.h",
+   "src/cxx_supportlib/ServerKit/HttpHeaderParserState.h",
+   "src/cxx_supportlib/ServerKit/HttpRequest.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
-   "src/cxx_supportlib/UnionStationFilterSupport.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
    "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/Hasher.h",
    "src/cxx_supportlib/Utils/IOUtils.h",
    "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/JsonUtils.h",
    "src/cxx_supportlib/Utils/LargeFiles.h",
-   "src/cxx_supportlib/Utils/ReleaseableScopedPointer.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
    "src/cxx_supportlib/Utils/StrIntUtils.h",
    "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
    "src/cxx_supportlib/oxt/detail/context.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
    "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
@@ -8606,13 +11007,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/IOUtilsTest.cpp"=>
+ "test/cxx/MemoryKit/MbufTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
@@ -8634,14 +11036,14 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
- "test/cxx/MemoryKit/MbufTest.cpp"=>
+ "test/cxx/MemoryKit/ObjectSlabTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
    "src/cxx_supportlib/Exceptions.h",
    "src/cxx_supportlib/FileDescriptor.h",
    "src/cxx_supportlib/InstanceDirectory.h",
    "src/cxx_supportlib/Logging.h",
-   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/MemoryKit/ObjectSlab.h",
    "src/cxx_supportlib/RandomGenerator.h",
    "src/cxx_supportlib/ResourceLocator.h",
    "src/cxx_supportlib/StaticString.h",
@@ -8835,6 +11237,7 @@
    "src/cxx_supportlib/ServerKit/Channel.h",
    "src/cxx_supportlib/ServerKit/Context.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
    "src/cxx_supportlib/Utils/../Exceptions.h",
@@ -8911,6 +11314,7 @@
    "src/cxx_supportlib/ServerKit/Errors.h",
    "src/cxx_supportlib/ServerKit/FileBufferedChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
@@ -8973,6 +11377,71 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/ServerKit/HttpChunkedBodyParserTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/MemoryKit/mbuf.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/Errors.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParser.h",
+   "src/cxx_supportlib/ServerKit/HttpChunkedBodyParserState.h",
+   "src/cxx_supportlib/ServerKit/http_parser.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
+ "test/cxx/ServerKit/HttpCompressionTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/ServerKit/HttpCompression.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/ServerKit/HttpServerTest.cpp"=>
   ["src/cxx_supportlib/Algorithms/MovingAverage.h",
    "src/cxx_supportlib/BackgroundEventLoop.h",
@@ -9008,6 +11477,7 @@
    "src/cxx_supportlib/ServerKit/HttpRequestRef.h",
    "src/cxx_supportlib/ServerKit/HttpServer.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
@@ -9061,6 +11531,7 @@
    "src/cxx_supportlib/ServerKit/FileBufferedFdSinkChannel.h",
    "src/cxx_supportlib/ServerKit/Hooks.h",
    "src/cxx_supportlib/ServerKit/Server.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
    "src/cxx_supportlib/ServerKit/http_parser.h",
    "src/cxx_supportlib/StaticString.h",
    "src/cxx_supportlib/Utils.h",
@@ -9089,6 +11560,36 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/ServerKit/TimerWheelTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/SafeLibev.h",
+   "src/cxx_supportlib/ServerKit/TimerWheel.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/StaticStringTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -9117,6 +11618,35 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/StatsSegmentTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/StatsSegment.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/StringMapTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -9307,6 +11837,38 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/Utils/BufferedMessageReaderTest.cpp"=>
+  ["src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/BufferedMessageReader.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/cxx/Utils/StrIntUtilsTest.cpp"=>
   ["src/cxx_supportlib/BackgroundEventLoop.h",
    "src/cxx_supportlib/Constants.h",
@@ -9399,6 +11961,44 @@
    "src/cxx_supportlib/oxt/tracable_exception.hpp",
    "test/cxx/../tut/tut.h",
    "test/cxx/TestSupport.h"],
+ "test/cxx/Watchdog/ChildReaperTest.cpp"=>
+  ["src/agent/Watchdog/AgentWatcher.cpp",
+   "src/agent/Watchdog/ChildReaper.h",
+   "src/cxx_supportlib/BackgroundEventLoop.h",
+   "src/cxx_supportlib/Constants.h",
+   "src/cxx_supportlib/Exceptions.h",
+   "src/cxx_supportlib/FileDescriptor.h",
+   "src/cxx_supportlib/InstanceDirectory.h",
+   "src/cxx_supportlib/Logging.h",
+   "src/cxx_supportlib/RandomGenerator.h",
+   "src/cxx_supportlib/ResourceLocator.h",
+   "src/cxx_supportlib/StaticString.h",
+   "src/cxx_supportlib/Utils.h",
+   "src/cxx_supportlib/Utils/../Exceptions.h",
+   "src/cxx_supportlib/Utils/FastStringStream.h",
+   "src/cxx_supportlib/Utils/IOUtils.h",
+   "src/cxx_supportlib/Utils/IniFile.h",
+   "src/cxx_supportlib/Utils/LargeFiles.h",
+   "src/cxx_supportlib/Utils/MemZeroGuard.h",
+   "src/cxx_supportlib/Utils/MessageIO.h",
+   "src/cxx_supportlib/Utils/ScopeGuard.h",
+   "src/cxx_supportlib/Utils/StrIntUtils.h",
+   "src/cxx_supportlib/Utils/SystemTime.h",
+   "src/cxx_supportlib/Utils/Timer.h",
+   "src/cxx_supportlib/Utils/VariantMap.h",
+   "src/cxx_supportlib/oxt/backtrace.hpp",
+   "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/backtrace_enabled.hpp",
+   "src/cxx_supportlib/oxt/detail/context.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_disabled.hpp",
+   "src/cxx_supportlib/oxt/detail/tracable_exception_enabled.hpp",
+   "src/cxx_supportlib/oxt/macros.hpp",
+   "src/cxx_supportlib/oxt/system_calls.hpp",
+   "src/cxx_supportlib/oxt/thread.hpp",
+   "src/cxx_supportlib/oxt/tracable_exception.hpp",
+   "test/cxx/../tut/tut.h",
+   "test/cxx/TestSupport.h"],
  "test/oxt/backtrace_test.cpp"=>
   ["src/cxx_supportlib/oxt/backtrace.hpp",
    "src/cxx_supportlib/oxt/detail/../spin_lock.hpp",
@@ -37,10 +37,18 @@
     "test/cxx/Core/ApplicationPool/ProcessTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/PoolTest.o" =>
     "test/cxx/Core/ApplicationPool/PoolTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/RestartFileWatcherTest.o" =>
+    "test/cxx/Core/ApplicationPool/RestartFileWatcherTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/DetachedProcessReaperTest.o" =>
+    "test/cxx/Core/ApplicationPool/DetachedProcessReaperTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/ApplicationPool/WorkerPoolTest.o" =>
+    "test/cxx/Core/ApplicationPool/WorkerPoolTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Core/SpawningKit/DirectSpawnerTest.o" =>
     "test/cxx/Core/SpawningKit/DirectSpawnerTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Core/SpawningKit/SmartSpawnerTest.o" =>
     "test/cxx/Core/SpawningKit/SmartSpawnerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Core/SpawningKit/OutputMultiplexerTest.o" =>
+    "test/cxx/Core/SpawningKit/OutputMultiplexerTest.cpp",
 
   "#{TEST_OUTPUT_DIR}cxx/Core/UnionStationTest.o" =>
     "test/cxx/Core/UnionStationTest.cpp",
@@ -52,6 +60,12 @@
   "#{TEST_OUTPUT_DIR}cxx/UstRouter/TransactionTest.o" =>
     "test/cxx/UstRouter/TransactionTest.cpp",
 
+  "#{TEST_OUTPUT_DIR}cxx/Watchdog/ChildReaperTest.o" =>
+    "test/cxx/Watchdog/ChildReaperTest.cpp",
+
+  "#{TEST_OUTPUT_DIR}cxx/LoadGenerator/LoadGeneratorTest.o" =>
+    "test/cxx/LoadGenerator/LoadGeneratorTest.cpp",
+
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/ChannelTest.o" =>
     "test/cxx/ServerKit/ChannelTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/FileBufferedChannelTest.o" =>
@@ -60,15 +74,27 @@
     "test/cxx/ServerKit/HeaderTableTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/ServerTest.o" =>
     "test/cxx/ServerKit/ServerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ServerKit/TimerWheelTest.o" =>
+    "test/cxx/ServerKit/TimerWheelTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/HttpServerTest.o" =>
     "test/cxx/ServerKit/HttpServerTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ServerKit/HttpChunkedBodyParserTest.o" =>
+    "test/cxx/ServerKit/HttpChunkedBodyParserTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/ServerKit/CookieUtilsTest.o" =>
     "test/cxx/ServerKit/CookieUtilsTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ServerKit/HttpCompressionTest.o" =>
+    "test/cxx/ServerKit/HttpCompressionTest.cpp",
 
+  "#{TEST_OUTPUT_DIR}cxx/Algorithms/HistogramTest.o" =>
+    "test/cxx/Algorithms/HistogramTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Algorithms/CoDelTest.o" =>
+    "test/cxx/Algorithms/CoDelTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MemoryKit/MbufTest.o" =>
     "test/cxx/MemoryKit/MbufTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MemoryKit/PallocTest.o" =>
     "test/cxx/MemoryKit/PallocTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/MemoryKit/ObjectSlabTest.o" =>
+    "test/cxx/MemoryKit/ObjectSlabTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/LStringTest.o" =>
     "test/cxx/DataStructures/LStringTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/DataStructures/StringKeyTableTest.o" =>
@@ -81,12 +107,20 @@
     "test/cxx/FileChangeCheckerTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/FileDescriptorTest.o" =>
     "test/cxx/FileDescriptorTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/StatsSegmentTest.o" =>
+    "test/cxx/StatsSegmentTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/SystemTimeTest.o" =>
     "test/cxx/SystemTimeTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/FilterSupportTest.o" =>
     "test/cxx/FilterSupportTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/CachedFileStatTest.o" =>
     "test/cxx/CachedFileStatTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/ConcurrentCachedFileStatTest.o" =>
+    "test/cxx/ConcurrentCachedFileStatTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/DirectoryMapperCacheTest.o" =>
+    "test/cxx/DirectoryMapperCacheTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/DirectoryToucherTest.o" =>
+    "test/cxx/DirectoryToucherTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/BufferedIOTest.o" =>
     "test/cxx/BufferedIOTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/MessageIOTest.o" =>
@@ -105,6 +139,8 @@
     "test/cxx/UtilsTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/Utils/StrIntUtilsTest.o" =>
     "test/cxx/Utils/StrIntUtilsTest.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Utils/BufferedMessageReaderTest.o" =>
+    "test/cxx/Utils/BufferedMessageReaderTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/IOUtilsTest.o" =>
     "test/cxx/IOUtilsTest.cpp",
   "#{TEST_OUTPUT_DIR}cxx/TemplateTest.o" =>
@@ -229,3 +265,117 @@ def test_cxx_ldflags
     ].flatten
   )
 end
+
+
+### C++ components benchmarks ###
+
+TEST_CXX_BENCHMARK_TARGET = "#{TEST_OUTPUT_DIR}cxx/benchmark"
+TEST_CXX_BENCHMARK_OBJECTS = {
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/BenchmarkMain.o" =>
+    "test/cxx/Benchmarks/BenchmarkMain.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Core/ResponseCacheBenchmark.o" =>
+    "test/cxx/Benchmarks/Core/ResponseCacheBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Core/RequestBenchmark.o" =>
+    "test/cxx/Benchmarks/Core/RequestBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Core/MetricsBenchmark.o" =>
+    "test/cxx/Benchmarks/Core/MetricsBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Core/PoolBenchmark.o" =>
+    "test/cxx/Benchmarks/Core/PoolBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Core/ResponseHeaderBenchmark.o" =>
+    "test/cxx/Benchmarks/Core/ResponseHeaderBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/ServerKit/HeaderTableBenchmark.o" =>
+    "test/cxx/Benchmarks/ServerKit/HeaderTableBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/ServerKit/HttpParserBenchmark.o" =>
+    "test/cxx/Benchmarks/ServerKit/HttpParserBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/ServerKit/HttpCompressionBenchmark.o" =>
+    "test/cxx/Benchmarks/ServerKit/HttpCompressionBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/DataStructures/StringKeyTableBenchmark.o" =>
+    "test/cxx/Benchmarks/DataStructures/StringKeyTableBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/MemoryKit/PallocBenchmark.o" =>
+    "test/cxx/Benchmarks/MemoryKit/PallocBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/MemoryKit/MbufBenchmark.o" =>
+    "test/cxx/Benchmarks/MemoryKit/MbufBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Utils/StrIntUtilsBenchmark.o" =>
+    "test/cxx/Benchmarks/Utils/StrIntUtilsBenchmark.cpp",
+  "#{TEST_OUTPUT_DIR}cxx/Benchmarks/Utils/MessageReaderBenchmark.o" =>
+    "test/cxx/Benchmarks/Utils/MessageReaderBenchmark.cpp"
+}
+
+# The benchmarks don't use tut or TestSupport.h. They are optimized if and
+# only if the code under benchmark is, i.e. when OPTIMIZE=1 is given.
+def benchmark_cxx_flags
+  @benchmark_cxx_flags ||= begin
+    flags = basic_test_cxx_flags.dup
+    flags << "-O2" if OPTIMIZE
+    flags
+  end
+end
+
+TEST_CXX_BENCHMARK_OBJECTS.each_pair do |object, source|
+  define_cxx_object_compilation_task(
+    object,
+    source,
+    :include_paths => test_cxx_include_paths,
+    :flags => benchmark_cxx_flags
+  )
+end
+
+dependencies = [
+  TEST_CXX_BENCHMARK_OBJECTS.keys,
+  LIBEV_TARGET,
+  LIBUV_TARGET,
+  TEST_BOOST_OXT_LIBRARY,
+  TEST_COMMON_LIBRARY.link_objects,
+  AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT]
+].flatten.compact
+file(TEST_CXX_BENCHMARK_TARGET => dependencies) do
+  create_cxx_executable(
+    TEST_CXX_BENCHMARK_TARGET,
+    TEST_CXX_BENCHMARK_OBJECTS.keys + AGENT_OBJECTS.keys - [AGENT_MAIN_OBJECT],
+    :flags => test_cxx_ldflags
+  )
+end
+
+def benchmark_cxx_command(args)
+  "#{File.expand_path(TEST_CXX_BENCHMARK_TARGET)} #{args.join(' ')}".strip
+end
+
+desc "Run microbenchmarks for the C++ components (use OPTIMIZE=1)"
+task 'benchmark:cxx' => TEST_CXX_BENCHMARK_TARGET do
+  require 'shellwords'
+  if !OPTIMIZE
+    STDERR.puts "Warning: OPTIMIZE=1 is not set; results will not be representative."
+  end
+
+  args = ENV['FILTER'].to_s.split(";").map { |filter| "--filter #{Shellwords.escape(filter)}" }
+  args << "--json #{Shellwords.escape(ENV['JSON'])}" if ENV['JSON']
+  args << "--samples #{ENV['SAMPLES'].to_i}" if ENV['SAMPLES']
+  args << "--cpu #{ENV['CPU'].to_i}" if ENV['CPU']
+  sh benchmark_cxx_command(args)
+
+  if ENV['BASELINE']
+    if !ENV['JSON']
+      abort "BASELINE=... requires JSON=... to be set as well."
+    end
+    Rake::Task['benchmark:cxx:compare'].invoke
+  end
+end
+
+desc "Print C++ object size and memory usage reports (FILTER=a;b)"
+task 'benchmark:cxx:report' => TEST_CXX_BENCHMARK_TARGET do
+  require 'shellwords'
+  args = ["--report"]
+  args.concat(ENV['FILTER'].to_s.split(";").map { |filter| "--filter #{Shellwords.escape(filter)}" })
+  sh benchmark_cxx_command(args)
+end
+
+desc "Compare two C++ benchmark results (BASELINE=a.json CURRENT=b.json [THRESHOLD=10])"
+task 'benchmark:cxx:compare' => TEST_CXX_BENCHMARK_TARGET do
+  require 'shellwords'
+  baseline = ENV['BASELINE'] || abort("Please set BASELINE to a benchmark results JSON file.")
+  current = ENV['CURRENT'] || ENV['JSON'] ||
+    abort("Please set CURRENT to a benchmark results JSON file.")
+  args = ["--compare", Shellwords.escape(baseline), Shellwords.escape(current)]
+  args << "--threshold #{ENV['THRESHOLD'].to_f}" if ENV['THRESHOLD']
+  sh benchmark_cxx_command(args)
+end
@@ -0,0 +1,104 @@
+#!/usr/bin/env ruby
+# Benchmarks the ways in which the Ruby request handler can read and parse
+# a session protocol header block:
+#
+#  * The old path: MessageChannel#read_scalar followed by
+#    NativeSupport.split_by_null_into_hash.
+#  * The pure-Ruby fallback that is used when native_support is unavailable.
+#  * NativeSupport.read_session_header.
+#
+# Usage: ./dev/benchmark_session_header_parser.rb [ITERATIONS]
+
+source_root = File.expand_path("..", File.dirname(__FILE__))
+$LOAD_PATH.unshift("#{source_root}/src/ruby_supportlib")
+require 'socket'
+require 'benchmark'
+require 'phusion_passenger'
+
+PhusionPassenger.locate_directories
+PhusionPassenger.require_passenger_lib 'native_support'
+PhusionPassenger.require_passenger_lib 'message_channel'
+
+include PhusionPassenger
+
+if !defined?(NativeSupport) || !NativeSupport.respond_to?(:read_session_header)
+  abort "This benchmark requires a native_support that provides read_session_header."
+end
+
+ITERATIONS = (ARGV[0] || 100_000).to_i
+MAX_HEADER_SIZE = 128 * 1024
+
+# A header block similar to what the Core sends for a typical browser request.
+HEADERS = {
+  "REQUEST_URI" => "/posts/1234?page=2",
+  "PATH_INFO" => "/posts/1234",
+  "SCRIPT_NAME" => "",
+  "QUERY_STRING" => "page=2",
+  "REQUEST_METHOD" => "GET",
+  "SERVER_NAME" => "www.example.com",
+  "SERVER_PORT" => "80",
+  "SERVER_SOFTWARE" => "nginx/1.8.1 Phusion_Passenger/5.0.27",
+  "SERVER_PROTOCOL" => "HTTP/1.1",
+  "REMOTE_ADDR" => "127.0.0.1",
+  "REMOTE_PORT" => "51234",
+  "CONTENT_LENGTH" => "0",
+  "PASSENGER_CONNECT_PASSWORD" => "0123456789abcdef0123456789abcdef",
+  "HTTP_HOST" => "www.example.com",
+  "HTTP_CONNECTION" => "keep-alive",
+  "HTTP_ACCEPT" => "text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8",
+  "HTTP_USER_AGENT" => "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 " \
+    "(KHTML, like Gecko) Chrome/49.0.2623.87 Safari/537.36",
+  "HTTP_ACCEPT_ENCODING" => "gzip, deflate, sdch",
+  "HTTP_ACCEPT_LANGUAGE" => "en-US,en;q=0.8,nl;q=0.6",
+  "HTTP_COOKIE" => "_session_id=5f2b0a9c8d7e6f5a4b3c2d1e0f9a8b7c; locale=en",
+  "HTTP_REFERER" => "http://www.example.com/posts",
+  "HTTPS" => "off",
+  "PASSENGER_APP_TYPE" => "rack",
+  "PASSENGER_TXN_ID" => "00000000-abcdefg"
+}
+DATA = HEADERS.map { |k, v| "#{k}\0#{v}\0" }.join
+MESSAGE = [DATA.bytesize].pack('N') + DATA
+
+def ruby_split_by_null_into_hash(data)
+  args = data.split("\0", -1)
+  args.pop
+  Hash[*args]
+end
+
+def run(name, iterations)
+  reader, writer = UNIXSocket.pair
+  channel = MessageChannel.new(reader)
+  buffer = ''
+  buffer.force_encoding('binary')
+  GC.start
+  allocated_before = GC.stat[:total_allocated_objects] if GC.respond_to?(:stat)
+  result = Benchmark.realtime do
+    iterations.times do
+      writer.write(MESSAGE)
+      headers = yield(reader, channel, buffer)
+      raise "Parse error" if headers.size != HEADERS.size
+    end
+  end
+  if allocated_before
+    allocations = (GC.stat[:total_allocated_objects] - allocated_before) / iterations.to_f
+  end
+  printf "%-40s %8.2f usec/request   %6.1f objects/request\n",
+    name, result * 1_000_000 / iterations, allocations || -1
+ensure
+  reader.close if reader
+  writer.close if writer
+end
+
+puts "#{ITERATIONS} iterations, #{HEADERS.size} headers, #{MESSAGE.bytesize} bytes per header block"
+2.times do |i|
+  puts(i == 0 ? "Warmup:" : "Results:")
+  run("read_scalar + split_by_null_into_hash", ITERATIONS) do |reader, channel, buffer|
+    NativeSupport.split_by_null_into_hash(channel.read_scalar(buffer, MAX_HEADER_SIZE))
+  end
+  run("read_scalar + pure Ruby split", ITERATIONS) do |reader, channel, buffer|
+    ruby_split_by_null_into_hash(channel.read_scalar(buffer, MAX_HEADER_SIZE))
+  end
+  run("NativeSupport.read_session_header", ITERATIONS) do |reader, channel, buffer|
+    NativeSupport.read_session_header(reader.fileno, buffer, MAX_HEADER_SIZE)
+  end
+end
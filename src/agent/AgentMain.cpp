@@ -36,6 +36,8 @@ int ustRouterMain(int argc, char *argv[]);
 int systemMetricsMain(int argc, char *argv[]);
 int tempDirToucherMain(int argc, char *argv[]);
 int spawnPreparerMain(int argc, char *argv[]);
+int loadGeneratorMain(int argc, char *argv[]);
+int statsReaderMain(int argc, char *argv[]);
 
 static bool
 isHelp(const char *arg) {
@@ -58,6 +60,8 @@ usage(int argc, char *argv[]) {
 	printf("\n");
 	printf("Utility subcommands:\n");
 	printf("  system-metrics\n");
+	printf("  loadgen\n");
+	printf("  stats\n");
 }
 
 static bool
@@ -90,6 +94,10 @@ dispatchSubcommand(int argc, char *argv[]) {
 		exit(tempDirToucherMain(argc, argv));
 	} else if (strcmp(argv[1], "spawn-preparer") == 0) {
 		exit(spawnPreparerMain(argc, argv));
+	} else if (strcmp(argv[1], "loadgen") == 0) {
+		exit(loadGeneratorMain(argc, argv));
+	} else if (strcmp(argv[1], "stats") == 0) {
+		exit(statsReaderMain(argc, argv));
 	} else if (strcmp(argv[1], "test-binary") == 0) {
 		printf("PASS\n");
 		exit(0);
@@ -37,6 +37,7 @@
 #include <modp_b64.h>
 
 #include <Core/Controller.h>
+#include <Core/Controller/Metrics.h>
 #include <Core/ApplicationPool/Pool.h>
 #include <Shared/ApiServerUtils.h>
 #include <ServerKit/HttpServer.h>
@@ -63,6 +64,7 @@ public:
 	Authorization authorization;
 	unsigned int controllerStatesGathered;
 	vector<Json::Value> controllerStates;
+	boost::shared_ptr<ControllerMetrics> controllerMetrics;
 
 	DEFINE_SERVER_KIT_BASE_HTTP_REQUEST_FOOTER(Passenger::Core::ApiServer::Request);
 };
@@ -129,6 +131,8 @@ private:
 				instanceDir, fdPassingPassword);
 		} else if (path == P_STATIC_STRING("/reopen_logs.json")) {
 			apiServerProcessReopenLogs(this, client, req);
+		} else if (path == P_STATIC_STRING("/metrics")) {
+			processMetrics(client, req);
 		} else {
 			apiServerRespondWith404(this, client, req);
 		}
@@ -230,6 +234,191 @@ private:
 		}
 	}
 
+	void gatherControllerMetrics(Client *client, Request *req,
+		Controller *controller)
+	{
+		boost::shared_ptr<ControllerMetrics> metrics =
+			boost::make_shared<ControllerMetrics>();
+		controller->collectMetrics(*metrics);
+		getContext()->libev->runLater(boost::bind(&ApiServer::controllerMetricsGathered,
+			this, client, req, metrics));
+	}
+
+	void controllerMetricsGathered(Client *client, Request *req,
+		boost::shared_ptr<ControllerMetrics> metrics)
+	{
+		if (req->ended()) {
+			unrefRequest(req, __FILE__, __LINE__);
+			return;
+		}
+
+		req->controllerStatesGathered++;
+		if (req->controllerMetrics == NULL) {
+			req->controllerMetrics = metrics;
+		} else {
+			req->controllerMetrics->merge(*metrics);
+		}
+
+		if (req->controllerStatesGathered == controllers.size()) {
+			HeaderTable headers;
+			headers.insert(req->pool, "Content-Type", "text/plain; version=0.0.4");
+			writeSimpleResponse(client, 200, &headers,
+				psg_pstrdup(req->pool, formatMetrics(*req->controllerMetrics)));
+			if (!req->ended()) {
+				Request *req2 = req;
+				endRequest(&client, &req2);
+			}
+		}
+
+		unrefRequest(req, __FILE__, __LINE__);
+	}
+
+	string formatMetrics(const ControllerMetrics &metrics) {
+		const ApplicationPool2::Context *poolContext = appPool->getContext();
+		PrometheusWriter writer;
+		map<string, AppGroupMetrics>::const_iterator it, end = metrics.appGroups.end();
+
+		writer.declare("passenger_request_duration_seconds", "histogram",
+			"Time spent handling requests, per application group.");
+		for (it = metrics.appGroups.begin(); it != end; it++) {
+			writer.histogram("passenger_request_duration_seconds",
+				it->second.requestDurations, 7, 26, 1000000,
+				PrometheusWriter::label("app_group", it->first));
+		}
+
+		writer.declare("passenger_session_checkout_wait_seconds", "histogram",
+			"Time spent waiting for an application process to become available.");
+		for (it = metrics.appGroups.begin(); it != end; it++) {
+			writer.histogram("passenger_session_checkout_wait_seconds",
+				it->second.sessionCheckoutWaits, 4, 26, 1000000,
+				PrometheusWriter::label("app_group", it->first));
+		}
+
+		writer.declare("passenger_request_time_to_app_seconds", "histogram",
+			"Time between the beginning of a request with a body and sending"
+			" its header to the application. The body label tells whether the"
+			" body was buffered entirely first, or streamed.");
+		for (it = metrics.appGroups.begin(); it != end; it++) {
+			string appGroupLabel = PrometheusWriter::label("app_group", it->first);
+			writer.histogram("passenger_request_time_to_app_seconds",
+				it->second.bufferedBodyTimesToApp, 7, 26, 1000000,
+				appGroupLabel + "," + PrometheusWriter::label("body", "buffered"));
+			writer.histogram("passenger_request_time_to_app_seconds",
+				it->second.streamedBodyTimesToApp, 7, 26, 1000000,
+				appGroupLabel + "," + PrometheusWriter::label("body", "streamed"));
+		}
+
+		map<string, Histogram> sojourns;
+		map<string, Histogram>::const_iterator s_it, s_end;
+		appPool->collectGetWaitlistSojourns(sojourns);
+		writer.declare("passenger_request_queue_sojourn_seconds", "histogram",
+			"Time that requests spent in an application group's request queue.");
+		for (s_it = sojourns.begin(), s_end = sojourns.end(); s_it != s_end; s_it++) {
+			writer.histogram("passenger_request_queue_sojourn_seconds",
+				s_it->second, 4, 26, 1000000,
+				PrometheusWriter::label("app_group", s_it->first));
+		}
+
+		writer.declare("passenger_get_waitlist_depth", "histogram",
+			"Size of the request queue that a request is put on, sampled on enqueue.");
+		writer.histogram("passenger_get_waitlist_depth",
+			poolContext->getWaitlistDepths, 0, 14);
+
+		writer.declare("passenger_spawn_duration_seconds", "histogram",
+			"Time spent spawning application processes.");
+		writer.histogram("passenger_spawn_duration_seconds",
+			poolContext->spawnDurations, 14, 28, 1000000);
+
+		writer.declare("passenger_spawn_failures_total", "counter",
+			"Number of application process spawn attempts that failed.");
+		writer.sample("passenger_spawn_failures_total",
+			poolContext->spawnFailures.load(boost::memory_order_relaxed));
+
+		writer.declare("passenger_oobw_duration_seconds", "histogram",
+			"Time that application processes spent on out-of-band work.");
+		writer.histogram("passenger_oobw_duration_seconds",
+			poolContext->oobwDurations, 10, 26, 1000000);
+
+		writer.declare("passenger_oobw_deferrals_total", "counter",
+			"Number of out-of-band work requests that were held back because of"
+			" too little spare concurrency.");
+		writer.sample("passenger_oobw_deferrals_total",
+			poolContext->oobwDeferrals.load(boost::memory_order_relaxed));
+
+		writer.declare("passenger_request_queue_timeouts_total", "counter",
+			"Number of queued requests that were dropped because they passed"
+			" their deadline.");
+		writer.sample("passenger_request_queue_timeouts_total",
+			poolContext->getWaitlistTimeouts.load(boost::memory_order_relaxed));
+
+		writer.declare("passenger_request_queue_sheds_total", "counter",
+			"Number of queued requests that were dropped by load shedding.");
+		writer.sample("passenger_request_queue_sheds_total",
+			poolContext->getWaitlistSheds.load(boost::memory_order_relaxed));
+
+		writer.declare("passenger_memory_recycles_total", "counter",
+			"Number of application processes that were replaced because of"
+			" their memory usage.");
+		writer.sample("passenger_memory_recycles_total",
+			poolContext->memoryRecycles.load(boost::memory_order_relaxed));
+
+		writer.declare("passenger_requests_total", "counter",
+			"Number of requests begun.");
+		writer.sample("passenger_requests_total", metrics.totalRequestsBegun);
+
+		writer.declare("passenger_active_clients", "gauge",
+			"Number of client connections.");
+		writer.sample("passenger_active_clients", metrics.activeClients);
+
+		// ResponseCache periodically resets its statistics, so these
+		// are gauges rather than counters.
+		writer.declare("passenger_turbocache_fetches", "gauge",
+			"Number of turbocache lookups in the current turbocache period.");
+		writer.sample("passenger_turbocache_fetches", metrics.turboCacheFetches);
+		writer.declare("passenger_turbocache_hits", "gauge",
+			"Number of turbocache hits in the current turbocache period.");
+		writer.sample("passenger_turbocache_hits", metrics.turboCacheHits);
+		writer.declare("passenger_turbocache_hit_ratio", "gauge",
+			"Turbocache hit ratio in the current turbocache period.");
+		writer.sample("passenger_turbocache_hit_ratio", (metrics.turboCacheFetches == 0)
+			? 0 : metrics.turboCacheHits / (double) metrics.turboCacheFetches);
+
+		writer.declare("passenger_mbuf_blocks", "gauge",
+			"Number of mbuf blocks, by state.");
+		writer.sample("passenger_mbuf_blocks", metrics.mbufActiveBlocks,
+			"state=\"active\"");
+		writer.sample("passenger_mbuf_blocks", metrics.mbufFreeBlocks,
+			"state=\"free\"");
+		writer.declare("passenger_mbuf_block_size_bytes", "gauge",
+			"Size of a single mbuf block.");
+		writer.sample("passenger_mbuf_block_size_bytes", metrics.mbufBlockSize);
+
+		writer.declare("passenger_request_pools", "gauge",
+			"Number of memory pools owned by in-flight requests.");
+		writer.sample("passenger_request_pools", metrics.pallocPools);
+		writer.declare("passenger_request_pool_bytes", "gauge",
+			"Memory owned by in-flight request pools, by state.");
+		writer.sample("passenger_request_pool_bytes", metrics.pallocReservedBytes,
+			"state=\"reserved\"");
+		writer.sample("passenger_request_pool_bytes", metrics.pallocUsedBytes,
+			"state=\"used\"");
+
+		return writer.str();
+	}
+
+	void processMetrics(Client *client, Request *req) {
+		if (authorizeStateInspectionOperation(this, client, req)) {
+			for (unsigned int i = 0; i < controllers.size(); i++) {
+				refRequest(req, __FILE__, __LINE__);
+				controllers[i]->getContext()->libev->runLater(boost::bind(
+					&ApiServer::gatherControllerMetrics, this,
+					client, req, controllers[i]));
+			}
+		} else {
+			apiServerRespondWith401(this, client, req);
+		}
+	}
+
 	void processPoolStatusXml(Client *client, Request *req) {
 		Authorization auth(authorize(this, client, req));
 		if (auth.canReadPool) {
@@ -634,6 +823,7 @@ protected:
 		}
 		req->authorization = Authorization();
 		req->controllerStates.clear();
+		req->controllerMetrics.reset();
 		ParentClass::deinitializeRequest(client, req);
 	}
 
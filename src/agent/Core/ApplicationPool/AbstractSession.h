@@ -42,6 +42,21 @@ namespace ApplicationPool2 {
  */
 class AbstractSession {
 public:
+	enum InitiateResult {
+		/** The session is initiated and fd() is connected. */
+		INITIATE_DONE,
+		/**
+		 * A connect is in progress. Call initiateNonBlocking() again
+		 * once fd() becomes writable.
+		 */
+		INITIATE_WAIT_WRITABLE,
+		/**
+		 * The process's listen backlog is full. Call initiateNonBlocking()
+		 * again after a short delay.
+		 */
+		INITIATE_RETRY_LATER
+	};
+
 	virtual ~AbstractSession() {}
 
 	virtual void ref() const = 0;
@@ -57,6 +72,24 @@ public:
 
 	virtual void initiate(bool blocking = true) = 0;
 
+	/**
+	 * Like `initiate(false)`, but never blocks on connecting to the process.
+	 * Must be called repeatedly, as indicated by the return value, until it
+	 * returns INITIATE_DONE. Throws an exception on failure, just like
+	 * initiate().
+	 */
+	virtual InitiateResult initiateNonBlocking() {
+		initiate(false);
+		return INITIATE_DONE;
+	}
+
+	/**
+	 * Gives up on a non-blocking initiation that is still in progress,
+	 * for example because it took too long. This is treated as a failure
+	 * to initiate.
+	 */
+	virtual void abortInitiate() { /* Do nothing */ }
+
 	virtual void requestOOBW() { /* Do nothing */ }
 
 	/**
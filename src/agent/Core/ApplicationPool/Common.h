@@ -188,10 +188,16 @@ struct GetCallback {
 struct GetWaiter {
 	Options options;
 	GetCallback callback;
+	/** The time at which this waiter was put on the getWaitlist, in
+	 * microseconds.
+	 */
+	unsigned long long enqueueTime;
 
-	GetWaiter(const Options &o, const GetCallback &cb)
+	GetWaiter(const Options &o, const GetCallback &cb,
+		unsigned long long _enqueueTime = 0)
 		: options(o),
-		  callback(cb)
+		  callback(cb),
+		  enqueueTime(_enqueueTime)
 	{
 		options.persist(o);
 	}
@@ -26,11 +26,17 @@
 #ifndef _PASSENGER_APPLICATION_POOL2_CONTEXT_H_
 #define _PASSENGER_APPLICATION_POOL2_CONTEXT_H_
 
+#include <climits>
 #include <boost/thread.hpp>
 #include <boost/pool/object_pool.hpp>
+#include <boost/atomic.hpp>
 #include <Exceptions.h>
+#include <Algorithms/Histogram.h>
 #include <Utils/ClassUtils.h>
 #include <Core/SpawningKit/Factory.h>
+#include <Core/ApplicationPool/RestartFileWatcher.h>
+#include <Core/ApplicationPool/DetachedProcessReaper.h>
+#include <Core/ApplicationPool/WorkerPool.h>
 
 namespace Passenger {
 namespace ApplicationPool2 {
@@ -67,11 +73,69 @@ private:
 
 
 public:
+	/****** Metrics ******/
+	// These fields are not protected by any mutex. They may be read at
+	// any time, from any thread, for exposing via the /metrics endpoint.
+
+	/** Time spent in SpawningKit::Spawner::spawn(), in microseconds. Written
+	 * to concurrently by all spawner threads.
+	 */
+	Histogram spawnDurations;
+	boost::atomic<boost::uint64_t> spawnFailures;
+	/** Size of the getWaitlist that a request ends up in, sampled whenever a
+	 * request is put on a (Group or Pool) getWaitlist. Only written while
+	 * holding the Pool lock.
+	 */
+	Histogram getWaitlistDepths;
+	/** Time that applications spent handling out-of-band work requests, in
+	 * microseconds. Written to concurrently by the OOBW worker pool.
+	 */
+	Histogram oobwDurations;
+	/** Number of times that a Group held back an out-of-band work request
+	 * because it would have left too little spare concurrency.
+	 */
+	boost::atomic<boost::uint64_t> oobwDeferrals;
+	/** Number of processes that were replaced because of their memory usage. */
+	boost::atomic<boost::uint64_t> memoryRecycles;
+	/** Number of requests that were dropped from a Group's getWaitlist
+	 * because they passed their deadline. Only written while holding the
+	 * Pool lock.
+	 */
+	boost::atomic<boost::uint64_t> getWaitlistTimeouts;
+	/** Number of requests that were dropped from a Group's getWaitlist
+	 * by CoDel load shedding. Only written while holding the Pool lock.
+	 */
+	boost::atomic<boost::uint64_t> getWaitlistSheds;
+
+
+	/****** Services ******/
+
+	/** Thread-safe. Shared by all Groups. */
+	RestartFileWatcher restartFileWatcher;
+	/** Thread-safe. Shared by all Groups. */
+	DetachedProcessReaper detachedProcessReaper;
+	/**
+	 * Thread-safe. Runs the out-of-band work requests of all Groups. Its
+	 * thread count is not limited: a process is disabled before its OOBW
+	 * request is submitted, so a request must never wait for a free
+	 * thread. The number of concurrent requests is already bounded by
+	 * each Group's `maxOutOfBandWorkInstances`.
+	 */
+	WorkerPool oobwWorkerPool;
+
+
+
 	/****** Initialization ******/
 
 	Context()
 		: mSessionObjectPool(64, 1024),
-		  mProcessObjectPool(4, 64)
+		  mProcessObjectPool(4, 64),
+		  spawnFailures(0),
+		  oobwDeferrals(0),
+		  memoryRecycles(0),
+		  getWaitlistTimeouts(0),
+		  getWaitlistSheds(0),
+		  oobwWorkerPool("OOBW worker", UINT_MAX)
 		{ }
 
 	void finalize() {
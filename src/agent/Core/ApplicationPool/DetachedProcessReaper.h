@@ -0,0 +1,388 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_DETACHED_PROCESS_REAPER_H_
+#define _PASSENGER_APPLICATION_POOL2_DETACHED_PROCESS_REAPER_H_
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/macros.hpp>
+#include <ev++.h>
+#include <map>
+#include <vector>
+#include <cerrno>
+#include <sys/types.h>
+#include <unistd.h>
+#ifdef __linux__
+	#include <sys/syscall.h>
+#endif
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/**
+ * Runs the detached processes checks of all Groups in a Pool, from a single
+ * background event loop. Before, every Group with detached processes had its
+ * own checker thread that woke up every 100 msec. That caused bursts of
+ * threads when many Groups were restarted at once, and delayed cleanups by up
+ * to 100 msec.
+ *
+ * An owner (a Group) registers a check function with `schedule()`. The check
+ * function is called from the event loop thread, as soon as possible, and then
+ * again whenever:
+ *
+ *  - `schedule()` is called for the same owner again;
+ *  - an OS process that was registered with `watchPid()` exits;
+ *  - the poll timer fires, every `pollInterval` seconds.
+ *
+ * On Linux >= 5.3, exits are noticed through pidfds in the event loop's epoll
+ * set, so the poll timer only serves as a safety net (e.g. for shutdown
+ * timeouts). Elsewhere, the poll timer fires every 100 msec like before.
+ *
+ * A check function may clean up at most `maxCleanupsPerCheck` processes per
+ * call, so that the Pool lock isn't held for too long when many processes
+ * exit at the same time. If it returns `CHECK_AGAIN`, it's called again after
+ * other owners got their turn.
+ */
+class DetachedProcessReaper: public boost::noncopyable {
+public:
+	enum CheckResult {
+		/** The owner has no more detached processes; forget about it. */
+		CHECK_DONE,
+		/** Some detached processes haven't exited yet. */
+		CHECK_WAITING,
+		/** The cleanup limit was reached. Check again soon. */
+		CHECK_AGAIN
+	};
+
+	typedef boost::function<CheckResult (unsigned int maxCleanups)> CheckFunction;
+
+private:
+	static const unsigned int DEFAULT_MAX_CLEANUPS_PER_CHECK = 16;
+
+	struct Owner {
+		CheckFunction check;
+		bool due;
+	};
+
+	struct PidWatch {
+		ev_io watcher;
+		DetachedProcessReaper *self;
+		const void *owner;
+		int fd;
+	};
+
+	typedef std::map<const void *, Owner> OwnerMap;
+	typedef std::multimap<const void *, PidWatch *> PidWatchMap;
+
+	const unsigned int maxCleanupsPerCheck;
+	const bool pidfdsSupported;
+	const ev_tstamp pollInterval;
+
+	/** Protects `owners` and `bg`. */
+	boost::mutex syncher;
+	boost::condition_variable idleCond;
+	OwnerMap owners;
+	BackgroundEventLoop *bg;
+
+	// These fields are only accessed from the event loop thread.
+	struct ev_idle idleWatcher;
+	struct ev_timer pollTimer;
+	PidWatchMap pidWatches;
+
+	static int openPidfd(pid_t pid) {
+		#if defined(__linux__) && defined(SYS_pidfd_open)
+			return syscall(SYS_pidfd_open, pid, 0);
+		#else
+			errno = ENOSYS;
+			return -1;
+		#endif
+	}
+
+	static bool checkPidfdsSupported() {
+		int fd = openPidfd(getpid());
+		if (fd == -1) {
+			return false;
+		} else {
+			close(fd);
+			return true;
+		}
+	}
+
+	void startEventLoop() {
+		bg = new BackgroundEventLoop(true, false);
+		ev_idle_init(&idleWatcher, onIdle);
+		idleWatcher.data = this;
+		ev_timer_init(&pollTimer, onPollTimeout, pollInterval, pollInterval);
+		pollTimer.data = this;
+		bg->start("Detached process reaper", 128 * 1024);
+	}
+
+	void wakeup() {
+		ev_idle_start(bg->libev_loop, &idleWatcher);
+		if (!ev_is_active(&pollTimer)) {
+			ev_timer_start(bg->libev_loop, &pollTimer);
+		}
+	}
+
+	void addPidWatch(const void *owner, int fd) {
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			if (owners.find(owner) == owners.end()) {
+				close(fd);
+				return;
+			}
+		}
+
+		PidWatch *watch = new PidWatch();
+		watch->self = this;
+		watch->owner = owner;
+		watch->fd = fd;
+		ev_io_init(&watch->watcher, onPidfdReadable, fd, EV_READ);
+		watch->watcher.data = watch;
+		ev_io_start(bg->libev_loop, &watch->watcher);
+		pidWatches.insert(make_pair(owner, watch));
+	}
+
+	void removePidWatch(PidWatch *watch) {
+		pair<PidWatchMap::iterator, PidWatchMap::iterator> range =
+			pidWatches.equal_range(watch->owner);
+		PidWatchMap::iterator it;
+
+		for (it = range.first; it != range.second; it++) {
+			if (it->second == watch) {
+				pidWatches.erase(it);
+				break;
+			}
+		}
+		ev_io_stop(bg->libev_loop, &watch->watcher);
+		close(watch->fd);
+		delete watch;
+	}
+
+	void removePidWatches(const void *owner) {
+		while (true) {
+			PidWatchMap::iterator it = pidWatches.find(owner);
+			if (it == pidWatches.end()) {
+				break;
+			}
+			removePidWatch(it->second);
+		}
+	}
+
+	/**
+	 * Runs the check functions of all due owners once. Called from the
+	 * event loop thread.
+	 */
+	void runDueChecks() {
+		vector< pair<const void *, CheckFunction> > checks;
+		vector<CheckResult> results;
+		bool moreWork = false;
+
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			OwnerMap::iterator it, end = owners.end();
+			for (it = owners.begin(); it != end; it++) {
+				if (it->second.due) {
+					it->second.due = false;
+					checks.push_back(make_pair(it->first, it->second.check));
+				}
+			}
+		}
+
+		// The check functions grab the Pool lock, so don't hold ours.
+		for (unsigned int i = 0; i < checks.size(); i++) {
+			results.push_back(checks[i].second(maxCleanupsPerCheck));
+		}
+
+		boost::lock_guard<boost::mutex> l(syncher);
+		for (unsigned int i = 0; i < checks.size(); i++) {
+			OwnerMap::iterator it = owners.find(checks[i].first);
+			if (it == owners.end()) {
+				continue;
+			}
+			Owner &owner = it->second;
+			// If the owner was rescheduled while its check was running,
+			// then it's due again, even if the check said it's done.
+			if (results[i] == CHECK_DONE && !owner.due) {
+				removePidWatches(it->first);
+				owners.erase(it);
+			} else if (results[i] == CHECK_AGAIN) {
+				owner.due = true;
+			}
+			moreWork = moreWork || owner.due;
+		}
+
+		if (!moreWork) {
+			ev_idle_stop(bg->libev_loop, &idleWatcher);
+		}
+		if (owners.empty()) {
+			ev_timer_stop(bg->libev_loop, &pollTimer);
+			idleCond.notify_all();
+		}
+	}
+
+	void stopEverything() {
+		ev_idle_stop(bg->libev_loop, &idleWatcher);
+		ev_timer_stop(bg->libev_loop, &pollTimer);
+		while (!pidWatches.empty()) {
+			removePidWatch(pidWatches.begin()->second);
+		}
+	}
+
+	static void onIdle(EV_P_ ev_idle *watcher, int revents) {
+		static_cast<DetachedProcessReaper *>(watcher->data)->runDueChecks();
+	}
+
+	static void onPidfdReadable(EV_P_ ev_io *watcher, int revents) {
+		PidWatch *watch = static_cast<PidWatch *>(watcher->data);
+		DetachedProcessReaper *self = watch->self;
+		const void *owner = watch->owner;
+
+		self->removePidWatch(watch);
+		{
+			boost::lock_guard<boost::mutex> l(self->syncher);
+			OwnerMap::iterator it = self->owners.find(owner);
+			if (it == self->owners.end()) {
+				return;
+			}
+			it->second.due = true;
+		}
+		ev_idle_start(EV_A_ &self->idleWatcher);
+	}
+
+	static void onPollTimeout(EV_P_ ev_timer *timer, int revents) {
+		DetachedProcessReaper *self = static_cast<DetachedProcessReaper *>(timer->data);
+		boost::lock_guard<boost::mutex> l(self->syncher);
+		OwnerMap::iterator it, end = self->owners.end();
+
+		for (it = self->owners.begin(); it != end; it++) {
+			it->second.due = true;
+		}
+		if (!self->owners.empty()) {
+			ev_idle_start(EV_A_ &self->idleWatcher);
+		}
+	}
+
+public:
+	/**
+	 * @param pollInterval How often, in seconds, all owners are checked even
+	 *     if nothing happened. 0 means: 1 second if pidfds are supported,
+	 *     100 msec otherwise.
+	 */
+	DetachedProcessReaper(unsigned int _maxCleanupsPerCheck = DEFAULT_MAX_CLEANUPS_PER_CHECK,
+		ev_tstamp _pollInterval = 0)
+		: maxCleanupsPerCheck(_maxCleanupsPerCheck),
+		  pidfdsSupported(checkPidfdsSupported()),
+		  pollInterval(_pollInterval != 0
+			  ? _pollInterval
+			  : (pidfdsSupported ? 1 : 0.1)),
+		  bg(NULL)
+		{ }
+
+	~DetachedProcessReaper() {
+		if (bg != NULL) {
+			bg->safe->runSync(boost::bind(&DetachedProcessReaper::stopEverything, this));
+			bg->stop();
+			delete bg;
+		}
+	}
+
+	/**
+	 * Calls the given owner's check function as soon as possible, from the
+	 * event loop thread, registering the owner if it isn't already. Replaces
+	 * any check function that was previously registered for the owner. Does
+	 * not block, so it may be called while holding the Pool lock.
+	 */
+	void schedule(const void *owner, const CheckFunction &check) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		Owner &o = owners[owner];
+		o.check = check;
+		o.due = true;
+		if (bg == NULL) {
+			startEventLoop();
+		}
+		bg->safe->runLater(boost::bind(&DetachedProcessReaper::wakeup, this));
+	}
+
+	/**
+	 * Calls the owner's check function as soon as the given OS process exits.
+	 * Returns false if that can't be noticed on this system, in which case
+	 * the owner is only checked every `pollInterval` seconds.
+	 *
+	 * @pre The owner has been scheduled, and its check hasn't returned
+	 *      CHECK_DONE yet.
+	 */
+	bool watchPid(const void *owner, pid_t pid) {
+		if (!pidfdsSupported) {
+			return false;
+		}
+
+		// Open the pidfd right away, while the PID still refers to this
+		// process.
+		int fd = openPidfd(pid);
+		if (fd == -1) {
+			return false;
+		}
+
+		boost::lock_guard<boost::mutex> l(syncher);
+		bg->safe->runLater(boost::bind(&DetachedProcessReaper::addPidWatch,
+			this, owner, fd));
+		return true;
+	}
+
+	/**
+	 * Blocks until no owner is registered anymore. Must not be called while
+	 * holding the Pool lock, because the check functions need it.
+	 */
+	void waitUntilIdle() {
+		boost::unique_lock<boost::mutex> l(syncher);
+		while (!owners.empty()) {
+			idleCond.wait(l);
+		}
+	}
+
+	unsigned int getOwnerCount() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return owners.size();
+	}
+
+	bool usingPidfds() const {
+		return pidfdsSupported;
+	}
+};
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_DETACHED_PROCESS_REAPER_H_ */
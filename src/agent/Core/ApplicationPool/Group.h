@@ -48,6 +48,8 @@
 #include <MemoryKit/palloc.h>
 #include <Hooks.h>
 #include <Utils.h>
+#include <Algorithms/CoDel.h>
+#include <Algorithms/Histogram.h>
 #include <Core/ApplicationPool/Common.h>
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/BasicGroupInfo.h>
@@ -64,6 +66,8 @@ using namespace std;
 using namespace boost;
 using namespace oxt;
 
+struct GroupSnapshotConstants;
+
 
 /**
  * Except for otherwise documented parts, this class is not thread-safe,
@@ -77,6 +81,7 @@ public:
 	struct GetAction {
 		GetCallback callback;
 		SessionPtr session;
+		ExceptionPtr exception;
 	};
 
 	struct DisableWaiter {
@@ -125,8 +130,6 @@ public:
 	 * Read-only; only set during initialization.
 	 */
 	Pool *pool;
-	time_t lastRestartFileMtime;
-	time_t lastRestartFileCheckTime;
 
 	/** Number of times a restart has been initiated so far. This is incremented immediately
 	 * in Group::restart(), and is used to abort the restarter thread that was active at the
@@ -173,22 +176,54 @@ public:
 	 *    if m_restarting: processesBeingSpawned == 0
 	 */
 	bool m_restarting: 1;
-	bool alwaysRestartFileExists: 1;
 
 	/** Contains the spawn loop thread and the restarter thread. */
 	dynamic_thread_group interruptableThreads;
 
-	string restartFile;
-	string alwaysRestartFile;
+	/** Tells us when restart.txt or always_restart.txt changes. Created in
+	 * the constructor, unwatched in `shutdown()`.
+	 */
+	RestartFileWatchPtr restartFileWatch;
 	ProcessPtr nullProcess;
 
-	/** This timer scans `detachedProcesses` periodically to see
-	 * whether any of the Processes can be shut down.
+	/** Whether this Group is registered with the Context's
+	 * DetachedProcessReaper, which checks `detachedProcesses` to see
+	 * whether any of the Processes can be shut down or cleaned up.
 	 */
 	bool detachedProcessesCheckerActive;
-	boost::condition_variable detachedProcessesCheckerCond;
+	/** Whether the reaper hasn't checked this Group yet since it was
+	 * registered. Only used for running debugging hooks.
+	 */
+	bool detachedProcessesCheckerStarting;
+	/** Whether a Process may be waiting for its out-of-band work request to
+	 * be scheduled. Lets `onSessionClose()` skip `scheduleOobw()` if not.
+	 */
+	bool oobwBacklogged;
+	/** The process that is being replaced because of its memory usage, while
+	 * its replacement is being spawned. See Group/MemoryRecycling.cpp.
+	 */
+	ProcessPtr memoryRecyclingProcess;
+	/** `enabledCount` at the time that the replacement spawn was started. */
+	int memoryRecyclingEnabledCount;
+	/** Whether `memoryRecyclingProcess` is over the memory limit, in which
+	 * case it is replaced even if no replacement could be spawned.
+	 */
+	bool memoryRecyclingForced;
+	/** The earliest `options.deadline` of the requests in getWaitlist, or 0
+	 * if none of them has a deadline. May be earlier than the actual earliest
+	 * deadline, but never later.
+	 */
+	unsigned long long nextGetWaiterDeadline;
+	/** Decides when to shed requests from getWaitlist, based on
+	 * `options.requestQueueTargetDelay`.
+	 */
+	CoDel getWaitlistCoDel;
 	Callback shutdownCallback;
 	GroupPtr selfPointer;
+	/** Lazily created by `getSnapshotConstants()`. Reset whenever something
+	 * changes that it depends on, i.e. the options or the UUID.
+	 */
+	mutable boost::shared_ptr<const GroupSnapshotConstants> snapshotConstants;
 
 
 	/****** Initialization and shutdown ******/
@@ -234,17 +269,31 @@ public:
 	void enableAllDisablingProcesses(boost::container::vector<Callback> &postLockActions);
 
 	void startCheckingDetachedProcesses(bool immediately);
-	void detachedProcessesCheckerMain(GroupPtr self);
+	DetachedProcessReaper::CheckResult checkDetachedProcesses(GroupPtr self,
+		unsigned int maxCleanups);
 
 	/****** Out-of-band work ******/
 
 	bool oobwAllowed() const;
 	bool shouldInitiateOobw(Process *process) const;
+	int projectedSpareConcurrency(const Process *candidate) const;
 	void maybeInitiateOobw(Process *process);
+	void scheduleOobw();
 	void lockAndMaybeInitiateOobw(const ProcessPtr &process, DisableResult result, GroupPtr self);
 	void initiateOobw(const ProcessPtr &process);
-	void spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process);
-	void initiateNextOobwRequest();
+	void performOobwRequest(GroupPtr self, ProcessPtr process);
+
+	/****** Memory-based recycling ******/
+
+	Process *findProcessToRecycleForMemory(double memoryPressure, bool *overLimit,
+		size_t *growth) const;
+	void startMemoryRecycling(const ProcessPtr &process, bool overLimit,
+		boost::container::vector<Callback> &postLockActions);
+	void continueMemoryRecycling(boost::container::vector<Callback> &postLockActions);
+	void disableAndDetachForMemoryRecycling(const ProcessPtr &process,
+		boost::container::vector<Callback> &postLockActions);
+	void lockAndDetachAfterMemoryRecyclingDisable(const ProcessPtr &process,
+		DisableResult result, GroupPtr self);
 
 	/****** Internal utilities ******/
 
@@ -269,6 +318,9 @@ public:
 	Group *findOtherGroupWaitingForCapacity() const;
 	bool pushGetWaiter(const Options &newOptions, const GetCallback &callback,
 		boost::container::vector<Callback> &postLockActions);
+	ExceptionPtr checkGetWaiterDequeue(const GetWaiter &waiter, unsigned long long now);
+	void expireGetWaiters(unsigned long long now,
+		boost::container::vector<Callback> &postLockActions);
 	template<typename Lock> void assignSessionsToGetWaitersQuickly(Lock &lock);
 	void assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions);
 	bool testOverflowRequestQueue() const;
@@ -398,6 +450,12 @@ public:
 	 *       !enabledProcesses.empty() || m_spawning || restarting() || poolAtFullCapacity()
 	 */
 	deque<GetWaiter> getWaitlist;
+	/**
+	 * Time that requests spent in getWaitlist before they were assigned a
+	 * session or dropped, in microseconds. Only written while holding the
+	 * Pool lock.
+	 */
+	Histogram getWaitlistSojourns;
 	/**
 	 * Disable() commands that couldn't finish immediately will put their callbacks
 	 * in this queue. Note that there may be multiple DisableWaiters pointing to the
@@ -446,7 +504,7 @@ public:
 
 	void restart(const Options &options, RestartMethod method = RM_DEFAULT);
 	bool restarting() const;
-	bool needsRestart(const Options &options);
+	bool needsRestart();
 
 	SpawnResult spawn();
 	bool spawning() const;
@@ -472,11 +530,13 @@ public:
 	bool processLowerLimitsSatisfied() const;
 	bool processUpperLimitsReached() const;
 	bool allEnabledProcessesAreTotallyBusy() const;
+	bool hasFreeProcess() const;
 
 	unsigned int capacityUsed() const;
 	bool isWaitingForCapacity() const;
 	bool garbageCollectable(unsigned long long now = 0) const;
 
+	boost::shared_ptr<const GroupSnapshotConstants> getSnapshotConstants(bool cache = true) const;
 	void inspectXml(std::ostream &stream, bool includeSecrets = true) const;
 
 	/****** Out-of-band work ******/
@@ -115,9 +115,8 @@ Group::Group(Pool *_pool, const Options &_options)
 	m_spawning     = false;
 	m_restarting   = false;
 	lifeStatus.store(ALIVE, boost::memory_order_relaxed);
-	lastRestartFileMtime = 0;
-	lastRestartFileCheckTime = 0;
-	alwaysRestartFileExists = false;
+
+	string restartFile, alwaysRestartFile;
 	if (options.restartDir.empty()) {
 		restartFile = options.appRoot + "/tmp/restart.txt";
 		alwaysRestartFile = options.appRoot + "/tmp/always_restart.txt";
@@ -128,8 +127,15 @@ Group::Group(Pool *_pool, const Options &_options)
 		restartFile = options.appRoot + "/" + options.restartDir + "/restart.txt";
 		alwaysRestartFile = options.appRoot + "/" + options.restartDir + "/always_restart.txt";
 	}
+	restartFileWatch = getContext()->restartFileWatcher.watch(restartFile,
+		alwaysRestartFile, options.statThrottleRate);
 
 	detachedProcessesCheckerActive = false;
+	detachedProcessesCheckerStarting = false;
+	oobwBacklogged = false;
+	memoryRecyclingEnabledCount = 0;
+	memoryRecyclingForced = false;
+	nextGetWaiterDeadline = 0;
 }
 
 Group::~Group() {
@@ -177,6 +183,7 @@ Group::shutdown(const Callback &callback,
 	P_DEBUG("Begin shutting down group " << info.name);
 	shutdownCallback = callback;
 	detachAll(postLockActions);
+	getContext()->restartFileWatcher.unwatch(restartFileWatch);
 	startCheckingDetachedProcesses(true);
 	interruptableThreads.interrupt_all();
 	postLockActions.push_back(boost::bind(doCleanupSpawner, spawner));
@@ -77,6 +77,9 @@ Group::resetOptions(const Options &newOptions, Options *destination) {
 	destination->clearPerRequestFields();
 	destination->apiKey    = getApiKey().toStaticString();
 	destination->groupUuid = uuid;
+	if (destination == &this->options) {
+		snapshotConstants.reset();
+	}
 }
 
 /**
@@ -84,10 +87,22 @@ Group::resetOptions(const Options &newOptions, Options *destination) {
  */
 void
 Group::mergeOptions(const Options &other) {
+	if (options.maxRequests != other.maxRequests
+	 || options.minProcesses != other.minProcesses
+	 || options.statThrottleRate != other.statThrottleRate
+	 || options.maxPreloaderIdleTime != other.maxPreloaderIdleTime)
+	{
+		snapshotConstants.reset();
+		pool->invalidateSnapshot();
+	}
 	options.maxRequests      = other.maxRequests;
 	options.minProcesses     = other.minProcesses;
 	options.statThrottleRate = other.statThrottleRate;
 	options.maxPreloaderIdleTime = other.maxPreloaderIdleTime;
+	options.oobwMinSpareConcurrency = other.oobwMinSpareConcurrency;
+	options.memoryRecycleLimit = other.memoryRecycleLimit;
+	options.memoryRecyclePressureThreshold = other.memoryRecyclePressureThreshold;
+	options.requestQueueTargetDelay = other.requestQueueTargetDelay;
 }
 
 /* Given a hook name like "queue_full_error", we return HookScriptOptions filled in with this name and a spec
@@ -218,13 +233,35 @@ bool
 Group::pushGetWaiter(const Options &newOptions, const GetCallback &callback,
 	boost::container::vector<Callback> &postLockActions)
 {
+	unsigned long long now = newOptions.currentTime;
+	if (now == 0) {
+		now = SystemTime::getUsec();
+	}
+	// Make room for the new request by dropping the ones that nobody
+	// is waiting for anymore.
+	expireGetWaiters(now, postLockActions);
+
 	if (OXT_LIKELY(!testOverflowRequestQueue()
 		&& (newOptions.maxRequestQueueSize == 0
 		    || getWaitlist.size() < newOptions.maxRequestQueueSize)))
 	{
 		getWaitlist.push_back(GetWaiter(
 			newOptions.copyAndPersist().detachFromUnionStationTransaction(),
-			callback));
+			callback, now));
+		getContext()->getWaitlistDepths.record(getWaitlist.size());
+		if (newOptions.deadline != 0
+		 && (nextGetWaiterDeadline == 0 || newOptions.deadline < nextGetWaiterDeadline))
+		{
+			// Let the garbage collector expire this request in time if
+			// no process becomes available before its deadline. It only
+			// needs to be woken up if it's going to sleep past the deadline.
+			Pool *pool = getPool();
+			nextGetWaiterDeadline = newOptions.deadline;
+			if (pool->nextGcRunTime == 0 || newOptions.deadline < pool->nextGcRunTime) {
+				pool->nextGcRunTime = newOptions.deadline;
+				wakeUpGarbageCollector();
+			}
+		}
 		return true;
 	} else {
 		postLockActions.push_back(boost::bind(GetCallback::call,
@@ -240,6 +277,74 @@ Group::pushGetWaiter(const Options &newOptions, const GetCallback &callback,
 	}
 }
 
+/**
+ * Called when a session is about to be assigned to the given getWaitlist
+ * waiter. Records its sojourn time, and decides whether the waiter should be
+ * dropped instead, because it passed its deadline or because the queue is
+ * shedding load. Returns the exception to drop it with, or NULL.
+ */
+ExceptionPtr
+Group::checkGetWaiterDequeue(const GetWaiter &waiter, unsigned long long now) {
+	unsigned long long sojournTime = (now > waiter.enqueueTime)
+		? now - waiter.enqueueTime
+		: 0;
+	getWaitlistSojourns.record(sojournTime);
+
+	if (waiter.options.deadline != 0 && now >= waiter.options.deadline) {
+		getContext()->getWaitlistTimeouts.fetch_add(1, boost::memory_order_relaxed);
+		return boost::make_shared<RequestQueueTimeoutException>(
+			"Request queue timeout (waited " + toString(sojournTime / 1000) + " ms)");
+	}
+
+	if (options.requestQueueTargetDelay != 0) {
+		unsigned long long target = options.requestQueueTargetDelay * 1000ull;
+		if (getWaitlistCoDel.shouldDrop(sojournTime, now, target, 20 * target)) {
+			getContext()->getWaitlistSheds.fetch_add(1, boost::memory_order_relaxed);
+			return boost::make_shared<RequestQueueTimeoutException>(
+				"Request queue overloaded (waited " + toString(sojournTime / 1000) +
+				" ms; target delay: " + toString(options.requestQueueTargetDelay) +
+				" ms)");
+		}
+	}
+
+	return ExceptionPtr();
+}
+
+/**
+ * Drops all requests from getWaitlist that have passed their deadline.
+ * Only does any work if `nextGetWaiterDeadline` has passed.
+ */
+void
+Group::expireGetWaiters(unsigned long long now,
+	boost::container::vector<Callback> &postLockActions)
+{
+	if (nextGetWaiterDeadline == 0 || now < nextGetWaiterDeadline) {
+		return;
+	}
+
+	deque<GetWaiter>::iterator it = getWaitlist.begin();
+	nextGetWaiterDeadline = 0;
+	while (it != getWaitlist.end()) {
+		unsigned long long deadline = it->options.deadline;
+		if (deadline != 0 && now >= deadline) {
+			postLockActions.push_back(boost::bind(GetCallback::call,
+				it->callback, SessionPtr(), checkGetWaiterDequeue(*it, now)));
+			it = getWaitlist.erase(it);
+		} else {
+			if (deadline != 0
+			 && (nextGetWaiterDeadline == 0 || deadline < nextGetWaiterDeadline))
+			{
+				nextGetWaiterDeadline = deadline;
+			}
+			it++;
+		}
+	}
+
+	if (getWaitlist.empty()) {
+		getWaitlistCoDel.reset();
+	}
+}
+
 template<typename Lock>
 void
 Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
@@ -250,6 +355,7 @@ Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
 	}
 
 	SmallVector<GetAction, 8> actions;
+	unsigned long long now = SystemTime::getUsec();
 	unsigned int i = 0;
 	bool done = false;
 
@@ -261,7 +367,10 @@ Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
 		if (result.process != NULL) {
 			GetAction action;
 			action.callback = waiter.callback;
-			action.session  = newSession(result.process);
+			action.exception = checkGetWaiterDequeue(waiter, now);
+			if (action.exception == NULL) {
+				action.session = newSession(result.process, now);
+			}
 			getWaitlist.erase(getWaitlist.begin() + i);
 			actions.push_back(action);
 		} else {
@@ -272,16 +381,21 @@ Group::assignSessionsToGetWaitersQuickly(Lock &lock) {
 		}
 	}
 
+	if (getWaitlist.empty()) {
+		nextGetWaiterDeadline = 0;
+	}
+
 	verifyInvariants();
 	lock.unlock();
 	SmallVector<GetAction, 50>::const_iterator it, end = actions.end();
 	for (it = actions.begin(); it != end; it++) {
-		it->callback(it->session, ExceptionPtr());
+		it->callback(it->session, it->exception);
 	}
 }
 
 void
 Group::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockActions) {
+	unsigned long long now = getWaitlist.empty() ? 0 : SystemTime::getUsec();
 	unsigned int i = 0;
 	bool done = false;
 
@@ -289,11 +403,12 @@ Group::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockAc
 		const GetWaiter &waiter = getWaitlist[i];
 		RouteResult result = route(waiter.options);
 		if (result.process != NULL) {
+			ExceptionPtr e = checkGetWaiterDequeue(waiter, now);
 			postLockActions.push_back(boost::bind(
 				GetCallback::call,
 				waiter.callback,
-				newSession(result.process),
-				ExceptionPtr()));
+				(e == NULL) ? newSession(result.process, now) : SessionPtr(),
+				e));
 			getWaitlist.erase(getWaitlist.begin() + i);
 		} else {
 			done = result.finished;
@@ -302,6 +417,10 @@ Group::assignSessionsToGetWaiters(boost::container::vector<Callback> &postLockAc
 			}
 		}
 	}
+
+	if (getWaitlist.empty()) {
+		nextGetWaiterDeadline = 0;
+	}
 }
 
 bool
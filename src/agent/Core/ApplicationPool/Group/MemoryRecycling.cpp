@@ -0,0 +1,235 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Group.h>
+
+/*************************************************************************
+ *
+ * Memory-based recycling functions for ApplicationPool2::Group
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+/****************************
+ *
+ * Private methods
+ *
+ ****************************/
+
+
+/**
+ * Under memory pressure, a process is only considered to be leaking if it
+ * grew by at least this percentage since its first memory sample.
+ */
+#define MEMORY_RECYCLE_MIN_GROWTH_PERCENT 25
+
+/**
+ * Looks for an enabled process that should be replaced because of its memory
+ * usage. A process that exceeds `options.memoryRecycleLimit` takes precedence;
+ * if there are several, the largest one is returned and `*overLimit` is set to
+ * true. Otherwise, if `memoryPressure` reaches
+ * `options.memoryRecyclePressureThreshold`, the process that grew the most
+ * since its first memory sample is returned, and `*growth` is set to that
+ * growth in KB. Returns NULL if no process qualifies.
+ */
+Process *
+Group::findProcessToRecycleForMemory(double memoryPressure, bool *overLimit,
+	size_t *growth) const
+{
+	size_t limit = (size_t) options.memoryRecycleLimit * 1024;
+	bool underPressure = options.memoryRecyclePressureThreshold > 0
+		&& memoryPressure >= options.memoryRecyclePressureThreshold;
+	Process *largest = NULL, *fastestGrowing = NULL;
+	size_t largestUsage = 0, largestGrowth = 0;
+
+	*overLimit = false;
+	*growth = 0;
+	if (limit == 0 && !underPressure) {
+		return NULL;
+	}
+
+	foreach (const ProcessPtr &process, enabledProcesses) {
+		if (process->oobwStatus != Process::OOBW_NOT_ACTIVE
+		 || process->memoryRecycling
+		 || !process->metrics.isValid())
+		{
+			continue;
+		}
+
+		size_t usage = process->metrics.realMemory();
+		if (limit > 0 && usage > limit && usage > largestUsage) {
+			largest = process.get();
+			largestUsage = usage;
+		}
+		if (underPressure && process->memoryBaseline > 0
+		 && usage > process->memoryBaseline)
+		{
+			size_t processGrowth = usage - process->memoryBaseline;
+			if (processGrowth * 100 >= process->memoryBaseline * MEMORY_RECYCLE_MIN_GROWTH_PERCENT
+			 && processGrowth > largestGrowth)
+			{
+				fastestGrowing = process.get();
+				largestGrowth = processGrowth;
+			}
+		}
+	}
+
+	if (largest != NULL) {
+		*overLimit = true;
+		return largest;
+	} else {
+		*growth = largestGrowth;
+		return fastestGrowing;
+	}
+}
+
+/**
+ * Starts replacing the given process. If possible, a replacement process is
+ * spawned first so that the Group's capacity doesn't drop; the old process is
+ * then disabled and detached by `continueMemoryRecycling()` once the
+ * replacement is up. If spawning isn't allowed, a process that is over the
+ * memory limit is disabled and detached right away, while a process that is
+ * merely growing under memory pressure is left alone.
+ */
+void
+Group::startMemoryRecycling(const ProcessPtr &process, bool overLimit,
+	boost::container::vector<Callback> &postLockActions)
+{
+	assert(memoryRecyclingProcess == NULL);
+	assert(process->enabled == Process::ENABLED);
+
+	if (allowSpawn()) {
+		P_NOTICE("Process " << process->inspect() << " uses " <<
+			process->metrics.realMemory() / 1024 << " MB of memory (" <<
+			(overLimit ? "over the limit" : "growing under memory pressure") <<
+			"); spawning a replacement before shutting it down");
+		process->memoryRecycling = true;
+		memoryRecyclingProcess = process;
+		memoryRecyclingEnabledCount = enabledCount;
+		memoryRecyclingForced = overLimit;
+		getContext()->memoryRecycles.fetch_add(1, boost::memory_order_relaxed);
+		spawn();
+	} else if (overLimit) {
+		P_WARN("Process " << process->inspect() << " uses " <<
+			process->metrics.realMemory() / 1024 << " MB of memory, which is"
+			" over the limit, but no replacement can be spawned because of the"
+			" process limits; shutting it down anyway");
+		process->memoryRecycling = true;
+		getContext()->memoryRecycles.fetch_add(1, boost::memory_order_relaxed);
+		disableAndDetachForMemoryRecycling(process, postLockActions);
+	} else {
+		P_DEBUG("Not replacing process " << process->inspect() << " under memory"
+			" pressure because no replacement can be spawned");
+	}
+}
+
+/**
+ * Called on every analytics collection while `memoryRecyclingProcess` is set.
+ * Disables and detaches that process once its replacement has been spawned.
+ */
+void
+Group::continueMemoryRecycling(boost::container::vector<Callback> &postLockActions) {
+	ProcessPtr process = memoryRecyclingProcess;
+
+	if (!process->isAlive() || process->enabled != Process::ENABLED || restarting()) {
+		// Detached, disabled or restarted in the mean time.
+		memoryRecyclingProcess.reset();
+		process->memoryRecycling = false;
+		return;
+	}
+	if (spawning()) {
+		return;
+	}
+
+	memoryRecyclingProcess.reset();
+	if (enabledCount > memoryRecyclingEnabledCount || memoryRecyclingForced) {
+		disableAndDetachForMemoryRecycling(process, postLockActions);
+	} else {
+		P_WARN("No replacement could be spawned for process " << process->inspect() <<
+			"; not shutting it down");
+		process->memoryRecycling = false;
+	}
+}
+
+void
+Group::disableAndDetachForMemoryRecycling(const ProcessPtr &process,
+	boost::container::vector<Callback> &postLockActions)
+{
+	DisableResult result = disable(process,
+		boost::bind(&Group::lockAndDetachAfterMemoryRecyclingDisable, this,
+			_1, _2, shared_from_this()));
+	switch (result) {
+	case DR_SUCCESS:
+	case DR_NOOP:
+		getPool()->detachProcessUnlocked(process, postLockActions);
+		break;
+	case DR_DEFERRED:
+		break;
+	default:
+		P_WARN("Could not disable process " << process->inspect() <<
+			" in order to replace it");
+		process->memoryRecycling = false;
+		break;
+	}
+}
+
+// The 'self' parameter is for keeping the current Group object alive
+void
+Group::lockAndDetachAfterMemoryRecyclingDisable(const ProcessPtr &process,
+	DisableResult result, GroupPtr self)
+{
+	TRACE_POINT();
+	Pool *pool = getPool();
+	boost::container::vector<Callback> actions;
+
+	{
+		boost::unique_lock<boost::mutex> lock(pool->syncher);
+		if (OXT_UNLIKELY(!process->isAlive() || !isAlive())) {
+			return;
+		}
+
+		if (result == DR_SUCCESS && process->enabled == Process::DISABLED) {
+			pool->detachProcessUnlocked(process, actions);
+		} else {
+			// Like with out-of-band work, we do not touch a process that
+			// was re-enabled in the mean time.
+			P_DEBUG("Replacement of process " << process->inspect() << " aborted"
+				" because the process could not be disabled");
+			process->memoryRecycling = false;
+		}
+	}
+
+	runAllActions(actions);
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
@@ -23,6 +23,8 @@
  *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
  *  THE SOFTWARE.
  */
+#include <algorithm>
+#include <climits>
 #include <Core/ApplicationPool/Group.h>
 #include <MessageReadersWriters.h>
 
@@ -72,13 +74,83 @@ Group::shouldInitiateOobw(Process *process) const {
 		&& oobwAllowed();
 }
 
+/**
+ * Returns how many free session slots the enabled processes in this group,
+ * other than `candidate`, would have left after serving the requests on the
+ * getWaitlist. Returns INT_MAX if any of them has unlimited concurrency.
+ */
+int
+Group::projectedSpareConcurrency(const Process *candidate) const {
+	int spare = 0;
+	foreach (const ProcessPtr &process, enabledProcesses) {
+		if (process.get() == candidate) {
+			continue;
+		}
+		int concurrency = process->getConcurrency();
+		if (concurrency == 0) {
+			return INT_MAX;
+		}
+		spare += std::max(concurrency - process->sessions, 0);
+	}
+	return spare - (int) getWaitlist.size();
+}
+
 void
 Group::maybeInitiateOobw(Process *process) {
-	if (shouldInitiateOobw(process)) {
+	if (process->oobwStatus == Process::OOBW_REQUESTED || oobwBacklogged) {
+		scheduleOobw();
+	}
+}
+
+/**
+ * Initiates as many of the requested OOBW requests as allowed. Processes that
+ * haven't performed out-of-band work for the longest time go first. A request
+ * is held back if starting it would leave the rest of the group with less
+ * than `options.oobwMinSpareConcurrency` free session slots; it is considered
+ * again whenever a session in this group is closed.
+ */
+void
+Group::scheduleOobw() {
+	const ProcessList *lists[] = { &enabledProcesses, &disablingProcesses, &disabledProcesses };
+	int minSpare = (int) options.oobwMinSpareConcurrency;
+
+	oobwBacklogged = false;
+	while (oobwAllowed()) {
+		Process *best = NULL;
+		bool deferred = false;
+
+		for (unsigned int i = 0; i < sizeof(lists) / sizeof(lists[0]); i++) {
+			foreach (const ProcessPtr &process, *lists[i]) {
+				if (process->oobwStatus != Process::OOBW_REQUESTED || !process->isAlive()) {
+					continue;
+				}
+				if (projectedSpareConcurrency(process.get()) < minSpare) {
+					if (!process->oobwDeferred) {
+						P_DEBUG("Deferring out-of-band work for process " << process->inspect() <<
+							" because the group does not have enough spare concurrency");
+						process->oobwDeferred = true;
+						getContext()->oobwDeferrals.fetch_add(1, boost::memory_order_relaxed);
+					}
+					deferred = true;
+				} else if (best == NULL || process->lastOobwTime < best->lastOobwTime) {
+					best = process.get();
+				}
+			}
+		}
+
+		if (best == NULL) {
+			oobwBacklogged = deferred;
+			return;
+		}
+
 		// We keep an extra reference to prevent premature destruction.
-		ProcessPtr p = process->shared_from_this();
+		ProcessPtr p = best->shared_from_this();
 		initiateOobw(p);
 	}
+
+	// The limit on concurrent OOBW instances has been reached. There may
+	// still be processes waiting, so check again on the next session close.
+	oobwBacklogged = true;
 }
 
 // The 'self' parameter is for keeping the current Group object alive
@@ -128,6 +200,7 @@ Group::initiateOobw(const ProcessPtr &process) {
 	assert(process->oobwStatus == Process::OOBW_REQUESTED);
 
 	process->oobwStatus = Process::OOBW_IN_PROGRESS;
+	process->oobwDeferred = false;
 
 	if (process->enabled == Process::ENABLED
 	 || process->enabled == Process::DISABLING)
@@ -161,15 +234,21 @@ Group::initiateOobw(const ProcessPtr &process) {
 	assert(process->sessions == 0);
 
 	P_DEBUG("Initiating OOBW request for process " << process->inspect());
-	interruptableThreads.create_thread(
-		boost::bind(&Group::spawnThreadOOBWRequest, this, shared_from_this(), process),
-		"OOBW request thread for process " + process->inspect(),
-		POOL_HELPER_THREAD_STACK_SIZE);
+	if (!getContext()->oobwWorkerPool.submit(
+		boost::bind(&Group::performOobwRequest, this, shared_from_this(), process)))
+	{
+		// The pool is shutting down, so the process is about to be
+		// detached anyway.
+		P_DEBUG("Out-of-band work for process " << process->inspect() << " aborted "
+			"because the pool is shutting down");
+		process->oobwStatus = Process::OOBW_NOT_ACTIVE;
+	}
 }
 
-// The 'self' parameter is for keeping the current Group object alive while this thread is running.
+// Runs in the Context's OOBW worker pool.
+// The 'self' parameter is for keeping the current Group object alive while this job is running.
 void
-Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
+Group::performOobwRequest(GroupPtr self, ProcessPtr process) {
 	TRACE_POINT();
 	this_thread::disable_interruption di;
 	this_thread::disable_syscall_interruption dsi;
@@ -214,6 +293,7 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 
 	UPDATE_TRACE_POINT();
 	unsigned long long timeout = 1000 * 1000 * 60; // 1 min
+	unsigned long long startTime = SystemTime::getUsec();
 	try {
 		this_thread::restore_interruption ri(di);
 		this_thread::restore_syscall_interruption rsi(dsi);
@@ -249,6 +329,8 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 		// We do not care what the actual response is ... just wait for it.
 		UPDATE_TRACE_POINT();
 		waitUntilReadable(connection.fd, &timeout);
+		getContext()->oobwDurations.recordConcurrently(
+			SystemTime::getUsec() - startTime);
 	} catch (const SystemException &e) {
 		P_ERROR("*** ERROR: " << e.what() << "\n" << e.backtrace());
 	} catch (const TimeoutException &e) {
@@ -266,6 +348,8 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 		}
 
 		process->oobwStatus = Process::OOBW_NOT_ACTIVE;
+		process->lastOobwTime = SystemTime::getUsec();
+		process->oobwCount++;
 		if (process->enabled == Process::DISABLED) {
 			enable(process, actions);
 			assignSessionsToGetWaiters(actions);
@@ -273,7 +357,7 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 
 		pool->fullVerifyInvariants();
 
-		initiateNextOobwRequest();
+		scheduleOobw();
 	}
 	UPDATE_TRACE_POINT();
 	runAllActions(actions);
@@ -286,21 +370,6 @@ Group::spawnThreadOOBWRequest(GroupPtr self, ProcessPtr process) {
 	}
 }
 
-void
-Group::initiateNextOobwRequest() {
-	ProcessList::const_iterator it, end = enabledProcesses.end();
-	for (it = enabledProcesses.begin(); it != end; it++) {
-		const ProcessPtr &process = *it;
-		if (shouldInitiateOobw(process.get())) {
-			// We keep an extra reference to processes to prevent premature destruction.
-			ProcessPtr p = process;
-			initiateOobw(p);
-			return;
-		}
-	}
-}
-
-
 /****************************
  *
  * Public methods
@@ -316,6 +385,7 @@ Group::requestOOBW(const ProcessPtr &process) {
 	boost::unique_lock<boost::mutex> lock(pool->syncher);
 	if (isAlive() && process->isAlive() && process->oobwStatus == Process::OOBW_NOT_ACTIVE) {
 		process->oobwStatus = Process::OOBW_REQUESTED;
+		oobwBacklogged = true;
 	}
 }
 
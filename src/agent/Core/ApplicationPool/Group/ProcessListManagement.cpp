@@ -163,6 +163,7 @@ Group::addProcessToList(const ProcessPtr &process, ProcessList &destination) {
 	} else {
 		P_BUG("Unknown destination list");
 	}
+	getPool()->invalidateSnapshot();
 }
 
 /**
@@ -216,6 +217,8 @@ Group::removeProcessFromList(const ProcessPtr &process, ProcessList &source) {
 		}
 		enabledProcessBusynessLevels.shrink_to_fit();
 	}
+
+	getPool()->invalidateSnapshot();
 }
 
 void
@@ -271,119 +274,134 @@ Group::enableAllDisablingProcesses(boost::container::vector<Callback> &postLockA
 }
 
 /**
- * The `immediately` parameter only has effect if the detached processes checker
- * thread is active. It means that, if the thread is currently sleeping, it should
- * wake up immediately and perform work.
+ * Registers this Group with the DetachedProcessReaper, if it isn't already.
+ * The `immediately` parameter only has effect if the Group is already
+ * registered. It means that the detached processes should be checked again
+ * right away, e.g. because one of them has no more sessions.
  */
 void
 Group::startCheckingDetachedProcesses(bool immediately) {
 	if (!detachedProcessesCheckerActive) {
 		P_DEBUG("Starting detached processes checker");
-		getPool()->nonInterruptableThreads.create_thread(
-			boost::bind(&Group::detachedProcessesCheckerMain, this, shared_from_this()),
-			"Detached processes checker: " + getName(),
-			POOL_HELPER_THREAD_STACK_SIZE
-		);
 		detachedProcessesCheckerActive = true;
-	} else if (detachedProcessesCheckerActive && immediately) {
-		detachedProcessesCheckerCond.notify_all();
+		detachedProcessesCheckerStarting = true;
+	} else if (!immediately) {
+		return;
 	}
+	getContext()->detachedProcessReaper.schedule(this,
+		boost::bind(&Group::checkDetachedProcesses, this, shared_from_this(), _1));
 }
 
-void
-Group::detachedProcessesCheckerMain(GroupPtr self) {
+/**
+ * Called by the DetachedProcessReaper, from its event loop thread. Triggers
+ * the shutdown of detached processes that have no sessions anymore, and
+ * cleans up at most `maxCleanups` processes that have exited.
+ */
+DetachedProcessReaper::CheckResult
+Group::checkDetachedProcesses(GroupPtr self, unsigned int maxCleanups) {
 	TRACE_POINT();
 	Pool *pool = getPool();
-
-	Pool::DebugSupportPtr debug = pool->debugSupport;
-	if (debug != NULL && debug->detachedProcessesChecker) {
-		debug->debugger->send("About to start detached processes checker");
-		debug->messages->recv("Proceed with starting detached processes checker");
-	}
+	DetachedProcessReaper &reaper = getContext()->detachedProcessReaper;
+	unsigned int cleanups = 0;
 
 	boost::unique_lock<boost::mutex> lock(pool->syncher);
-	while (true) {
-		assert(detachedProcessesCheckerActive);
-
-		if (getLifeStatus() == SHUT_DOWN || this_thread::interruption_requested()) {
-			UPDATE_TRACE_POINT();
-			P_DEBUG("Stopping detached processes checker");
-			detachedProcessesCheckerActive = false;
-			break;
+	if (detachedProcessesCheckerStarting) {
+		Pool::DebugSupportPtr debug = pool->debugSupport;
+		detachedProcessesCheckerStarting = false;
+		if (debug != NULL && debug->detachedProcessesChecker) {
+			lock.unlock();
+			debug->debugger->send("About to start detached processes checker");
+			debug->messages->recv("Proceed with starting detached processes checker");
+			lock.lock();
 		}
+	}
+
+	if (!detachedProcessesCheckerActive) {
+		// Already finished by an earlier check.
+		return DetachedProcessReaper::CHECK_DONE;
+	}
 
+	if (getLifeStatus() == SHUT_DOWN) {
 		UPDATE_TRACE_POINT();
-		if (!detachedProcesses.empty()) {
-			P_TRACE(2, "Checking whether any of the " << detachedProcesses.size() <<
-				" detached processes have exited...");
-			ProcessList::iterator it, end = detachedProcesses.end();
-			ProcessList processesToRemove;
-
-			for (it = detachedProcesses.begin(); it != end; it++) {
-				const ProcessPtr process = *it;
-				switch (process->getLifeStatus()) {
-				case Process::ALIVE:
-					if (process->canTriggerShutdown()) {
-						P_DEBUG("Detached process " << process->inspect() <<
-							" has 0 active sessions now. Triggering shutdown.");
-						process->triggerShutdown();
-						assert(process->getLifeStatus() == Process::SHUTDOWN_TRIGGERED);
-					}
-					break;
-				case Process::SHUTDOWN_TRIGGERED:
-					if (process->canCleanup()) {
-						P_DEBUG("Detached process " << process->inspect() << " has shut down. Cleaning up associated resources.");
-						process->cleanup();
-						assert(process->getLifeStatus() == Process::DEAD);
-						processesToRemove.push_back(process);
-					} else if (process->shutdownTimeoutExpired()) {
-						P_WARN("Detached process " << process->inspect() <<
-							" didn't shut down within " PROCESS_SHUTDOWN_TIMEOUT_DISPLAY
-							". Forcefully killing it with SIGKILL.");
-						kill(process->getPid(), SIGKILL);
+		P_DEBUG("Stopping detached processes checker");
+		detachedProcessesCheckerActive = false;
+		return DetachedProcessReaper::CHECK_DONE;
+	}
+
+	UPDATE_TRACE_POINT();
+	if (!detachedProcesses.empty()) {
+		P_TRACE(2, "Checking whether any of the " << detachedProcesses.size() <<
+			" detached processes have exited...");
+		ProcessList::iterator it, end = detachedProcesses.end();
+		ProcessList processesToRemove;
+
+		for (it = detachedProcesses.begin(); it != end && cleanups < maxCleanups; it++) {
+			const ProcessPtr process = *it;
+			switch (process->getLifeStatus()) {
+			case Process::ALIVE:
+				if (process->canTriggerShutdown()) {
+					P_DEBUG("Detached process " << process->inspect() <<
+						" has 0 active sessions now. Triggering shutdown.");
+					process->triggerShutdown();
+					assert(process->getLifeStatus() == Process::SHUTDOWN_TRIGGERED);
+					if (!process->isDummy()) {
+						reaper.watchPid(this, process->getPid());
 					}
-					break;
-				default:
-					P_BUG("Unknown 'lifeStatus' state " << (int) process->getLifeStatus());
 				}
-			}
-
-			UPDATE_TRACE_POINT();
-			end = processesToRemove.end();
-			for (it = processesToRemove.begin(); it != end; it++) {
-				removeProcessFromList(*it, detachedProcesses);
+				break;
+			case Process::SHUTDOWN_TRIGGERED:
+				if (process->canCleanup()) {
+					P_DEBUG("Detached process " << process->inspect() << " has shut down. Cleaning up associated resources.");
+					process->cleanup();
+					assert(process->getLifeStatus() == Process::DEAD);
+					processesToRemove.push_back(process);
+					cleanups++;
+				} else if (process->shutdownTimeoutExpired()) {
+					P_WARN("Detached process " << process->inspect() <<
+						" didn't shut down within " PROCESS_SHUTDOWN_TIMEOUT_DISPLAY
+						". Forcefully killing it with SIGKILL.");
+					kill(process->getPid(), SIGKILL);
+				}
+				break;
+			default:
+				P_BUG("Unknown 'lifeStatus' state " << (int) process->getLifeStatus());
 			}
 		}
 
 		UPDATE_TRACE_POINT();
-		if (detachedProcesses.empty()) {
-			UPDATE_TRACE_POINT();
-			P_DEBUG("Stopping detached processes checker");
-			detachedProcessesCheckerActive = false;
+		end = processesToRemove.end();
+		for (it = processesToRemove.begin(); it != end; it++) {
+			removeProcessFromList(*it, detachedProcesses);
+		}
+	}
 
-			boost::container::vector<Callback> actions;
-			if (shutdownCanFinish()) {
-				UPDATE_TRACE_POINT();
-				finishShutdown(actions);
-			}
+	UPDATE_TRACE_POINT();
+	if (detachedProcesses.empty()) {
+		UPDATE_TRACE_POINT();
+		P_DEBUG("Stopping detached processes checker");
+		detachedProcessesCheckerActive = false;
 
-			verifyInvariants();
-			verifyExpensiveInvariants();
-			lock.unlock();
-			UPDATE_TRACE_POINT();
-			runAllActions(actions);
-			break;
-		} else {
+		boost::container::vector<Callback> actions;
+		if (shutdownCanFinish()) {
 			UPDATE_TRACE_POINT();
-			verifyInvariants();
-			verifyExpensiveInvariants();
+			finishShutdown(actions);
 		}
 
-		// Not all processes can be shut down yet. Sleep for a while unless
-		// someone wakes us up.
+		verifyInvariants();
+		verifyExpensiveInvariants();
+		lock.unlock();
+		UPDATE_TRACE_POINT();
+		runAllActions(actions);
+		return DetachedProcessReaper::CHECK_DONE;
+	} else {
 		UPDATE_TRACE_POINT();
-		detachedProcessesCheckerCond.timed_wait(lock,
-			posix_time::milliseconds(100));
+		verifyInvariants();
+		verifyExpensiveInvariants();
+		if (cleanups == maxCleanups) {
+			return DetachedProcessReaper::CHECK_AGAIN;
+		} else {
+			return DetachedProcessReaper::CHECK_WAITING;
+		}
 	}
 }
 
@@ -498,6 +516,10 @@ Group::detach(const ProcessPtr &process, boost::container::vector<Callback> &pos
 
 	addProcessToList(process, detachedProcesses);
 	startCheckingDetachedProcesses(false);
+	if (memoryRecyclingProcess == process) {
+		memoryRecyclingProcess.reset();
+	}
+	process->memoryRecycling = false;
 
 	postLockActions.push_back(boost::bind(&Group::runDetachHooks, this, process));
 }
@@ -513,12 +535,15 @@ Group::detachAll(boost::container::vector<Callback> &postLockActions) {
 
 	foreach (ProcessPtr process, enabledProcesses) {
 		addProcessToList(process, detachedProcesses);
+		process->memoryRecycling = false;
 	}
 	foreach (ProcessPtr process, disablingProcesses) {
 		addProcessToList(process, detachedProcesses);
+		process->memoryRecycling = false;
 	}
 	foreach (ProcessPtr process, disabledProcesses) {
 		addProcessToList(process, detachedProcesses);
+		process->memoryRecycling = false;
 	}
 
 	enabledProcesses.clear();
@@ -529,6 +554,7 @@ Group::detachAll(boost::container::vector<Callback> &postLockActions) {
 	disablingCount = 0;
 	disabledCount = 0;
 	nEnabledProcessesTotallyBusy = 0;
+	memoryRecyclingProcess.reset();
 	clearDisableWaitlist(DR_NOOP, postLockActions);
 	startCheckingDetachedProcesses(false);
 }
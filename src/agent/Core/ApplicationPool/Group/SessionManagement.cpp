@@ -171,6 +171,11 @@ Group::onSessionClose(Process *process, Session *session) {
 	 */
 	assert(!process->isTotallyBusy());
 
+	if (process->enabled == Process::DETACHED && process->sessions == 0) {
+		// Let the detached process be shut down right away.
+		startCheckingDetachedProcesses(true);
+	}
+
 	bool detachingBecauseOfMaxRequests = false;
 	bool detachingBecauseCapacityNeeded = false;
 	bool shouldDetach =
@@ -259,7 +264,7 @@ Group::get(const Options &newOptions, const GetCallback &callback,
 	assert(isAlive());
 
 	if (OXT_LIKELY(!restarting())) {
-		if (OXT_UNLIKELY(needsRestart(newOptions))) {
+		if (OXT_UNLIKELY(needsRestart())) {
 			restart(newOptions);
 		} else {
 			mergeOptions(newOptions);
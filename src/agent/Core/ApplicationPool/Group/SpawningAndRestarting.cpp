@@ -91,6 +91,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 
 		ProcessPtr process;
 		ExceptionPtr exception;
+		unsigned long long spawnBeginTime = SystemTime::getUsec();
 		try {
 			UPDATE_TRACE_POINT();
 			this_thread::restore_interruption ri(di);
@@ -102,10 +103,13 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 			} else {
 				process = createProcessObject(spawner->spawn(options));
 			}
+			getContext()->spawnDurations.recordConcurrently(
+				SystemTime::getUsec() - spawnBeginTime);
 		} catch (const thread_interrupted &) {
 			break;
 		} catch (const tracable_exception &e) {
 			exception = copyException(e);
+			getContext()->spawnFailures.fetch_add(1, boost::memory_order_relaxed);
 			// Let other (unexpected) exceptions crash the program so
 			// gdb can generate a backtrace.
 		}
@@ -174,6 +178,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 				enableAllDisablingProcesses(actions);
 			}
 			Pool::assignExceptionToGetWaiters(getWaitlist, exception, actions);
+			nextGetWaiterDeadline = 0;
 			pool->assignSessionsToGetWaiters(actions);
 			done = true;
 		}
@@ -184,6 +189,7 @@ Group::spawnThreadRealMain(const SpawningKit::SpawnerPtr &spawner,
 			|| pool->atFullCapacityUnlocked();
 		m_spawning = !done;
 		if (done) {
+			pool->invalidateSnapshot();
 			P_DEBUG("Spawn loop done");
 		} else {
 			processesBeingSpawned++;
@@ -264,6 +270,7 @@ Group::finalizeRestart(GroupPtr self,
 	spawner    = newSpawner;
 
 	m_restarting = false;
+	pool->invalidateSnapshot();
 	if (shouldSpawn()) {
 		spawn();
 	} else if (isWaitingForCapacity()) {
@@ -310,6 +317,8 @@ Group::restart(const Options &options, RestartMethod method) {
 	m_spawning   = false;
 	m_restarting = true;
 	uuid         = generateUuid(pool);
+	snapshotConstants.reset();
+	pool->invalidateSnapshot();
 	detachAll(actions);
 	getPool()->interruptableThreads.create_thread(
 		boost::bind(&Group::finalizeRestart, this, shared_from_this(),
@@ -327,83 +336,19 @@ Group::restarting() const {
 	return m_restarting;
 }
 
+/**
+ * Returns whether restart.txt has been touched since the last time this
+ * method returned true, or whether always_restart.txt exists. Both files
+ * are watched by the Context's RestartFileWatcher, so this method doesn't
+ * perform any I/O.
+ */
 bool
-Group::needsRestart(const Options &options) {
+Group::needsRestart() {
 	if (m_restarting) {
 		return false;
 	} else {
-		time_t now;
-		struct stat buf;
-
-		if (options.currentTime != 0) {
-			now = options.currentTime / 1000000;
-		} else {
-			now = SystemTime::get();
-		}
-
-		if (lastRestartFileCheckTime == 0) {
-			// First time we call needsRestart() for this group.
-			if (syscalls::stat(restartFile.c_str(), &buf) == 0) {
-				lastRestartFileMtime = buf.st_mtime;
-			} else {
-				lastRestartFileMtime = 0;
-			}
-			lastRestartFileCheckTime = now;
-			return false;
-
-		} else if (lastRestartFileCheckTime <= now - (time_t) options.statThrottleRate) {
-			// Not first time we call needsRestart() for this group.
-			// Stat throttle time has passed.
-			bool restart;
-
-			lastRestartFileCheckTime = now;
-
-			if (lastRestartFileMtime > 0) {
-				// restart.txt existed before
-				if (syscalls::stat(restartFile.c_str(), &buf) == -1) {
-					// restart.txt no longer exists
-					lastRestartFileMtime = buf.st_mtime;
-					restart = false;
-				} else if (buf.st_mtime != lastRestartFileMtime) {
-					// restart.txt's mtime has changed
-					lastRestartFileMtime = buf.st_mtime;
-					restart = true;
-				} else {
-					restart = false;
-				}
-			} else {
-				// restart.txt didn't exist before
-				if (syscalls::stat(restartFile.c_str(), &buf) == 0) {
-					// restart.txt now exists
-					lastRestartFileMtime = buf.st_mtime;
-					restart = true;
-				} else {
-					// restart.txt still doesn't exist
-					lastRestartFileMtime = 0;
-					restart = false;
-				}
-			}
-
-			if (!restart) {
-				alwaysRestartFileExists = restart =
-					syscalls::stat(alwaysRestartFile.c_str(), &buf) == 0;
-			}
-
-			return restart;
-
-		} else {
-			// Not first time we call needsRestart() for this group.
-			// Still within stat throttling window.
-			if (alwaysRestartFileExists) {
-				// always_restart.txt existed before
-				alwaysRestartFileExists = syscalls::stat(
-					alwaysRestartFile.c_str(), &buf) == 0;
-				return alwaysRestartFileExists;
-			} else {
-				// Don't check until stat throttling window is over
-				return false;
-			}
-		}
+		return restartFileWatch->consumeRestartRequest()
+			|| restartFileWatch->alwaysRestart();
 	}
 }
 
@@ -435,6 +380,7 @@ Group::spawn() {
 			POOL_HELPER_THREAD_STACK_SIZE);
 		m_spawning = true;
 		processesBeingSpawned++;
+		pool->invalidateSnapshot();
 		return SR_OK;
 	}
 }
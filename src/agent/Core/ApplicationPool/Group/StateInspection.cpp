@@ -24,6 +24,7 @@
  *  THE SOFTWARE.
  */
 #include <Core/ApplicationPool/Group.h>
+#include <Core/ApplicationPool/Snapshot.h>
 
 /*************************************************************************
  *
@@ -80,6 +81,17 @@ Group::allEnabledProcessesAreTotallyBusy() const {
 	return nEnabledProcessesTotallyBusy == enabledCount;
 }
 
+/**
+ * Returns whether a new request can be routed to one of the enabled processes
+ * right away, i.e. without being put on the get wait list.
+ */
+bool
+Group::hasFreeProcess() const {
+	return isAlive()
+		&& nEnabledProcessesTotallyBusy < enabledCount
+		&& getWaitlist.empty();
+}
+
 /**
  * Returns the number of processes in this group that should be part of the
  * ApplicationPool process limits calculations.
@@ -115,84 +127,46 @@ Group::garbageCollectable(unsigned long long now) const {
 	return false;
 }
 
-void
-Group::inspectXml(std::ostream &stream, bool includeSecrets) const {
-	ProcessList::const_iterator it;
-
-	stream << "<name>" << escapeForXml(info.name) << "</name>";
-	stream << "<component_name>" << escapeForXml(info.name) << "</component_name>";
-	stream << "<app_root>" << escapeForXml(options.appRoot) << "</app_root>";
-	stream << "<app_type>" << escapeForXml(options.appType) << "</app_type>";
-	stream << "<environment>" << escapeForXml(options.environment) << "</environment>";
-	stream << "<uuid>" << toString(uuid) << "</uuid>";
-	stream << "<enabled_process_count>" << enabledCount << "</enabled_process_count>";
-	stream << "<disabling_process_count>" << disablingCount << "</disabling_process_count>";
-	stream << "<disabled_process_count>" << disabledCount << "</disabled_process_count>";
-	stream << "<capacity_used>" << capacityUsed() << "</capacity_used>";
-	stream << "<get_wait_list_size>" << getWaitlist.size() << "</get_wait_list_size>";
-	stream << "<disable_wait_list_size>" << disableWaitlist.size() << "</disable_wait_list_size>";
-	stream << "<processes_being_spawned>" << processesBeingSpawned << "</processes_being_spawned>";
-	if (m_spawning) {
-		stream << "<spawning/>";
-	}
-	if (restarting()) {
-		stream << "<restarting/>";
-	}
-	if (includeSecrets) {
-		stream << "<secret>" << escapeForXml(getApiKey().toStaticString()) << "</secret>";
-		stream << "<api_key>" << escapeForXml(getApiKey().toStaticString()) << "</api_key>";
-	}
-	LifeStatus lifeStatus = (LifeStatus) this->lifeStatus.load(boost::memory_order_relaxed);
-	switch (lifeStatus) {
-	case ALIVE:
-		stream << "<life_status>ALIVE</life_status>";
-		break;
-	case SHUTTING_DOWN:
-		stream << "<life_status>SHUTTING_DOWN</life_status>";
-		break;
-	case SHUT_DOWN:
-		stream << "<life_status>SHUT_DOWN</life_status>";
-		break;
-	default:
-		P_BUG("Unknown 'lifeStatus' state " << lifeStatus);
+/**
+ * Returns the parts of a GroupSnapshot that only change when the options change.
+ * The result is cached until then, unless `cache` is false (e.g. because we
+ * don't hold the pool lock).
+ */
+boost::shared_ptr<const GroupSnapshotConstants>
+Group::getSnapshotConstants(bool cache) const {
+	if (snapshotConstants != NULL) {
+		return snapshotConstants;
 	}
 
-	SpawningKit::UserSwitchingInfo usInfo(SpawningKit::prepareUserSwitching(options));
-	stream << "<user>" << escapeForXml(usInfo.username) << "</user>";
-	stream << "<uid>" << usInfo.uid << "</uid>";
-	stream << "<group>" << escapeForXml(usInfo.groupname) << "</group>";
-	stream << "<gid>" << usInfo.gid << "</gid>";
+	boost::shared_ptr<GroupSnapshotConstants> constants =
+		boost::make_shared<GroupSnapshotConstants>();
+	constants->name = info.name;
+	constants->appRoot = options.appRoot.toString();
+	constants->appType = options.appType.toString();
+	constants->environment = options.environment.toString();
+	constants->uuid = uuid;
+	constants->apiKey = getApiKey();
 
-	stream << "<options>";
-	options.toXml(stream, getResourceLocator());
-	stream << "</options>";
+	SpawningKit::UserSwitchingInfo usInfo(SpawningKit::prepareUserSwitching(options));
+	constants->user = usInfo.username;
+	constants->uid = usInfo.uid;
+	constants->group = usInfo.groupname;
+	constants->gid = usInfo.gid;
 
-	stream << "<processes>";
+	stringstream optionsXml;
+	options.toXml(optionsXml, getResourceLocator());
+	constants->optionsXml = optionsXml.str();
 
-	for (it = enabledProcesses.begin(); it != enabledProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-	for (it = disablingProcesses.begin(); it != disablingProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-	for (it = disabledProcesses.begin(); it != disabledProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
+	if (cache) {
+		snapshotConstants = constants;
 	}
-	for (it = detachedProcesses.begin(); it != detachedProcesses.end(); it++) {
-		stream << "<process>";
-		(*it)->inspectXml(stream, includeSecrets);
-		stream << "</process>";
-	}
-
-	stream << "</processes>";
+	return constants;
 }
 
+void
+Group::inspectXml(std::ostream &stream, bool includeSecrets) const {
+	GroupSnapshot(*this, getSnapshotConstants()).toXml(stream, includeSecrets);
+}
 
 } // namespace ApplicationPool2
 } // namespace Passenger
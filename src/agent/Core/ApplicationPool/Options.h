@@ -355,12 +355,62 @@ public:
 	 */
 	unsigned int maxOutOfBandWorkInstances;
 
+	/**
+	 * An out-of-band work request is only started if the other enabled
+	 * processes in the group would have at least this many free session
+	 * slots left, after subtracting the requests that are waiting in the
+	 * group's queue. Processes with unlimited concurrency always count
+	 * as having enough free slots.
+	 */
+	unsigned int oobwMinSpareConcurrency;
+
+	/**
+	 * Processes whose memory usage (see `ProcessMetrics::realMemory()`)
+	 * exceeds this many MB are gracefully replaced by new processes.
+	 * A value of 0 means no limit.
+	 */
+	unsigned int memoryRecycleLimit;
+
+	/**
+	 * When the system's memory pressure (the percentage of time in which
+	 * some tasks were stalled on memory, over the past 10 seconds) reaches
+	 * this value, the process in this group that grew the most since it was
+	 * spawned is gracefully replaced by a new process. A value of 0 disables
+	 * this.
+	 */
+	unsigned int memoryRecyclePressureThreshold;
+
 	/**
 	 * The maximum number of requests that may live in the Group.getWaitlist queue.
 	 * A value of 0 means unlimited.
 	 */
 	unsigned int maxRequestQueueSize;
 
+	/**
+	 * The maximum amount of time, in milliseconds, that a request may wait in
+	 * the Group.getWaitlist queue. The Controller turns this into `deadline`.
+	 * A value of 0 means unlimited.
+	 */
+	unsigned int requestQueueTimeout;
+
+	/**
+	 * The CoDel target delay for the Group.getWaitlist queue, in milliseconds.
+	 * If requests keep waiting longer than this for 20 times as long, the
+	 * Group starts shedding queued requests until the queueing delay drops
+	 * again. See Algorithms/CoDel.h. A value of 0 disables load shedding.
+	 */
+	unsigned int requestQueueTargetDelay;
+
+	/**
+	 * Enables adaptive request body buffering when nonzero. Content-Length
+	 * request bodies are then buffered while the Controller measures the
+	 * client's upload rate. If it reaches this many KB per second while the
+	 * Group has a free process, the session is checked out right away and
+	 * the body is streamed to the app; otherwise the body is buffered until
+	 * it is complete. A value of 0 disables adaptive buffering.
+	 */
+	unsigned int uploadStreamingThreshold;
+
 	/**
 	 * Whether websocket connections should be aborted on process shutdown
 	 * or restart.
@@ -430,6 +480,12 @@ public:
 	 */
 	unsigned long long currentTime;
 
+	/** The time (in microseconds, like `currentTime`) after which this request
+	 * is dropped from the Group.getWaitlist queue with a
+	 * RequestQueueTimeoutException. 0 means no deadline.
+	 */
+	unsigned long long deadline;
+
 	/** When true, Pool::get() and Pool::asyncGet() will create the necessary
 	 * Group structure just as normally, and will even handle
 	 * restarting logic, but will not actually spawn any processes and will not
@@ -490,13 +546,20 @@ public:
 		  maxProcesses(0),
 		  maxPreloaderIdleTime(-1),
 		  maxOutOfBandWorkInstances(1),
+		  oobwMinSpareConcurrency(DEFAULT_OOBW_MIN_SPARE_CONCURRENCY),
+		  memoryRecycleLimit(0),
+		  memoryRecyclePressureThreshold(0),
 		  maxRequestQueueSize(100),
+		  requestQueueTimeout(0),
+		  requestQueueTargetDelay(0),
+		  uploadStreamingThreshold(0),
 		  abortWebsocketsOnProcessShutdown(true),
 
 		  stickySessionId(0),
 		  statThrottleRate(DEFAULT_STAT_THROTTLE_RATE),
 		  maxRequests(0),
 		  currentTime(0),
+		  deadline(0),
 		  noop(false)
 		  /*********************************/
 	{
@@ -568,6 +631,7 @@ public:
 		uri      = StaticString();
 		stickySessionId = 0;
 		currentTime     = 0;
+		deadline        = 0;
 		noop     = false;
 		return detachFromUnionStationTransaction();
 	}
@@ -629,6 +693,10 @@ public:
 			appendKeyValue3(vec, "max_processes",       maxProcesses);
 			appendKeyValue2(vec, "max_preloader_idle_time", maxPreloaderIdleTime);
 			appendKeyValue3(vec, "max_out_of_band_work_instances", maxOutOfBandWorkInstances);
+			appendKeyValue3(vec, "oobw_min_spare_concurrency", oobwMinSpareConcurrency);
+			appendKeyValue3(vec, "memory_recycle_limit", memoryRecycleLimit);
+			appendKeyValue3(vec, "memory_recycle_pressure_threshold", memoryRecyclePressureThreshold);
+			appendKeyValue3(vec, "request_queue_target_delay", requestQueueTargetDelay);
 		}
 		if ((fields & SPAWN_OPTIONS) || (fields & PER_GROUP_POOL_OPTIONS)) {
 			appendKeyValue (vec, "union_station_key",   unionStationKey);
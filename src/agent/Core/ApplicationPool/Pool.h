@@ -65,6 +65,7 @@
 #include <Core/ApplicationPool/Group.h>
 #include <Core/ApplicationPool/Session.h>
 #include <Core/ApplicationPool/Options.h>
+#include <Core/ApplicationPool/Snapshot.h>
 #include <Core/SpawningKit/Factory.h>
 #include <Shared/ApplicationPoolApiKey.h>
 
@@ -227,6 +228,24 @@ public:
 
 	const VariantMap *agentsOptions;
 
+	/**
+	 * The most recently created state snapshot, served by `getSnapshot()`.
+	 * Protected by `snapshotSyncher`, which must be locked before `syncher`
+	 * if both are needed. State inspection only needs `syncher` while
+	 * (re)creating a snapshot.
+	 */
+	mutable boost::mutex snapshotSyncher;
+	mutable PoolSnapshotPtr lastSnapshot;
+	/**
+	 * Incremented whenever the set of groups or processes changes, or when
+	 * a group starts or stops spawning or restarting. A snapshot with an
+	 * older generation is never served. Changes to counters only (sessions,
+	 * wait list sizes, etc) do not increment this; those are allowed to be
+	 * at most `snapshotMaxAge` microseconds old.
+	 */
+	boost::atomic<unsigned int> snapshotGeneration;
+	unsigned long long snapshotMaxAge;
+
 // Actually private, but marked public so that unit tests can access the fields.
 public:
 	/****** Debugging support *******/
@@ -290,6 +309,12 @@ public:
 	void realCollectAnalytics();
 
 
+	/****** Memory-based recycling ******/
+
+	void recycleProcessesUsingTooMuchMemory(double memoryPressure,
+		boost::container::vector<Callback> &postLockActions);
+
+
 	/****** Garbage collection ******/
 
 	struct GarbageCollectorState {
@@ -299,6 +324,11 @@ public:
 	};
 
 	boost::condition_variable garbageCollectionCond;
+	/** When the garbage collector is going to wake up next, in microseconds.
+	 * May be lowered by others (followed by a `garbageCollectionCond`
+	 * notification) to make it run earlier.
+	 */
+	unsigned long long nextGcRunTime;
 
 	void initializeGarbageCollection();
 	static void garbageCollect(PoolPtr self);
@@ -308,6 +338,7 @@ public:
 	void garbageCollectProcessesInGroup(GarbageCollectorState &state,
 		const GroupPtr &group);
 	void maybeCleanPreloader(GarbageCollectorState &state, const GroupPtr &group);
+	void expireGetWaiters(GarbageCollectorState &state);
 	unsigned long long realGarbageCollect();
 	void wakeupGarbageCollector();
 
@@ -384,7 +415,9 @@ public:
 	unsigned int capacityUsedUnlocked() const;
 	bool atFullCapacityUnlocked() const;
 	void inspectProcessList(const InspectOptions &options, stringstream &result,
-		const Group *group, const ProcessList &processes) const;
+		const GroupSnapshot &group) const;
+	PoolSnapshotPtr createSnapshot(bool cache) const;
+	void invalidateSnapshot();
 
 public:
 	typedef void (*AbortLongRunningConnectionsCallback)(const ProcessPtr &process);
@@ -439,12 +472,15 @@ public:
 
 	unsigned int capacityUsed() const;
 	bool atFullCapacity() const;
+	bool hasFreeProcess(const HashedStaticString &appGroupName) const;
 	unsigned int getProcessCount(bool lock = true) const;
 	unsigned int getGroupCount() const;
+	void collectGetWaitlistSojourns(map<string, Histogram> &result) const;
 	string inspect(const InspectOptions &options = InspectOptions::makeAuthorized(),
 		bool lock = true) const;
 	string toXml(const ToXmlOptions &options = ToXmlOptions::makeAuthorized(),
 		bool lock = true) const;
+	PoolSnapshotPtr getSnapshot() const;
 
 
 	/****** Miscellaneous ******/
@@ -453,6 +489,7 @@ public:
 	SessionPtr get(const Options &options, Ticket *ticket);
 	void setMax(unsigned int max);
 	void setMaxIdleTime(unsigned long long value);
+	void setSnapshotMaxAge(unsigned long long value);
 	void enableSelfChecking(bool enabled);
 	bool isSpawning(bool lock = true) const;
 	bool authorizeByApiKey(const ApiKey &key, bool lock = true) const;
@@ -94,6 +94,9 @@ Pool::updateProcessMetrics(const ProcessList &processes,
 			allMetrics.find(process->getPid());
 		if (metrics_it != allMetrics.end()) {
 			process->metrics = metrics_it->second;
+			if (process->memoryBaseline == 0) {
+				process->memoryBaseline = process->metrics.realMemory();
+			}
 		// If the process is missing from 'allMetrics' then either 'ps'
 		// failed or the process really is gone. We double check by sending
 		// it a signal.
@@ -222,6 +225,9 @@ Pool::realCollectAnalytics() {
 		UPDATE_TRACE_POINT();
 		processesToDetach.clear();
 
+		UPDATE_TRACE_POINT();
+		recycleProcessesUsingTooMuchMemory(systemMetrics.memoryPressureSome, actions);
+
 		l.unlock();
 		UPDATE_TRACE_POINT();
 		if (!logEntries.empty()) {
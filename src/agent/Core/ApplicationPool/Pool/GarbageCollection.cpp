@@ -52,17 +52,23 @@ Pool::garbageCollect(PoolPtr self) {
 	TRACE_POINT();
 	{
 		ScopedLock lock(self->syncher);
+		self->nextGcRunTime = SystemTime::getUsec() + 5000000;
 		self->garbageCollectionCond.timed_wait(lock,
 			posix_time::seconds(5));
 	}
 	while (!this_thread::interruption_requested()) {
 		try {
 			UPDATE_TRACE_POINT();
-			unsigned long long sleepTime = self->realGarbageCollect();
+			self->realGarbageCollect();
 			UPDATE_TRACE_POINT();
 			ScopedLock lock(self->syncher);
-			self->garbageCollectionCond.timed_wait(lock,
-				posix_time::microseconds(sleepTime));
+			// nextGcRunTime may have been lowered while we weren't
+			// holding the lock, in which case the notification is lost.
+			unsigned long long now = SystemTime::getUsec();
+			if (self->nextGcRunTime > now) {
+				self->garbageCollectionCond.timed_wait(lock,
+					posix_time::microseconds(self->nextGcRunTime - now));
+			}
 		} catch (const thread_interrupted &) {
 			break;
 		} catch (const tracable_exception &e) {
@@ -138,6 +144,37 @@ Pool::maybeCleanPreloader(GarbageCollectorState &state, const GroupPtr &group) {
 	}
 }
 
+/**
+ * Drops all requests from the top-level getWaitlist that have passed
+ * their deadline.
+ */
+void
+Pool::expireGetWaiters(GarbageCollectorState &state) {
+	vector<GetWaiter>::iterator it = getWaitlist.begin();
+	while (it != getWaitlist.end()) {
+		unsigned long long deadline = it->options.deadline;
+		if (deadline != 0 && state.now >= deadline) {
+			unsigned long long sojournTime = (state.now > it->enqueueTime)
+				? state.now - it->enqueueTime
+				: 0;
+			P_DEBUG("Dropping request for " << it->options.getAppGroupName() <<
+				" from the top-level getWaitlist: deadline passed");
+			context.getWaitlistTimeouts.fetch_add(1, boost::memory_order_relaxed);
+			state.actions.push_back(boost::bind(GetCallback::call,
+				it->callback, SessionPtr(),
+				boost::make_shared<RequestQueueTimeoutException>(
+					"Request queue timeout (waited " + toString(sojournTime / 1000) +
+					" ms)")));
+			it = getWaitlist.erase(it);
+		} else {
+			if (deadline != 0) {
+				maybeUpdateNextGcRuntime(state, deadline);
+			}
+			it++;
+		}
+	}
+}
+
 unsigned long long
 Pool::realGarbageCollect() {
 	TRACE_POINT();
@@ -164,11 +201,19 @@ Pool::realGarbageCollect() {
 		// ...cleanup the spawner if it's been idle for more than preloaderIdleTime.
 		maybeCleanPreloader(state, group);
 
+		// ...drop queued requests that have passed their deadline.
+		group->expireGetWaiters(state.now, state.actions);
+		if (group->nextGetWaiterDeadline != 0) {
+			maybeUpdateNextGcRuntime(state, group->nextGetWaiterDeadline);
+		}
+
 		g_it.next();
 	}
 
+	// ...and do the same for the top-level getWaitlist.
+	expireGetWaiters(state);
+
 	verifyInvariants();
-	lock.unlock();
 
 	// Schedule next garbage collection run.
 	unsigned long long sleepTime;
@@ -181,6 +226,9 @@ Pool::realGarbageCollect() {
 	} else {
 		sleepTime = state.nextGcRunTime - state.now;
 	}
+	nextGcRunTime = state.now + sleepTime;
+
+	lock.unlock();
 	P_DEBUG("Garbage collection done; next garbage collect in " <<
 		std::fixed << std::setprecision(3) << (sleepTime / 1000000.0) << " sec");
 
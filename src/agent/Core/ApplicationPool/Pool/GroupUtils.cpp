@@ -71,6 +71,7 @@ Pool::createGroup(const Options &options) {
 	GroupPtr group = boost::make_shared<Group>(this, options);
 	group->initialize();
 	groups.insert(options.getAppGroupName(), group);
+	invalidateSnapshot();
 	wakeupGarbageCollector();
 	return group;
 }
@@ -112,6 +113,7 @@ Pool::forceDetachGroup(const GroupPtr &group,
 	bool removed = groups.erase(group->getName());
 	assert(removed);
 	(void) removed; // Shut up compiler warning.
+	invalidateSnapshot();
 	group->shutdown(callback, postLockActions);
 }
 
@@ -56,7 +56,10 @@ Pool::Pool(const SpawningKit::FactoryPtr &spawningKitFactory,
 	lifeStatus   = ALIVE;
 	max          = 6;
 	maxIdleTime  = 60 * 1000000;
+	nextGcRunTime = 0;
 	selfchecking = true;
+	snapshotGeneration = 0;
+	snapshotMaxAge = 1000000;
 	palloc       = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
 
 	// The following code only serve to instantiate certain inline methods
@@ -104,9 +107,12 @@ Pool::prepareForShutdown() {
 		vector<ProcessPtr> processes = getProcesses(false);
 		foreach (ProcessPtr process, processes) {
 			// Ensure that the process is not immediately respawned.
-			process->getGroup()->options.minProcesses = 0;
+			Group *group = process->getGroup();
+			group->options.minProcesses = 0;
+			group->snapshotConstants.reset();
 			abortLongRunningConnectionsCallback(process);
 		}
+		invalidateSnapshot();
 	}
 }
 
@@ -133,6 +139,9 @@ Pool::destroy() {
 	P_DEBUG("Shutting down ApplicationPool background threads...");
 	interruptableThreads.interrupt_and_join_all();
 	nonInterruptableThreads.join_all();
+	context.oobwWorkerPool.interruptAndJoinAll();
+	P_DEBUG("Waiting until all detached processes have been cleaned up...");
+	context.detachedProcessReaper.waitUntilIdle();
 	lock.lock();
 
 	lifeStatus = SHUT_DOWN;
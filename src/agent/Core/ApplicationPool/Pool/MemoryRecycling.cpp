@@ -0,0 +1,94 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <Core/ApplicationPool/Pool.h>
+
+/*************************************************************************
+ *
+ * Memory-based recycling functions for ApplicationPool2::Pool
+ *
+ *************************************************************************/
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+using namespace boost;
+
+
+/**
+ * Called by the analytics collector, right after it has updated the process
+ * metrics. Gracefully replaces processes that exceed their Group's memory
+ * limit, and under memory pressure, the process that leaked the most.
+ * `memoryPressure` is the system's memory pressure as collected in
+ * `systemMetrics`: a percentage, or negative if unknown.
+ *
+ * Only one process in the entire pool is replaced because of memory pressure
+ * per collection cycle: replacing a process takes a while before it frees
+ * any memory, and we don't want a pressure spike to restart all apps at once.
+ */
+void
+Pool::recycleProcessesUsingTooMuchMemory(double memoryPressure,
+	boost::container::vector<Callback> &postLockActions)
+{
+	GroupMap::ConstIterator g_it(groups);
+	Group *mostLeakingGroup = NULL;
+	ProcessPtr mostLeakingProcess;
+	size_t largestGrowth = 0;
+
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+
+		if (group->memoryRecyclingProcess != NULL) {
+			group->continueMemoryRecycling(postLockActions);
+		} else if (group->isAlive() && !group->restarting()) {
+			bool overLimit;
+			size_t growth;
+			Process *process = group->findProcessToRecycleForMemory(memoryPressure,
+				&overLimit, &growth);
+			if (process != NULL) {
+				if (overLimit) {
+					group->startMemoryRecycling(ProcessPtr(process),
+						true, postLockActions);
+				} else if (growth > largestGrowth) {
+					mostLeakingGroup = group.get();
+					mostLeakingProcess = ProcessPtr(process);
+					largestGrowth = growth;
+				}
+			}
+		}
+
+		g_it.next();
+	}
+
+	if (mostLeakingProcess != NULL) {
+		mostLeakingGroup->startMemoryRecycling(mostLeakingProcess, false,
+			postLockActions);
+	}
+}
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
@@ -118,9 +118,21 @@ Pool::asyncGet(const Options &options, const GetCallback &callback, bool lockNow
 			 * become available.
 			 */
 			P_DEBUG("Could not free a process; putting request to top-level getWaitlist");
+			unsigned long long now = options.currentTime;
+			if (now == 0) {
+				now = SystemTime::getUsec();
+			}
 			getWaitlist.push_back(GetWaiter(
 				options.copyAndPersist().detachFromUnionStationTransaction(),
-				callback));
+				callback, now));
+			context.getWaitlistDepths.record(getWaitlist.size());
+			if (options.deadline != 0
+			 && (nextGcRunTime == 0 || options.deadline < nextGcRunTime))
+			{
+				// Let the garbage collector expire this request in time.
+				nextGcRunTime = options.deadline;
+				wakeupGarbageCollector();
+			}
 		} else {
 			/* Now that a process has been trashed we can create
 			 * the missing Group.
@@ -198,6 +210,7 @@ Pool::setMax(unsigned int max) {
 	fullVerifyInvariants();
 	bool bigger = max > this->max;
 	this->max = max;
+	invalidateSnapshot();
 	if (bigger) {
 		/* If there are clients waiting for resources
 		 * to become free, spawn more processes now that
@@ -227,6 +240,16 @@ Pool::setMaxIdleTime(unsigned long long value) {
 	wakeupGarbageCollector();
 }
 
+/**
+ * Sets how old (in microseconds) the snapshot that `getSnapshot()` returns
+ * may be. 0 means that every call creates a new snapshot.
+ */
+void
+Pool::setSnapshotMaxAge(unsigned long long value) {
+	LockGuard l(snapshotSyncher);
+	snapshotMaxAge = value;
+}
+
 void
 Pool::enableSelfChecking(bool enabled) {
 	LockGuard l(syncher);
@@ -70,19 +70,19 @@ Pool::atFullCapacityUnlocked() const {
 
 void
 Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
-	const Group *group, const ProcessList &processes) const
+	const GroupSnapshot &group) const
 {
-	ProcessList::const_iterator p_it;
-	for (p_it = processes.begin(); p_it != processes.end(); p_it++) {
-		const ProcessPtr &process = *p_it;
+	vector<ProcessSnapshot>::const_iterator p_it;
+	for (p_it = group.processes.begin(); p_it != group.processes.end(); p_it++) {
+		const ProcessSnapshot &process = *p_it;
 		char buf[128];
 		char cpubuf[10];
 		char membuf[10];
 
-		 if (process->metrics.isValid()) {
-			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process->metrics.cpu);
+		 if (process.metrics.isValid()) {
+			snprintf(cpubuf, sizeof(cpubuf), "%d%%", (int) process.metrics.cpu);
 			snprintf(membuf, sizeof(membuf), "%ldM",
-				(unsigned long) (process->metrics.realMemory() / 1024));
+				(unsigned long) (process.metrics.realMemory() / 1024));
 		} else {
 			snprintf(cpubuf, sizeof(cpubuf), "0%%");
 			snprintf(membuf, sizeof(membuf), "0M");
@@ -90,31 +90,73 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
 		snprintf(buf, sizeof(buf),
 			"  * PID: %-5lu   Sessions: %-2u      Processed: %-5u   Uptime: %s\n"
 			"    CPU: %-5s   Memory  : %-5s   Last used: %s ago",
-			(unsigned long) process->getPid(),
-			process->sessions,
-			process->processed,
-			process->uptime().c_str(),
+			(unsigned long) process.pid,
+			process.sessions,
+			process.processed,
+			process.uptime().c_str(),
 			cpubuf,
 			membuf,
-			distanceOfTimeInWords(process->lastUsed / 1000000).c_str());
+			distanceOfTimeInWords(process.lastUsed / 1000000).c_str());
 		result << buf << endl;
 
-		if (process->enabled == Process::DISABLING) {
+		if (process.enabled == Process::DISABLING) {
 			result << "    Disabling..." << endl;
-		} else if (process->enabled == Process::DISABLED) {
+		} else if (process.enabled == Process::DISABLED) {
 			result << "    DISABLED" << endl;
-		} else if (process->enabled == Process::DETACHED) {
+		} else if (process.enabled == Process::DETACHED) {
 			result << "    Shutting down..." << endl;
 		}
 
-		const Socket *socket;
-		if (options.verbose && (socket = process->getSockets().findSocketWithName("http")) != NULL) {
+		const ProcessSnapshot::SocketInfo *socket;
+		if (options.verbose && (socket = process.findSocketWithName("http")) != NULL) {
 			result << "    URL     : http://" << replaceString(socket->address, "tcp://", "") << endl;
-			result << "    Password: " << group->getApiKey().toStaticString() << endl;
+			result << "    Password: " << group.getApiKey().toStaticString() << endl;
 		}
 	}
 }
 
+/**
+ * Copies the state that the state inspection functions need into a new
+ * PoolSnapshot. The caller must hold the lock, except in emergencies (e.g.
+ * the crash handler) in which case `cache` must be false, so that we don't
+ * modify any state.
+ */
+PoolSnapshotPtr
+Pool::createSnapshot(bool cache) const {
+	boost::shared_ptr<PoolSnapshot> result = boost::make_shared<PoolSnapshot>();
+	GroupMap::ConstIterator g_it(groups);
+
+	result->max = max;
+	result->processCount = getProcessCount(false);
+	result->capacityUsed = capacityUsedUnlocked();
+	result->createdAt = SystemTime::getUsec();
+	result->generation = snapshotGeneration.load(boost::memory_order_relaxed);
+
+	result->getWaitlist.reserve(getWaitlist.size());
+	foreach (const GetWaiter &waiter, getWaitlist) {
+		result->getWaitlist.push_back(waiter.options.getAppGroupName().toString());
+	}
+
+	result->groups.reserve(groups.size());
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		result->groups.push_back(GroupSnapshot(*group,
+			group->getSnapshotConstants(cache)));
+		g_it.next();
+	}
+
+	return result;
+}
+
+/**
+ * Must be called (with the lock held) after every change that a snapshot
+ * must reflect immediately. See `snapshotGeneration`.
+ */
+void
+Pool::invalidateSnapshot() {
+	snapshotGeneration.fetch_add(1, boost::memory_order_relaxed);
+}
+
 
 /****************************
  *
@@ -125,79 +167,67 @@ Pool::inspectProcessList(const InspectOptions &options, stringstream &result,
 
 string
 Pool::inspect(const InspectOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	PoolSnapshotPtr snapshot = lock ? getSnapshot() : createSnapshot(false);
 	stringstream result;
 	const char *headerColor = maybeColorize(options, ANSI_COLOR_YELLOW ANSI_COLOR_BLUE_BG ANSI_COLOR_BOLD);
 	const char *resetColor  = maybeColorize(options, ANSI_COLOR_RESET);
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
 
 	result << headerColor << "----------- General information -----------" << resetColor << endl;
-	result << "Max pool size : " << max << endl;
-	result << "App groups    : " << groups.size() << endl;
-	result << "Processes     : " << getProcessCount(false) << endl;
-	result << "Requests in top-level queue : " << getWaitlist.size() << endl;
+	result << "Max pool size : " << snapshot->max << endl;
+	result << "App groups    : " << snapshot->groups.size() << endl;
+	result << "Processes     : " << snapshot->processCount << endl;
+	result << "Requests in top-level queue : " << snapshot->getWaitlist.size() << endl;
 	if (options.verbose) {
 		unsigned int i = 0;
-		foreach (const GetWaiter &waiter, getWaitlist) {
-			result << "  " << i << ": " << waiter.options.getAppGroupName() << endl;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
+			result << "  " << i << ": " << appGroupName << endl;
 			i++;
 		}
 	}
 	result << endl;
 
 	result << headerColor << "----------- Application groups -----------" << resetColor << endl;
-	GroupMap::ConstIterator g_it(groups);
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const GroupSnapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
-		ProcessList::const_iterator p_it;
-
-		result << group->getName() << ":" << endl;
-		result << "  App root: " << group->options.appRoot << endl;
-		if (group->restarting()) {
+		result << group.getName() << ":" << endl;
+		result << "  App root: " << group.constants->appRoot << endl;
+		if (group.restarting) {
 			result << "  (restarting...)" << endl;
 		}
-		if (group->spawning()) {
-			if (group->processesBeingSpawned == 0) {
+		if (group.spawning) {
+			if (group.processesBeingSpawned == 0) {
 				result << "  (spawning...)" << endl;
 			} else {
-				result << "  (spawning " << group->processesBeingSpawned << " new " <<
-					maybePluralize(group->processesBeingSpawned, "process", "processes") <<
+				result << "  (spawning " << group.processesBeingSpawned << " new " <<
+					maybePluralize(group.processesBeingSpawned, "process", "processes") <<
 					"...)" << endl;
 			}
 		}
-		result << "  Requests in queue: " << group->getWaitlist.size() << endl;
-		inspectProcessList(options, result, group.get(), group->enabledProcesses);
-		inspectProcessList(options, result, group.get(), group->disablingProcesses);
-		inspectProcessList(options, result, group.get(), group->disabledProcesses);
-		inspectProcessList(options, result, group.get(), group->detachedProcesses);
+		result << "  Requests in queue: " << group.getWaitlistSize << endl;
+		inspectProcessList(options, result, group);
 		result << endl;
-
-		g_it.next();
 	}
 	return result.str();
 }
 
 string
 Pool::toXml(const ToXmlOptions &options, bool lock) const {
-	DynamicScopedLock l(syncher, lock);
+	PoolSnapshotPtr snapshot = lock ? getSnapshot() : createSnapshot(false);
 	stringstream result;
-	GroupMap::ConstIterator g_it(groups);
-	ProcessList::const_iterator p_it;
 
-	if (!authorizeByUid(options.uid, false)
-	 && !authorizeByApiKey(options.apiKey, false))
+	if (!snapshot->authorizeByUid(options.uid)
+	 && !snapshot->authorizeByApiKey(options.apiKey))
 	{
 		throw SecurityException("Operation unauthorized");
 	}
@@ -206,51 +236,44 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	result << "<info version=\"3\">";
 
 	result << "<passenger_version>" << PASSENGER_VERSION << "</passenger_version>";
-	result << "<group_count>" << groups.size() << "</group_count>";
-	result << "<process_count>" << getProcessCount(false) << "</process_count>";
-	result << "<max>" << max << "</max>";
-	result << "<capacity_used>" << capacityUsedUnlocked() << "</capacity_used>";
-	result << "<get_wait_list_size>" << getWaitlist.size() << "</get_wait_list_size>";
+	result << "<group_count>" << snapshot->groups.size() << "</group_count>";
+	result << "<process_count>" << snapshot->processCount << "</process_count>";
+	result << "<max>" << snapshot->max << "</max>";
+	result << "<capacity_used>" << snapshot->capacityUsed << "</capacity_used>";
+	result << "<get_wait_list_size>" << snapshot->getWaitlist.size() << "</get_wait_list_size>";
 
 	if (options.secrets) {
-		vector<GetWaiter>::const_iterator w_it, w_end = getWaitlist.end();
-
 		result << "<get_wait_list>";
-		for (w_it = getWaitlist.begin(); w_it != w_end; w_it++) {
-			const GetWaiter &waiter = *w_it;
+		foreach (const string &appGroupName, snapshot->getWaitlist) {
 			result << "<item>";
-			result << "<app_group_name>" << escapeForXml(waiter.options.getAppGroupName()) << "</app_group_name>";
+			result << "<app_group_name>" << escapeForXml(appGroupName) << "</app_group_name>";
 			result << "</item>";
 		}
 		result << "</get_wait_list>";
 	}
 
 	result << "<supergroups>";
-	while (*g_it != NULL) {
-		const GroupPtr &group = g_it.getValue();
-		if (!group->authorizeByUid(options.uid)
-		 && !group->authorizeByApiKey(options.apiKey))
+	foreach (const GroupSnapshot &group, snapshot->groups) {
+		if (!group.authorizeByUid(options.uid)
+		 && !group.authorizeByApiKey(options.apiKey))
 		{
-			g_it.next();
 			continue;
 		}
 
 		result << "<supergroup>";
-		result << "<name>" << escapeForXml(group->getName()) << "</name>";
+		result << "<name>" << escapeForXml(group.getName()) << "</name>";
 		result << "<state>READY</state>";
 		result << "<get_wait_list_size>0</get_wait_list_size>";
-		result << "<capacity_used>" << group->capacityUsed() << "</capacity_used>";
+		result << "<capacity_used>" << group.capacityUsed << "</capacity_used>";
 		if (options.secrets) {
-			result << "<secret>" << escapeForXml(group->getApiKey().toStaticString()) << "</secret>";
+			result << "<secret>" << escapeForXml(group.getApiKey().toStaticString()) << "</secret>";
 		}
 
 		result << "<group default=\"true\">";
-		group->inspectXml(result, options.secrets);
+		group.toXml(result, options.secrets);
 		result << "</group>";
 
 		result << "</supergroup>";
-
-		g_it.next();
 	}
 	result << "</supergroups>";
 
@@ -258,6 +281,31 @@ Pool::toXml(const ToXmlOptions &options, bool lock) const {
 	return result.str();
 }
 
+/**
+ * Returns a snapshot of the pool state, for use by state inspection and
+ * monitoring code. Unlike most other inspection functions, this only grabs
+ * the lock when the most recent snapshot is out of date: i.e. when the set
+ * of groups and processes has changed since, or when it is older than
+ * `snapshotMaxAge`. Concurrent callers share the same snapshot, so any
+ * number of status pollers cause at most one lock acquisition per
+ * `snapshotMaxAge` (plus one per actual change).
+ */
+PoolSnapshotPtr
+Pool::getSnapshot() const {
+	LockGuard l(snapshotSyncher);
+	unsigned long long now = SystemTime::getUsec();
+
+	if (lastSnapshot == NULL
+	 || lastSnapshot->generation != snapshotGeneration.load(boost::memory_order_relaxed)
+	 || now < lastSnapshot->createdAt
+	 || now - lastSnapshot->createdAt >= snapshotMaxAge)
+	{
+		LockGuard l2(syncher);
+		lastSnapshot = createSnapshot(true);
+	}
+	return lastSnapshot;
+}
+
 
 unsigned int
 Pool::capacityUsed() const {
@@ -271,6 +319,21 @@ Pool::atFullCapacity() const {
 	return atFullCapacityUnlocked();
 }
 
+/**
+ * Returns whether the given group exists and can route a new request to one
+ * of its processes right away. See `Group::hasFreeProcess()`.
+ */
+bool
+Pool::hasFreeProcess(const HashedStaticString &appGroupName) const {
+	LockGuard l(syncher);
+	const GroupPtr *group;
+	if (groups.lookup(appGroupName, &group)) {
+		return (*group)->hasFreeProcess();
+	} else {
+		return false;
+	}
+}
+
 /**
  * Returns the total number of processes in the pool, including all disabling and
  * disabled processes, but excluding processes that are shutting down and excluding
@@ -295,6 +358,21 @@ Pool::getGroupCount() const {
 	return groups.size();
 }
 
+/**
+ * Adds the getWaitlist sojourn time histograms of all Groups to `result`,
+ * keyed by Group name.
+ */
+void
+Pool::collectGetWaitlistSojourns(map<string, Histogram> &result) const {
+	LockGuard l(syncher);
+	GroupMap::ConstIterator g_it(groups);
+	while (*g_it != NULL) {
+		const GroupPtr &group = g_it.getValue();
+		result[group->getName()].merge(group->getWaitlistSojourns);
+		g_it.next();
+	}
+}
+
 
 } // namespace ApplicationPool2
 } // namespace Passenger
@@ -416,13 +416,29 @@ public:
 		 * out-of-band work can be performed. */
 		OOBW_IN_PROGRESS,
 	} oobwStatus;
+	/** Time at which the last out-of-band work request finished, or the
+	 * spawn end time if there hasn't been one yet. Group's OOBW scheduler
+	 * serves the process with the oldest value first. */
+	unsigned long long lastOobwTime;
+	/** Number of out-of-band work requests performed so far. */
+	unsigned int oobwCount;
 	/** Caches whether or not the OS process still exists. */
 	mutable bool m_osProcessExists: 1;
 	bool longRunningConnectionsAborted: 1;
+	/** Whether the current OOBW request has been held back by the Group's
+	 * spare concurrency floor. Only used for counting deferrals once. */
+	bool oobwDeferred: 1;
+	/** Whether this process is being replaced because of its memory usage. */
+	bool memoryRecycling: 1;
 	/** Time at which shutdown began. */
 	time_t shutdownStartTime;
 	/** Collected by Pool::collectAnalytics(). */
 	ProcessMetrics metrics;
+	/** `metrics.realMemory()` as of the first time that metrics were
+	 * collected for this process, in KB. 0 if not yet known. Memory-based
+	 * recycling uses this to tell leaking processes apart from processes
+	 * that are simply large. */
+	size_t memoryBaseline;
 
 
 	Process(const BasicGroupInfo *groupInfo, const Json::Value &json)
@@ -441,9 +457,14 @@ public:
 		  lifeStatus(ALIVE),
 		  enabled(ENABLED),
 		  oobwStatus(OOBW_NOT_ACTIVE),
+		  lastOobwTime(spawnEndTime),
+		  oobwCount(0),
 		  m_osProcessExists(true),
 		  longRunningConnectionsAborted(false),
-		  shutdownStartTime(0)
+		  oobwDeferred(false),
+		  memoryRecycling(false),
+		  shutdownStartTime(0),
+		  memoryBaseline(0)
 	{
 		initializeSocketsAndStringFields(json);
 		indexSessionSockets();
@@ -629,6 +650,22 @@ public:
 		return spawnerCreationTime;
 	}
 
+	unsigned long long getSpawnStartTime() const {
+		return spawnStartTime;
+	}
+
+	unsigned long long getSpawnEndTime() const {
+		return spawnEndTime;
+	}
+
+	int getConcurrency() const {
+		return concurrency;
+	}
+
+	StaticString getCodeRevision() const {
+		return codeRevision;
+	}
+
 	bool isDummy() const {
 		return dummy;
 	}
@@ -819,83 +856,6 @@ public:
 		result << "(pid=" << getPid() << ", group=" << getGroupName() << ")";
 		return result.str();
 	}
-
-	template<typename Stream>
-	void inspectXml(Stream &stream, bool includeSockets = true) const {
-		stream << "<pid>" << getPid() << "</pid>";
-		stream << "<sticky_session_id>" << getStickySessionId() << "</sticky_session_id>";
-		stream << "<gupid>" << getGupid() << "</gupid>";
-		stream << "<concurrency>" << concurrency << "</concurrency>";
-		stream << "<sessions>" << sessions << "</sessions>";
-		stream << "<busyness>" << busyness() << "</busyness>";
-		stream << "<processed>" << processed << "</processed>";
-		stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
-		stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
-		stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
-		stream << "<last_used>" << lastUsed << "</last_used>";
-		stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
-		stream << "<uptime>" << uptime() << "</uptime>";
-		if (!codeRevision.empty()) {
-			stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
-		}
-		switch (lifeStatus) {
-		case ALIVE:
-			stream << "<life_status>ALIVE</life_status>";
-			break;
-		case SHUTDOWN_TRIGGERED:
-			stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
-			break;
-		case DEAD:
-			stream << "<life_status>DEAD</life_status>";
-			break;
-		default:
-			P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
-		}
-		switch (enabled) {
-		case ENABLED:
-			stream << "<enabled>ENABLED</enabled>";
-			break;
-		case DISABLING:
-			stream << "<enabled>DISABLING</enabled>";
-			break;
-		case DISABLED:
-			stream << "<enabled>DISABLED</enabled>";
-			break;
-		case DETACHED:
-			stream << "<enabled>DETACHED</enabled>";
-			break;
-		default:
-			P_BUG("Unknown 'enabled' state " << (int) enabled);
-		}
-		if (metrics.isValid()) {
-			stream << "<has_metrics>true</has_metrics>";
-			stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
-			stream << "<rss>" << metrics.rss << "</rss>";
-			stream << "<pss>" << metrics.pss << "</pss>";
-			stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
-			stream << "<swap>" << metrics.swap << "</swap>";
-			stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
-			stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
-			stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
-			stream << "<command>" << escapeForXml(metrics.command) << "</command>";
-		}
-		if (includeSockets) {
-			SocketList::const_iterator it;
-
-			stream << "<sockets>";
-			for (it = sockets.begin(); it != sockets.end(); it++) {
-				const Socket &socket = *it;
-				stream << "<socket>";
-				stream << "<name>" << escapeForXml(socket.name) << "</name>";
-				stream << "<address>" << escapeForXml(socket.address) << "</address>";
-				stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
-				stream << "<concurrency>" << socket.concurrency << "</concurrency>";
-				stream << "<sessions>" << socket.sessions << "</sessions>";
-				stream << "</socket>";
-			}
-			stream << "</sockets>";
-		}
-	}
 };
 
 
@@ -0,0 +1,294 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_RESTART_FILE_WATCHER_H_
+#define _PASSENGER_APPLICATION_POOL2_RESTART_FILE_WATCHER_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/atomic.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/macros.hpp>
+#include <ev++.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <string>
+#include <set>
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/**
+ * Watches the restart.txt and always_restart.txt files of Groups, so that
+ * `Group::needsRestart()` only has to check a flag instead of calling stat()
+ * while holding the Pool lock. On network filesystems such a stat() can take
+ * milliseconds, which would stall every thread that needs the Pool.
+ *
+ * All watches are serviced by a single background event loop, which is
+ * started when the first watch is created. Files are watched with libev's
+ * ev_stat, which uses inotify on Linux and falls back to stat() polling on
+ * other platforms, and on filesystems that inotify can't watch reliably (e.g.
+ * NFS, where changes made by other hosts don't generate events).
+ *
+ * inotify also doesn't notice changes that are made through a different path
+ * than the one being watched, for example after a deployment switched the app
+ * root symlink. So every watch is re-stat()ed once per `statThrottleRate`
+ * seconds as well, like before, but from the background thread.
+ */
+class RestartFileWatcher: public boost::noncopyable {
+public:
+	class Watch: public boost::noncopyable {
+	private:
+		friend class RestartFileWatcher;
+
+		// These fields are only accessed from the event loop thread.
+		string restartFile;
+		string alwaysRestartFile;
+		ev_stat restartFileWatcher;
+		ev_stat alwaysRestartFileWatcher;
+		time_t lastRestartFileMtime;
+		ev_tstamp pollInterval;
+		ev_tstamp lastPollTime;
+
+		boost::atomic<bool> restartRequested;
+		boost::atomic<bool> alwaysRestartFileExists;
+
+		Watch(const string &_restartFile, const string &_alwaysRestartFile,
+			ev_tstamp _pollInterval)
+			: restartFile(_restartFile),
+			  alwaysRestartFile(_alwaysRestartFile),
+			  lastRestartFileMtime(0),
+			  pollInterval(_pollInterval),
+			  lastPollTime(0),
+			  restartRequested(false),
+			  alwaysRestartFileExists(false)
+			{ }
+
+	public:
+		/**
+		 * Returns whether restart.txt has been created or its mtime has
+		 * changed since the last call. Thread-safe.
+		 */
+		bool consumeRestartRequest() {
+			return restartRequested.load(boost::memory_order_relaxed)
+				&& restartRequested.exchange(false, boost::memory_order_acq_rel);
+		}
+
+		bool isRestartRequested() const {
+			return restartRequested.load(boost::memory_order_acquire);
+		}
+
+		/** Thread-safe. */
+		bool alwaysRestart() const {
+			return alwaysRestartFileExists.load(boost::memory_order_acquire);
+		}
+	};
+
+	typedef boost::shared_ptr<Watch> WatchPtr;
+
+private:
+	/** How often the poll timer checks whether any watch is due for a poll. */
+	static const unsigned int POLL_TIMER_INTERVAL = 1;
+
+	boost::mutex syncher;
+	BackgroundEventLoop *bg;
+	struct ev_timer pollTimer;
+	std::set<WatchPtr> watches;
+
+	void startEventLoop() {
+		bg = new BackgroundEventLoop(false, false);
+		ev_timer_init(&pollTimer, onPollTimeout, POLL_TIMER_INTERVAL, POLL_TIMER_INTERVAL);
+		pollTimer.data = this;
+		bg->start("Restart file watcher", 128 * 1024);
+		bg->safe->runSync(boost::bind(&RestartFileWatcher::startPollTimer, this));
+	}
+
+	void startPollTimer() {
+		ev_timer_start(bg->libev_loop, &pollTimer);
+	}
+
+	void stopEverything() {
+		std::set<WatchPtr>::iterator it, end = watches.end();
+		for (it = watches.begin(); it != end; it++) {
+			stopWatching(it->get());
+		}
+		watches.clear();
+		ev_timer_stop(bg->libev_loop, &pollTimer);
+	}
+
+	void startWatching(const WatchPtr &watch) {
+		Watch *w = watch.get();
+		ev_tstamp interval = w->pollInterval;
+
+		ev_stat_init(&w->restartFileWatcher, onFileChanged,
+			w->restartFile.c_str(), interval);
+		ev_stat_init(&w->alwaysRestartFileWatcher, onFileChanged,
+			w->alwaysRestartFile.c_str(), interval);
+		w->restartFileWatcher.data = w;
+		w->alwaysRestartFileWatcher.data = w;
+		ev_stat_start(bg->libev_loop, &w->restartFileWatcher);
+		ev_stat_start(bg->libev_loop, &w->alwaysRestartFileWatcher);
+		w->lastPollTime = ev_now(bg->libev_loop);
+
+		// Like before, an already existing restart.txt does not trigger
+		// a restart; only subsequent changes do.
+		if (w->restartFileWatcher.attr.st_nlink) {
+			w->lastRestartFileMtime = w->restartFileWatcher.attr.st_mtime;
+		}
+		update(w);
+		watches.insert(watch);
+	}
+
+	void stopWatching(Watch *w) {
+		ev_stat_stop(bg->libev_loop, &w->restartFileWatcher);
+		ev_stat_stop(bg->libev_loop, &w->alwaysRestartFileWatcher);
+	}
+
+	void getWatchCountFromEventLoop(unsigned int *result) {
+		*result = watches.size();
+	}
+
+	void unwatchFromEventLoop(const WatchPtr &watch) {
+		if (watches.erase(watch) > 0) {
+			stopWatching(watch.get());
+		}
+	}
+
+	/**
+	 * Restarts both ev_stat watchers, so that their inotify watches are
+	 * re-resolved from the file paths, and so that their attributes are
+	 * refreshed.
+	 */
+	void poll(Watch *w) {
+		stopWatching(w);
+		ev_stat_start(bg->libev_loop, &w->restartFileWatcher);
+		ev_stat_start(bg->libev_loop, &w->alwaysRestartFileWatcher);
+		w->lastPollTime = ev_now(bg->libev_loop);
+		update(w);
+	}
+
+	static void update(Watch *w) {
+		const ev_statdata &restartFileAttr = w->restartFileWatcher.attr;
+		if (restartFileAttr.st_nlink) {
+			if (restartFileAttr.st_mtime != w->lastRestartFileMtime) {
+				w->lastRestartFileMtime = restartFileAttr.st_mtime;
+				w->restartRequested.store(true, boost::memory_order_release);
+			}
+		} else {
+			w->lastRestartFileMtime = 0;
+		}
+
+		w->alwaysRestartFileExists.store(w->alwaysRestartFileWatcher.attr.st_nlink != 0,
+			boost::memory_order_release);
+	}
+
+	static void onFileChanged(EV_P_ ev_stat *watcher, int revents) {
+		update(static_cast<Watch *>(watcher->data));
+	}
+
+	static void onPollTimeout(EV_P_ ev_timer *timer, int revents) {
+		RestartFileWatcher *self = static_cast<RestartFileWatcher *>(timer->data);
+		ev_tstamp now = ev_now(EV_A);
+		std::set<WatchPtr>::iterator it, end = self->watches.end();
+
+		for (it = self->watches.begin(); it != end; it++) {
+			Watch *w = it->get();
+			if (now - w->lastPollTime >= w->pollInterval) {
+				self->poll(w);
+			}
+		}
+	}
+
+public:
+	RestartFileWatcher()
+		: bg(NULL)
+		{ }
+
+	~RestartFileWatcher() {
+		if (bg != NULL) {
+			bg->safe->runSync(boost::bind(&RestartFileWatcher::stopEverything, this));
+			bg->stop();
+			delete bg;
+		}
+	}
+
+	/**
+	 * Starts watching the given files. The returned object's flags are
+	 * initialized before this method returns. Thread-safe.
+	 *
+	 * @param statThrottleRate How often, in seconds, the files are re-stat()ed
+	 *     in addition to being watched with inotify.
+	 */
+	WatchPtr watch(const string &restartFile, const string &alwaysRestartFile,
+		unsigned int statThrottleRate)
+	{
+		WatchPtr watch(new Watch(restartFile, alwaysRestartFile, statThrottleRate));
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (bg == NULL) {
+			startEventLoop();
+		}
+		bg->safe->runSync(boost::bind(&RestartFileWatcher::startWatching, this, watch));
+		return watch;
+	}
+
+	/**
+	 * Stops watching the files of the given watch. This happens asynchronously:
+	 * the watch's flags may still change shortly after this method returns.
+	 * Thread-safe.
+	 */
+	void unwatch(const WatchPtr &watch) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (bg != NULL) {
+			bg->safe->runLater(boost::bind(&RestartFileWatcher::unwatchFromEventLoop,
+				this, watch));
+		}
+	}
+
+	/** Returns the number of active watches. For unit tests. */
+	unsigned int getWatchCount() {
+		unsigned int result = 0;
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (bg != NULL) {
+			bg->safe->runSync(boost::bind(&RestartFileWatcher::getWatchCountFromEventLoop,
+				this, &result));
+		}
+		return result;
+	}
+};
+
+typedef RestartFileWatcher::WatchPtr RestartFileWatchPtr;
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_RESTART_FILE_WATCHER_H_ */
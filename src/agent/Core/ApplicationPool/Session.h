@@ -27,12 +27,16 @@
 #define _PASSENGER_APPLICATION_POOL_SESSION_H_
 
 #include <sys/types.h>
+#include <sys/socket.h>
+#include <cerrno>
 #include <boost/atomic.hpp>
 #include <oxt/macros.hpp>
 #include <oxt/system_calls.hpp>
 #include <oxt/backtrace.hpp>
+#include <Exceptions.h>
 #include <Utils/ScopeGuard.h>
 #include <Utils/Lock.h>
+#include <Utils/IOUtils.h>
 #include <Core/ApplicationPool/Context.h>
 #include <Core/ApplicationPool/BasicProcessInfo.h>
 #include <Core/ApplicationPool/BasicGroupInfo.h>
@@ -85,6 +89,12 @@ private:
 	Socket *socket;
 
 	Connection connection;
+	/**
+	 * Non-NULL while initiateNonBlocking() is connecting to the process.
+	 * Only allocated at that point, because most of the time a connection
+	 * either comes from the connection pool, or is established immediately.
+	 */
+	NConnect_State *connectState;
 	mutable boost::atomic<int> refcount;
 	bool closed;
 
@@ -95,6 +105,45 @@ private:
 		connection.fd = -1;
 	}
 
+	int connectingFd() const {
+		if (connectState->type == SAT_UNIX) {
+			return connectState->s_unix.fd;
+		} else {
+			return connectState->s_tcp.fd;
+		}
+	}
+
+	/**
+	 * Completes a TCP connect that was in progress, after the socket
+	 * became writable. Calling connect() again is not an option, because
+	 * on some platforms that starts a new attempt if the previous one failed.
+	 */
+	void checkTcpConnectResult() {
+		int error = 0;
+		socklen_t len = sizeof(error);
+		if (getsockopt(connectState->s_tcp.fd, SOL_SOCKET, SO_ERROR, &error, &len) == -1) {
+			error = errno;
+		}
+		if (error != 0) {
+			string message = "Cannot connect to TCP socket '";
+			message.append(socket->address.data(), socket->address.size());
+			message.append("'");
+			throw SystemException(message, error);
+		}
+	}
+
+	/**
+	 * Releases a connect that initiateNonBlocking() has in progress, and
+	 * checks the reserved connection back in as failed.
+	 */
+	void cancelConnect() {
+		Connection failedConnection;
+		failedConnection.fail = true;
+		delete connectState;
+		connectState = NULL;
+		socket->checkinConnection(failedConnection);
+	}
+
 	void callOnInitiateFailure() {
 		if (OXT_LIKELY(onInitiateFailure != NULL)) {
 			onInitiateFailure(this);
@@ -122,6 +171,7 @@ public:
 		: context(_context),
 		  processInfo(_processInfo),
 		  socket(_socket),
+		  connectState(NULL),
 		  refcount(1),
 		  closed(false),
 		  onInitiateFailure(NULL),
@@ -133,6 +183,8 @@ public:
 		// If user doesn't close() explicitly, we penalize performance.
 		if (OXT_LIKELY(initiated())) {
 			deinitiate(false, false);
+		} else if (connectState != NULL) {
+			cancelConnect();
 		}
 		if (OXT_LIKELY(!closed)) {
 			callOnClose();
@@ -196,13 +248,80 @@ public:
 		this->connection = connection;
 	}
 
+	virtual InitiateResult initiateNonBlocking() {
+		assert(!closed);
+		ScopeGuard g(boost::bind(&Session::abortInitiate, this));
+
+		if (connectState == NULL) {
+			Connection connection;
+			if (socket->checkoutIdleConnectionOrReserve(connection)) {
+				connection.fail = true;
+				if (connection.blocking) {
+					FdGuard g2(connection.fd, NULL, 0);
+					setNonBlocking(connection.fd);
+					g2.clear();
+					connection.blocking = false;
+				}
+				g.clear();
+				this->connection = connection;
+				return INITIATE_DONE;
+			}
+
+			P_TRACE(3, "Connecting to " << socket->address);
+			connectState = new NConnect_State();
+			setupNonBlockingSocket(*connectState, socket->address, __FILE__, __LINE__);
+			if (!connectToServer(*connectState)) {
+				g.clear();
+				return (connectState->type == SAT_UNIX)
+					? INITIATE_RETRY_LATER
+					: INITIATE_WAIT_WRITABLE;
+			}
+		} else if (connectState->type == SAT_UNIX) {
+			// A Unix socket connect() that would block has not been started at
+			// all, so it has to be retried.
+			if (!connectToServer(*connectState)) {
+				g.clear();
+				return INITIATE_RETRY_LATER;
+			}
+		} else {
+			checkTcpConnectResult();
+		}
+
+		connection.fd = (connectState->type == SAT_UNIX)
+			? connectState->s_unix.fd.detach()
+			: connectState->s_tcp.fd.detach();
+		connection.fail = true;
+		connection.wantKeepAlive = false;
+		connection.blocking = false;
+		P_LOG_FILE_DESCRIPTOR_PURPOSE(connection.fd, "App " << socket->pid << " connection");
+		delete connectState;
+		connectState = NULL;
+		g.clear();
+		return INITIATE_DONE;
+	}
+
+	virtual void abortInitiate() {
+		if (connectState != NULL) {
+			cancelConnect();
+		}
+		callOnInitiateFailure();
+	}
+
 	bool initiated() const {
 		return connection.fd != -1;
 	}
 
+	/**
+	 * While initiateNonBlocking() is connecting, this returns the
+	 * file descriptor of the connection in progress.
+	 */
 	virtual int fd() const {
 		assert(!closed);
-		return connection.fd;
+		if (OXT_UNLIKELY(connectState != NULL)) {
+			return connectingFd();
+		} else {
+			return connection.fd;
+		}
 	}
 
 	/**
@@ -211,6 +330,8 @@ public:
 	virtual void close(bool success, bool wantKeepAlive = false) {
 		if (OXT_LIKELY(initiated())) {
 			deinitiate(success, wantKeepAlive);
+		} else if (connectState != NULL) {
+			cancelConnect();
 		}
 		if (OXT_LIKELY(!closed)) {
 			callOnClose();
@@ -0,0 +1,412 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_
+#define _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_
+
+#include <string>
+#include <vector>
+#include <ostream>
+#include <boost/shared_ptr.hpp>
+#include <sys/types.h>
+#include <unistd.h>
+#include <Constants.h>
+#include <Utils.h>
+#include <Utils/StrIntUtils.h>
+#include <Utils/ProcessMetricsCollector.h>
+#include <Core/ApplicationPool/Process.h>
+#include <Core/ApplicationPool/Group.h>
+#include <Shared/ApplicationPoolApiKey.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/**
+ * Immutable copies of the Pool, Group and Process state that the state
+ * inspection functions (`Pool::inspect()`, `Pool::toXml()`, the analytics
+ * collector) need. A snapshot is created while holding the pool lock, but
+ * can afterwards be serialized, passed to other threads and kept around
+ * without any locking. See `Pool::getSnapshot()`.
+ */
+
+struct ProcessSnapshot {
+	struct SocketInfo {
+		string name;
+		string address;
+		string protocol;
+		int concurrency;
+		int sessions;
+	};
+
+	pid_t pid;
+	unsigned int stickySessionId;
+	string gupid;
+	int concurrency;
+	int sessions;
+	int busyness;
+	unsigned int processed;
+	unsigned long long spawnerCreationTime;
+	unsigned long long spawnStartTime;
+	unsigned long long spawnEndTime;
+	unsigned long long lastUsed;
+	unsigned long long lastOobwTime;
+	unsigned int oobwCount;
+	string codeRevision;
+	Process::LifeStatus lifeStatus;
+	Process::EnabledStatus enabled;
+	ProcessMetrics metrics;
+	vector<SocketInfo> sockets;
+
+	ProcessSnapshot(const Process &process)
+		: pid(process.getPid()),
+		  stickySessionId(process.getStickySessionId()),
+		  gupid(process.getGupid().toString()),
+		  concurrency(process.getConcurrency()),
+		  sessions(process.sessions),
+		  busyness(process.busyness()),
+		  processed(process.processed),
+		  spawnerCreationTime(process.getSpawnerCreationTime()),
+		  spawnStartTime(process.getSpawnStartTime()),
+		  spawnEndTime(process.getSpawnEndTime()),
+		  lastUsed(process.lastUsed),
+		  lastOobwTime(process.lastOobwTime),
+		  oobwCount(process.oobwCount),
+		  codeRevision(process.getCodeRevision().toString()),
+		  lifeStatus(process.getLifeStatus()),
+		  enabled(process.enabled),
+		  metrics(process.metrics)
+	{
+		const SocketList &processSockets = process.getSockets();
+		SocketList::const_iterator it, end = processSockets.end();
+
+		sockets.reserve(processSockets.size());
+		for (it = processSockets.begin(); it != end; it++) {
+			SocketInfo info;
+			info.name = it->name.toString();
+			info.address = it->address.toString();
+			info.protocol = it->protocol.toString();
+			info.concurrency = it->concurrency;
+			info.sessions = it->sessions;
+			sockets.push_back(info);
+		}
+	}
+
+	/**
+	 * Returns the uptime of this process, as a string.
+	 */
+	string uptime() const {
+		return distanceOfTimeInWords(spawnEndTime / 1000000);
+	}
+
+	const SocketInfo *findSocketWithName(const StaticString &name) const {
+		vector<SocketInfo>::const_iterator it, end = sockets.end();
+		for (it = sockets.begin(); it != end; it++) {
+			if (it->name == name) {
+				return &(*it);
+			}
+		}
+		return NULL;
+	}
+
+	void toXml(std::ostream &stream, bool includeSockets = true) const {
+		stream << "<pid>" << pid << "</pid>";
+		stream << "<sticky_session_id>" << stickySessionId << "</sticky_session_id>";
+		stream << "<gupid>" << gupid << "</gupid>";
+		stream << "<concurrency>" << concurrency << "</concurrency>";
+		stream << "<sessions>" << sessions << "</sessions>";
+		stream << "<busyness>" << busyness << "</busyness>";
+		stream << "<processed>" << processed << "</processed>";
+		stream << "<spawner_creation_time>" << spawnerCreationTime << "</spawner_creation_time>";
+		stream << "<spawn_start_time>" << spawnStartTime << "</spawn_start_time>";
+		stream << "<spawn_end_time>" << spawnEndTime << "</spawn_end_time>";
+		stream << "<last_used>" << lastUsed << "</last_used>";
+		stream << "<last_used_desc>" << distanceOfTimeInWords(lastUsed / 1000000).c_str() << " ago</last_used_desc>";
+		stream << "<uptime>" << uptime() << "</uptime>";
+		stream << "<oobw_count>" << oobwCount << "</oobw_count>";
+		if (oobwCount > 0) {
+			stream << "<last_oobw_time>" << lastOobwTime << "</last_oobw_time>";
+		}
+		if (!codeRevision.empty()) {
+			stream << "<code_revision>" << escapeForXml(codeRevision) << "</code_revision>";
+		}
+		switch (lifeStatus) {
+		case Process::ALIVE:
+			stream << "<life_status>ALIVE</life_status>";
+			break;
+		case Process::SHUTDOWN_TRIGGERED:
+			stream << "<life_status>SHUTDOWN_TRIGGERED</life_status>";
+			break;
+		case Process::DEAD:
+			stream << "<life_status>DEAD</life_status>";
+			break;
+		default:
+			P_BUG("Unknown 'lifeStatus' state " << (int) lifeStatus);
+		}
+		switch (enabled) {
+		case Process::ENABLED:
+			stream << "<enabled>ENABLED</enabled>";
+			break;
+		case Process::DISABLING:
+			stream << "<enabled>DISABLING</enabled>";
+			break;
+		case Process::DISABLED:
+			stream << "<enabled>DISABLED</enabled>";
+			break;
+		case Process::DETACHED:
+			stream << "<enabled>DETACHED</enabled>";
+			break;
+		default:
+			P_BUG("Unknown 'enabled' state " << (int) enabled);
+		}
+		if (metrics.isValid()) {
+			stream << "<has_metrics>true</has_metrics>";
+			stream << "<cpu>" << (int) metrics.cpu << "</cpu>";
+			stream << "<rss>" << metrics.rss << "</rss>";
+			stream << "<pss>" << metrics.pss << "</pss>";
+			stream << "<private_dirty>" << metrics.privateDirty << "</private_dirty>";
+			stream << "<swap>" << metrics.swap << "</swap>";
+			stream << "<real_memory>" << metrics.realMemory() << "</real_memory>";
+			stream << "<vmsize>" << metrics.vmsize << "</vmsize>";
+			stream << "<process_group_id>" << metrics.processGroupId << "</process_group_id>";
+			stream << "<command>" << escapeForXml(metrics.command) << "</command>";
+		}
+		if (includeSockets) {
+			vector<SocketInfo>::const_iterator it;
+
+			stream << "<sockets>";
+			for (it = sockets.begin(); it != sockets.end(); it++) {
+				const SocketInfo &socket = *it;
+				stream << "<socket>";
+				stream << "<name>" << escapeForXml(socket.name) << "</name>";
+				stream << "<address>" << escapeForXml(socket.address) << "</address>";
+				stream << "<protocol>" << escapeForXml(socket.protocol) << "</protocol>";
+				stream << "<concurrency>" << socket.concurrency << "</concurrency>";
+				stream << "<sessions>" << socket.sessions << "</sessions>";
+				stream << "</socket>";
+			}
+			stream << "</sockets>";
+		}
+	}
+};
+
+/**
+ * The parts of a Group's state that only change when its options change.
+ * Resolving the user account and rendering the options are by far the most
+ * expensive parts of creating a GroupSnapshot, so the Group caches this
+ * object and shares it between successive snapshots.
+ */
+struct GroupSnapshotConstants {
+	string name;
+	string appRoot;
+	string appType;
+	string environment;
+	string uuid;
+	ApiKey apiKey;
+	string user;
+	uid_t uid;
+	string group;
+	gid_t gid;
+	string optionsXml;
+};
+
+typedef boost::shared_ptr<const GroupSnapshotConstants> GroupSnapshotConstantsPtr;
+
+struct GroupSnapshot {
+	GroupSnapshotConstantsPtr constants;
+	int enabledCount;
+	int disablingCount;
+	int disabledCount;
+	unsigned int capacityUsed;
+	unsigned int getWaitlistSize;
+	unsigned int disableWaitlistSize;
+	short processesBeingSpawned;
+	bool spawning;
+	bool restarting;
+	Group::LifeStatus lifeStatus;
+	/** Enabled, disabling, disabled and detached processes, in that order. */
+	vector<ProcessSnapshot> processes;
+
+	GroupSnapshot(const Group &group, const GroupSnapshotConstantsPtr &_constants)
+		: constants(_constants),
+		  enabledCount(group.enabledCount),
+		  disablingCount(group.disablingCount),
+		  disabledCount(group.disabledCount),
+		  capacityUsed(group.capacityUsed()),
+		  getWaitlistSize(group.getWaitlist.size()),
+		  disableWaitlistSize(group.disableWaitlist.size()),
+		  processesBeingSpawned(group.processesBeingSpawned),
+		  spawning(group.spawning()),
+		  restarting(group.restarting()),
+		  lifeStatus((Group::LifeStatus) group.lifeStatus.load(boost::memory_order_relaxed))
+	{
+		processes.reserve(group.enabledProcesses.size()
+			+ group.disablingProcesses.size()
+			+ group.disabledProcesses.size()
+			+ group.detachedProcesses.size());
+		addProcesses(group.enabledProcesses);
+		addProcesses(group.disablingProcesses);
+		addProcesses(group.disabledProcesses);
+		addProcesses(group.detachedProcesses);
+	}
+
+	void addProcesses(const ProcessList &list) {
+		ProcessList::const_iterator it, end = list.end();
+		for (it = list.begin(); it != end; it++) {
+			processes.push_back(ProcessSnapshot(**it));
+		}
+	}
+
+	const string &getName() const {
+		return constants->name;
+	}
+
+	const ApiKey &getApiKey() const {
+		return constants->apiKey;
+	}
+
+	bool authorizeByUid(uid_t uid) const {
+		return uid == 0 || constants->uid == uid;
+	}
+
+	bool authorizeByApiKey(const ApiKey &key) const {
+		return key.isSuper() || key == constants->apiKey;
+	}
+
+	void toXml(std::ostream &stream, bool includeSecrets = true) const {
+		vector<ProcessSnapshot>::const_iterator it;
+
+		stream << "<name>" << escapeForXml(constants->name) << "</name>";
+		stream << "<component_name>" << escapeForXml(constants->name) << "</component_name>";
+		stream << "<app_root>" << escapeForXml(constants->appRoot) << "</app_root>";
+		stream << "<app_type>" << escapeForXml(constants->appType) << "</app_type>";
+		stream << "<environment>" << escapeForXml(constants->environment) << "</environment>";
+		stream << "<uuid>" << constants->uuid << "</uuid>";
+		stream << "<enabled_process_count>" << enabledCount << "</enabled_process_count>";
+		stream << "<disabling_process_count>" << disablingCount << "</disabling_process_count>";
+		stream << "<disabled_process_count>" << disabledCount << "</disabled_process_count>";
+		stream << "<capacity_used>" << capacityUsed << "</capacity_used>";
+		stream << "<get_wait_list_size>" << getWaitlistSize << "</get_wait_list_size>";
+		stream << "<disable_wait_list_size>" << disableWaitlistSize << "</disable_wait_list_size>";
+		stream << "<processes_being_spawned>" << processesBeingSpawned << "</processes_being_spawned>";
+		if (spawning) {
+			stream << "<spawning/>";
+		}
+		if (restarting) {
+			stream << "<restarting/>";
+		}
+		if (includeSecrets) {
+			stream << "<secret>" << escapeForXml(constants->apiKey.toStaticString()) << "</secret>";
+			stream << "<api_key>" << escapeForXml(constants->apiKey.toStaticString()) << "</api_key>";
+		}
+		switch (lifeStatus) {
+		case Group::ALIVE:
+			stream << "<life_status>ALIVE</life_status>";
+			break;
+		case Group::SHUTTING_DOWN:
+			stream << "<life_status>SHUTTING_DOWN</life_status>";
+			break;
+		case Group::SHUT_DOWN:
+			stream << "<life_status>SHUT_DOWN</life_status>";
+			break;
+		default:
+			P_BUG("Unknown 'lifeStatus' state " << lifeStatus);
+		}
+
+		stream << "<user>" << escapeForXml(constants->user) << "</user>";
+		stream << "<uid>" << constants->uid << "</uid>";
+		stream << "<group>" << escapeForXml(constants->group) << "</group>";
+		stream << "<gid>" << constants->gid << "</gid>";
+
+		stream << "<options>" << constants->optionsXml << "</options>";
+
+		stream << "<processes>";
+		for (it = processes.begin(); it != processes.end(); it++) {
+			stream << "<process>";
+			it->toXml(stream, includeSecrets);
+			stream << "</process>";
+		}
+		stream << "</processes>";
+	}
+};
+
+struct PoolSnapshot {
+	unsigned int max;
+	unsigned int processCount;
+	unsigned int capacityUsed;
+	/** The app group names of the requests in the Pool's getWaitlist. */
+	vector<string> getWaitlist;
+	vector<GroupSnapshot> groups;
+	/** When this snapshot was created. Microseconds resolution. */
+	unsigned long long createdAt;
+	/** The value of `Pool::snapshotGeneration` when this snapshot was created. */
+	unsigned int generation;
+
+	PoolSnapshot()
+		: max(0),
+		  processCount(0),
+		  capacityUsed(0),
+		  createdAt(0),
+		  generation(0)
+		{ }
+
+	bool authorizeByUid(uid_t uid) const {
+		if (uid == 0 || uid == geteuid()) {
+			return true;
+		}
+
+		vector<GroupSnapshot>::const_iterator it, end = groups.end();
+		for (it = groups.begin(); it != end; it++) {
+			if (it->authorizeByUid(uid)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool authorizeByApiKey(const ApiKey &key) const {
+		if (key.isSuper()) {
+			return true;
+		}
+
+		vector<GroupSnapshot>::const_iterator it, end = groups.end();
+		for (it = groups.begin(); it != end; it++) {
+			if (it->getApiKey() == key) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+typedef boost::shared_ptr<const PoolSnapshot> PoolSnapshotPtr;
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_SNAPSHOT_H_ */
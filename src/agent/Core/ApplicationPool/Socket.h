@@ -154,29 +154,52 @@ public:
 	}
 
 	/**
-	 * Connect to this socket or reuse an existing connection.
+	 * Connect to this socket or reuse an existing connection. The connect()
+	 * call blocks, but does not hold the connection pool lock.
 	 *
 	 * One MUST call checkinConnection() when one's done using the Connection.
 	 * Failure to do so will result in a resource leak.
 	 */
 	Connection checkoutConnection() {
-		boost::unique_lock<boost::mutex> l(connectionPoolLock);
+		Connection connection;
+		if (!checkoutIdleConnectionOrReserve(connection)) {
+			try {
+				connection = connect();
+			} catch (...) {
+				connection.fail = true;
+				checkinConnection(connection);
+				throw;
+			}
+		}
+		return connection;
+	}
+
+	/**
+	 * Checks out a connection from the connection pool and returns true if
+	 * there is an idle one. Otherwise, accounts for a new connection that
+	 * the caller is going to establish by itself, and returns false. This
+	 * allows the caller to connect in a non-blocking manner.
+	 *
+	 * Either way, one MUST call checkinConnection() afterwards. If the caller
+	 * failed to establish the new connection, then it must check in a
+	 * Connection with `fail` set.
+	 */
+	bool checkoutIdleConnectionOrReserve(Connection &connection) {
+		boost::lock_guard<boost::mutex> l(connectionPoolLock);
 
 		if (!idleConnections.empty()) {
 			P_TRACE(3, "Socket " << address << ": checking out connection from connection pool (" <<
 				idleConnections.size() << " -> " << (idleConnections.size() - 1) <<
 				" items). Current total number of connections: " << totalConnections);
-			Connection connection = idleConnections.back();
+			connection = idleConnections.back();
 			idleConnections.pop_back();
 			totalIdleConnections--;
-			return connection;
+			return true;
 		} else {
-			Connection connection = connect();
 			totalConnections++;
 			P_TRACE(3, "Socket " << address << ": there are now " <<
 				totalConnections << " total connections");
-			l.unlock();
-			return connection;
+			return false;
 		}
 	}
 
@@ -50,6 +50,8 @@ private:
 	SocketPair connection;
 	BufferedIO peerBufferedIO;
 	unsigned int stickySessionId;
+	bool unresponsive;
+	bool initiateAborted;
 	mutable bool closed;
 	mutable bool success;
 	mutable bool wantKeepAlive;
@@ -61,6 +63,8 @@ public:
 		  gupid("gupid-123"),
 		  protocol("session"),
 		  stickySessionId(0),
+		  unresponsive(false),
+		  initiateAborted(false),
 		  closed(false),
 		  success(false),
 		  wantKeepAlive(false)
@@ -168,6 +172,36 @@ public:
 		}
 	}
 
+	/**
+	 * Makes initiateNonBlocking() behave as if the process's listen
+	 * backlog is full and it never accepts the connection.
+	 */
+	void setUnresponsive(bool v) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		unresponsive = v;
+	}
+
+	virtual InitiateResult initiateNonBlocking() {
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			if (unresponsive) {
+				return INITIATE_RETRY_LATER;
+			}
+		}
+		initiate(false);
+		return INITIATE_DONE;
+	}
+
+	virtual void abortInitiate() {
+		boost::lock_guard<boost::mutex> l(syncher);
+		initiateAborted = true;
+	}
+
+	bool isInitiateAborted() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return initiateAborted;
+	}
+
 	virtual void close(bool _success, bool _wantKeepAlive = false) {
 		boost::lock_guard<boost::mutex> l(syncher);
 		closed = true;
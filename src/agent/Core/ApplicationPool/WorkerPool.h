@@ -0,0 +1,194 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_APPLICATION_POOL2_WORKER_POOL_H_
+#define _PASSENGER_APPLICATION_POOL2_WORKER_POOL_H_
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/dynamic_thread_group.hpp>
+#include <oxt/macros.hpp>
+#include <string>
+#include <deque>
+#include <Constants.h>
+#include <Logging.h>
+
+namespace Passenger {
+namespace ApplicationPool2 {
+
+using namespace std;
+
+
+/**
+ * A small pool of threads that runs blocking jobs on behalf of all Groups in
+ * a Pool, for example out-of-band work requests. Before, every such job got
+ * a thread of its own, which had to be created and destroyed every time.
+ *
+ * Threads are created on demand, up to `maxThreads` (pass UINT_MAX for no
+ * limit). A thread that has been idle for `idleTimeout` seconds exits, so an
+ * idle Pool doesn't keep any threads around. Jobs that are submitted while
+ * all threads are busy are run in FIFO order as soon as a thread becomes
+ * available.
+ *
+ * Jobs are run with interruption enabled. `interruptAndJoinAll()` interrupts
+ * all threads, so jobs that block in interruptible calls should expect a
+ * `thread_interrupted` exception during shutdown.
+ */
+class WorkerPool: public boost::noncopyable {
+public:
+	typedef boost::function<void ()> Job;
+
+private:
+	const string name;
+	const unsigned int maxThreads;
+	const unsigned int idleTimeout;
+
+	mutable boost::mutex syncher;
+	boost::condition_variable cond;
+	deque<Job> queue;
+	oxt::dynamic_thread_group threads;
+	unsigned int threadCount;
+	unsigned int idleThreadCount;
+	bool shuttingDown;
+
+	void threadMain() {
+		boost::unique_lock<boost::mutex> l(syncher);
+		try {
+			while (true) {
+				idleThreadCount++;
+				bool timedOut = false;
+				while (queue.empty() && !shuttingDown && !timedOut) {
+					timedOut = !cond.timed_wait(l,
+						boost::posix_time::seconds(idleTimeout));
+				}
+				idleThreadCount--;
+				if (queue.empty()) {
+					// Idle timeout or shutdown.
+					break;
+				}
+
+				Job job = queue.front();
+				queue.pop_front();
+				l.unlock();
+				try {
+					job();
+				} catch (const oxt::tracable_exception &e) {
+					P_WARN("Uncaught exception in " << name << " job: " <<
+						e.what() << "\n" << e.backtrace());
+				} catch (const std::exception &e) {
+					P_WARN("Uncaught exception in " << name << " job: " << e.what());
+				}
+				job = Job();
+				l.lock();
+			}
+		} catch (const boost::thread_interrupted &) {
+			if (!l.owns_lock()) {
+				l.lock();
+			}
+		}
+		threadCount--;
+	}
+
+public:
+	WorkerPool(const string &_name, unsigned int _maxThreads, unsigned int _idleTimeout = 60)
+		: name(_name),
+		  maxThreads(_maxThreads),
+		  idleTimeout(_idleTimeout),
+		  threadCount(0),
+		  idleThreadCount(0),
+		  shuttingDown(false)
+		{ }
+
+	~WorkerPool() {
+		interruptAndJoinAll();
+	}
+
+	/**
+	 * Runs the given job on one of the threads, creating a new thread if
+	 * none is idle and there is room for one. Thread-safe.
+	 *
+	 * @return Whether the job was accepted. Returns false, without running
+	 *     the job, after `interruptAndJoinAll()` has been called.
+	 * @throws thread_resource_error A new thread was needed but could not
+	 *     be created, and there are no other threads to run the job on.
+	 */
+	bool submit(const Job &job) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (OXT_UNLIKELY(shuttingDown)) {
+			return false;
+		}
+		queue.push_back(job);
+		if (idleThreadCount < queue.size() && threadCount < maxThreads) {
+			try {
+				threads.create_thread(
+					boost::bind(&WorkerPool::threadMain, this),
+					name + " thread",
+					POOL_HELPER_THREAD_STACK_SIZE);
+				threadCount++;
+			} catch (const boost::thread_resource_error &) {
+				if (threadCount == 0) {
+					queue.pop_back();
+					throw;
+				}
+				// The existing threads will eventually get to it.
+			}
+		}
+		cond.notify_one();
+		return true;
+	}
+
+	/**
+	 * Interrupts all threads, waits until they have exited and discards
+	 * all jobs that haven't started yet. Jobs that are submitted afterwards
+	 * are rejected.
+	 */
+	void interruptAndJoinAll() {
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			shuttingDown = true;
+			queue.clear();
+			cond.notify_all();
+		}
+		threads.interrupt_and_join_all();
+	}
+
+	unsigned int getThreadCount() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return threadCount;
+	}
+
+	unsigned int getQueueSize() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return queue.size();
+	}
+};
+
+
+} // namespace ApplicationPool2
+} // namespace Passenger
+
+#endif /* _PASSENGER_APPLICATION_POOL2_WORKER_POOL_H_ */
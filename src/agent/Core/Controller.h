@@ -67,7 +67,9 @@
 #include <ServerKit/Errors.h>
 #include <ServerKit/HttpServer.h>
 #include <ServerKit/HttpHeaderParser.h>
+#include <ServerKit/HttpCompression.h>
 #include <MemoryKit/palloc.h>
+#include <MemoryKit/ObjectSlab.h>
 #include <DataStructures/LString.h>
 #include <DataStructures/StringKeyTable.h>
 #include <StaticString.h>
@@ -82,8 +84,13 @@
 #include <Core/Controller/Client.h>
 #include <Core/Controller/AppResponse.h>
 #include <Core/Controller/TurboCaching.h>
+#include <Core/Controller/Metrics.h>
 #include <Core/UnionStation/Context.h>
 
+namespace tut {
+	struct Core_ControllerTest;
+}
+
 namespace Passenger {
 
 using namespace std;
@@ -92,6 +99,10 @@ using namespace oxt;
 using namespace ApplicationPool2;
 
 
+namespace Benchmarks {
+	class ResponseHeaderBenchmark;
+}
+
 namespace ServerKit {
 	extern const HashedStaticString HTTP_COOKIE;
 	extern const HashedStaticString HTTP_SET_COOKIE;
@@ -122,14 +133,36 @@ private:
 	// If you change this value, make sure that Request::sessionCheckoutTry
 	// has enough bits.
 	static const unsigned int MAX_SESSION_CHECKOUT_TRY = 10;
+	// When adaptively buffering a request body, the upload rate is measured
+	// over at least this many bytes or this many milliseconds, whichever
+	// comes first. See decideBodyBufferingMode().
+	static const unsigned int ADAPTIVE_BUFFERING_PROBE_SIZE = 128 * 1024;
+	static const unsigned int ADAPTIVE_BUFFERING_PROBE_TIME = 100;
+	// Responses with a smaller Content-Length are not worth compressing:
+	// the gzip header and trailer alone take 18 bytes.
+	static const unsigned int RESPONSE_COMPRESSION_MIN_SIZE = 256;
+	static const unsigned int MAX_IDLE_RESPONSE_COMPRESSORS = 16;
+	// Turbocached responses are compressed once and served many times,
+	// so they are worth the best compression level.
+	static const int TURBOCACHE_COMPRESSION_LEVEL = 9;
 
 	unsigned int statThrottleRate;
 	unsigned int responseBufferHighWatermark;
+	/** Maximum time to wait for the app to begin its response, in seconds.
+	 * 0 means no limit.
+	 */
+	ev_tstamp appResponseTimeout;
+	/** Maximum time to wait for a connection with the app to be established,
+	 * in seconds.
+	 */
+	ev_tstamp appConnectTimeout;
 	BenchmarkMode benchmarkMode: 3;
 	bool singleAppMode: 1;
 	bool showVersionInHeader: 1;
 	bool stickySessions: 1;
 	bool gracefulExit: 1;
+	bool responseCompression: 1;
+	int responseCompressionLevel;
 
 	const VariantMap *agentsOptions;
 	psg_pool_t *stringPool;
@@ -166,14 +199,48 @@ private:
 	HashedStaticString HTTP_CONNECTION;
 	HashedStaticString HTTP_STATUS;
 	HashedStaticString HTTP_TRANSFER_ENCODING;
+	HashedStaticString HTTP_ACCEPT_ENCODING;
+	HashedStaticString HTTP_CONTENT_ENCODING;
+	HashedStaticString HTTP_CONTENT_RANGE;
+	HashedStaticString HTTP_CACHE_CONTROL;
+	HashedStaticString HTTP_ETAG;
+	HashedStaticString HTTP_VARY;
 
 	unsigned int threadNumber;
 	StaticString serverLogName;
 
+	/**
+	 * The "Date: ...\r\n" response header line, reformatted by getDateHeader()
+	 * only when the event loop time crosses a second boundary.
+	 */
+	char dateHeader[48];
+	unsigned int dateHeaderSize;
+	time_t dateHeaderTime;
+
 	friend class TurboCaching<Request>;
 	friend class ResponseCache<Request>;
+	friend struct tut::Core_ControllerTest;
+	friend class Benchmarks::ResponseHeaderBenchmark;
 	struct ev_check checkWatcher;
 	TurboCaching<Request> turboCaching;
+	StringKeyTable< boost::shared_ptr<AppGroupMetrics> > appGroupMetrics;
+
+	/**
+	 * Cold parts of Request objects. See the comment in Request.h. Only
+	 * accessed from the event loop thread, so no locking is needed.
+	 */
+	MemoryKit::ObjectSlab<Request::BodyBuffer> bodyBufferSlab;
+	MemoryKit::ObjectSlab<Request::StopwatchLogs> stopwatchLogsSlab;
+	MemoryKit::ObjectSlab<Request::TurboCacheCapture> turboCacheCaptureSlab;
+	/**
+	 * Response compressors that are not attached to a request. Each holds
+	 * a zlib deflate state of up to ~256 KB, so a few are kept around for
+	 * reuse instead of being reallocated for every compressed response.
+	 */
+	vector<ServerKit::GzipCompressor *> idleResponseCompressors;
+	unsigned int activeResponseCompressors;
+	/** Compresses turbocache entries. Only used within a single call. */
+	ServerKit::GzipCompressor turboCacheCompressor;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		struct ev_prepare prepareWatcher;
@@ -212,9 +279,11 @@ private:
 
 	/****** Stage: buffering body ******/
 
+	bool shouldBufferBodyAdaptively(Request *req);
 	void beginBufferingBody(Client *client, Request *req);
 	Channel::Result whenBufferingBody_onRequestBody(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer, int errcode);
+	void decideBodyBufferingMode(Client *client, Request *req);
 
 
 	/****** Stage: checkout session ******/
@@ -228,11 +297,19 @@ private:
 		const AbstractSessionPtr &session, const ExceptionPtr &e);
 	void maybeSend100Continue(Client *client, Request *req);
 	void initiateSession(Client *client, Request *req);
+	void continueInitiatingSession(Client *client, Request *req);
+	void stopInitiatingSession(Request *req);
+	void onSessionInitiated(Client *client, Request *req);
+	void onSessionInitiateError(Client *client, Request *req, const StaticString &error);
+	static void onAppConnectWritable(EV_P_ struct ev_io *io, int revents);
+	static void onAppConnectRetryTimeout(EV_P_ struct ev_timer *timer, int revents);
+	static void onAppConnectTimeout(ServerKit::TimerWheel::Entry *entry);
 	static void checkoutSessionLater(Request *req);
+	AppGroupMetrics *lookupAppGroupMetrics(const HashedStaticString &appGroupName);
 	void reportSessionCheckoutError(Client *client, Request *req,
 		const ExceptionPtr &e);
 	void writeRequestQueueFullExceptionErrorResponse(Client *client,
-		Request *req, const boost::shared_ptr<RequestQueueFullException> &e);
+		Request *req, const boost::shared_ptr<GetAbortedException> &e);
 	void writeSpawnExceptionErrorResponse(Client *client, Request *req,
 		const boost::shared_ptr<SpawnException> &e);
 	void writeOtherExceptionErrorResponse(Client *client, Request *req,
@@ -248,6 +325,7 @@ private:
 	struct HttpHeaderConstructionCache;
 
 	void sendHeaderToApp(Client *client, Request *req);
+	void recordTimeToApp(Request *req);
 	void sendHeaderToAppWithSessionProtocol(Client *client, Request *req);
 	static void sendBodyToAppWhenAppSinkIdle(Channel *_channel, unsigned int size);
 	unsigned int determineHeaderSizeForSessionProtocol(Request *req,
@@ -280,22 +358,30 @@ private:
 	Channel::Result onAppSourceData(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer, int errcode);
 	void onAppResponseBegin(Client *client, Request *req);
+	static void onAppResponseTimeout(ServerKit::TimerWheel::Entry *entry);
 	void prepareAppResponseCaching(Client *client, Request *req);
+	bool appResponseIsCompressible(Request *req);
+	bool requestAcceptsGzip(Request *req);
+	void prepareAppResponseCompression(Client *client, Request *req);
+	void weakenAppResponseETag(Request *req);
+	bool appResponseHasStrongETag(Request *req);
+	void addAcceptEncodingToAppResponseVary(Request *req);
 	void onAppResponse100Continue(Client *client, Request *req);
-	bool constructHeaderBuffersForResponse(Request *req, struct iovec *buffers,
-		unsigned int maxbuffers, unsigned int & restrict_ref nbuffers,
-		unsigned int & restrict_ref dataSize,
-		unsigned int & restrict_ref nCacheableBuffers);
-	unsigned int constructDateHeaderBuffersForResponse(char *dateStr,
-		unsigned int bufsize);
+	unsigned int constructHeaderForResponse(Request *req, char *output,
+		unsigned int outputSize, unsigned int &cacheableSize);
+	unsigned int constructHeaderBuffersForResponse(Request *req,
+		struct iovec *buffers, unsigned int &dataSize,
+		unsigned int &cacheableSize);
+	StaticString getDateHeader();
+	StaticString getResponseTrailer(Request *req, bool upgrade) const;
 	bool sendResponseHeaderWithWritev(Client *client, Request *req,
 		ssize_t &bytesWritten);
 	void sendResponseHeaderWithBuffering(Client *client, Request *req,
 		unsigned int offset);
 	void logResponseHeaders(Client *client, Request *req, struct iovec *buffers,
 		unsigned int nbuffers, unsigned int dataSize);
-	void markHeaderBuffersForTurboCaching(Client *client, Request *req,
-		struct iovec *buffers, unsigned int nbuffers);
+	void markHeaderForTurboCaching(Client *client, Request *req,
+		const char *data, unsigned int size);
 	static ServerKit::HttpHeaderParser<AppResponse, ServerKit::HttpParseResponse>
 		createAppResponseHeaderParser(ServerKit::Context *ctx, Request *req);
 	static ServerKit::HttpChunkedBodyParser createAppResponseChunkedBodyParser(
@@ -305,6 +391,12 @@ private:
 	void prepareAppResponseChunkedBodyParsing(Client *client, Request *req);
 	void writeResponseAndMarkForTurboCaching(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer);
+	void writeCompressedResponseBody(Client *client, Request *req,
+		const char *data, size_t size, ServerKit::GzipCompressor::Flush flush);
+	static void flushResponseCompressionLater(Request *req);
+	void finishResponseCompression(Client *client, Request *req);
+	void releaseResponseCompressor(Request *req);
+	bool capturingResponseBodyForTurboCaching(const Request *req) const;
 	void markResponsePartForTurboCaching(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer);
 	void maybeThrottleAppSource(Client *client, Request *req);
@@ -371,6 +463,7 @@ protected:
 
 	virtual void onClientAccepted(Client *client);
 	virtual void onRequestObjectCreated(Client *client, Request *req);
+	virtual void onRequestObjectReleased(Client *client, Request *req);
 	virtual void deinitializeClient(Client *client);
 	virtual void reinitializeRequest(Client *client, Request *req);
 	virtual void deinitializeRequest(Client *client, Request *req);
@@ -387,6 +480,7 @@ protected:
 
 	virtual void asyncGetFromApplicationPool(Request *req,
 		ApplicationPool2::GetCallback callback);
+	virtual bool appGroupHasFreeProcess(Request *req);
 
 
 public:
@@ -416,6 +510,7 @@ public:
 	virtual Json::Value inspectStateAsJson() const;
 	virtual Json::Value inspectClientStateAsJson(const Client *client) const;
 	virtual Json::Value inspectRequestStateAsJson(const Request *req) const;
+	void collectMetrics(ControllerMetrics &metrics) const;
 
 
 	/****** Miscellaneous *******/
@@ -127,19 +127,6 @@ public:
 	LString *expiresHeader;
 	LString *lastModifiedHeader;
 
-	/* If the response is eligible for turbocaching, then the buffers
-	 * that contain the part of the response that can be cached, will be
-	 * stored here.
-	 */
-	struct iovec *headerCacheBuffers;
-	unsigned int nHeaderCacheBuffers;
-
-	/* If the response is eligible for turbocaching, then all response mbufs
-	 * will be stored here, so that we can store it in the response cache
-	 * at the end of the response.
-	 */
-	LString bodyCacheBuffer;
-
 
 	AppResponse()
 		: headers(16),
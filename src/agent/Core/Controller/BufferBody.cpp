@@ -46,14 +46,40 @@ using namespace boost;
  ****************************/
 
 
+/**
+ * Adaptive buffering only applies to bodies with a Content-Length. Because
+ * the request headers are forwarded as-is, a chunked body can only be
+ * forwarded after it has been buffered entirely, see
+ * whenBufferingBody_onRequestBody(). Requests that expect a 100-Continue
+ * are also excluded, because the client waits for the app before sending
+ * the body. So are requests for which the web server module asked for the
+ * entire body to be buffered (the 'B' flag, set by PassengerBufferUpload):
+ * that explicit setting wins.
+ */
+bool
+Controller::shouldBufferBodyAdaptively(Request *req) {
+	return req->options.uploadStreamingThreshold > 0
+		&& !req->requestBodyBuffering
+		&& req->bodyType == Request::RBT_CONTENT_LENGTH
+		&& (req->strip100ContinueHeader || req->headers.lookup(HTTP_EXPECT) == NULL);
+}
+
 void
 Controller::beginBufferingBody(Client *client, Request *req) {
 	TRACE_POINT();
 	req->state = Request::BUFFERING_REQUEST_BODY;
 	req->bodyChannel.start();
-	req->bodyBuffer.reinitialize();
-	req->bodyBuffer.stop();
-	req->beginStopwatchLog(&req->stopwatchLogs.bufferingRequestBody, "buffering request body");
+	if (req->bodyBuffer == NULL) {
+		req->bodyBuffer = bodyBufferSlab.construct();
+		req->bodyBuffer->channel.setContext(getContext());
+		req->bodyBuffer->channel.setHooks(&req->hooks);
+		req->bodyBuffer->channel.setDataCallback(onBodyBufferData);
+	}
+	req->bodyBuffer->bytesBuffered = 0;
+	req->bodyBuffer->channel.reinitialize();
+	req->bodyBuffer->channel.stop();
+	req->beginStopwatchLog(&Request::StopwatchLogs::bufferingRequestBody,
+		"buffering request body");
 }
 
 ServerKit::Channel::Result
@@ -64,17 +90,25 @@ Controller::whenBufferingBody_onRequestBody(Client *client, Request *req,
 
 	if (buffer.size() > 0) {
 		// Data
-		req->bodyBytesBuffered += buffer.size();
+		req->bodyBuffer->bytesBuffered += buffer.size();
 		SKC_TRACE(client, 3, "Buffering " << buffer.size() <<
 			" bytes of client request body: \"" <<
 			cEscapeString(StaticString(buffer.start, buffer.size())) <<
-			"\"; " << req->bodyBytesBuffered << " bytes buffered so far");
-		req->bodyBuffer.feed(buffer);
+			"\"; " << req->bodyBuffer->bytesBuffered << " bytes buffered so far");
+		req->bodyBuffer->channel.feed(buffer);
+		if (req->bodyBufferingMode == Request::BUFFER_ADAPTIVELY) {
+			decideBodyBufferingMode(client, req);
+		}
 		return Channel::Result(buffer.size(), false);
 	} else if (errcode == 0 || errcode == ECONNRESET) {
 		// EOF
 		SKC_TRACE(client, 2, "End of request body encountered");
-		req->bodyBuffer.feed(MemoryKit::mbuf());
+		req->bodyBuffer->channel.feed(MemoryKit::mbuf());
+		if (req->bodyBufferingMode == Request::STREAM_BUFFERED_BODY) {
+			// The session has already been checked out.
+			return Channel::Result(0, true);
+		}
+		req->bodyBufferingMode = Request::BUFFER_ENTIRE_BODY;
 		if (req->bodyType == Request::RBT_CHUNKED) {
 			// The data that we've stored in the body buffer is dechunked, so when forwarding
 			// the buffered body to the app we must advertise it as being a fixed-length,
@@ -85,7 +119,7 @@ Controller::whenBufferingBody_onRequestBody(Client *client, Request *req,
 				psg_palloc(req->pool, sizeof(ServerKit::Header));
 			char *contentLength = (char *) psg_pnalloc(req->pool, UINT64_STRSIZE);
 			unsigned int size = integerToOtherBase<boost::uint64_t, 10>(
-				req->bodyBytesBuffered, contentLength, UINT64_STRSIZE);
+				req->bodyBuffer->bytesBuffered, contentLength, UINT64_STRSIZE);
 
 			psg_lstr_init(&header->key);
 			psg_lstr_append(&header->key, req->pool, "content-length",
@@ -102,7 +136,7 @@ Controller::whenBufferingBody_onRequestBody(Client *client, Request *req,
 			req->headers.erase(HTTP_TRANSFER_ENCODING);
 			req->headers.insert(&header, req->pool);
 		}
-		req->endStopwatchLog(&req->stopwatchLogs.bufferingRequestBody);
+		req->endStopwatchLog(&Request::StopwatchLogs::bufferingRequestBody);
 		checkoutSession(client, req);
 		return Channel::Result(0, true);
 	} else {
@@ -116,6 +150,46 @@ Controller::whenBufferingBody_onRequestBody(Client *client, Request *req,
 	}
 }
 
+/**
+ * Called while adaptively buffering a request body, after each piece of body
+ * data. Once enough data or time has passed to measure the client's upload
+ * rate, this either checks out a session right away (if the client uploads
+ * at least `options.uploadStreamingThreshold` KB/sec and the app group has
+ * a free process) or commits to buffering the entire body. In the former
+ * case, the rest of the body still goes through the body buffer, which
+ * SendRequest.cpp reads from as it fills up. That way a fast upload doesn't
+ * wait for its own end before reaching the app, while a slow upload doesn't
+ * occupy a process for its entire duration.
+ */
+void
+Controller::decideBodyBufferingMode(Client *client, Request *req) {
+	TRACE_POINT();
+	ev_tstamp elapsed = ev_now(getLoop()) - req->startedAt;
+	boost::uint64_t bytesBuffered = req->bodyBuffer->bytesBuffered;
+
+	if (bytesBuffered < ADAPTIVE_BUFFERING_PROBE_SIZE
+	 && elapsed * 1000 < ADAPTIVE_BUFFERING_PROBE_TIME)
+	{
+		return;
+	}
+
+	// `elapsed` is 0 if all data so far arrived within a single event
+	// loop iteration, in which case the upload is as fast as it gets.
+	double threshold = req->options.uploadStreamingThreshold * 1024.0;
+	if (bytesBuffered >= threshold * elapsed && appGroupHasFreeProcess(req)) {
+		SKC_TRACE(client, 2, "Client uploaded " << bytesBuffered << " bytes in "
+			<< elapsed << " sec and the app has a free process;"
+			" streaming request body to the app");
+		req->bodyBufferingMode = Request::STREAM_BUFFERED_BODY;
+		req->endStopwatchLog(&Request::StopwatchLogs::bufferingRequestBody);
+		checkoutSession(client, req);
+	} else {
+		SKC_TRACE(client, 2, "Client uploaded " << bytesBuffered << " bytes in "
+			<< elapsed << " sec; buffering entire request body");
+		req->bodyBufferingMode = Request::BUFFER_ENTIRE_BODY;
+	}
+}
+
 
 } // namespace Core
 } // namespace Passenger
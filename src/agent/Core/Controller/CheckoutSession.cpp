@@ -56,7 +56,7 @@ Controller::checkoutSession(Client *client, Request *req) {
 	req->state = Request::CHECKING_OUT_SESSION;
 
 	if (req->requestBodyBuffering) {
-		assert(!req->bodyBuffer.isStarted());
+		assert(!req->bodyBuffer->channel.isStarted());
 	} else {
 		assert(!req->bodyChannel.isStarted());
 	}
@@ -64,7 +64,13 @@ Controller::checkoutSession(Client *client, Request *req) {
 	callback.func = sessionCheckedOut;
 	callback.userData = req;
 
+	if (req->appGroupMetrics == NULL) {
+		req->appGroupMetrics = lookupAppGroupMetrics(options.getAppGroupName());
+	}
 	options.currentTime = SystemTime::getUsec();
+	if (options.requestQueueTimeout != 0) {
+		options.deadline = options.currentTime + options.requestQueueTimeout * 1000ull;
+	}
 
 	refRequest(req, __FILE__, __LINE__);
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
@@ -84,11 +90,16 @@ Controller::checkoutSession(Client *client, Request *req) {
 void
 Controller::asyncGetFromApplicationPool(Request *req, ApplicationPool2::GetCallback callback) {
 	appPool->asyncGet(req->options, callback, true,
-		req->useUnionStation()
-		? &req->stopwatchLogs.getFromPool
+		(req->useUnionStation() && req->stopwatchLogs != NULL)
+		? &req->stopwatchLogs->getFromPool
 		: NULL);
 }
 
+bool
+Controller::appGroupHasFreeProcess(Request *req) {
+	return appPool->hasFreeProcess(req->options.getAppGroupName());
+}
+
 void
 Controller::sessionCheckedOut(const AbstractSessionPtr &session, const ExceptionPtr &e,
 	void *userData)
@@ -127,6 +138,12 @@ Controller::sessionCheckedOutFromEventLoopThread(Client *client, Request *req,
 	TRACE_POINT();
 	CC_BENCHMARK_POINT(client, req, BM_AFTER_CHECKOUT);
 
+	if (req->appGroupMetrics != NULL) {
+		unsigned long long now = SystemTime::getUsec();
+		req->appGroupMetrics->sessionCheckoutWaits.record(
+			(now > req->options.currentTime) ? now - req->options.currentTime : 0);
+	}
+
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		if (!req->timedAppPoolGet) {
 			req->timedAppPoolGet = true;
@@ -146,7 +163,7 @@ Controller::sessionCheckedOutFromEventLoopThread(Client *client, Request *req,
 		initiateSession(client, req);
 	} else {
 		UPDATE_TRACE_POINT();
-		req->endStopwatchLog(&req->stopwatchLogs.getFromPool, false);
+		req->endStopwatchLog(&Request::StopwatchLogs::getFromPool, false);
 		reportSessionCheckoutError(client, req, e);
 	}
 }
@@ -175,34 +192,85 @@ Controller::maybeSend100Continue(Client *client, Request *req) {
 	}
 }
 
+/**
+ * Connects to the app without blocking the event loop. If the app's listen
+ * backlog is full (e.g. because of a burst of requests, or because it's
+ * paused for garbage collection), then connecting would block this entire
+ * thread, and with it all other clients. Instead, we wait for TCP
+ * connects to complete, and retry Unix socket connects with a backoff,
+ * until `appConnectTimeout` has passed.
+ */
 void
 Controller::initiateSession(Client *client, Request *req) {
 	TRACE_POINT();
 	req->sessionCheckoutTry++;
+	req->appConnectRetries = 0;
+	continueInitiatingSession(client, req);
+}
+
+void
+Controller::continueInitiatingSession(Client *client, Request *req) {
+	TRACE_POINT();
+	AbstractSession::InitiateResult result;
+
 	try {
-		req->session->initiate(false);
-	} catch (const SystemException &e2) {
-		if (req->sessionCheckoutTry < MAX_SESSION_CHECKOUT_TRY) {
-			SKC_DEBUG(client, "Error checking out session (" << e2.what() <<
-				"); retrying (attempt " << req->sessionCheckoutTry << ")");
-			refRequest(req, __FILE__, __LINE__);
-			getContext()->libev->runLater(boost::bind(checkoutSessionLater, req));
-		} else {
-			string message = "could not initiate a session (";
-			message.append(e2.what());
-			message.append(")");
-			disconnectWithError(&client, message);
-		}
+		result = req->session->initiateNonBlocking();
+	} catch (const SystemException &e) {
+		stopInitiatingSession(req);
+		onSessionInitiateError(client, req, e.what());
 		return;
 	}
 
-	UPDATE_TRACE_POINT();
+	switch (result) {
+	case AbstractSession::INITIATE_DONE:
+		stopInitiatingSession(req);
+		onSessionInitiated(client, req);
+		break;
+	case AbstractSession::INITIATE_WAIT_WRITABLE:
+		SKC_TRACE(client, 2, "Waiting until connection with application is established");
+		if (!ev_is_active(&req->appConnectWatcher)) {
+			ev_io_set(&req->appConnectWatcher, req->session->fd(), EV_WRITE);
+			ev_io_start(getLoop(), &req->appConnectWatcher);
+		}
+		if (!req->appConnectTimer.armed()) {
+			getContext()->timerWheel.arm(&req->appConnectTimer, appConnectTimeout);
+		}
+		break;
+	case AbstractSession::INITIATE_RETRY_LATER: {
+		ev_tstamp delay = 0.001 * (1 << std::min<unsigned int>(req->appConnectRetries, 6));
+		SKC_TRACE(client, 2, "Application's listen backlog is full; retrying connect in " <<
+			delay << " seconds");
+		if (req->appConnectRetries < 255) {
+			req->appConnectRetries++;
+		}
+		ev_timer_set(&req->appConnectRetryTimer, delay, 0);
+		ev_timer_start(getLoop(), &req->appConnectRetryTimer);
+		if (!req->appConnectTimer.armed()) {
+			getContext()->timerWheel.arm(&req->appConnectTimer, appConnectTimeout);
+		}
+		break;
+	}
+	default:
+		P_BUG("Invalid session initiation result " << (int) result);
+	}
+}
+
+void
+Controller::stopInitiatingSession(Request *req) {
+	ev_io_stop(getLoop(), &req->appConnectWatcher);
+	ev_timer_stop(getLoop(), &req->appConnectRetryTimer);
+	getContext()->timerWheel.cancel(&req->appConnectTimer);
+}
+
+void
+Controller::onSessionInitiated(Client *client, Request *req) {
+	TRACE_POINT();
 	if (req->useUnionStation()) {
-		req->endStopwatchLog(&req->stopwatchLogs.getFromPool);
+		req->endStopwatchLog(&Request::StopwatchLogs::getFromPool);
 		req->logMessage("Application PID: " +
 			toString(req->session->getPid()) +
 			" (GUPID: " + req->session->getGupid() + ")");
-		req->beginStopwatchLog(&req->stopwatchLogs.requestProxying, "request proxying");
+		req->beginStopwatchLog(&Request::StopwatchLogs::requestProxying, "request proxying");
 	}
 
 	UPDATE_TRACE_POINT();
@@ -215,6 +283,67 @@ Controller::initiateSession(Client *client, Request *req) {
 	sendHeaderToApp(client, req);
 }
 
+/**
+ * The session has already notified its Group about the failure, which
+ * detaches the process, so a retry checks out a session from another process.
+ */
+void
+Controller::onSessionInitiateError(Client *client, Request *req, const StaticString &error) {
+	TRACE_POINT();
+	if (req->sessionCheckoutTry < MAX_SESSION_CHECKOUT_TRY) {
+		SKC_DEBUG(client, "Error checking out session (" << error <<
+			"); retrying (attempt " << req->sessionCheckoutTry << ")");
+		refRequest(req, __FILE__, __LINE__);
+		getContext()->libev->runLater(boost::bind(checkoutSessionLater, req));
+	} else {
+		string message = "could not initiate a session (";
+		message.append(error.data(), error.size());
+		message.append(")");
+		disconnectWithError(&client, message);
+	}
+}
+
+void
+Controller::onAppConnectWritable(EV_P_ struct ev_io *io, int revents) {
+	Request *req = static_cast<Request *>(io->data);
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "onAppConnectWritable");
+
+	ev_io_stop(EV_A_ io);
+	if (!req->ended()) {
+		self->continueInitiatingSession(client, req);
+	}
+}
+
+void
+Controller::onAppConnectRetryTimeout(EV_P_ struct ev_timer *timer, int revents) {
+	Request *req = static_cast<Request *>(timer->data);
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "onAppConnectRetryTimeout");
+
+	if (!req->ended()) {
+		self->continueInitiatingSession(client, req);
+	}
+}
+
+void
+Controller::onAppConnectTimeout(ServerKit::TimerWheel::Entry *entry) {
+	Request *req = static_cast<Request *>(entry->userData);
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "onAppConnectTimeout");
+
+	if (!req->ended()) {
+		SKC_WARN_FROM_STATIC(self, client, "Could not connect to application process " <<
+			req->session->getPid() << " within " << self->appConnectTimeout << " seconds");
+		self->stopInitiatingSession(req);
+		req->session->abortInitiate();
+		self->onSessionInitiateError(client, req, "connection timed out");
+	}
+}
+
 void
 Controller::checkoutSessionLater(Request *req) {
 	Client *client = static_cast<Client *>(req->client);
@@ -228,6 +357,25 @@ Controller::checkoutSessionLater(Request *req) {
 	self->unrefRequest(req, __FILE__, __LINE__);
 }
 
+AppGroupMetrics *
+Controller::lookupAppGroupMetrics(const HashedStaticString &appGroupName) {
+	if (OXT_UNLIKELY(appGroupName.empty()
+		|| appGroupName.size() > StringKeyTable<int>::MAX_KEY_LENGTH))
+	{
+		return NULL;
+	}
+
+	boost::shared_ptr<AppGroupMetrics> *metrics;
+	if (appGroupMetrics.lookup(appGroupName, &metrics)) {
+		return metrics->get();
+	} else {
+		boost::shared_ptr<AppGroupMetrics> newMetrics =
+			boost::make_shared<AppGroupMetrics>();
+		appGroupMetrics.insert(appGroupName, newMetrics);
+		return newMetrics.get();
+	}
+}
+
 void
 Controller::reportSessionCheckoutError(Client *client, Request *req,
 	const ExceptionPtr &e)
@@ -241,6 +389,14 @@ Controller::reportSessionCheckoutError(Client *client, Request *req,
 			return;
 		}
 	}
+	{
+		boost::shared_ptr<RequestQueueTimeoutException> e2 =
+			dynamic_pointer_cast<RequestQueueTimeoutException>(e);
+		if (e2 != NULL) {
+			writeRequestQueueFullExceptionErrorResponse(client, req, e2);
+			return;
+		}
+	}
 	{
 		boost::shared_ptr<SpawnException> e2 = dynamic_pointer_cast<SpawnException>(e);
 		if (e2 != NULL) {
@@ -253,7 +409,7 @@ Controller::reportSessionCheckoutError(Client *client, Request *req,
 
 void
 Controller::writeRequestQueueFullExceptionErrorResponse(Client *client, Request *req,
-	const boost::shared_ptr<RequestQueueFullException> &e)
+	const boost::shared_ptr<GetAbortedException> &e)
 {
 	TRACE_POINT();
 	const LString *value = req->secureHeaders.lookup(
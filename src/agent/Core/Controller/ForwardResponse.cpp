@@ -204,11 +204,18 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 			SKC_TRACE(client, 3, "Processing " << buffer.size() <<
 				" bytes of application data: \"" << cEscapeString(StaticString(
 					buffer.start, buffer.size())) << "\"");
+			// When forwarding the response chunked, we pass the app's chunks
+			// through verbatim. Unless the body is needed for turbocaching,
+			// that means we only need to find the end of the body, and we can
+			// forward everything that the app sent in one write instead of
+			// one write per chunk. A compressed response is rechunked by
+			// writeCompressedResponseBody(), so it is dechunked here.
+			bool dechunk = req->dechunkResponse || req->responseCompressor != NULL;
 			ServerKit::HttpChunkedEvent event(createAppResponseChunkedBodyParser(req)
-				.feed(buffer));
+				.feed(buffer, dechunk || capturingResponseBodyForTurboCaching(req)));
 			resp->bodyAlreadyRead += event.consumed;
 
-			if (req->dechunkResponse) {
+			if (dechunk) {
 				UPDATE_TRACE_POINT();
 				switch (event.type) {
 				case ServerKit::HttpChunkedEvent::NONE:
@@ -297,6 +304,7 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 			SKC_TRACE(client, 2, "Application sent EOF");
 			SKC_TRACE(client, 2, "Not keep-aliving application session connection");
 			req->session->close(true, false);
+			finishResponseCompression(client, req);
 			endRequest(&client, &req);
 			return Channel::Result(0, false);
 		} else {
@@ -312,6 +320,21 @@ Controller::onAppSourceData(Client *client, Request *req, const MemoryKit::mbuf
 	}
 }
 
+void
+Controller::onAppResponseTimeout(ServerKit::TimerWheel::Entry *entry) {
+	Request *req = static_cast<Request *>(entry->userData);
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "onAppResponseTimeout");
+
+	if (!req->ended() && !req->responseBegun) {
+		SKC_WARN_FROM_STATIC(self, client, "Sending 504 response: application "
+			"did not respond within " << self->appResponseTimeout << " seconds");
+		self->endRequestWithSimpleResponse(&client, &req,
+			"<h2>Application response timeout</h2>", 504);
+	}
+}
+
 void
 Controller::onAppResponseBegin(Client *client, Request *req) {
 	TRACE_POINT();
@@ -319,6 +342,8 @@ Controller::onAppResponseBegin(Client *client, Request *req) {
 	ssize_t bytesWritten;
 	bool oobw;
 
+	getContext()->timerWheel.cancel(&req->appResponseTimer);
+
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timeOnRequestHeaderSent = ev_now(getLoop());
 		reportLargeTimeDiff(client,
@@ -369,6 +394,7 @@ Controller::onAppResponseBegin(Client *client, Request *req) {
 	}
 
 	prepareAppResponseCaching(client, req);
+	prepareAppResponseCompression(client, req);
 
 	if (OXT_UNLIKELY(oobw)) {
 		SKC_TRACE(client, 2, "Response with OOBW detected");
@@ -414,6 +440,8 @@ Controller::prepareAppResponseCaching(Client *client, Request *req) {
 				// Decrease store success ratio.
 				turboCaching.responseCache.incStores();
 				req->cacheKey = HashedStaticString();
+			} else if (req->turboCacheCapture == NULL) {
+				req->turboCacheCapture = turboCacheCaptureSlab.construct();
 			}
 		} else if (turboCaching.responseCache.requestAllowsInvalidating(req)) {
 			SKC_DEBUG(client, "Processing turbocache invalidation based on response");
@@ -429,6 +457,177 @@ Controller::prepareAppResponseCaching(Client *client, Request *req) {
 	}
 }
 
+/**
+ * Whether the app response may be gzip-compressed for clients that accept
+ * it. This only depends on the response, so that the turbocache can also
+ * store a compressed variant of responses to clients that don't accept gzip.
+ */
+bool
+Controller::appResponseIsCompressible(Request *req) {
+	AppResponse *resp = &req->appResponse;
+	const LString *value;
+
+	if (!resp->hasBody() || resp->upgraded()
+	 || resp->statusCode == 206
+	 || resp->headers.lookup(HTTP_CONTENT_ENCODING) != NULL
+	 || resp->headers.lookup(HTTP_CONTENT_RANGE) != NULL)
+	{
+		return false;
+	}
+	if (resp->bodyType == AppResponse::RBT_CONTENT_LENGTH
+	 && resp->aux.bodyInfo.contentLength < RESPONSE_COMPRESSION_MIN_SIZE)
+	{
+		return false;
+	}
+
+	value = resp->headers.lookup(HTTP_CONTENT_TYPE);
+	if (value == NULL) {
+		return false;
+	}
+	value = psg_lstr_make_contiguous(value, req->pool);
+	if (!ServerKit::contentTypeIsCompressible(StaticString(value->start->data,
+		value->size)))
+	{
+		return false;
+	}
+
+	value = resp->headers.lookup(HTTP_CACHE_CONTROL);
+	if (value != NULL && value->size > 0) {
+		value = psg_lstr_make_contiguous(value, req->pool);
+		if (ServerKit::cacheControlForbidsTransform(StaticString(value->start->data,
+			value->size)))
+		{
+			return false;
+		}
+	}
+
+	return true;
+}
+
+bool
+Controller::requestAcceptsGzip(Request *req) {
+	const LString *value = req->headers.lookup(HTTP_ACCEPT_ENCODING);
+	if (value == NULL || value->size == 0) {
+		return false;
+	}
+	value = psg_lstr_make_contiguous(value, req->pool);
+	return ServerKit::acceptEncodingAllowsGzip(StaticString(value->start->data,
+		value->size));
+}
+
+/**
+ * Decides whether to gzip-compress the app response, and if so, attaches a
+ * compressor to the request. The body is then passed through
+ * writeCompressedResponseBody(), which sends it with chunked encoding.
+ * Only HTTP/1.1 clients support that, and if we're already dechunking the
+ * response then the web server in front of us wants the body as-is.
+ */
+void
+Controller::prepareAppResponseCompression(Client *client, Request *req) {
+	if (!responseCompression || OXT_UNLIKELY(benchmarkMode == BM_RESPONSE_BEGIN)) {
+		return;
+	}
+
+	TRACE_POINT();
+	req->compressibleResponse = appResponseIsCompressible(req);
+	if (!req->compressibleResponse) {
+		SKC_TRACE(client, 2, "Response compression: response not eligible");
+		return;
+	}
+
+	// Whether or not we compress this response, the same URL may be
+	// served with a different content coding to other clients.
+	addAcceptEncodingToAppResponseVary(req);
+
+	if (req->dechunkResponse || req->httpMajor != 1 || req->httpMinor < 1
+	 || !requestAcceptsGzip(req))
+	{
+		SKC_TRACE(client, 2, "Response compression: client does not support it");
+		return;
+	}
+
+	UPDATE_TRACE_POINT();
+	AppResponse *resp = &req->appResponse;
+	ServerKit::GzipCompressor *compressor;
+	size_t sizeHint = 0;
+
+	if (resp->bodyType == AppResponse::RBT_CONTENT_LENGTH) {
+		sizeHint = resp->aux.bodyInfo.contentLength;
+	}
+	if (idleResponseCompressors.empty()) {
+		compressor = new ServerKit::GzipCompressor();
+	} else {
+		compressor = idleResponseCompressors.back();
+		idleResponseCompressors.pop_back();
+	}
+	if (!compressor->start(responseCompressionLevel, sizeHint)) {
+		SKC_WARN(client, "Cannot initialize response compression: out of memory. "
+			"Sending the response uncompressed");
+		delete compressor;
+		return;
+	}
+
+	SKC_TRACE(client, 2, "Compressing response with gzip");
+	weakenAppResponseETag(req);
+	req->responseCompressor = compressor;
+	activeResponseCompressors++;
+}
+
+/**
+ * A compressed response is a different representation than the app's
+ * response, so a strong ETag must not be reused for it (RFC 7232 section
+ * 2.1). Only called for responses that are actually compressed. Turns
+ * `"xyz"` into `W/"xyz"` by prepending a part to the header value.
+ */
+void
+Controller::weakenAppResponseETag(Request *req) {
+	LString *etag = req->appResponse.headers.lookup(HTTP_ETAG);
+	if (etag != NULL && etag->size > 0 && psg_lstr_first_byte(etag) == '"') {
+		LString::Part *part = (LString::Part *) psg_palloc(req->pool,
+			sizeof(LString::Part));
+		part->next = etag->start;
+		part->mbuf_block = NULL;
+		part->data = "W/";
+		part->size = 2;
+		etag->start = part;
+		etag->size += 2;
+	}
+}
+
+bool
+Controller::appResponseHasStrongETag(Request *req) {
+	LString *etag = req->appResponse.headers.lookup(HTTP_ETAG);
+	return etag != NULL && etag->size > 0 && psg_lstr_first_byte(etag) == '"';
+}
+
+/**
+ * Caches must know that a compressible response depends on Accept-Encoding.
+ * If the app sent a Vary header, Accept-Encoding is appended to it unless
+ * the header covers it already. Otherwise constructHeaderForResponse() adds
+ * a separate Vary header. Responses with a Vary header are never
+ * turbocached, so this doesn't end up in cached headers.
+ */
+void
+Controller::addAcceptEncodingToAppResponseVary(Request *req) {
+	LString *vary = req->appResponse.headers.lookup(HTTP_VARY);
+	if (vary == NULL) {
+		return;
+	}
+
+	if (vary->size == 0) {
+		psg_lstr_append(vary, req->pool, "Accept-Encoding");
+		return;
+	}
+
+	// The header itself is appended to, not the contiguous copy.
+	const LString *value = psg_lstr_make_contiguous(vary, req->pool);
+	if (!ServerKit::varyCoversAcceptEncoding(StaticString(value->start->data,
+		value->size)))
+	{
+		psg_lstr_append(vary, req->pool, ", Accept-Encoding");
+	}
+}
+
 void
 Controller::onAppResponse100Continue(Client *client, Request *req) {
 	TRACE_POINT();
@@ -451,264 +650,136 @@ Controller::onAppResponse100Continue(Client *client, Request *req) {
 }
 
 /**
- * Construct an array of buffers, which together contain the HTTP response
- * data that should be sent to the client. This method does not copy any data:
- * it just constructs buffers that point to the data stored inside `req->pool`,
- * `req->appResponse.headers`, etc.
+ * Build the dynamic part of the HTTP response header: the status line, the
+ * application's headers, the Date header (if the app didn't set one), the
+ * Set-Cookie headers, the framing headers and the sticky session cookie. Everything
+ * is copied into `output`, which must be at least `outputSize` bytes, so that the
+ * result can be sent in a single buffer. The static part that follows (the
+ * Connection and X-Powered-By headers) is returned by getResponseTrailer().
  *
- * The buffers will be stored in the array pointed to by `buffer`. This array must
- * have space for at least `maxbuffers` items. The actual number of buffers constructed
- * is stored in `nbuffers`, and the total data size of the buffers is stored in `dataSize`.
- * Upon success, returns true. If the actual number of buffers necessary exceeds
- * `maxbuffers`, then false is returned.
+ * You can also set `output` to NULL, in which case this method only calculates
+ * the necessary size.
  *
- * You can also set `buffers` to NULL, in which case this method will not construct any
- * buffers, but only count the number of buffers necessary, as well as the total data size.
- * In this case, this method always returns true.
+ * Returns the size of the constructed data. `cacheableSize` is set to the size of
+ * the prefix that may be stored in the turbocache.
  */
-bool
-Controller::constructHeaderBuffersForResponse(Request *req, struct iovec *buffers,
-	unsigned int maxbuffers, unsigned int & restrict_ref nbuffers,
-	unsigned int & restrict_ref dataSize,
-	unsigned int & restrict_ref nCacheableBuffers)
+unsigned int
+Controller::constructHeaderForResponse(Request *req, char *output,
+	unsigned int outputSize, unsigned int &cacheableSize)
 {
-	#define BEGIN_PUSH_NEXT_BUFFER() \
+	#define PUSH_STATIC_STRING(str) \
 		do { \
-			if (buffers != NULL && i >= maxbuffers) { \
-				return false; \
+			result += sizeof(str) - 1; \
+			if (output != NULL) { \
+				pos = appendData(pos, end, str, sizeof(str) - 1); \
 			} \
 		} while (false)
-	#define INC_BUFFER_ITER(i) \
+	#define PUSH_STRING(data, size) \
 		do { \
-			i++; \
+			result += (size); \
+			if (output != NULL) { \
+				pos = appendData(pos, end, data, size); \
+			} \
 		} while (false)
-	#define PUSH_STATIC_BUFFER(str) \
+	#define PUSH_LSTRING(str) \
 		do { \
-			BEGIN_PUSH_NEXT_BUFFER(); \
-			if (buffers != NULL) { \
-				buffers[i].iov_base = (void *) str; \
-				buffers[i].iov_len  = sizeof(str) - 1; \
+			result += (str)->size; \
+			if (output != NULL) { \
+				part = (str)->start; \
+				while (part != NULL) { \
+					pos = appendData(pos, end, part->data, part->size); \
+					part = part->next; \
+				} \
+			} \
+		} while (false)
+	#define PUSH_UINT(value, size) \
+		do { \
+			result += (size); \
+			if (output != NULL) { \
+				uintToString(value, pos, end - pos); \
+				pos += (size); \
 			} \
-			INC_BUFFER_ITER(i); \
-			dataSize += sizeof(str) - 1; \
 		} while (false)
 
 	AppResponse *resp = &req->appResponse;
 	ServerKit::HeaderTable::Iterator it(resp->headers);
 	const LString::Part *part;
 	const char *statusAndReason;
-	unsigned int i = 0;
-
-	nbuffers = 0;
-	dataSize = 0;
-
-	PUSH_STATIC_BUFFER("HTTP/");
-
-	if (buffers != NULL) {
-		BEGIN_PUSH_NEXT_BUFFER();
-		const unsigned int BUFSIZE = 16;
-		char *buf = (char *) psg_pnalloc(req->pool, BUFSIZE);
-		const char *end = buf + BUFSIZE;
-		char *pos = buf;
-		pos += uintToString(req->httpMajor, pos, end - pos);
-		pos = appendData(pos, end, ".", 1);
-		pos += uintToString(req->httpMinor, pos, end - pos);
-		buffers[i].iov_base = (void *) buf;
-		buffers[i].iov_len  = pos - buf;
-		dataSize += pos - buf;
-	} else {
-		char buf[16];
-		const char *end = buf + sizeof(buf);
-		char *pos = buf;
-		pos += uintToString(req->httpMajor, pos, end - pos);
-		pos = appendData(pos, end, ".", 1);
-		pos += uintToString(req->httpMinor, pos, end - pos);
-		dataSize += pos - buf;
-	}
-	INC_BUFFER_ITER(i);
+	unsigned int result = 0;
+	char *pos = output;
+	const char *end = output + outputSize;
 
-	PUSH_STATIC_BUFFER(" ");
+	PUSH_STATIC_STRING("HTTP/");
+	PUSH_UINT(req->httpMajor, uintSizeAsString(req->httpMajor));
+	PUSH_STATIC_STRING(".");
+	PUSH_UINT(req->httpMinor, uintSizeAsString(req->httpMinor));
+	PUSH_STATIC_STRING(" ");
 
 	statusAndReason = getStatusCodeAndReasonPhrase(resp->statusCode);
 	if (statusAndReason != NULL) {
 		size_t len = strlen(statusAndReason);
-		BEGIN_PUSH_NEXT_BUFFER();
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) statusAndReason;
-			buffers[i].iov_len  = len;
-		}
-		INC_BUFFER_ITER(i);
-		dataSize += len;
-
-		PUSH_STATIC_BUFFER("\r\nStatus: ");
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) statusAndReason;
-			buffers[i].iov_len  = len;
-		}
-		INC_BUFFER_ITER(i);
-		dataSize += len;
-
-		PUSH_STATIC_BUFFER("\r\n");
+		PUSH_STRING(statusAndReason, len);
+		PUSH_STATIC_STRING("\r\nStatus: ");
+		PUSH_STRING(statusAndReason, len);
+		PUSH_STATIC_STRING("\r\n");
 	} else {
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			const unsigned int BUFSIZE = 8;
-			char *buf = (char *) psg_pnalloc(req->pool, BUFSIZE);
-			const char *end = buf + BUFSIZE;
-			char *pos = buf;
-			unsigned int size = uintToString(resp->statusCode, pos, end - pos);
-			buffers[i].iov_base = (void *) buf;
-			buffers[i].iov_len  = size;
-			INC_BUFFER_ITER(i);
-			dataSize += size;
-
-			PUSH_STATIC_BUFFER(" Unknown Reason-Phrase\r\nStatus: ");
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) buf;
-			buffers[i].iov_len  = size;
-			INC_BUFFER_ITER(i);
-			dataSize += size;
-
-			PUSH_STATIC_BUFFER("\r\n");
-		} else {
-			char buf[8];
-			const char *end = buf + sizeof(buf);
-			char *pos = buf;
-			unsigned int size = uintToString(resp->statusCode, pos, end - pos);
-			INC_BUFFER_ITER(i);
-			dataSize += size;
-
-			dataSize += sizeof(" Unknown Reason-Phrase\r\nStatus: ") - 1;
-			INC_BUFFER_ITER(i);
-			dataSize += size;
-			INC_BUFFER_ITER(i);
-			dataSize += sizeof("\r\n");
-			INC_BUFFER_ITER(i);
-		}
+		unsigned int size = uintSizeAsString(resp->statusCode);
+		PUSH_UINT(resp->statusCode, size);
+		PUSH_STATIC_STRING(" Unknown Reason-Phrase\r\nStatus: ");
+		PUSH_UINT(resp->statusCode, size);
+		PUSH_STATIC_STRING("\r\n");
 	}
 
 	while (*it != NULL) {
-		dataSize += it->header->origKey.size + sizeof(": ") - 1;
-		dataSize += it->header->val.size + sizeof("\r\n") - 1;
-
-		part = it->header->origKey.start;
-		while (part != NULL) {
-			if (buffers != NULL) {
-				BEGIN_PUSH_NEXT_BUFFER();
-				buffers[i].iov_base = (void *) part->data;
-				buffers[i].iov_len  = part->size;
-			}
-			INC_BUFFER_ITER(i);
-			part = part->next;
-		}
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) ": ";
-			buffers[i].iov_len  = sizeof(": ") - 1;
-		}
-		INC_BUFFER_ITER(i);
-
-		part = it->header->val.start;
-		while (part != NULL) {
-			if (buffers != NULL) {
-				BEGIN_PUSH_NEXT_BUFFER();
-				buffers[i].iov_base = (void *) part->data;
-				buffers[i].iov_len  = part->size;
-			}
-			INC_BUFFER_ITER(i);
-			part = part->next;
-		}
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) "\r\n";
-			buffers[i].iov_len  = sizeof("\r\n") - 1;
-		}
-		INC_BUFFER_ITER(i);
-
+		PUSH_LSTRING(&it->header->origKey);
+		PUSH_STATIC_STRING(": ");
+		PUSH_LSTRING(&it->header->val);
+		PUSH_STATIC_STRING("\r\n");
 		it.next();
 	}
 
 	// Add Date header. https://code.google.com/p/phusion-passenger/issues/detail?id=485
 	if (resp->date == NULL) {
-		unsigned int size;
-
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			const unsigned int BUFSIZE = 60;
-			char *dateStr = (char *) psg_pnalloc(req->pool, BUFSIZE);
-			size = constructDateHeaderBuffersForResponse(dateStr, BUFSIZE);
-			buffers[i].iov_base = dateStr;
-			buffers[i].iov_len  = size;
-		} else {
-			char dateStr[60];
-			size = constructDateHeaderBuffersForResponse(dateStr, sizeof(dateStr));
-		}
-		INC_BUFFER_ITER(i);
-		dataSize += size;
-
-		PUSH_STATIC_BUFFER("\r\n");
+		StaticString date = getDateHeader();
+		PUSH_STRING(date.data(), date.size());
 	}
 
 	if (resp->setCookie != NULL) {
-		PUSH_STATIC_BUFFER("Set-Cookie: ");
+		PUSH_STATIC_STRING("Set-Cookie: ");
 		part = resp->setCookie->start;
 		while (part != NULL) {
 			if (part->size == 1 && part->data[0] == '\n') {
 				// HeaderTable joins multiple Set-Cookie headers together using \n.
-				PUSH_STATIC_BUFFER("\r\nSet-Cookie: ");
+				PUSH_STATIC_STRING("\r\nSet-Cookie: ");
 			} else {
-				if (buffers != NULL) {
-					BEGIN_PUSH_NEXT_BUFFER();
-					buffers[i].iov_base = (void *) part->data;
-					buffers[i].iov_len  = part->size;
-				}
-				INC_BUFFER_ITER(i);
-				dataSize += part->size;
+				PUSH_STRING(part->data, part->size);
 			}
 			part = part->next;
 		}
-		PUSH_STATIC_BUFFER("\r\n");
+		PUSH_STATIC_STRING("\r\n");
 	}
 
-	nCacheableBuffers = i;
+	cacheableSize = result;
 
-	if (resp->bodyType == AppResponse::RBT_CONTENT_LENGTH) {
-		PUSH_STATIC_BUFFER("Content-Length: ");
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			const unsigned int BUFSIZE = 16;
-			char *buf = (char *) psg_pnalloc(req->pool, BUFSIZE);
-			unsigned int size = integerToOtherBase<boost::uint64_t, 10>(
-				resp->aux.bodyInfo.contentLength, buf, BUFSIZE);
-			buffers[i].iov_base = (void *) buf;
-			buffers[i].iov_len  = size;
-			dataSize += size;
-		} else {
-			dataSize += integerSizeInOtherBase<boost::uint64_t, 10>(
-				resp->aux.bodyInfo.contentLength);
-		}
-		INC_BUFFER_ITER(i);
-		PUSH_STATIC_BUFFER("\r\n");
-	} else if (resp->bodyType == AppResponse::RBT_CHUNKED && !req->dechunkResponse) {
-		PUSH_STATIC_BUFFER("Transfer-Encoding: chunked\r\n");
+	if (req->compressibleResponse && resp->headers.lookup(HTTP_VARY) == NULL) {
+		PUSH_STATIC_STRING("Vary: Accept-Encoding\r\n");
 	}
 
-	if (resp->bodyType == AppResponse::RBT_UPGRADE) {
-		PUSH_STATIC_BUFFER("Connection: upgrade\r\n");
-	} else if (canKeepAlive(req)) {
-		unsigned int httpVersion = req->httpMajor * 1000 + req->httpMinor * 10;
-		if (httpVersion < 1010) {
-			// HTTP < 1.1 defaults to "Connection: close"
-			PUSH_STATIC_BUFFER("Connection: keep-alive\r\n");
-		}
-	} else {
-		unsigned int httpVersion = req->httpMajor * 1000 + req->httpMinor * 10;
-		if (httpVersion >= 1010) {
-			// HTTP 1.1 defaults to "Connection: keep-alive"
-			PUSH_STATIC_BUFFER("Connection: close\r\n");
+	if (req->responseCompressor != NULL) {
+		PUSH_STATIC_STRING("Content-Encoding: gzip\r\nTransfer-Encoding: chunked\r\n");
+	} else if (resp->bodyType == AppResponse::RBT_CONTENT_LENGTH) {
+		unsigned int size = integerSizeInOtherBase<boost::uint64_t, 10>(
+			resp->aux.bodyInfo.contentLength);
+		PUSH_STATIC_STRING("Content-Length: ");
+		result += size;
+		if (output != NULL) {
+			integerToOtherBase<boost::uint64_t, 10>(
+				resp->aux.bodyInfo.contentLength, pos, end - pos);
+			pos += size;
 		}
+		PUSH_STATIC_STRING("\r\n");
+	} else if (resp->bodyType == AppResponse::RBT_CHUNKED && !req->dechunkResponse) {
+		PUSH_STATIC_STRING("Transfer-Encoding: chunked\r\n");
 	}
 
 	if (req->stickySession) {
@@ -720,86 +791,121 @@ Controller::constructHeaderBuffersForResponse(Request *req, struct iovec *buffer
 		// Note that we do NOT set HttpOnly. If we set that flag then Chrome
 		// doesn't send cookies over WebSocket handshakes. Confirmed on Chrome 25.
 
-		const LString *cookieName = getStickySessionCookieName(req);
-		unsigned int stickySessionId;
-		unsigned int stickySessionIdSize;
-		char *stickySessionIdStr;
+		unsigned int stickySessionId = req->session->getStickySessionId();
 
-		PUSH_STATIC_BUFFER("Set-Cookie: ");
+		PUSH_STATIC_STRING("Set-Cookie: ");
+		PUSH_LSTRING(getStickySessionCookieName(req));
+		PUSH_STATIC_STRING("=");
+		PUSH_UINT(stickySessionId, uintSizeAsString(stickySessionId));
+		PUSH_STATIC_STRING("; Path=");
+		PUSH_STRING(baseURI.data(), baseURI.size());
+		PUSH_STATIC_STRING("\r\n");
+	}
 
-		part = cookieName->start;
-		while (part != NULL) {
-			if (buffers != NULL) {
-				BEGIN_PUSH_NEXT_BUFFER();
-				buffers[i].iov_base = (void *) part->data;
-				buffers[i].iov_len  = part->size;
-			}
-			dataSize += part->size;
-			INC_BUFFER_ITER(i);
-			part = part->next;
+	#ifndef NDEBUG
+		if (output != NULL) {
+			assert(size_t(pos - output) == size_t(result));
+			assert(size_t(pos - output) <= size_t(outputSize));
 		}
+	#endif
+	return result;
 
-		stickySessionId = req->session->getStickySessionId();
-		stickySessionIdSize = uintSizeAsString(stickySessionId);
-		stickySessionIdStr = (char *) psg_pnalloc(req->pool, stickySessionIdSize + 1);
-		uintToString(stickySessionId, stickySessionIdStr, stickySessionIdSize + 1);
-
-		PUSH_STATIC_BUFFER("=");
+	#undef PUSH_STATIC_STRING
+	#undef PUSH_STRING
+	#undef PUSH_LSTRING
+	#undef PUSH_UINT
+}
 
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = stickySessionIdStr;
-			buffers[i].iov_len  = stickySessionIdSize;
-		}
-		dataSize += stickySessionIdSize;
-		INC_BUFFER_ITER(i);
+/**
+ * Construct the buffers that together contain the HTTP response header that
+ * should be sent to the client. The first buffer contains the output of
+ * constructHeaderForResponse(), allocated from `req->pool`. The second buffer
+ * is the static trailer returned by getResponseTrailer(). `buffers` must have
+ * space for at least 2 items.
+ *
+ * Returns the number of buffers. The total data size is stored in `dataSize`,
+ * and the size of the turbocacheable prefix of the first buffer in `cacheableSize`.
+ */
+unsigned int
+Controller::constructHeaderBuffersForResponse(Request *req, struct iovec *buffers,
+	unsigned int &dataSize, unsigned int &cacheableSize)
+{
+	unsigned int size = constructHeaderForResponse(req, NULL, 0, cacheableSize);
+	char *header = (char *) psg_pnalloc(req->pool, size);
+	StaticString trailer = getResponseTrailer(req,
+		req->appResponse.bodyType == AppResponse::RBT_UPGRADE);
+
+	constructHeaderForResponse(req, header, size, cacheableSize);
+	buffers[0].iov_base = header;
+	buffers[0].iov_len  = size;
+	buffers[1].iov_base = (void *) trailer.data();
+	buffers[1].iov_len  = trailer.size();
+	dataSize = size + trailer.size();
+	return 2;
+}
 
-		PUSH_STATIC_BUFFER("; Path=");
+/**
+ * Returns the "Date: ...\r\n" header line for the current event loop time.
+ * The line is formatted at most once per second.
+ */
+StaticString
+Controller::getDateHeader() {
+	time_t now = (time_t) ev_now(getLoop());
+	if (OXT_UNLIKELY(now != dateHeaderTime)) {
+		char *pos = dateHeader;
+		const char *end = dateHeader + sizeof(dateHeader) - 1;
+		struct tm the_tm;
+
+		pos = appendData(pos, end, "Date: ");
+		gmtime_r(&now, &the_tm);
+		pos += strftime(pos, end - pos, "%a, %d %b %Y %H:%M:%S GMT", &the_tm);
+		pos = appendData(pos, end, "\r\n");
+		dateHeaderSize = pos - dateHeader;
+		dateHeaderTime = now;
+	}
+	return StaticString(dateHeader, dateHeaderSize);
+}
 
-		if (buffers != NULL) {
-			BEGIN_PUSH_NEXT_BUFFER();
-			buffers[i].iov_base = (void *) baseURI.data();
-			buffers[i].iov_len  = baseURI.size();
-		}
-		dataSize += baseURI.size();
-		INC_BUFFER_ITER(i);
+/**
+ * Returns the static part of the response header that follows
+ * constructHeaderForResponse()'s output: the Connection header (if any), the
+ * X-Powered-By header and the terminating empty line. Every combination is a
+ * string literal, so nothing needs to be formatted or copied.
+ */
+StaticString
+Controller::getResponseTrailer(Request *req, bool upgrade) const {
+	#ifdef PASSENGER_IS_ENTERPRISE
+		#define POWERED_BY "X-Powered-By: " PROGRAM_NAME " Enterprise"
+	#else
+		#define POWERED_BY "X-Powered-By: " PROGRAM_NAME
+	#endif
+	#define TRAILER(connectionHeader) \
+		(showVersionInHeader \
+			? P_STATIC_STRING(connectionHeader POWERED_BY " " PASSENGER_VERSION "\r\n\r\n") \
+			: P_STATIC_STRING(connectionHeader POWERED_BY "\r\n\r\n"))
 
-		PUSH_STATIC_BUFFER("\r\n");
-	}
+	unsigned int httpVersion = req->httpMajor * 1000 + req->httpMinor * 10;
 
-	if (showVersionInHeader) {
-		#ifdef PASSENGER_IS_ENTERPRISE
-			PUSH_STATIC_BUFFER("X-Powered-By: " PROGRAM_NAME " Enterprise " PASSENGER_VERSION "\r\n\r\n");
-		#else
-			PUSH_STATIC_BUFFER("X-Powered-By: " PROGRAM_NAME " " PASSENGER_VERSION "\r\n\r\n");
-		#endif
+	if (upgrade) {
+		return TRAILER("Connection: upgrade\r\n");
+	} else if (canKeepAlive(req)) {
+		if (httpVersion < 1010) {
+			// HTTP < 1.1 defaults to "Connection: close"
+			return TRAILER("Connection: keep-alive\r\n");
+		} else {
+			return TRAILER("");
+		}
 	} else {
-		#ifdef PASSENGER_IS_ENTERPRISE
-			PUSH_STATIC_BUFFER("X-Powered-By: " PROGRAM_NAME " Enterprise\r\n\r\n");
-		#else
-			PUSH_STATIC_BUFFER("X-Powered-By: " PROGRAM_NAME "\r\n\r\n");
-		#endif
+		if (httpVersion >= 1010) {
+			// HTTP 1.1 defaults to "Connection: keep-alive"
+			return TRAILER("Connection: close\r\n");
+		} else {
+			return TRAILER("");
+		}
 	}
 
-	nbuffers = i;
-	return true;
-
-	#undef BEGIN_PUSH_NEXT_BUFFER
-	#undef INC_BUFFER_ITER
-	#undef PUSH_STATIC_BUFFER
-}
-
-unsigned int
-Controller::constructDateHeaderBuffersForResponse(char *dateStr, unsigned int bufsize) {
-	char *pos = dateStr;
-	const char *end = dateStr + bufsize - 1;
-	time_t the_time = (time_t) ev_now(getContext()->libev->getLoop());
-	struct tm the_tm;
-
-	pos = appendData(pos, end, "Date: ");
-	gmtime_r(&the_time, &the_tm);
-	pos += strftime(pos, end - pos, "%a, %d %b %Y %H:%M:%S GMT", &the_tm);
-	return pos - dateStr;
+	#undef POWERED_BY
+	#undef TRAILER
 }
 
 bool
@@ -813,53 +919,37 @@ Controller::sendResponseHeaderWithWritev(Client *client, Request *req,
 		return true;
 	}
 
-	unsigned int maxbuffers = std::min<unsigned int>(
-		8 + req->appResponse.headers.size() * 4 + 11, IOV_MAX);
-	struct iovec *buffers = (struct iovec *) psg_palloc(req->pool,
-		sizeof(struct iovec) * maxbuffers);
-	unsigned int nbuffers, dataSize, nCacheableBuffers;
+	struct iovec buffers[2];
+	unsigned int nbuffers, dataSize, cacheableSize;
 
-	if (constructHeaderBuffersForResponse(req, buffers,
-		maxbuffers, nbuffers, dataSize, nCacheableBuffers))
-	{
-		SKC_TRACE(client, 2, "Sending response headers using writev()");
-		logResponseHeaders(client, req, buffers, nbuffers, dataSize);
-		markHeaderBuffersForTurboCaching(client, req, buffers, nCacheableBuffers);
-
-		ssize_t ret;
-		do {
-			ret = writev(client->getFd(), buffers, nbuffers);
-		} while (ret == -1 && errno == EINTR);
-		bytesWritten = ret;
-		req->responseBegun |= ret > 0;
-		return ret == (ssize_t) dataSize;
-	} else {
-		bytesWritten = 0;
-		return false;
-	}
+	nbuffers = constructHeaderBuffersForResponse(req, buffers, dataSize,
+		cacheableSize);
+	SKC_TRACE(client, 2, "Sending response headers using writev()");
+	logResponseHeaders(client, req, buffers, nbuffers, dataSize);
+	markHeaderForTurboCaching(client, req, (const char *) buffers[0].iov_base,
+		cacheableSize);
+
+	ssize_t ret;
+	do {
+		ret = writev(client->getFd(), buffers, nbuffers);
+	} while (ret == -1 && errno == EINTR);
+	bytesWritten = ret;
+	req->responseBegun |= ret > 0;
+	return ret == (ssize_t) dataSize;
 }
 
 void
 Controller::sendResponseHeaderWithBuffering(Client *client, Request *req,
 	unsigned int offset)
 {
-	struct iovec *buffers;
-	unsigned int nbuffers, dataSize, nCacheableBuffers;
-	bool ok;
-
-	ok = constructHeaderBuffersForResponse(req, NULL, 0, nbuffers, dataSize,
-		nCacheableBuffers);
-	assert(ok);
-
-	buffers = (struct iovec *) psg_palloc(req->pool,
-		sizeof(struct iovec) * nbuffers);
-	ok = constructHeaderBuffersForResponse(req, buffers, nbuffers,
-		nbuffers, dataSize, nCacheableBuffers);
-	assert(ok);
-	(void) ok; // Shut up compiler warning
+	struct iovec buffers[2];
+	unsigned int nbuffers, dataSize, cacheableSize;
 
+	nbuffers = constructHeaderBuffersForResponse(req, buffers, dataSize,
+		cacheableSize);
 	logResponseHeaders(client, req, buffers, nbuffers, dataSize);
-	markHeaderBuffersForTurboCaching(client, req, buffers, nCacheableBuffers);
+	markHeaderForTurboCaching(client, req, (const char *) buffers[0].iov_base,
+		cacheableSize);
 
 	MemoryKit::mbuf_pool &mbuf_pool = getContext()->mbuf_pool;
 	const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
@@ -915,17 +1005,13 @@ Controller::logResponseHeaders(Client *client, Request *req, struct iovec *buffe
 }
 
 void
-Controller::markHeaderBuffersForTurboCaching(Client *client, Request *req,
-	struct iovec *buffers, unsigned int nbuffers)
+Controller::markHeaderForTurboCaching(Client *client, Request *req,
+	const char *data, unsigned int size)
 {
-	if (turboCaching.isEnabled() && !req->cacheKey.empty()) {
-		unsigned int totalSize = 0;
-
-		for (unsigned int i = 0; i < nbuffers; i++) {
-			totalSize += buffers[i].iov_len;
-		}
-
-		if (totalSize > ResponseCache<Request>::MAX_HEADER_SIZE) {
+	if (turboCaching.isEnabled() && req->turboCacheCapture != NULL
+	 && !req->cacheKey.empty())
+	{
+		if (size > ResponseCache<Request>::MAX_HEADER_SIZE) {
 			SKC_DEBUG(client, "Response headers larger than " <<
 				ResponseCache<Request>::MAX_HEADER_SIZE <<
 				" bytes, so response is not eligible for turbocaching");
@@ -933,8 +1019,8 @@ Controller::markHeaderBuffersForTurboCaching(Client *client, Request *req,
 			turboCaching.responseCache.incStores();
 			req->cacheKey = HashedStaticString();
 		} else {
-			req->appResponse.headerCacheBuffers = buffers;
-			req->appResponse.nHeaderCacheBuffers = nbuffers;
+			req->turboCacheCapture->headerData = data;
+			req->turboCacheCapture->headerSize = size;
 		}
 	}
 }
@@ -975,17 +1061,136 @@ Controller::writeResponseAndMarkForTurboCaching(Client *client, Request *req,
 	const MemoryKit::mbuf &buffer)
 {
 	if (OXT_LIKELY(benchmarkMode != BM_RESPONSE_BEGIN)) {
-		writeResponse(client, buffer);
+		if (req->responseCompressor == NULL) {
+			writeResponse(client, buffer);
+		} else {
+			writeCompressedResponseBody(client, req, buffer.start, buffer.size(),
+				ServerKit::GzipCompressor::NO_FLUSH);
+		}
 	}
 	markResponsePartForTurboCaching(client, req, buffer);
 }
 
+/**
+ * Compresses the given response body data and writes the output as HTTP
+ * chunks. With FINISH, the gzip trailer and the terminating chunk are
+ * written as well.
+ *
+ * Deflate buffers its input to find matches, so after NO_FLUSH, the client
+ * may not receive anything yet. A SYNC_FLUSH is scheduled for the next event
+ * loop iteration, so that a streaming response is still delivered promptly
+ * while all data that the app sent within a single iteration is compressed
+ * as a whole.
+ */
+void
+Controller::writeCompressedResponseBody(Client *client, Request *req,
+	const char *data, size_t size, ServerKit::GzipCompressor::Flush flush)
+{
+	ServerKit::GzipCompressor *compressor = req->responseCompressor;
+	char output[1024 * 16];
+	bool done;
+
+	compressor->feed(data, size);
+	do {
+		size_t outputSize = compressor->compress(output, sizeof(output), flush, done);
+		bool finished = compressor->isFinished();
+		if (outputSize == 0 && !finished) {
+			continue;
+		}
+
+		char chunkSize[2 * sizeof(size_t) + 1];
+		unsigned int chunkSizeLen = 0;
+		size_t total = 0;
+		if (outputSize > 0) {
+			chunkSizeLen = integerToHex<size_t>(outputSize, chunkSize);
+			total += chunkSizeLen + outputSize + 4;
+		}
+		if (finished) {
+			total += sizeof("0\r\n\r\n") - 1;
+		}
+
+		MemoryKit::mbuf buffer(MemoryKit::mbuf_get_with_size(
+			&getContext()->mbuf_pool, total));
+		char *pos = buffer.start;
+		const char *end = buffer.start + total;
+		if (outputSize > 0) {
+			pos = appendData(pos, end, chunkSize, chunkSizeLen);
+			pos = appendData(pos, end, "\r\n", 2);
+			pos = appendData(pos, end, output, outputSize);
+			pos = appendData(pos, end, "\r\n", 2);
+		}
+		if (finished) {
+			pos = appendData(pos, end, "0\r\n\r\n");
+		}
+		assert(pos == end);
+
+		writeResponse(client, buffer);
+		if (req->ended()) {
+			return;
+		}
+	} while (!done);
+
+	if (compressor->hasUnflushedInput() && !req->responseCompressionFlushScheduled) {
+		req->responseCompressionFlushScheduled = true;
+		refRequest(req, __FILE__, __LINE__);
+		getContext()->libev->runLater(boost::bind(flushResponseCompressionLater, req));
+	}
+}
+
+void
+Controller::flushResponseCompressionLater(Request *req) {
+	Client *client = static_cast<Client *>(req->client);
+	Controller *self = static_cast<Controller *>(
+		Controller::getServerFromClient(client));
+	SKC_LOG_EVENT_FROM_STATIC(self, Controller, client, "flushResponseCompressionLater");
+
+	req->responseCompressionFlushScheduled = false;
+	if (!req->ended() && req->responseCompressor != NULL
+	 && !req->responseCompressor->isFinished()
+	 && req->responseCompressor->hasUnflushedInput())
+	{
+		SKC_TRACE_FROM_STATIC(self, client, 3, "Flushing compressed response data");
+		self->writeCompressedResponseBody(client, req, NULL, 0,
+			ServerKit::GzipCompressor::SYNC_FLUSH);
+	}
+	self->unrefRequest(req, __FILE__, __LINE__);
+}
+
+void
+Controller::finishResponseCompression(Client *client, Request *req) {
+	if (req->responseCompressor != NULL && !req->responseCompressor->isFinished()
+	 && !req->ended())
+	{
+		writeCompressedResponseBody(client, req, NULL, 0,
+			ServerKit::GzipCompressor::FINISH);
+	}
+}
+
+void
+Controller::releaseResponseCompressor(Request *req) {
+	assert(activeResponseCompressors > 0);
+	activeResponseCompressors--;
+	if (idleResponseCompressors.size() < MAX_IDLE_RESPONSE_COMPRESSORS) {
+		idleResponseCompressors.push_back(req->responseCompressor);
+	} else {
+		delete req->responseCompressor;
+	}
+	req->responseCompressor = NULL;
+}
+
+bool
+Controller::capturingResponseBodyForTurboCaching(const Request *req) const {
+	return !req->ended() && turboCaching.isEnabled() && req->turboCacheCapture != NULL
+		&& !req->cacheKey.empty();
+}
+
 void
 Controller::markResponsePartForTurboCaching(Client *client, Request *req,
 	const MemoryKit::mbuf &buffer)
 {
-	if (!req->ended() && turboCaching.isEnabled() && !req->cacheKey.empty()) {
-		unsigned int totalSize = req->appResponse.bodyCacheBuffer.size + buffer.size();
+	if (capturingResponseBodyForTurboCaching(req)) {
+		LString *body = &req->turboCacheCapture->body;
+		unsigned int totalSize = body->size + buffer.size();
 		if (totalSize > ResponseCache<Request>::MAX_BODY_SIZE) {
 			SKC_DEBUG(client, "Response body larger than " <<
 				ResponseCache<Request>::MAX_HEADER_SIZE <<
@@ -993,9 +1198,9 @@ Controller::markResponsePartForTurboCaching(Client *client, Request *req,
 			// Decrease store success ratio.
 			turboCaching.responseCache.incStores();
 			req->cacheKey = HashedStaticString();
-			psg_lstr_deinit(&req->appResponse.bodyCacheBuffer);
+			psg_lstr_deinit(body);
 		} else {
-			psg_lstr_append(&req->appResponse.bodyCacheBuffer, req->pool, buffer,
+			psg_lstr_append(body, req->pool, buffer,
 				buffer.start, buffer.size());
 		}
 	}
@@ -1075,6 +1280,8 @@ Controller::handleAppResponseBodyEnd(Client *client, Request *req) {
 	storeAppResponseInTurboCache(client, req);
 	finalizeUnionStationWithSuccess(client, req);
 	assert(!req->ended());
+	// May end the request if writing to the client fails.
+	finishResponseCompression(client, req);
 }
 
 OXT_FORCE_INLINE void
@@ -1101,35 +1308,46 @@ Controller::keepAliveAppConnection(Client *client, Request *req) {
 
 void
 Controller::storeAppResponseInTurboCache(Client *client, Request *req) {
-	if (turboCaching.isEnabled() && !req->cacheKey.empty()) {
+	if (turboCaching.isEnabled() && req->turboCacheCapture != NULL
+	 && !req->cacheKey.empty())
+	{
 		TRACE_POINT();
-		AppResponse *resp = &req->appResponse;
-		unsigned int headerSize = 0;
-		unsigned int i;
-
-		for (i = 0; i < resp->nHeaderCacheBuffers; i++) {
-			headerSize += resp->headerCacheBuffers[i].iov_len;
-		}
+		Request::TurboCacheCapture *capture = req->turboCacheCapture;
 		ResponseCache<Request>::Entry entry(
 			turboCaching.responseCache.store(req, ev_now(getLoop()),
-				headerSize, resp->bodyCacheBuffer.size));
+				capture->headerSize, capture->body.size));
 		if (entry.valid()) {
 			UPDATE_TRACE_POINT();
 			SKC_DEBUG(client, "Storing app response in turbocache");
 			SKC_TRACE(client, 2, "Turbocache entries:\n" << turboCaching.responseCache.inspect());
 
-			gatherBuffers(entry.body->httpHeaderData,
-				ResponseCache<Request>::MAX_HEADER_SIZE,
-				resp->headerCacheBuffers, resp->nHeaderCacheBuffers);
+			memcpy(entry.body->httpHeaderData, capture->headerData,
+				capture->headerSize);
 
 			char *pos = entry.body->httpBodyData;
 			const char *end = entry.body->httpBodyData
 				+ ResponseCache<Request>::MAX_BODY_SIZE;
-			const LString::Part *part = resp->bodyCacheBuffer.start;
+			const LString::Part *part = capture->body.start;
 			while (part != NULL) {
 				pos = appendData(pos, end, part->data, part->size);
 				part = part->next;
 			}
+
+			// Compressing once at store time is much cheaper than compressing
+			// every cache hit. The variant is only worth storing if it's smaller.
+			// Both variants are served with the captured header, so a response
+			// that went out uncompressed with a strong ETag doesn't get one.
+			if (req->compressibleResponse && capture->body.size > 1
+			 && !appResponseHasStrongETag(req))
+			{
+				UPDATE_TRACE_POINT();
+				entry.body->httpGzipBodySize = turboCacheCompressor.compressAll(
+					TURBOCACHE_COMPRESSION_LEVEL,
+					entry.body->httpBodyData, capture->body.size,
+					entry.body->httpGzipBodyData, capture->body.size - 1);
+				SKC_TRACE(client, 2, "Turbocache: gzip variant is " <<
+					entry.body->httpGzipBodySize << " bytes");
+			}
 		} else {
 			SKC_DEBUG(client, "Could not store app response for turbocaching");
 		}
@@ -1138,8 +1356,8 @@ Controller::storeAppResponseInTurboCache(Client *client, Request *req) {
 
 void
 Controller::finalizeUnionStationWithSuccess(Client *client, Request *req) {
-	req->endStopwatchLog(&req->stopwatchLogs.requestProxying, true);
-	req->endStopwatchLog(&req->stopwatchLogs.requestProcessing, true);
+	req->endStopwatchLog(&Request::StopwatchLogs::requestProxying, true);
+	req->endStopwatchLog(&Request::StopwatchLogs::requestProcessing, true);
 }
 
 
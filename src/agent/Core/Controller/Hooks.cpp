@@ -104,9 +104,36 @@ Controller::onRequestObjectCreated(Client *client, Request *req) {
 	req->appSource.setHooks(&req->hooks);
 	req->appSource.setDataCallback(_onAppSourceData);
 
-	req->bodyBuffer.setContext(getContext());
-	req->bodyBuffer.setHooks(&req->hooks);
-	req->bodyBuffer.setDataCallback(onBodyBufferData);
+	req->appResponseTimer.callback = onAppResponseTimeout;
+	req->appResponseTimer.userData = req;
+
+	ev_io_init(&req->appConnectWatcher, onAppConnectWritable, -1, EV_WRITE);
+	req->appConnectWatcher.data = req;
+	ev_timer_init(&req->appConnectRetryTimer, onAppConnectRetryTimeout, 0, 0);
+	req->appConnectRetryTimer.data = req;
+	req->appConnectTimer.callback = onAppConnectTimeout;
+	req->appConnectTimer.userData = req;
+}
+
+void
+Controller::onRequestObjectReleased(Client *client, Request *req) {
+	ParentClass::onRequestObjectReleased(client, req);
+
+	if (req->bodyBuffer != NULL) {
+		bodyBufferSlab.destroy(req->bodyBuffer);
+		req->bodyBuffer = NULL;
+	}
+	if (req->stopwatchLogs != NULL) {
+		stopwatchLogsSlab.destroy(req->stopwatchLogs);
+		req->stopwatchLogs = NULL;
+	}
+	if (req->turboCacheCapture != NULL) {
+		turboCacheCaptureSlab.destroy(req->turboCacheCapture);
+		req->turboCacheCapture = NULL;
+	}
+	if (req->responseCompressor != NULL) {
+		releaseResponseCompressor(req);
+	}
 }
 
 void
@@ -120,26 +147,33 @@ void
 Controller::reinitializeRequest(Client *client, Request *req) {
 	ParentClass::reinitializeRequest(client, req);
 
-	// bodyBuffer is initialized in Controller::beginBufferingBody().
+	// bodyBuffer is attached in Controller::beginBufferingBody().
+	// stopwatchLogs is attached in Controller::initializeUnionStation().
+	// turboCacheCapture is attached in Controller::prepareAppResponseCaching().
+	// responseCompressor is attached in Controller::prepareAppResponseCompression().
 	// appSink and appSource are initialized in Controller::checkoutSession().
 
 	req->startedAt = 0;
 	req->state = Request::ANALYZING_REQUEST;
 	req->dechunkResponse = false;
 	req->requestBodyBuffering = false;
+	req->bodyBufferingMode = Request::BUFFER_ENTIRE_BODY;
 	req->https = false;
 	req->stickySession = false;
 	req->sessionCheckoutTry = 0;
+	req->appConnectRetries = 0;
 	req->halfClosePolicy = Request::HALF_CLOSE_POLICY_UNINITIALIZED;
 	req->appResponseInitialized = false;
 	req->strip100ContinueHeader = false;
 	req->hasPragmaHeader = false;
+	req->compressibleResponse = false;
+	req->responseCompressionFlushScheduled = false;
 	req->host = NULL;
-	req->bodyBytesBuffered = 0;
 	req->cacheKey = HashedStaticString();
 	req->cacheControl = NULL;
 	req->varyCookie = NULL;
 	req->envvars = NULL;
+	req->appGroupMetrics = NULL;
 
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		req->timedAppPoolGet = false;
@@ -153,19 +187,32 @@ Controller::reinitializeRequest(Client *client, Request *req) {
 
 void
 Controller::deinitializeRequest(Client *client, Request *req) {
+	if (req->appGroupMetrics != NULL && req->startedAt != 0) {
+		ev_tstamp duration = ev_now(getLoop()) - req->startedAt;
+		req->appGroupMetrics->requestDurations.record(
+			(duration > 0) ? (boost::uint64_t) (duration * 1000000) : 0);
+	}
+
+	getContext()->timerWheel.cancel(&req->appResponseTimer);
+	stopInitiatingSession(req);
 	req->session.reset();
 
-	req->endStopwatchLog(&req->stopwatchLogs.getFromPool, false);
-	req->endStopwatchLog(&req->stopwatchLogs.bufferingRequestBody, false);
-	req->endStopwatchLog(&req->stopwatchLogs.requestProxying, false);
-	req->endStopwatchLog(&req->stopwatchLogs.requestProcessing, false);
+	req->endStopwatchLog(&Request::StopwatchLogs::getFromPool, false);
+	req->endStopwatchLog(&Request::StopwatchLogs::bufferingRequestBody, false);
+	req->endStopwatchLog(&Request::StopwatchLogs::requestProxying, false);
+	req->endStopwatchLog(&Request::StopwatchLogs::requestProcessing, false);
 
 	req->options.transaction.reset();
 
 	req->appSink.setConsumedCallback(NULL);
 	req->appSink.deinitialize();
 	req->appSource.deinitialize();
-	req->bodyBuffer.deinitialize();
+	if (req->bodyBuffer != NULL) {
+		req->bodyBuffer->channel.deinitialize();
+	}
+	if (req->turboCacheCapture != NULL) {
+		psg_lstr_deinit(&req->turboCacheCapture->body);
+	}
 
 	/***************/
 	/***************/
@@ -199,10 +246,6 @@ Controller::reinitializeAppResponse(Client *client, Request *req) {
 	resp->cacheControl = NULL;
 	resp->expiresHeader = NULL;
 	resp->lastModifiedHeader = NULL;
-
-	resp->headerCacheBuffers = NULL;
-	resp->nHeaderCacheBuffers = 0;
-	psg_lstr_init(&resp->bodyCacheBuffer);
 }
 
 void
@@ -240,13 +283,20 @@ Controller::deinitializeAppResponse(Client *client, Request *req) {
 	if (resp->setCookie != NULL) {
 		psg_lstr_deinit(resp->setCookie);
 	}
-	psg_lstr_deinit(&resp->bodyCacheBuffer);
 }
 
 ServerKit::Channel::Result
 Controller::onRequestBody(Client *client, Request *req, const MemoryKit::mbuf &buffer,
 	int errcode)
 {
+	if (req->requestBodyBuffering
+	 && req->bodyBufferingMode == Request::STREAM_BUFFERED_BODY)
+	{
+		// The session has already been checked out, but the client body
+		// still goes through the body buffer.
+		return whenBufferingBody_onRequestBody(client, req, buffer, errcode);
+	}
+
 	switch (req->state) {
 	case Request::BUFFERING_REQUEST_BODY:
 		return whenBufferingBody_onRequestBody(client, req, buffer, errcode);
@@ -115,7 +115,9 @@ Controller::respondFromTurboCache(Client *client, Request *req) {
 		if (entry.valid()) {
 			SKC_TRACE(client, 2, "Turbocaching: cache hit (key \"" <<
 				cEscapeString(req->cacheKey) << "\")");
-			turboCaching.writeResponse(this, client, req, entry);
+			turboCaching.writeResponse(this, client, req, entry,
+				responseCompression && entry.body->httpGzipBodySize > 0
+					&& requestAcceptsGzip(req));
 			if (!req->ended()) {
 				endRequest(&client, &req);
 			}
@@ -208,6 +210,12 @@ Controller::fillPoolOptionsFromAgentsOptions(Options &options) {
 	options.minProcesses = agentsOptions->getInt("min_instances");
 	options.maxPreloaderIdleTime = agentsOptions->getInt("max_preloader_idle_time");
 	options.maxRequestQueueSize = agentsOptions->getInt("max_request_queue_size");
+	options.requestQueueTimeout = agentsOptions->getInt("request_queue_timeout");
+	options.requestQueueTargetDelay = agentsOptions->getInt("request_queue_target_delay");
+	options.uploadStreamingThreshold = agentsOptions->getInt("upload_streaming_threshold");
+	options.oobwMinSpareConcurrency = agentsOptions->getInt("oobw_min_spare_concurrency");
+	options.memoryRecycleLimit = agentsOptions->getInt("memory_recycle_limit");
+	options.memoryRecyclePressureThreshold = agentsOptions->getInt("memory_recycle_pressure_threshold");
 	options.abortWebsocketsOnProcessShutdown = agentsOptions->getBool("abort_websockets_on_process_shutdown");
 	options.forceMaxConcurrentRequestsPerProcess = agentsOptions->getInt("force_max_concurrent_requests_per_process");
 	options.spawnMethod = agentsOptions->get("spawn_method");
@@ -376,6 +384,12 @@ Controller::createNewPoolOptions(Client *client, Request *req,
 	fillPoolOptionSecToMsec(req, options.startTimeout, "!~PASSENGER_START_TIMEOUT");
 	fillPoolOption(req, options.maxPreloaderIdleTime, "!~PASSENGER_MAX_PRELOADER_IDLE_TIME");
 	fillPoolOption(req, options.maxRequestQueueSize, "!~PASSENGER_MAX_REQUEST_QUEUE_SIZE");
+	fillPoolOption(req, options.requestQueueTimeout, "!~PASSENGER_REQUEST_QUEUE_TIMEOUT");
+	fillPoolOption(req, options.requestQueueTargetDelay, "!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY");
+	fillPoolOption(req, options.uploadStreamingThreshold, "!~PASSENGER_UPLOAD_STREAMING_THRESHOLD");
+	fillPoolOption(req, options.oobwMinSpareConcurrency, "!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY");
+	fillPoolOption(req, options.memoryRecycleLimit, "!~PASSENGER_MEMORY_RECYCLE_LIMIT");
+	fillPoolOption(req, options.memoryRecyclePressureThreshold, "!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD");
 	fillPoolOption(req, options.abortWebsocketsOnProcessShutdown, "!~PASSENGER_ABORT_WEBSOCKETS_ON_PROCESS_SHUTDOWN");
 	fillPoolOption(req, options.forceMaxConcurrentRequestsPerProcess, "!~PASSENGER_FORCE_MAX_CONCURRENT_REQUESTS_PER_PROCESS");
 	fillPoolOption(req, options.restartDir, "!~PASSENGER_RESTART_DIR");
@@ -421,7 +435,10 @@ Controller::initializeUnionStation(Client *client, Request *req, RequestAnalysis
 			options.unionStationKey = StaticString(key->start->data, key->size);
 		}
 
-		req->beginStopwatchLog(&req->stopwatchLogs.requestProcessing, "request processing");
+		if (req->stopwatchLogs == NULL) {
+			req->stopwatchLogs = stopwatchLogsSlab.construct();
+		}
+		req->beginStopwatchLog(&Request::StopwatchLogs::requestProcessing, "request processing");
 		req->logMessage(string("Request method: ") + http_method_str(req->method));
 		req->logMessage("URI: " + StaticString(req->path.start->data, req->path.size));
 	}
@@ -512,7 +529,11 @@ Controller::onRequestBegin(Client *client, Request *req) {
 		setStickySessionId(client, req);
 	}
 
-	if (!req->hasBody() || !req->requestBodyBuffering) {
+	if (req->hasBody() && shouldBufferBodyAdaptively(req)) {
+		req->requestBodyBuffering = true;
+		req->bodyBufferingMode = Request::BUFFER_ADAPTIVELY;
+		beginBufferingBody(client, req);
+	} else if (!req->hasBody() || !req->requestBodyBuffering) {
 		req->requestBodyBuffering = false;
 		checkoutSession(client, req);
 	} else {
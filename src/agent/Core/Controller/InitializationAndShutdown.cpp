@@ -51,11 +51,16 @@ Controller::Controller(ServerKit::Context *context, const VariantMap *_agentsOpt
 
 	  statThrottleRate(_agentsOptions->getInt("stat_throttle_rate")),
 	  responseBufferHighWatermark(_agentsOptions->getInt("response_buffer_high_watermark")),
+	  appResponseTimeout(0),
+	  appConnectTimeout(5),
 	  benchmarkMode(parseBenchmarkMode(_agentsOptions->get("benchmark_mode", false))),
 	  singleAppMode(false),
 	  showVersionInHeader(_agentsOptions->getBool("show_version_in_header")),
 	  stickySessions(_agentsOptions->getBool("sticky_sessions")),
 	  gracefulExit(_agentsOptions->getBool("core_graceful_exit")),
+	  responseCompression(_agentsOptions->getBool("response_compression", false, false)),
+	  responseCompressionLevel(clamp<int>(_agentsOptions->getInt("response_compression_level",
+		  false, DEFAULT_RESPONSE_COMPRESSION_LEVEL), 1, 9)),
 
 	  agentsOptions(_agentsOptions),
 	  stringPool(psg_create_pool(1024 * 4)),
@@ -81,9 +86,18 @@ Controller::Controller(ServerKit::Context *context, const VariantMap *_agentsOpt
 	  HTTP_CONNECTION("connection"),
 	  HTTP_STATUS("status"),
 	  HTTP_TRANSFER_ENCODING("transfer-encoding"),
+	  HTTP_ACCEPT_ENCODING("accept-encoding"),
+	  HTTP_CONTENT_ENCODING("content-encoding"),
+	  HTTP_CONTENT_RANGE("content-range"),
+	  HTTP_CACHE_CONTROL("cache-control"),
+	  HTTP_ETAG("etag"),
+	  HTTP_VARY("vary"),
 
 	  threadNumber(_threadNumber),
-	  turboCaching(getTurboCachingInitialState(_agentsOptions))
+	  dateHeaderSize(0),
+	  dateHeaderTime(-1),
+	  turboCaching(getTurboCachingInitialState(_agentsOptions)),
+	  activeResponseCompressors(0)
 {
 	defaultRuby = psg_pstrdup(stringPool,
 		agentsOptions->get("default_ruby"));
@@ -111,6 +125,11 @@ Controller::Controller(ServerKit::Context *context, const VariantMap *_agentsOpt
 
 	generateServerLogName(_threadNumber);
 
+	// The client connection timeouts are disabled by default in
+	// ServerKit::HttpServer, because they don't suit all servers built on it.
+	keepAliveTimeout = 300;
+	headerReadTimeout = 60;
+
 	if (!agentsOptions->getBool("multi_app")) {
 		boost::shared_ptr<Options> options = boost::make_shared<Options>();
 
@@ -145,6 +164,9 @@ Controller::Controller(ServerKit::Context *context, const VariantMap *_agentsOpt
 Controller::~Controller() {
 	ev_check_stop(getLoop(), &checkWatcher);
 	psg_destroy_pool(stringPool);
+	for (unsigned int i = 0; i < idleResponseCompressors.size(); i++) {
+		delete idleResponseCompressors[i];
+	}
 }
 
 void
@@ -0,0 +1,247 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_CONTROLLER_METRICS_H_
+#define _PASSENGER_CORE_CONTROLLER_METRICS_H_
+
+#include <boost/cstdint.hpp>
+#include <string>
+#include <map>
+#include <cstdio>
+#include <Algorithms/Histogram.h>
+#include <StaticString.h>
+#include <Utils/StrIntUtils.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+
+
+/**
+ * Per-app group metrics, owned by a single Controller and only written to
+ * from that Controller's event loop thread.
+ */
+struct AppGroupMetrics {
+	/** Time between the beginning of a request and its deinitialization,
+	 * in microseconds.
+	 */
+	Histogram requestDurations;
+	/** Time spent waiting for ApplicationPool to return a session, in microseconds. */
+	Histogram sessionCheckoutWaits;
+	/** For requests with a body: time between the beginning of the request
+	 * and sending its header to the app, in microseconds. Separately for
+	 * requests whose body was buffered entirely and for requests whose body
+	 * was streamed.
+	 */
+	Histogram bufferedBodyTimesToApp;
+	Histogram streamedBodyTimesToApp;
+
+	void merge(const AppGroupMetrics &other) {
+		requestDurations.merge(other.requestDurations);
+		sessionCheckoutWaits.merge(other.sessionCheckoutWaits);
+		bufferedBodyTimesToApp.merge(other.bufferedBodyTimesToApp);
+		streamedBodyTimesToApp.merge(other.streamedBodyTimesToApp);
+	}
+};
+
+/**
+ * A snapshot of a Controller's metrics. Created on the Controller's event loop
+ * thread by `Controller::collectMetrics()`, and merged with the snapshots of
+ * other Controllers by the ApiServer.
+ */
+struct ControllerMetrics {
+	map<string, AppGroupMetrics> appGroups;
+	boost::uint64_t totalRequestsBegun;
+	unsigned int activeClients;
+	unsigned int turboCacheFetches;
+	unsigned int turboCacheHits;
+	unsigned int mbufFreeBlocks;
+	unsigned int mbufActiveBlocks;
+	unsigned int mbufBlockSize;
+	unsigned int pallocPools;
+	boost::uint64_t pallocReservedBytes;
+	boost::uint64_t pallocUsedBytes;
+
+	ControllerMetrics()
+		: totalRequestsBegun(0),
+		  activeClients(0),
+		  turboCacheFetches(0),
+		  turboCacheHits(0),
+		  mbufFreeBlocks(0),
+		  mbufActiveBlocks(0),
+		  mbufBlockSize(0),
+		  pallocPools(0),
+		  pallocReservedBytes(0),
+		  pallocUsedBytes(0)
+		{ }
+
+	void merge(const ControllerMetrics &other) {
+		map<string, AppGroupMetrics>::const_iterator it, end = other.appGroups.end();
+		for (it = other.appGroups.begin(); it != end; it++) {
+			appGroups[it->first].merge(it->second);
+		}
+		totalRequestsBegun += other.totalRequestsBegun;
+		activeClients += other.activeClients;
+		turboCacheFetches += other.turboCacheFetches;
+		turboCacheHits += other.turboCacheHits;
+		// Every Controller has its own ServerKit::Context and thus
+		// its own mbuf pool, so summing is correct.
+		mbufFreeBlocks += other.mbufFreeBlocks;
+		mbufActiveBlocks += other.mbufActiveBlocks;
+		mbufBlockSize = other.mbufBlockSize;
+		pallocPools += other.pallocPools;
+		pallocReservedBytes += other.pallocReservedBytes;
+		pallocUsedBytes += other.pallocUsedBytes;
+	}
+};
+
+
+/**
+ * Renders metrics in the Prometheus text exposition format, version 0.0.4.
+ * https://prometheus.io/docs/instrumenting/exposition_formats/
+ */
+class PrometheusWriter {
+private:
+	string result;
+
+	static string formatNumber(double value) {
+		char buf[32];
+		int size = snprintf(buf, sizeof(buf), "%.9g", value);
+		return string(buf, size);
+	}
+
+	static void appendEscapedLabelValue(string &output, const StaticString &value) {
+		const char *pos = value.data();
+		const char *end = value.data() + value.size();
+		while (pos < end) {
+			switch (*pos) {
+			case '\\':
+				output.append("\\\\", 2);
+				break;
+			case '"':
+				output.append("\\\"", 2);
+				break;
+			case '\n':
+				output.append("\\n", 2);
+				break;
+			default:
+				output.append(1, *pos);
+				break;
+			}
+			pos++;
+		}
+	}
+
+	void appendSampleName(const StaticString &name, const StaticString &suffix,
+		const StaticString &labels, const StaticString &extraLabel = StaticString())
+	{
+		result.append(name.data(), name.size());
+		result.append(suffix.data(), suffix.size());
+		if (!labels.empty() || !extraLabel.empty()) {
+			result.append(1, '{');
+			result.append(labels.data(), labels.size());
+			if (!labels.empty() && !extraLabel.empty()) {
+				result.append(1, ',');
+			}
+			result.append(extraLabel.data(), extraLabel.size());
+			result.append(1, '}');
+		}
+		result.append(1, ' ');
+	}
+
+public:
+	/** Formats a single label as `name="value"`, with the value escaped. */
+	static string label(const StaticString &name, const StaticString &value) {
+		string output;
+		output.reserve(name.size() + value.size() + 3);
+		output.append(name.data(), name.size());
+		output.append("=\"", 2);
+		appendEscapedLabelValue(output, value);
+		output.append(1, '"');
+		return output;
+	}
+
+	void declare(const StaticString &name, const StaticString &type,
+		const StaticString &help)
+	{
+		result.append("# HELP ");
+		result.append(name.data(), name.size());
+		result.append(1, ' ');
+		result.append(help.data(), help.size());
+		result.append("\n# TYPE ");
+		result.append(name.data(), name.size());
+		result.append(1, ' ');
+		result.append(type.data(), type.size());
+		result.append(1, '\n');
+	}
+
+	void sample(const StaticString &name, double value,
+		const StaticString &labels = StaticString())
+	{
+		appendSampleName(name, StaticString(), labels);
+		result.append(formatNumber(value));
+		result.append(1, '\n');
+	}
+
+	/**
+	 * Writes the given histogram as a Prometheus histogram. Bucket boundaries
+	 * are at 2^k - 1 raw units for k in [minMagnitude, maxMagnitude]. Because
+	 * Histogram buckets never straddle these boundaries, the cumulative bucket
+	 * counts are exact. All values are divided by `divisor` (e.g. 1000000 to
+	 * convert microseconds to seconds).
+	 */
+	void histogram(const StaticString &name, const Histogram &h,
+		unsigned int minMagnitude, unsigned int maxMagnitude,
+		double divisor = 1, const StaticString &labels = StaticString())
+	{
+		for (unsigned int k = minMagnitude; k <= maxMagnitude; k++) {
+			boost::uint64_t edge = (((boost::uint64_t) 1) << k) - 1;
+			string le = "le=\"" + formatNumber(edge / divisor) + "\"";
+			appendSampleName(name, "_bucket", labels, le);
+			result.append(toString(h.getCountAtOrBelow(edge)));
+			result.append(1, '\n');
+		}
+		appendSampleName(name, "_bucket", labels, "le=\"+Inf\"");
+		result.append(toString(h.getCount()));
+		result.append(1, '\n');
+		appendSampleName(name, "_sum", labels);
+		result.append(formatNumber(h.getSum() / divisor));
+		result.append(1, '\n');
+		appendSampleName(name, "_count", labels);
+		result.append(toString(h.getCount()));
+		result.append(1, '\n');
+	}
+
+	const string &str() const {
+		return result;
+	}
+};
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_CONTROLLER_METRICS_H_ */
@@ -33,12 +33,15 @@
 #include <ServerKit/HttpRequest.h>
 #include <ServerKit/FdSinkChannel.h>
 #include <ServerKit/FdSourceChannel.h>
+#include <ServerKit/TimerWheel.h>
+#include <ServerKit/HttpCompression.h>
 #include <Logging.h>
 #include <Core/ApplicationPool/Pool.h>
 #include <Core/UnionStation/Context.h>
 #include <Core/UnionStation/Transaction.h>
 #include <Core/UnionStation/StopwatchLog.h>
 #include <Core/Controller/AppResponse.h>
+#include <Core/Controller/Metrics.h>
 
 namespace Passenger {
 namespace Core {
@@ -66,6 +69,77 @@ public:
 		HALF_CLOSE_PERFORMED
 	};
 
+	/** Only meaningful if `requestBodyBuffering` is true. */
+	enum BodyBufferingMode {
+		// The session is checked out after the entire body is buffered.
+		BUFFER_ENTIRE_BODY,
+		// The upload rate is being measured in order to choose one of the
+		// other modes. See Controller::decideBodyBufferingMode().
+		BUFFER_ADAPTIVELY,
+		// The session has been checked out while the body is still being
+		// buffered. The app reads from the body buffer as it fills up.
+		STREAM_BUFFERED_BODY
+	};
+
+	/**
+	 * State for buffering the request body before forwarding it to the app.
+	 * Only attached when request body buffering is in effect.
+	 */
+	struct BodyBuffer {
+		ServerKit::FileBufferedChannel channel;
+		boost::uint64_t bytesBuffered; // After dechunking
+
+		BodyBuffer()
+			: bytesBuffered(0)
+			{ }
+	};
+
+	/**
+	 * Union Station stopwatch logs. Only attached when the request is
+	 * logged to Union Station.
+	 */
+	struct StopwatchLogs {
+		UnionStation::StopwatchLog *requestProcessing;
+		UnionStation::StopwatchLog *bufferingRequestBody;
+		UnionStation::StopwatchLog *getFromPool;
+		UnionStation::StopwatchLog *requestProxying;
+
+		StopwatchLogs() {
+			memset(this, 0, sizeof(StopwatchLogs));
+		}
+	};
+
+	/**
+	 * The parts of the app response that will be stored in the turbocache
+	 * once the response is complete. Only attached when the response is
+	 * eligible for turbocaching.
+	 */
+	struct TurboCacheCapture {
+		/* The part of the response header that can be cached. */
+		const char *headerData;
+		unsigned int headerSize;
+		/* All response body mbufs. */
+		LString body;
+
+		TurboCacheCapture()
+			: headerData(NULL),
+			  headerSize(0)
+		{
+			psg_lstr_init(&body);
+		}
+	};
+
+
+	/*
+	 * Fields are ordered by how often they're accessed. The fields up to and
+	 * including `options` are touched by every request. The cold parts at the
+	 * end are separately allocated from per-Controller slabs, and are NULL
+	 * unless a request needs them. They are freed in
+	 * Controller::onRequestObjectReleased() rather than in
+	 * deinitializeRequest(), because channel callbacks may still be on the
+	 * stack when a request ends.
+	 */
+
 	ev_tstamp startedAt;
 
 	State state: 3;
@@ -73,6 +147,7 @@ public:
 	bool requestBodyBuffering: 1;
 	bool https: 1;
 	bool stickySession: 1;
+	BodyBufferingMode bodyBufferingMode: 2;
 
 	// Range: 0..MAX_SESSION_CHECKOUT_TRY
 	boost::uint8_t sessionCheckoutTry: 4;
@@ -80,24 +155,26 @@ public:
 	bool appResponseInitialized: 1;
 	bool strip100ContinueHeader: 1;
 	bool hasPragmaHeader: 1;
+	// Whether the app response may be gzip-compressed, regardless of
+	// what the client accepts. Set in Controller::onAppResponseBegin().
+	bool compressibleResponse: 1;
+	bool responseCompressionFlushScheduled: 1;
+	boost::uint8_t appConnectRetries;
 
-	Options options;
 	AbstractSessionPtr session;
+	// Set when the session is checked out. Owned by the Controller.
+	AppGroupMetrics *appGroupMetrics;
 	const LString *host;
 
 	ServerKit::FdSinkChannel appSink;
 	ServerKit::FdSourceChannel appSource;
 	AppResponse appResponse;
+	ServerKit::TimerWheel::Entry appResponseTimer;
 
-	ServerKit::FileBufferedChannel bodyBuffer;
-	boost::uint64_t bodyBytesBuffered; // After dechunking
-
-	struct {
-		UnionStation::StopwatchLog *requestProcessing;
-		UnionStation::StopwatchLog *bufferingRequestBody;
-		UnionStation::StopwatchLog *getFromPool;
-		UnionStation::StopwatchLog *requestProxying;
-	} stopwatchLogs;
+	// Used while connecting to the app. See Controller::initiateSession().
+	struct ev_io appConnectWatcher;
+	struct ev_timer appConnectRetryTimer;
+	ServerKit::TimerWheel::Entry appConnectTimer;
 
 	HashedStaticString cacheKey;
 	LString *cacheControl;
@@ -110,6 +187,18 @@ public:
 	// This value is guaranteed to be contiguous.
 	LString *envvars;
 
+	Options options;
+
+	BodyBuffer *bodyBuffer;
+	StopwatchLogs *stopwatchLogs;
+	TurboCacheCapture *turboCacheCapture;
+	/**
+	 * Only attached when the response is being gzip-compressed. Borrowed
+	 * from Controller::idleResponseCompressors rather than allocated from
+	 * a slab, so that the zlib state is reused across requests.
+	 */
+	ServerKit::GzipCompressor *responseCompressor;
+
 	#ifdef DEBUG_CC_EVENT_LOOP_BLOCKING
 		bool timedAppPoolGet;
 		ev_tstamp timeBeforeAccessingApplicationPool;
@@ -119,10 +208,12 @@ public:
 
 
 	Request()
-		: BaseHttpRequest()
-	{
-		memset(&stopwatchLogs, 0, sizeof(stopwatchLogs));
-	}
+		: BaseHttpRequest(),
+		  bodyBuffer(NULL),
+		  stopwatchLogs(NULL),
+		  turboCacheCapture(NULL),
+		  responseCompressor(NULL)
+		{ }
 
 	const char *getStateString() const {
 		switch (state) {
@@ -143,22 +234,45 @@ public:
 		}
 	}
 
+	const char *getBodyBufferingModeString() const {
+		switch (bodyBufferingMode) {
+		case BUFFER_ENTIRE_BODY:
+			return "BUFFER_ENTIRE_BODY";
+		case BUFFER_ADAPTIVELY:
+			return "BUFFER_ADAPTIVELY";
+		case STREAM_BUFFERED_BODY:
+			return "STREAM_BUFFERED_BODY";
+		default:
+			return "UNKNOWN";
+		}
+	}
+
 	bool useUnionStation() const {
 		return options.transaction != NULL;
 	}
 
-	void beginStopwatchLog(UnionStation::StopwatchLog **stopwatchLog, const char *id, const char *nameAndData = NULL) {
-		if (options.transaction != NULL) {
-			*stopwatchLog = new UnionStation::StopwatchLog(options.transaction, id, nameAndData);
+	void beginStopwatchLog(UnionStation::StopwatchLog *StopwatchLogs::*which,
+		const char *id, const char *nameAndData = NULL)
+	{
+		if (stopwatchLogs != NULL && options.transaction != NULL) {
+			stopwatchLogs->*which = new UnionStation::StopwatchLog(
+				options.transaction, id, nameAndData);
 		}
 	}
 
-	void endStopwatchLog(UnionStation::StopwatchLog **stopwatchLog, bool success = true) {
-		if (success && *stopwatchLog != NULL) {
-			(*stopwatchLog)->success();
+	void endStopwatchLog(UnionStation::StopwatchLog *StopwatchLogs::*which,
+		bool success = true)
+	{
+		if (stopwatchLogs == NULL) {
+			return;
+		}
+
+		UnionStation::StopwatchLog *&stopwatchLog = stopwatchLogs->*which;
+		if (success && stopwatchLog != NULL) {
+			stopwatchLog->success();
 		}
-		delete *stopwatchLog;
-		*stopwatchLog = NULL;
+		delete stopwatchLog;
+		stopwatchLog = NULL;
 	}
 
 	void logMessage(const StaticString &message) {
@@ -90,6 +90,11 @@ Controller::sendHeaderToApp(Client *client, Request *req) {
 		req->session->getProtocol() << " protocol");
 	req->state = Request::SENDING_HEADER_TO_APP;
 	P_ASSERT_EQ(req->halfClosePolicy, Request::HALF_CLOSE_POLICY_UNINITIALIZED);
+	recordTimeToApp(req);
+
+	if (appResponseTimeout > 0) {
+		getContext()->timerWheel.arm(&req->appResponseTimer, appResponseTimeout);
+	}
 
 	if (req->session->getProtocol() == "session") {
 		UPDATE_TRACE_POINT();
@@ -153,6 +158,23 @@ Controller::sendHeaderToApp(Client *client, Request *req) {
 	}
 }
 
+void
+Controller::recordTimeToApp(Request *req) {
+	if (!req->hasBody() || req->appGroupMetrics == NULL) {
+		return;
+	}
+
+	ev_tstamp duration = ev_now(getLoop()) - req->startedAt;
+	boost::uint64_t usec = (duration > 0) ? (boost::uint64_t) (duration * 1000000) : 0;
+	if (req->requestBodyBuffering
+	 && req->bodyBufferingMode != Request::STREAM_BUFFERED_BODY)
+	{
+		req->appGroupMetrics->bufferedBodyTimesToApp.record(usec);
+	} else {
+		req->appGroupMetrics->streamedBodyTimesToApp.record(usec);
+	}
+}
+
 void
 Controller::sendHeaderToAppWithSessionProtocol(Client *client, Request *req) {
 	TRACE_POINT();
@@ -1073,7 +1095,7 @@ Controller::resumeRequestBodyChannelWhenAppSinkIdle(Channel *_channel,
 void
 Controller::startBodyChannel(Client *client, Request *req) {
 	if (req->requestBodyBuffering) {
-		req->bodyBuffer.start();
+		req->bodyBuffer->channel.start();
 	} else {
 		req->bodyChannel.start();
 	}
@@ -1082,7 +1104,7 @@ Controller::startBodyChannel(Client *client, Request *req) {
 void
 Controller::stopBodyChannel(Client *client, Request *req) {
 	if (req->requestBodyBuffering) {
-		req->bodyBuffer.stop();
+		req->bodyBuffer->channel.stop();
 	} else {
 		req->bodyChannel.stop();
 	}
@@ -53,6 +53,10 @@ Controller::getConfigAsJson() const {
 	doc["stat_throttle_rate"] = statThrottleRate;
 	doc["show_version_in_header"] = showVersionInHeader;
 	doc["data_buffer_dir"] = getContext()->defaultFileBufferedChannelConfig.bufferDir;
+	doc["app_response_timeout"] = appResponseTimeout;
+	doc["app_connect_timeout"] = appConnectTimeout;
+	doc["response_compression"] = responseCompression;
+	doc["response_compression_level"] = responseCompressionLevel;
 	return doc;
 }
 
@@ -66,6 +70,19 @@ Controller::configure(const Json::Value &doc) {
 		getContext()->defaultFileBufferedChannelConfig.bufferDir =
 			doc["data_buffer_dir"].asString();
 	}
+	if (doc.isMember("app_response_timeout")) {
+		appResponseTimeout = doc["app_response_timeout"].asDouble();
+	}
+	if (doc.isMember("app_connect_timeout")) {
+		appConnectTimeout = doc["app_connect_timeout"].asDouble();
+	}
+	if (doc.isMember("response_compression")) {
+		responseCompression = doc["response_compression"].asBool();
+	}
+	if (doc.isMember("response_compression_level")) {
+		responseCompressionLevel = clamp<int>(
+			doc["response_compression_level"].asInt(), 1, 9);
+	}
 }
 
 Json::Value
@@ -81,6 +98,17 @@ Controller::inspectStateAsJson() const {
 		subdoc["store_success_ratio"] = turboCaching.responseCache.getStoreSuccessRatio();
 		doc["turbocaching"] = subdoc;
 	}
+
+	Json::Value coldParts;
+	coldParts["body_buffers"] = bodyBufferSlab.getLiveCount();
+	coldParts["stopwatch_logs"] = stopwatchLogsSlab.getLiveCount();
+	coldParts["turbocache_captures"] = turboCacheCaptureSlab.getLiveCount();
+	coldParts["response_compressors"] = activeResponseCompressors;
+	coldParts["idle_response_compressors"] = (Json::UInt) idleResponseCompressors.size();
+	coldParts["allocated"] = byteSizeToJson(bodyBufferSlab.getAllocatedSize()
+		+ stopwatchLogsSlab.getAllocatedSize()
+		+ turboCacheCaptureSlab.getAllocatedSize());
+	doc["request_cold_parts"] = coldParts;
 	return doc;
 }
 
@@ -110,10 +138,14 @@ Controller::inspectRequestStateAsJson(const Request *req) const {
 	flags["dechunk_response"] = req->dechunkResponse;
 	flags["request_body_buffering"] = req->requestBodyBuffering;
 	flags["https"] = req->https;
+	flags["compress_response"] = req->responseCompressor != NULL;
 	doc["flags"] = flags;
 
 	if (req->requestBodyBuffering) {
-		doc["body_bytes_buffered"] = byteSizeToJson(req->bodyBytesBuffered);
+		doc["body_buffering_mode"] = req->getBodyBufferingModeString();
+	}
+	if (req->requestBodyBuffering && req->bodyBuffer != NULL) {
+		doc["body_bytes_buffered"] = byteSizeToJson(req->bodyBuffer->bytesBuffered);
 	}
 
 	if (req->session != NULL) {
@@ -157,6 +189,40 @@ Controller::inspectRequestStateAsJson(const Request *req) const {
 	return doc;
 }
 
+/**
+ * Collects a snapshot of this Controller's metrics. Must be called from the
+ * event loop thread.
+ */
+void
+Controller::collectMetrics(ControllerMetrics &metrics) const {
+	StringKeyTable< boost::shared_ptr<AppGroupMetrics> >::ConstIterator it(appGroupMetrics);
+	while (*it != NULL) {
+		metrics.appGroups[it.getKey()] = *it.getValue();
+		it.next();
+	}
+
+	metrics.totalRequestsBegun = totalRequestsBegun;
+	metrics.activeClients = activeClientCount;
+	metrics.turboCacheFetches = turboCaching.responseCache.getFetches();
+	metrics.turboCacheHits = turboCaching.responseCache.getHits();
+
+	const struct MemoryKit::mbuf_pool &mbufPool = getContext()->mbuf_pool;
+	metrics.mbufFreeBlocks = mbufPool.nfree_mbuf_blockq;
+	metrics.mbufActiveBlocks = mbufPool.nactive_mbuf_blockq;
+	metrics.mbufBlockSize = mbufPool.mbuf_block_chunk_size;
+
+	Client *client;
+	TAILQ_FOREACH (client, &activeClients, nextClient.activeOrDisconnectedClient) {
+		if (client->currentRequest != NULL && client->currentRequest->pool != NULL) {
+			size_t reserved, used, nlarge;
+			psg_pool_usage(client->currentRequest->pool, &reserved, &used, &nlarge);
+			metrics.pallocPools++;
+			metrics.pallocReservedBytes += reserved;
+			metrics.pallocUsedBytes += used;
+		}
+	}
+}
+
 
 } // namespace Core
 } // namespace Passenger
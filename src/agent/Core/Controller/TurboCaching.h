@@ -92,18 +92,32 @@ private:
 
 		time_t now;
 		time_t age;
+		/* The body variant to send: either the identity or the gzip one. */
+		const char *bodyData;
+		unsigned int bodySize;
+		bool gzip;
+		bool varyByAcceptEncoding;
 		unsigned int ageValueSize;
 		unsigned int contentLengthStrSize;
-		bool showVersionInHeader;
+		StaticString trailer;
 	};
 
 	template<typename Server>
 	void prepareResponseHeader(ResponsePreparation &prep, Server *server,
-		Request *req, const ResponseCacheEntryType &entry)
+		Request *req, const ResponseCacheEntryType &entry, bool gzip)
 	{
 		prep.req   = req;
 		prep.entry = &entry;
 		prep.now   = (time_t) ev_now(server->getLoop());
+		prep.gzip  = gzip && entry.body->httpGzipBodySize > 0;
+		prep.varyByAcceptEncoding = entry.body->httpGzipBodySize > 0;
+		if (prep.gzip) {
+			prep.bodyData = entry.body->httpGzipBodyData;
+			prep.bodySize = entry.body->httpGzipBodySize;
+		} else {
+			prep.bodyData = entry.body->httpBodyData;
+			prep.bodySize = entry.body->httpBodySize;
+		}
 
 		if (prep.now >= entry.header->date) {
 			prep.age = prep.now - entry.header->date;
@@ -112,8 +126,8 @@ private:
 		}
 
 		prep.ageValueSize = integerSizeInOtherBase<time_t, 10>(prep.age);
-		prep.contentLengthStrSize = uintSizeAsString(entry.body->httpBodySize);
-		prep.showVersionInHeader = server->showVersionInHeader;
+		prep.contentLengthStrSize = uintSizeAsString(prep.bodySize);
+		prep.trailer = server->getResponseTrailer(req, false);
 	}
 
 	template<typename Server>
@@ -129,9 +143,6 @@ private:
 			} while (false)
 
 		const ResponseCacheEntryType *entry = prep.entry;
-		Request *req = prep.req;
-
-		unsigned int httpVersion = req->httpMajor * 1000 + req->httpMinor * 10;
 		unsigned int result = 0;
 		char *pos = output;
 		const char *end = output + outputSize;
@@ -142,10 +153,17 @@ private:
 				entry->body->httpHeaderSize);
 		}
 
+		if (prep.gzip) {
+			PUSH_STATIC_STRING("Content-Encoding: gzip\r\n");
+		}
+		if (prep.varyByAcceptEncoding) {
+			PUSH_STATIC_STRING("Vary: Accept-Encoding\r\n");
+		}
+
 		PUSH_STATIC_STRING("Content-Length: ");
 		result += prep.contentLengthStrSize;
 		if (output != NULL) {
-			uintToString(entry->body->httpBodySize, pos, end - pos);
+			uintToString(prep.bodySize, pos, end - pos);
 			pos += prep.contentLengthStrSize;
 		}
 		PUSH_STATIC_STRING("\r\n");
@@ -158,26 +176,11 @@ private:
 		}
 		PUSH_STATIC_STRING("\r\n");
 
-		if (prep.showVersionInHeader) {
-			PUSH_STATIC_STRING("X-Powered-By: " PROGRAM_NAME " " PASSENGER_VERSION "\r\n");
-		} else {
-			PUSH_STATIC_STRING("X-Powered-By: " PROGRAM_NAME "\r\n");
-		}
-
-		if (server->canKeepAlive(req)) {
-			if (httpVersion < 1010) {
-				// HTTP < 1.1 defaults to "Connection: close", but we want keep-alive
-				PUSH_STATIC_STRING("Connection: keep-alive\r\n");
-			}
-		} else {
-			if (httpVersion >= 1010) {
-				// HTTP 1.1 defaults to "Connection: keep-alive", but we don't want it
-				PUSH_STATIC_STRING("Connection: close\r\n");
-			}
+		result += prep.trailer.size();
+		if (output != NULL) {
+			pos = appendData(pos, end, prep.trailer.data(), prep.trailer.size());
 		}
 
-		PUSH_STATIC_STRING("\r\n");
-
 		#ifndef NDEBUG
 			if (output != NULL) {
 				assert(size_t(pos - output) == size_t(result));
@@ -261,32 +264,39 @@ public:
 		lastTimeout = now;
 	}
 
+	/**
+	 * Writes the cached response to the client. If `gzip` is true and the
+	 * entry has a gzip-compressed variant of the body, then that variant
+	 * is sent instead of the identity one.
+	 */
 	template<typename Server, typename Client>
-	void writeResponse(Server *server, Client *client, Request *req, ResponseCacheEntryType &entry) {
+	void writeResponse(Server *server, Client *client, Request *req, ResponseCacheEntryType &entry,
+		bool gzip = false)
+	{
 		MemoryKit::mbuf_pool &mbuf_pool = server->getContext()->mbuf_pool;
 		const unsigned int MBUF_MAX_SIZE = mbuf_pool_data_size(&mbuf_pool);
 		ResponsePreparation prep;
 		unsigned int headerSize;
 
-		prepareResponseHeader(prep, server, req, entry);
+		prepareResponseHeader(prep, server, req, entry, gzip);
 		headerSize = buildResponseHeader(prep, server, NULL, 0);
 
-		if (headerSize + entry.body->httpBodySize <= MBUF_MAX_SIZE) {
+		if (headerSize + prep.bodySize <= MBUF_MAX_SIZE) {
 			// Header and body fit inside a single mbuf
 			MemoryKit::mbuf buffer(MemoryKit::mbuf_get(&mbuf_pool));
-			buffer = MemoryKit::mbuf(buffer, 0, headerSize + entry.body->httpBodySize);
+			buffer = MemoryKit::mbuf(buffer, 0, headerSize + prep.bodySize);
 
 			buildResponseHeader(prep, server, buffer.start, buffer.size());
-			memcpy(buffer.start + headerSize, entry.body->httpBodyData, entry.body->httpBodySize);
+			memcpy(buffer.start + headerSize, prep.bodyData, prep.bodySize);
 
 			server->writeResponse(client, buffer);
 		} else {
-			char *buffer = (char *) psg_pnalloc(req->pool, headerSize + entry.body->httpBodySize);
+			char *buffer = (char *) psg_pnalloc(req->pool, headerSize + prep.bodySize);
 			buildResponseHeader(prep, server, buffer,
-				headerSize + entry.body->httpBodySize);
-			memcpy(buffer + headerSize, entry.body->httpBodyData, entry.body->httpBodySize);
+				headerSize + prep.bodySize);
+			memcpy(buffer + headerSize, prep.bodyData, prep.bodySize);
 
-			server->writeResponse(client, buffer, headerSize + entry.body->httpBodySize);
+			server->writeResponse(client, buffer, headerSize + prep.bodySize);
 		}
 	}
 };
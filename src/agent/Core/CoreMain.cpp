@@ -87,6 +87,7 @@
 #include <Core/OptionParser.h>
 #include <Core/Controller.h>
 #include <Core/ApiServer.h>
+#include <Core/StatsSegmentPublisher.h>
 #include <Core/ApplicationPool/Pool.h>
 #include <Core/UnionStation/Context.h>
 
@@ -150,6 +151,7 @@ namespace Core {
 		unsigned int terminationCount;
 		boost::atomic<unsigned int> shutdownCounter;
 		oxt::thread *prestarterThread;
+		StatsSegmentPublisher *statsSegmentPublisher;
 
 		WorkingObjects()
 			: exitEvent(__FILE__, __LINE__, "WorkingObjects: exitEvent"),
@@ -165,6 +167,7 @@ namespace Core {
 
 		~WorkingObjects() {
 			delete prestarterThread;
+			delete statsSegmentPublisher;
 
 			vector<ThreadWorkingObjects>::iterator it, end = threadWorkingObjects.end();
 			for (it = threadWorkingObjects.begin(); it != end; it++) {
@@ -204,6 +207,7 @@ initializePrivilegedWorkingObjects() {
 	WorkingObjects *wo = workingObjects = new WorkingObjects();
 
 	wo->prestarterThread = NULL;
+	wo->statsSegmentPublisher = NULL;
 
 	wo->password = options.get("core_password", false);
 	if (wo->password == "-") {
@@ -238,7 +242,7 @@ initializeSingleAppMode() {
 
 	if (!options.has("app_type")) {
 		P_DEBUG("Autodetecting application type...");
-		AppTypeDetector detector(NULL, 0);
+		AppTypeDetector detector;
 		PassengerAppType appType = detector.checkAppRoot(options.get("app_root"));
 		if (appType == PAT_NONE || appType == PAT_ERROR) {
 			fprintf(stderr, "ERROR: unable to autodetect what kind of application "
@@ -590,6 +594,7 @@ initializeNonPrivilegedWorkingObjects() {
 		wo->spawningKitConfig->instanceDir = absolutizePath(
 			wo->spawningKitConfig->instanceDir);
 	}
+	wo->spawningKitConfig->appOutputRateLimit = options.getUint("app_output_rate_limit");
 	wo->spawningKitConfig->finalize();
 
 	UPDATE_TRACE_POINT();
@@ -677,6 +682,20 @@ initializeNonPrivilegedWorkingObjects() {
 		wo->shutdownCounter.fetch_add(1, boost::memory_order_relaxed);
 	}
 
+	UPDATE_TRACE_POINT();
+	string instanceDir = options.get("instance_dir", false);
+	if (!instanceDir.empty() && options.getUint("stats_segment_interval") > 0) {
+		vector<Controller *> controllers;
+		controllers.reserve(wo->threadWorkingObjects.size());
+		for (unsigned int i = 0; i < wo->threadWorkingObjects.size(); i++) {
+			controllers.push_back(wo->threadWorkingObjects[i].controller);
+		}
+		wo->statsSegmentPublisher = new StatsSegmentPublisher(
+			absolutizePath(instanceDir) + "/core_stats",
+			wo->appPool, controllers,
+			options.getUint("stats_segment_interval"));
+	}
+
 	UPDATE_TRACE_POINT();
 	/* We do not delete Unix domain socket files at shutdown because
 	 * that can cause a race condition if the user tries to start another
@@ -801,6 +820,9 @@ mainLoop() {
 	if (wo->threadWorkingObjects.size() > 1) {
 		wo->loadBalancer.start();
 	}
+	if (wo->statsSegmentPublisher != NULL) {
+		wo->statsSegmentPublisher->start();
+	}
 	waitForExitEvent();
 }
 
@@ -933,6 +955,10 @@ cleanup() {
 	WorkingObjects *wo = workingObjects;
 
 	P_DEBUG("Shutting down " SHORT_PROGRAM_NAME " core...");
+	// The publisher collects metrics on the event loops,
+	// so it must be stopped before they are.
+	delete wo->statsSegmentPublisher;
+	wo->statsSegmentPublisher = NULL;
 	wo->appPool->destroy();
 	installDiagnosticsDumper(NULL, NULL);
 	for (unsigned i = 0; i < wo->threadWorkingObjects.size(); i++) {
@@ -1088,12 +1114,22 @@ setAgentsOptionsDefaults() {
 	options.setDefaultInt("min_instances", 1);
 	options.setDefaultInt("max_preloader_idle_time", DEFAULT_MAX_PRELOADER_IDLE_TIME);
 	options.setDefaultUint("max_request_queue_size", DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+	options.setDefaultUint("oobw_min_spare_concurrency", DEFAULT_OOBW_MIN_SPARE_CONCURRENCY);
+	options.setDefaultUint("memory_recycle_limit", 0);
+	options.setDefaultUint("memory_recycle_pressure_threshold", 0);
+	options.setDefaultUint("request_queue_timeout", 0);
+	options.setDefaultUint("request_queue_target_delay", 0);
+	options.setDefaultUint("upload_streaming_threshold", 0);
 	options.setDefaultUint("stat_throttle_rate", DEFAULT_STAT_THROTTLE_RATE);
+	options.setDefaultUint("stats_segment_interval", DEFAULT_STATS_SEGMENT_INTERVAL);
+	options.setDefaultUint("app_output_rate_limit", DEFAULT_APP_OUTPUT_RATE_LIMIT);
 	options.setDefault("server_software", SERVER_TOKEN_NAME "/" PASSENGER_VERSION);
 	options.setDefaultBool("show_version_in_header", true);
 	options.setDefaultBool("sticky_sessions", false);
 	options.setDefault("sticky_sessions_cookie_name", DEFAULT_STICKY_SESSIONS_COOKIE_NAME);
 	options.setDefaultBool("turbocaching", true);
+	options.setDefaultBool("response_compression", false);
+	options.setDefaultInt("response_compression_level", DEFAULT_RESPONSE_COMPRESSION_LEVEL);
 	options.setDefault("data_buffer_dir", getSystemTempDir());
 	options.setDefaultUint("file_buffer_threshold", DEFAULT_FILE_BUFFERED_CHANNEL_THRESHOLD);
 	options.setDefaultInt("response_buffer_high_watermark", DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK);
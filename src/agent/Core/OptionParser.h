@@ -150,6 +150,31 @@ coreUsage() {
 	printf("      --max-request-queue-size NUMBER\n");
 	printf("                            Specify request queue size. Default: %d\n",
 		DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+	printf("      --oobw-min-spare-concurrency NUMBER\n");
+	printf("                            Only start out-of-band work if the other\n");
+	printf("                            processes keep at least this many free\n");
+	printf("                            session slots. Default: %d\n",
+		DEFAULT_OOBW_MIN_SPARE_CONCURRENCY);
+	printf("      --request-queue-timeout MSEC\n");
+	printf("                            Return 503 for requests that have been\n");
+	printf("                            queued for longer than this. Default: 0\n");
+	printf("                            (no timeout)\n");
+	printf("      --request-queue-target-delay MSEC\n");
+	printf("                            Shed queued requests when the queueing\n");
+	printf("                            delay stays above this. Default: 0\n");
+	printf("                            (disabled)\n");
+	printf("      --upload-streaming-threshold KB/SEC\n");
+	printf("                            Stream request bodies that are uploaded at\n");
+	printf("                            least this fast to the app if a process is\n");
+	printf("                            free, buffer them otherwise. Default: 0\n");
+	printf("                            (disabled)\n");
+	printf("      --memory-recycle-limit MB\n");
+	printf("                            Replace processes that use more than this\n");
+	printf("                            much memory. Default: 0 (no limit)\n");
+	printf("      --memory-recycle-pressure-threshold PERCENT\n");
+	printf("                            Under this much system memory pressure,\n");
+	printf("                            replace the process that grew the most.\n");
+	printf("                            Default: 0 (disabled)\n");
 	printf("      --sticky-sessions     Enable sticky sessions\n");
 	printf("      --sticky-sessions-cookie-name NAME\n");
 	printf("                            Cookie name to use for sticky sessions.\n");
@@ -158,6 +183,13 @@ coreUsage() {
 	printf("                            Vary the turbocache by the cookie of the given name\n");
 	printf("      --disable-turbocaching\n");
 	printf("                            Disable turbocaching\n");
+	printf("      --response-compression\n");
+	printf("                            Gzip-compress textual app responses for clients\n");
+	printf("                            that accept it\n");
+	printf("      --response-compression-level LEVEL\n");
+	printf("                            Gzip level (1-9) for streamed responses. Turbocached\n");
+	printf("                            responses are always compressed at level 9.\n");
+	printf("                            Default: %d\n", DEFAULT_RESPONSE_COMPRESSION_LEVEL);
 	printf("      --no-abort-websockets-on-process-shutdown\n");
 	printf("                            Do not abort WebSocket connections on process\n");
 	printf("                            shutdown or restart\n");
@@ -169,6 +201,10 @@ coreUsage() {
 	printf("      --stat-throttle-rate SECONDS\n");
 	printf("                            Throttle filesystem restart.txt checks to at most\n");
 	printf("                            once per given seconds. Default: %d\n", DEFAULT_STAT_THROTTLE_RATE);
+	printf("      --app-output-rate-limit LINES\n");
+	printf("                            Log at most the given number of lines of output per\n");
+	printf("                            second from each app process. 0 means unlimited.\n");
+	printf("                            Default: %d\n", DEFAULT_APP_OUTPUT_RATE_LIMIT);
 	printf("      --no-show-version-in-header\n");
 	printf("                            Do not show " PROGRAM_NAME " version number in\n");
 	printf("                            HTTP headers.\n");
@@ -189,6 +225,10 @@ coreUsage() {
 	printf("      --cpu-affine          Enable per-thread CPU affinity (Linux only)\n");
 	printf("      --core-file-descriptor-ulimit NUMBER\n");
 	printf("                            Set custom file descriptor ulimit for the core\n");
+	printf("      --stats-segment-interval MSEC\n");
+	printf("                            Publish statistics to the core_stats file in the\n");
+	printf("                            instance directory at this interval. 0 disables\n");
+	printf("                            publishing. Default: %d\n", DEFAULT_STATS_SEGMENT_INTERVAL);
 	printf("  -h, --help                Show this help\n");
 	printf("\n");
 	printf("API account privilege levels (ordered from most to least privileges):\n");
@@ -322,6 +362,24 @@ parseCoreOption(int argc, const char *argv[], int &i, VariantMap &options) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--max-request-queue-size")) {
 		options.setInt("max_request_queue_size", atoi(argv[i + 1]));
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--oobw-min-spare-concurrency")) {
+		options.setInt("oobw_min_spare_concurrency", atoi(argv[i + 1]));
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--request-queue-timeout")) {
+		options.setInt("request_queue_timeout", atoi(argv[i + 1]));
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--request-queue-target-delay")) {
+		options.setInt("request_queue_target_delay", atoi(argv[i + 1]));
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--upload-streaming-threshold")) {
+		options.setInt("upload_streaming_threshold", atoi(argv[i + 1]));
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--memory-recycle-limit")) {
+		options.setInt("memory_recycle_limit", atoi(argv[i + 1]));
+		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--memory-recycle-pressure-threshold")) {
+		options.setInt("memory_recycle_pressure_threshold", atoi(argv[i + 1]));
+		i += 2;
 	} else if (p.isFlag(argv[i], '\0', "--sticky-sessions")) {
 		options.setBool("sticky_sessions", true);
 		i++;
@@ -334,6 +392,12 @@ parseCoreOption(int argc, const char *argv[], int &i, VariantMap &options) {
 	} else if (p.isFlag(argv[i], '\0', "--disable-turbocaching")) {
 		options.setBool("turbocaching", false);
 		i++;
+	} else if (p.isFlag(argv[i], '\0', "--response-compression")) {
+		options.setBool("response_compression", true);
+		i++;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--response-compression-level")) {
+		options.setInt("response_compression_level", atoi(argv[i + 1]));
+		i += 2;
 	} else if (p.isFlag(argv[i], '\0', "--no-abort-websockets-on-process-shutdown")) {
 		options.setBool("abort_websockets_on_process_shutdown", false);
 		i++;
@@ -379,6 +443,9 @@ parseCoreOption(int argc, const char *argv[], int &i, VariantMap &options) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--stat-throttle-rate")) {
 		options.setInt("stat_throttle_rate", atoi(argv[i + 1]));
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--app-output-rate-limit")) {
+		options.setInt("app_output_rate_limit", atoi(argv[i + 1]));
+		i += 2;
 	} else if (p.isFlag(argv[i], '\0', "--no-show-version-in-header")) {
 		options.setBool("show_version_in_header", false);
 		i++;
@@ -403,6 +470,9 @@ parseCoreOption(int argc, const char *argv[], int &i, VariantMap &options) {
 	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--core-file-descriptor-ulimit")) {
 		options.setUint("core_file_descriptor_ulimit", atoi(argv[i + 1]));
 		i += 2;
+	} else if (p.isValueFlag(argc, i, argv[i], '\0', "--stats-segment-interval")) {
+		options.setUint("stats_segment_interval", atoi(argv[i + 1]));
+		i += 2;
 	} else if (!startsWith(argv[i], "-")) {
 		if (!options.has("app_root")) {
 			options.set("app_root", argv[i]);
@@ -71,15 +71,20 @@ public:
 	struct Body {
 		unsigned short httpHeaderSize;
 		unsigned short httpBodySize;
+		// 0 if there is no gzip-compressed variant of the body.
+		unsigned short httpGzipBodySize;
 		time_t expiryDate;
 		char key[MAX_KEY_LENGTH];
 		char httpHeaderData[MAX_HEADER_SIZE];
 		// This data is dechunked.
 		char httpBodyData[MAX_BODY_SIZE];
+		// Only stored if it is smaller than httpBodyData.
+		char httpGzipBodyData[MAX_BODY_SIZE];
 
 		Body()
 			: httpHeaderSize(0),
 			  httpBodySize(0),
+			  httpGzipBodySize(0),
 			  expiryDate(0)
 		{
 			key[0] = httpHeaderData[0] = httpBodyData[0] = '\0';
@@ -657,6 +662,7 @@ public:
 		entry.body->expiryDate = expiryDate;
 		entry.body->httpHeaderSize = headerSize;
 		entry.body->httpBodySize   = bodySize;
+		entry.body->httpGzipBodySize = 0;
 		storeSuccesses++;
 		return entry;
 	}
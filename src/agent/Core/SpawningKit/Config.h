@@ -36,6 +36,7 @@
 #include <Exceptions.h>
 #include <Utils/VariantMap.h>
 #include <Core/UnionStation/Context.h>
+#include <Core/SpawningKit/OutputMultiplexer.h>
 
 namespace Passenger {
 namespace ApplicationPool2 {
@@ -76,6 +77,8 @@ struct Config {
 
 	// Used by PipeWatcher.
 	OutputHandler outputHandler;
+	unsigned int appOutputRateLimit;
+	OutputMultiplexerPtr outputMultiplexer;
 
 	// Other.
 	void *data;
@@ -87,6 +90,7 @@ struct Config {
 		  concurrency(1),
 		  spawnerCreationSleepTime(0),
 		  spawnTime(0),
+		  appOutputRateLimit(DEFAULT_APP_OUTPUT_RATE_LIMIT),
 		  data(NULL)
 		{ }
 
@@ -98,6 +102,9 @@ struct Config {
 		if (randomGenerator == NULL) {
 			randomGenerator = boost::make_shared<RandomGenerator>();
 		}
+		if (outputMultiplexer == NULL) {
+			outputMultiplexer = boost::make_shared<OutputMultiplexer>(appOutputRateLimit);
+		}
 	}
 };
 
@@ -0,0 +1,361 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SPAWNING_KIT_OUTPUT_MULTIPLEXER_H_
+#define _PASSENGER_SPAWNING_KIT_OUTPUT_MULTIPLEXER_H_
+
+#include <boost/shared_ptr.hpp>
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/system_calls.hpp>
+#include <oxt/macros.hpp>
+#include <ev++.h>
+#include <sys/types.h>
+#include <cstring>
+#include <cerrno>
+#include <string>
+#include <vector>
+#include <set>
+#include <map>
+
+#include <BackgroundEventLoop.h>
+#include <SafeLibev.h>
+#include <FileDescriptor.h>
+#include <StaticString.h>
+#include <Constants.h>
+#include <Logging.h>
+#include <Utils/IOUtils.h>
+
+namespace Passenger {
+namespace SpawningKit {
+
+using namespace std;
+
+
+/**
+ * Forwards the stdout and stderr output of application processes to the log
+ * file. All channels are serviced by a single background event loop (epoll or
+ * kqueue based), which is started when the first channel is added, so that
+ * an app with hundreds of processes doesn't cost hundreds of threads.
+ *
+ * Every readable channel is read with a large buffer, and all complete lines
+ * in that read are written to the log file in a single write. Output is rate
+ * limited per process: a process may print `rateLimit` lines per second on
+ * average, with bursts of up to `RATE_LIMIT_BURST_SECONDS` seconds worth of
+ * lines. Lines beyond that are dropped from the log file (they are still
+ * passed to the data handler) and counted, so that a chatty app can't flood
+ * the log file or starve the output of other apps.
+ */
+class OutputMultiplexer: public boost::noncopyable {
+public:
+	typedef boost::function<void (const char *data, unsigned int size)> DataHandler;
+
+private:
+	static const unsigned int BUFFER_SIZE = 1024 * 64;
+	static const unsigned int RATE_LIMIT_BURST_SECONDS = 10;
+
+	struct RateLimiter {
+		double tokens;
+		ev_tstamp lastRefillTime;
+		unsigned long long suppressedLines;
+		unsigned int refcount;
+	};
+
+	struct Channel {
+		OutputMultiplexer *self;
+		ev_io watcher;
+		FileDescriptor fd;
+		const char *name;
+		pid_t pid;
+		DataHandler dataHandler;
+		string partialLine;
+		RateLimiter *rateLimiter;
+	};
+
+	const unsigned int rateLimit;
+	boost::mutex syncher;
+	BackgroundEventLoop *bg;
+
+	// These fields are only accessed from the event loop thread.
+	std::set<Channel *> channels;
+	std::map<pid_t, RateLimiter> rateLimiters;
+	vector<StaticString> lines;
+	unsigned long long totalSuppressedLines;
+	char buffer[BUFFER_SIZE];
+
+	void stopEverything() {
+		while (!channels.empty()) {
+			removeChannel(*channels.begin());
+		}
+	}
+
+	void addChannel(Channel *channel) {
+		if (rateLimit > 0) {
+			std::map<pid_t, RateLimiter>::iterator it = rateLimiters.find(channel->pid);
+			if (it == rateLimiters.end()) {
+				RateLimiter &limiter = rateLimiters[channel->pid];
+				limiter.tokens = (double) rateLimit * RATE_LIMIT_BURST_SECONDS;
+				limiter.lastRefillTime = ev_now(bg->libev_loop);
+				limiter.suppressedLines = 0;
+				limiter.refcount = 1;
+				channel->rateLimiter = &limiter;
+			} else {
+				it->second.refcount++;
+				channel->rateLimiter = &it->second;
+			}
+		}
+
+		// The event loop must never block on a channel, not even when
+		// some other thread happens to read from the same file descriptor.
+		setNonBlocking(channel->fd);
+		ev_io_init(&channel->watcher, onReadable, channel->fd, EV_READ);
+		channel->watcher.data = channel;
+		ev_io_start(bg->libev_loop, &channel->watcher);
+		channels.insert(channel);
+	}
+
+	void removeChannel(Channel *channel) {
+		ev_io_stop(bg->libev_loop, &channel->watcher);
+		channels.erase(channel);
+
+		if (!channel->partialLine.empty()) {
+			lines.clear();
+			lines.push_back(channel->partialLine);
+			printLines(channel);
+		}
+
+		RateLimiter *limiter = channel->rateLimiter;
+		if (limiter != NULL) {
+			limiter->refcount--;
+			if (limiter->refcount == 0) {
+				reportSuppressedLines(channel->pid, limiter);
+				rateLimiters.erase(channel->pid);
+			}
+		}
+
+		delete channel;
+	}
+
+	static void onReadable(EV_P_ ev_io *io, int revents) {
+		Channel *channel = static_cast<Channel *>(io->data);
+		channel->self->readChannel(channel);
+	}
+
+	void readChannel(Channel *channel) {
+		ssize_t ret = syscalls::read(channel->fd, buffer, BUFFER_SIZE);
+		if (ret == -1) {
+			int e = errno;
+			if (e == EAGAIN || e == EWOULDBLOCK || e == EINTR) {
+				return;
+			} else if (e != ECONNRESET) {
+				P_WARN("Cannot read from process " << channel->pid << " " <<
+					channel->name << ": " << strerror(e) << " (errno=" << e << ")");
+			}
+			removeChannel(channel);
+		} else if (ret == 0) {
+			removeChannel(channel);
+		} else {
+			// If the buffer is full then the rest of the last line is
+			// probably readable already, so we hold on to it. Otherwise
+			// we print it right away, like a complete line, so that
+			// prompts and progress indicators aren't delayed.
+			forwardLines(channel, buffer, ret, (unsigned int) ret == BUFFER_SIZE);
+			if (channel->dataHandler) {
+				channel->dataHandler(buffer, ret);
+			}
+		}
+	}
+
+	void forwardLines(Channel *channel, const char *data, size_t size, bool holdPartialLine) {
+		StaticString input;
+		const char *pos, *end;
+
+		if (channel->partialLine.empty()) {
+			input = StaticString(data, size);
+		} else {
+			channel->partialLine.append(data, size);
+			input = channel->partialLine;
+		}
+
+		lines.clear();
+		pos = input.data();
+		end = input.data() + input.size();
+		while (pos < end) {
+			const char *newline = (const char *) memchr(pos, '\n', end - pos);
+			if (newline == NULL) {
+				break;
+			}
+			lines.push_back(StaticString(pos, newline - pos));
+			pos = newline + 1;
+		}
+
+		if (pos < end && (!holdPartialLine || end - pos >= (ssize_t) BUFFER_SIZE)) {
+			lines.push_back(StaticString(pos, end - pos));
+			pos = end;
+		}
+
+		printLines(channel);
+
+		if (pos < end) {
+			string rest(pos, end - pos);
+			channel->partialLine.swap(rest);
+		} else {
+			channel->partialLine.clear();
+		}
+	}
+
+	void printLines(Channel *channel) {
+		unsigned int count = lines.size();
+		RateLimiter *limiter = channel->rateLimiter;
+
+		if (limiter != NULL) {
+			ev_tstamp now = ev_now(bg->libev_loop);
+			double burst = (double) rateLimit * RATE_LIMIT_BURST_SECONDS;
+			unsigned int allowed;
+
+			limiter->tokens += (now - limiter->lastRefillTime) * rateLimit;
+			if (limiter->tokens > burst) {
+				limiter->tokens = burst;
+			}
+			limiter->lastRefillTime = now;
+
+			if (limiter->tokens >= count) {
+				allowed = count;
+			} else {
+				allowed = (unsigned int) limiter->tokens;
+			}
+			if (allowed > 0) {
+				reportSuppressedLines(channel->pid, limiter);
+			}
+			if (allowed < count && limiter->suppressedLines == 0) {
+				P_WARN("Process " << channel->pid << " is printing more than " <<
+					rateLimit << " lines of output per second. Some of its output"
+					" will not be logged");
+			}
+
+			limiter->tokens -= allowed;
+			limiter->suppressedLines += count - allowed;
+			totalSuppressedLines += count - allowed;
+			count = allowed;
+		}
+
+		if (count > 0) {
+			printAppOutputLines(channel->pid, channel->name, &lines[0], count);
+		}
+	}
+
+	static void reportSuppressedLines(pid_t pid, RateLimiter *limiter) {
+		if (limiter->suppressedLines > 0) {
+			P_WARN("Process " << pid << ": " << limiter->suppressedLines <<
+				" lines of output were not logged because of rate limiting");
+			limiter->suppressedLines = 0;
+		}
+	}
+
+	void getStatsFromEventLoop(unsigned int *channelCount, unsigned long long *suppressedLines) {
+		*channelCount = channels.size();
+		*suppressedLines = totalSuppressedLines;
+	}
+
+public:
+	/**
+	 * @param _rateLimit The maximum average number of lines per second that
+	 *     a single process may print. 0 means unlimited.
+	 */
+	OutputMultiplexer(unsigned int _rateLimit = DEFAULT_APP_OUTPUT_RATE_LIMIT)
+		: rateLimit(_rateLimit),
+		  bg(NULL),
+		  totalSuppressedLines(0)
+		{ }
+
+	~OutputMultiplexer() {
+		if (bg != NULL) {
+			bg->safe->runSync(boost::bind(&OutputMultiplexer::stopEverything, this));
+			bg->stop();
+			delete bg;
+		}
+	}
+
+	/**
+	 * Starts forwarding the output from the given file descriptor, until it
+	 * reaches EOF. `dataHandler`, if set, is called from the event loop thread
+	 * with every piece of data that is read. Thread-safe.
+	 *
+	 * @param name The channel name, such as "stdout". Must stay valid for as
+	 *     long as the file descriptor is being watched.
+	 */
+	void add(const FileDescriptor &fd, const char *name, pid_t pid,
+		const DataHandler &dataHandler = DataHandler())
+	{
+		Channel *channel = new Channel();
+		channel->self = this;
+		channel->fd = fd;
+		channel->name = name;
+		channel->pid = pid;
+		channel->dataHandler = dataHandler;
+		channel->rateLimiter = NULL;
+
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (bg == NULL) {
+			bg = new BackgroundEventLoop(true, false);
+			bg->start("App output multiplexer", POOL_HELPER_THREAD_STACK_SIZE);
+		}
+		bg->safe->runLater(boost::bind(&OutputMultiplexer::addChannel, this, channel));
+	}
+
+	/** Returns the number of file descriptors that are being watched. For unit tests. */
+	unsigned int getChannelCount() {
+		unsigned int channelCount = 0;
+		unsigned long long suppressedLines = 0;
+		getStats(&channelCount, &suppressedLines);
+		return channelCount;
+	}
+
+	/** Returns the number of lines that were dropped so far. For unit tests. */
+	unsigned long long getSuppressedLineCount() {
+		unsigned int channelCount = 0;
+		unsigned long long suppressedLines = 0;
+		getStats(&channelCount, &suppressedLines);
+		return suppressedLines;
+	}
+
+	void getStats(unsigned int *channelCount, unsigned long long *suppressedLines) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (bg != NULL) {
+			bg->safe->runSync(boost::bind(&OutputMultiplexer::getStatsFromEventLoop,
+				this, channelCount, suppressedLines));
+		}
+	}
+};
+
+typedef boost::shared_ptr<OutputMultiplexer> OutputMultiplexerPtr;
+
+
+} // namespace SpawningKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SPAWNING_KIT_OUTPUT_MULTIPLEXER_H_ */
@@ -28,22 +28,15 @@
 
 #include <boost/shared_ptr.hpp>
 #include <boost/enable_shared_from_this.hpp>
-#include <boost/thread.hpp>
-#include <boost/function.hpp>
 #include <boost/bind.hpp>
-#include <boost/foreach.hpp>
-#include <oxt/thread.hpp>
 #include <oxt/backtrace.hpp>
-#include <vector>
 
 #include <sys/types.h>
 
 #include <FileDescriptor.h>
-#include <Constants.h>
-#include <Logging.h>
-#include <Utils.h>
-#include <Utils/StrIntUtils.h>
+#include <Exceptions.h>
 #include <Core/SpawningKit/Config.h>
+#include <Core/SpawningKit/OutputMultiplexer.h>
 
 namespace Passenger {
 namespace SpawningKit {
@@ -51,69 +44,22 @@ namespace SpawningKit {
 using namespace boost;
 
 
-/** A PipeWatcher lives until the file descriptor is closed. */
+/**
+ * Forwards the output from an application process's stdout or stderr to the
+ * log file, and to `config->outputHandler`, until the file descriptor is
+ * closed. The actual work is done by the Config's OutputMultiplexer, so the
+ * PipeWatcher object itself may be destroyed after `start()`.
+ */
 class PipeWatcher: public boost::enable_shared_from_this<PipeWatcher> {
 private:
 	ConfigPtr config;
 	FileDescriptor fd;
 	const char *name;
 	pid_t pid;
-	bool started;
-	boost::mutex startSyncher;
-	boost::condition_variable startCond;
-
-	static void threadMain(boost::shared_ptr<PipeWatcher> self) {
-		TRACE_POINT();
-		self->threadMain();
-	}
 
-	void threadMain() {
-		TRACE_POINT();
-		{
-			boost::unique_lock<boost::mutex> lock(startSyncher);
-			while (!started) {
-				startCond.wait(lock);
-			}
-		}
-
-		UPDATE_TRACE_POINT();
-		while (!this_thread::interruption_requested()) {
-			char buf[1024 * 8];
-			ssize_t ret;
-
-			UPDATE_TRACE_POINT();
-			ret = syscalls::read(fd, buf, sizeof(buf));
-			if (ret == 0) {
-				break;
-			} else if (ret == -1) {
-				UPDATE_TRACE_POINT();
-				if (errno == ECONNRESET) {
-					break;
-				} else if (errno != EAGAIN) {
-					int e = errno;
-					P_WARN("Cannot read from process " << pid << " " << name <<
-						": " << strerror(e) << " (errno=" << e << ")");
-					break;
-				}
-			} else if (ret == 1 && buf[0] == '\n') {
-				UPDATE_TRACE_POINT();
-				printAppOutput(pid, name, "", 0);
-			} else {
-				UPDATE_TRACE_POINT();
-				vector<StaticString> lines;
-				ssize_t ret2 = ret;
-				if (ret2 > 0 && buf[ret2 - 1] == '\n') {
-					ret2--;
-				}
-				split(StaticString(buf, ret2), '\n', lines);
-				foreach (const StaticString line, lines) {
-					printAppOutput(pid, name, line.data(), line.size());
-				}
-			}
-
-			if (config->outputHandler) {
-				config->outputHandler(buf, ret);
-			}
+	static void forwardOutput(Config *config, const char *data, unsigned int size) {
+		if (config->outputHandler) {
+			config->outputHandler(data, size);
 		}
 	}
 
@@ -123,20 +69,21 @@ public:
 		: config(_config),
 		  fd(_fd),
 		  name(_name),
-		  pid(_pid),
-		  started(false)
+		  pid(_pid)
 		{ }
 
 	void initialize() {
-		oxt::thread(boost::bind(threadMain, shared_from_this()),
-			"PipeWatcher: PID " + toString(pid) + " " + name + ", fd " + toString(fd),
-			POOL_HELPER_THREAD_STACK_SIZE);
+		if (config->outputMultiplexer == NULL) {
+			throw RuntimeException("SpawningKit::Config not finalized");
+		}
 	}
 
 	void start() {
-		boost::lock_guard<boost::mutex> lock(startSyncher);
-		started = true;
-		startCond.notify_all();
+		TRACE_POINT();
+		// The Config owns the multiplexer, which stops forwarding before
+		// the Config is destroyed, so a plain pointer is safe here.
+		config->outputMultiplexer->add(fd, name, pid,
+			boost::bind(forwardOutput, config.get(), _1, _2));
 	}
 };
 
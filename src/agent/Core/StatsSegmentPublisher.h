@@ -0,0 +1,290 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CORE_STATS_SEGMENT_PUBLISHER_H_
+#define _PASSENGER_CORE_STATS_SEGMENT_PUBLISHER_H_
+
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <oxt/backtrace.hpp>
+#include <string>
+#include <vector>
+#include <map>
+#include <cstring>
+#include <StatsSegment.h>
+#include <Logging.h>
+#include <Core/Controller.h>
+#include <Core/Controller/Metrics.h>
+#include <Core/ApplicationPool/Pool.h>
+
+namespace Passenger {
+namespace Core {
+
+using namespace std;
+using namespace oxt;
+
+
+/**
+ * Periodically publishes the pool state and the Controllers' counters into
+ * a stats segment file (see StatsSegment.h) in the instance directory, so
+ * that external tools can read them without querying the ApiServer.
+ *
+ * Publishing happens in a background thread and costs one pool snapshot
+ * (which is cached, see `Pool::getSnapshot()`) and one metrics collection
+ * round trip per Controller, per interval, regardless of how many readers
+ * there are or how often they poll.
+ */
+class StatsSegmentPublisher {
+private:
+	StatsSegmentWriter writer;
+	ApplicationPool2::PoolPtr appPool;
+	vector<Controller *> controllers;
+	unsigned int interval;
+	boost::scoped_ptr<StatsSegmentData> data;
+	oxt::thread *thread;
+
+	static void collectControllerMetrics(Controller *controller,
+		ControllerMetrics *metrics)
+	{
+		controller->collectMetrics(*metrics);
+	}
+
+	static StatsSegmentProcess::LifeStatus
+	convertProcessLifeStatus(ApplicationPool2::Process::LifeStatus status) {
+		switch (status) {
+		case ApplicationPool2::Process::ALIVE:
+			return StatsSegmentProcess::ALIVE;
+		case ApplicationPool2::Process::SHUTDOWN_TRIGGERED:
+			return StatsSegmentProcess::SHUTDOWN_TRIGGERED;
+		default:
+			return StatsSegmentProcess::DEAD;
+		}
+	}
+
+	static StatsSegmentProcess::EnabledStatus
+	convertProcessEnabledStatus(ApplicationPool2::Process::EnabledStatus status) {
+		switch (status) {
+		case ApplicationPool2::Process::ENABLED:
+			return StatsSegmentProcess::ENABLED;
+		case ApplicationPool2::Process::DISABLING:
+			return StatsSegmentProcess::DISABLING;
+		case ApplicationPool2::Process::DISABLED:
+			return StatsSegmentProcess::DISABLED;
+		default:
+			return StatsSegmentProcess::DETACHED;
+		}
+	}
+
+	static StatsSegmentGroup::LifeStatus
+	convertGroupLifeStatus(ApplicationPool2::Group::LifeStatus status) {
+		switch (status) {
+		case ApplicationPool2::Group::ALIVE:
+			return StatsSegmentGroup::ALIVE;
+		case ApplicationPool2::Group::SHUTTING_DOWN:
+			return StatsSegmentGroup::SHUTTING_DOWN;
+		default:
+			return StatsSegmentGroup::SHUT_DOWN;
+		}
+	}
+
+	static void fillProcess(StatsSegmentProcess &entry, unsigned int groupIndex,
+		const ApplicationPool2::ProcessSnapshot &process)
+	{
+		entry.pid = process.pid;
+		entry.groupIndex = groupIndex;
+		entry.concurrency = process.concurrency;
+		entry.sessions = process.sessions;
+		entry.busyness = process.busyness;
+		entry.processed = process.processed;
+		entry.spawnEndTime = process.spawnEndTime;
+		entry.lastUsed = process.lastUsed;
+		if (process.metrics.isValid()) {
+			entry.rss = process.metrics.rss;
+			entry.cpu = process.metrics.cpu;
+		} else {
+			entry.rss = -1;
+			entry.cpu = -1;
+		}
+		entry.lifeStatus = convertProcessLifeStatus(process.lifeStatus);
+		entry.enabled = convertProcessEnabledStatus(process.enabled);
+	}
+
+	void threadMain() {
+		TRACE_POINT();
+		while (!boost::this_thread::interruption_requested()) {
+			{
+				// Collecting Controller metrics waits on a condition
+				// variable, which must not be interrupted while the
+				// event loop may still write to our stack.
+				boost::this_thread::disable_interruption di;
+				this_thread::disable_syscall_interruption dsi;
+				try {
+					UPDATE_TRACE_POINT();
+					publish();
+				} catch (const tracable_exception &e) {
+					P_WARN("Cannot publish stats segment: " << e.what() << "\n"
+						<< e.backtrace());
+				} catch (const std::exception &e) {
+					P_WARN("Cannot publish stats segment: " << e.what());
+				}
+			}
+			syscalls::usleep(interval * 1000);
+		}
+	}
+
+public:
+	/**
+	 * @param path The stats segment file to create.
+	 * @param interval The publishing interval in milliseconds.
+	 * @throws FileSystemException The file cannot be created.
+	 */
+	StatsSegmentPublisher(const string &path,
+		const ApplicationPool2::PoolPtr &_appPool,
+		const vector<Controller *> &_controllers,
+		unsigned int _interval)
+		: writer(path),
+		  appPool(_appPool),
+		  controllers(_controllers),
+		  interval(_interval),
+		  data(new StatsSegmentData()),
+		  thread(NULL)
+		{ }
+
+	~StatsSegmentPublisher() {
+		if (thread != NULL) {
+			thread->interrupt_and_join();
+			delete thread;
+		}
+	}
+
+	const string &getPath() const {
+		return writer.getPath();
+	}
+
+	/**
+	 * Fills `data` from a pool snapshot and the merged metrics of
+	 * `controllerCount` Controllers.
+	 */
+	static void fill(StatsSegmentData &data,
+		const ApplicationPool2::PoolSnapshot &pool,
+		const ControllerMetrics &metrics,
+		unsigned int controllerCount)
+	{
+		memset(&data, 0, sizeof(StatsSegmentData));
+
+		data.poolMax = pool.max;
+		data.poolProcessCount = pool.processCount;
+		data.poolCapacityUsed = pool.capacityUsed;
+		data.poolGetWaitlistSize = pool.getWaitlist.size();
+
+		data.totalRequestsBegun = metrics.totalRequestsBegun;
+		data.controllerCount = controllerCount;
+		data.activeClients = metrics.activeClients;
+		data.turboCacheFetches = metrics.turboCacheFetches;
+		data.turboCacheHits = metrics.turboCacheHits;
+		data.mbufFreeBlocks = metrics.mbufFreeBlocks;
+		data.mbufActiveBlocks = metrics.mbufActiveBlocks;
+
+		vector<ApplicationPool2::GroupSnapshot>::const_iterator it, end = pool.groups.end();
+		for (it = pool.groups.begin(); it != end; it++) {
+			const ApplicationPool2::GroupSnapshot &group = *it;
+
+			if (data.groupCount == STATS_SEGMENT_MAX_GROUPS) {
+				data.groupsOmitted++;
+				data.processesOmitted += group.processes.size();
+				continue;
+			}
+
+			StatsSegmentGroup &entry = data.groups[data.groupCount];
+			setStatsSegmentGroupName(entry, group.getName());
+			entry.enabledCount = group.enabledCount;
+			entry.disablingCount = group.disablingCount;
+			entry.disabledCount = group.disabledCount;
+			entry.capacityUsed = group.capacityUsed;
+			entry.getWaitlistSize = group.getWaitlistSize;
+			entry.disableWaitlistSize = group.disableWaitlistSize;
+			entry.processesBeingSpawned = group.processesBeingSpawned;
+			entry.lifeStatus = convertGroupLifeStatus(group.lifeStatus);
+			entry.spawning = group.spawning;
+			entry.restarting = group.restarting;
+
+			map<string, AppGroupMetrics>::const_iterator m_it =
+				metrics.appGroups.find(group.getName());
+			if (m_it != metrics.appGroups.end()) {
+				entry.requestsHandled = m_it->second.requestDurations.getCount();
+				entry.requestDurationSum = m_it->second.requestDurations.getSum();
+			}
+
+			vector<ApplicationPool2::ProcessSnapshot>::const_iterator p_it,
+				p_end = group.processes.end();
+			for (p_it = group.processes.begin(); p_it != p_end; p_it++) {
+				if (data.processCount == STATS_SEGMENT_MAX_PROCESSES) {
+					data.processesOmitted++;
+				} else {
+					fillProcess(data.processes[data.processCount],
+						data.groupCount, *p_it);
+					data.processCount++;
+					entry.processCount++;
+				}
+			}
+
+			data.groupCount++;
+		}
+	}
+
+	/**
+	 * Collects the current state and publishes it. Must not be called
+	 * from a Controller's event loop thread.
+	 */
+	void publish() {
+		ControllerMetrics metrics;
+		for (unsigned int i = 0; i < controllers.size(); i++) {
+			ControllerMetrics controllerMetrics;
+			controllers[i]->getContext()->libev->runSync(boost::bind(
+				collectControllerMetrics, controllers[i], &controllerMetrics));
+			metrics.merge(controllerMetrics);
+		}
+
+		fill(*data, *appPool->getSnapshot(), metrics, controllers.size());
+		writer.publish(*data);
+	}
+
+	void start() {
+		assert(thread == NULL);
+		thread = new oxt::thread(
+			boost::bind(&StatsSegmentPublisher::threadMain, this),
+			"Stats segment publisher",
+			1024 * 128);
+	}
+};
+
+
+} // namespace Core
+} // namespace Passenger
+
+#endif /* _PASSENGER_CORE_STATS_SEGMENT_PUBLISHER_H_ */
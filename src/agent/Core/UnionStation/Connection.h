@@ -41,6 +41,7 @@
 #include <Exceptions.h>
 #include <Utils/IOUtils.h>
 #include <Utils/MessageIO.h>
+#include <Utils/BufferedMessageReader.h>
 
 namespace Passenger {
 namespace UnionStation {
@@ -91,9 +92,12 @@ public:
 struct Connection: public boost::noncopyable {
 	mutable boost::mutex syncher;
 	int fd;
+	/** Replies from the UstRouter must be read through this. */
+	BufferedMessageReader reader;
 
 	Connection(int _fd)
-		: fd(_fd)
+		: fd(_fd),
+		  reader(_fd, 1024)
 		{ }
 
 	~Connection() {
@@ -111,6 +115,7 @@ struct Connection: public boost::noncopyable {
 			safelyClose(fd);
 			P_LOG_FILE_DESCRIPTOR_CLOSE(fd);
 			fd = -1;
+			reader.reset(-1);
 		}
 	}
 };
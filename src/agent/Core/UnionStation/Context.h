@@ -308,7 +308,7 @@ public:
 
 			writeArrayMessage(connection->fd, argsSend, nrArgsSend, &timeout);
 
-			if (!readArrayMessage(connection->fd, argsReply, &timeout)) {
+			if (!connection->reader.readArrayMessage(argsReply, &timeout)) {
 				boost::lock_guard<boost::mutex> l(syncher);
 				P_WARN("The UstRouter at " << serverAddress <<
 					" closed the connection (no error message given);" <<
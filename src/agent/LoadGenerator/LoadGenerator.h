@@ -0,0 +1,1015 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_LOAD_GENERATOR_LOAD_GENERATOR_H_
+#define _PASSENGER_LOAD_GENERATOR_LOAD_GENERATOR_H_
+
+#include <sys/types.h>
+#include <sys/time.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <unistd.h>
+#include <time.h>
+#include <cerrno>
+#include <cstring>
+#include <ev.h>
+
+#include <boost/bind.hpp>
+#include <boost/cstdint.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <string>
+#include <vector>
+#include <deque>
+
+#include <Logging.h>
+#include <Exceptions.h>
+#include <StaticString.h>
+#include <Algorithms/Histogram.h>
+#include <MemoryKit/mbuf.h>
+#include <MemoryKit/palloc.h>
+#include <ServerKit/Context.h>
+#include <ServerKit/HttpHeaderParser.h>
+#include <ServerKit/HttpChunkedBodyParser.h>
+#include <Core/Controller/AppResponse.h>
+#include <Utils/IOUtils.h>
+#include <Utils/StrIntUtils.h>
+
+namespace Passenger {
+namespace LoadGenerator {
+
+using namespace std;
+using namespace oxt;
+
+
+/**
+ * Configuration of a load test. See LoadGeneratorMain.cpp for the
+ * corresponding command line options.
+ */
+struct Options {
+	/** The server to send requests to, in a format accepted by
+	 * getSocketAddressType(), e.g. "unix:/tmp/core.sock" or "tcp://127.0.0.1:3000".
+	 */
+	string address;
+	string method;
+	string path;
+	/** The value of the Host header. Defaults to the address's host and port,
+	 * or "localhost" for Unix domain sockets.
+	 */
+	string host;
+	/** Extra request headers, in "Name: value" format. */
+	vector<string> headers;
+	/** If nonzero, every request has a body of this many bytes. */
+	unsigned int bodySize;
+
+	unsigned int threads;
+	/** The total number of connections, divided over all threads. */
+	unsigned int connections;
+	/** The total number of requests per second to send. If zero, the
+	 * load test is closed-loop: every connection sends its next request
+	 * as soon as the previous response has been received. Otherwise it's
+	 * open-loop: requests are sent on a fixed schedule, no matter how long
+	 * earlier responses take.
+	 */
+	double rate;
+	/** The duration of the measurement period, in milliseconds. Zero means
+	 * that the test runs until `maxRequests` have been completed.
+	 */
+	unsigned int duration;
+	/** The time to run before starting to measure, in milliseconds. */
+	unsigned int warmup;
+	/** If nonzero, stop after this many requests (including the ones sent
+	 * during the warmup period) have been completed.
+	 */
+	boost::uint64_t maxRequests;
+	/** In closed-loop mode, the interval (in microseconds) at which requests
+	 * are assumed to have been intended to be sent, for the purpose of
+	 * correcting for coordinated omission. Zero means the median response
+	 * time.
+	 */
+	boost::uint64_t expectedInterval;
+
+	Options()
+		: method("GET"),
+		  path("/"),
+		  bodySize(0),
+		  threads(1),
+		  connections(1),
+		  rate(0),
+		  duration(10000),
+		  warmup(0),
+		  maxRequests(0),
+		  expectedInterval(0)
+		{ }
+
+	bool openLoop() const {
+		return rate > 0;
+	}
+
+	/** Returns the request that every connection sends, over and over. */
+	string buildRequest() const {
+		string result;
+		result.append(method);
+		result.append(" ");
+		result.append(path);
+		result.append(" HTTP/1.1\r\nHost: ");
+		result.append(host.empty() ? defaultHost() : host);
+		result.append("\r\n");
+		for (vector<string>::const_iterator it = headers.begin(); it != headers.end(); it++) {
+			result.append(*it);
+			result.append("\r\n");
+		}
+		if (bodySize > 0) {
+			result.append("Content-Length: ");
+			result.append(toString(bodySize));
+			result.append("\r\n\r\n");
+			result.append(bodySize, 'x');
+		} else {
+			result.append("\r\n");
+		}
+		return result;
+	}
+
+	string defaultHost() const {
+		if (getSocketAddressType(address) == SAT_TCP) {
+			string host;
+			unsigned short port;
+			parseTcpSocketAddress(address, host, port);
+			return host + ":" + toString(port);
+		} else {
+			return "localhost";
+		}
+	}
+};
+
+/**
+ * Counters and latency histograms of a load test. Latencies are in microseconds.
+ */
+struct Results {
+	/** The number of completed responses. */
+	boost::uint64_t requests;
+	/** The number of requests that failed because of an I/O error, an
+	 * unparseable response, or a premature end of stream.
+	 */
+	boost::uint64_t errors;
+	/** The number of failed attempts to (re)connect to the server. */
+	boost::uint64_t connectErrors;
+	/** The number of times that a connection was reopened, because either
+	 * side did not keep it alive.
+	 */
+	boost::uint64_t reconnects;
+	/** Response counts by status code class: index 1 is 1xx, index 2 is 2xx, etc.
+	 * Index 0 counts status codes that don't fit any class.
+	 */
+	boost::uint64_t statusClasses[6];
+	boost::uint64_t bytesReceived;
+	/** Open-loop only: the number of requests that were sent late because
+	 * no connection was available at their scheduled time.
+	 */
+	boost::uint64_t delayed;
+	/** Open-loop only: the number of requests that were scheduled, but
+	 * never sent because the test ended before a connection became available.
+	 */
+	boost::uint64_t unsent;
+	/** The length of the measurement period, in microseconds. */
+	boost::uint64_t elapsed;
+	/** Closed-loop only: the interval that was used for correcting `latency`. */
+	boost::uint64_t expectedInterval;
+
+	/**
+	 * The latency as experienced by users that arrive at a steady rate,
+	 * i.e. corrected for coordinated omission. In open-loop mode, this is
+	 * measured from the time that a request was scheduled to be sent,
+	 * so that time spent waiting for a connection counts. In closed-loop
+	 * mode, this is `serviceTime` corrected after the fact with
+	 * Histogram::correctedForCoordinatedOmission().
+	 */
+	Histogram latency;
+	/** The time from actually sending a request until receiving the end
+	 * of its response. In closed-loop mode this is the uncorrected latency.
+	 */
+	Histogram serviceTime;
+
+	Results() {
+		reset();
+	}
+
+	void reset() {
+		requests = 0;
+		errors = 0;
+		connectErrors = 0;
+		reconnects = 0;
+		memset(statusClasses, 0, sizeof(statusClasses));
+		bytesReceived = 0;
+		delayed = 0;
+		unsent = 0;
+		elapsed = 0;
+		expectedInterval = 0;
+		latency.reset();
+		serviceTime.reset();
+	}
+
+	void merge(const Results &other) {
+		requests += other.requests;
+		errors += other.errors;
+		connectErrors += other.connectErrors;
+		reconnects += other.reconnects;
+		for (unsigned int i = 0; i < sizeof(statusClasses) / sizeof(statusClasses[0]); i++) {
+			statusClasses[i] += other.statusClasses[i];
+		}
+		bytesReceived += other.bytesReceived;
+		delayed += other.delayed;
+		unsent += other.unsent;
+		elapsed = std::max(elapsed, other.elapsed);
+		latency.merge(other.latency);
+		serviceTime.merge(other.serviceTime);
+	}
+
+	double getThroughput() const {
+		if (elapsed == 0) {
+			return 0;
+		} else {
+			return requests * 1000000.0 / elapsed;
+		}
+	}
+};
+
+
+/** Returns the time in microseconds according to a clock that never jumps. */
+inline boost::uint64_t
+getMonotonicUsec() {
+	#ifdef CLOCK_MONOTONIC
+		struct timespec ts;
+		if (clock_gettime(CLOCK_MONOTONIC, &ts) == 0) {
+			return (boost::uint64_t) ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+		}
+	#endif
+	struct timeval tv;
+	gettimeofday(&tv, NULL);
+	return (boost::uint64_t) tv.tv_sec * 1000000 + tv.tv_usec;
+}
+
+
+class Worker;
+
+/**
+ * A keep-alive connection to the server, with at most one outstanding request.
+ * Responses are parsed with the same parsers that the Core uses for parsing
+ * application responses.
+ */
+struct Connection {
+	enum State {
+		IDLE,
+		SENDING,
+		RECEIVING,
+		DISCONNECTED
+	};
+
+	Worker *worker;
+	unsigned int number;
+	State state;
+	int fd;
+	ev_io readWatcher;
+	ev_io writeWatcher;
+
+	size_t written;
+	boost::uint64_t intendedTime;
+	boost::uint64_t sendTime;
+
+	MemoryKit::mbuf buffer;
+	psg_pool_t *pool;
+	ServerKit::HttpHeaderParserState headerParserState;
+	Core::AppResponse response;
+
+	Connection(Worker *_worker, unsigned int _number)
+		: worker(_worker),
+		  number(_number),
+		  state(DISCONNECTED),
+		  fd(-1),
+		  written(0),
+		  intendedTime(0),
+		  sendTime(0),
+		  pool(psg_create_pool(PSG_DEFAULT_POOL_SIZE))
+		{ }
+
+	~Connection() {
+		deinitializeResponse();
+		psg_destroy_pool(pool);
+	}
+
+	void reinitializeResponse(ServerKit::Context *ctx, http_method method) {
+		response.httpMajor = 1;
+		response.httpMinor = 0;
+		response.httpState = Core::AppResponse::PARSING_HEADERS;
+		response.bodyType  = Core::AppResponse::RBT_NO_BODY;
+		response.wantKeepAlive = false;
+		response.oneHundredContinueSent = false;
+		response.statusCode = 0;
+		response.parserState.headerParser = &headerParserState;
+		createHeaderParser(ctx, method).initialize();
+		response.aux.bodyInfo.contentLength = 0; // Sets the entire union to 0.
+		response.bodyAlreadyRead = 0;
+		response.date = NULL;
+		response.setCookie = NULL;
+		response.cacheControl = NULL;
+		response.expiresHeader = NULL;
+		response.lastModifiedHeader = NULL;
+	}
+
+	void deinitializeResponse() {
+		ServerKit::HeaderTable::Iterator it(response.headers);
+		while (*it != NULL) {
+			psg_lstr_deinit(&it->header->key);
+			psg_lstr_deinit(&it->header->origKey);
+			psg_lstr_deinit(&it->header->val);
+			it.next();
+		}
+		it = ServerKit::HeaderTable::Iterator(response.secureHeaders);
+		while (*it != NULL) {
+			psg_lstr_deinit(&it->header->key);
+			psg_lstr_deinit(&it->header->origKey);
+			psg_lstr_deinit(&it->header->val);
+			it.next();
+		}
+		response.headers.clear();
+		response.secureHeaders.clear();
+		psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+	}
+
+	ServerKit::HttpHeaderParser<Core::AppResponse, ServerKit::HttpParseResponse>
+	createHeaderParser(ServerKit::Context *ctx, http_method method) {
+		return ServerKit::HttpHeaderParser<Core::AppResponse, ServerKit::HttpParseResponse>(
+			ctx, response.parserState.headerParser, &response, pool, method);
+	}
+
+	ServerKit::HttpChunkedBodyParser createChunkedBodyParser() {
+		return ServerKit::HttpChunkedBodyParser(
+			&response.parserState.chunkedBodyParser,
+			formatChunkedBodyParserLoggingPrefix, this);
+	}
+
+	static unsigned int formatChunkedBodyParserLoggingPrefix(char *buf,
+		unsigned int bufsize, void *userData)
+	{
+		Connection *conn = static_cast<Connection *>(userData);
+		return snprintf(buf, bufsize, "[Connection %u] ChunkedBodyParser: ",
+			conn->number);
+	}
+};
+
+
+/**
+ * Drives a subset of the connections from its own thread and event loop.
+ * All methods except the constructor, `start()` and `join()` are only
+ * called from the worker thread.
+ */
+class Worker {
+private:
+	enum FeedResult {
+		NEED_MORE,
+		RESPONSE_COMPLETE,
+		RESPONSE_ERROR
+	};
+
+	const Options &options;
+	unsigned int number;
+	string request;
+	http_method requestMethod;
+	boost::uint64_t budget;
+
+	ServerKit::Context *context;
+	struct ev_loop *loop;
+	ev_timer scheduleTimer;
+	ev_timer warmupTimer;
+	ev_timer endTimer;
+	oxt::thread *thread;
+
+	vector<Connection *> connections;
+	vector<Connection *> idleConnections;
+	/** Open-loop only: the intended send times of requests that are waiting
+	 * for a connection to become available.
+	 */
+	deque<boost::uint64_t> backlog;
+	unsigned int liveConnections;
+
+	double interval;
+	boost::uint64_t startTime;
+	boost::uint64_t measureStartTime;
+	boost::uint64_t scheduled;
+	boost::uint64_t started;
+	boost::uint64_t finished;
+	bool stopping;
+
+	Results results;
+
+
+	/***** Connection management *****/
+
+	bool connect(Connection *conn) {
+		int fd;
+
+		try {
+			fd = connectToServer(options.address, __FILE__, __LINE__);
+		} catch (const tracable_exception &e) {
+			P_WARN("Load generator connection " << conn->number <<
+				": cannot connect to " << options.address << ": " << e.what());
+			results.connectErrors++;
+			return false;
+		}
+
+		setNonBlocking(fd);
+		if (getSocketAddressType(options.address) == SAT_TCP) {
+			int flag = 1;
+			setsockopt(fd, IPPROTO_TCP, TCP_NODELAY, &flag, sizeof(flag));
+		}
+		#ifdef SO_NOSIGPIPE
+			int flag = 1;
+			setsockopt(fd, SOL_SOCKET, SO_NOSIGPIPE, &flag, sizeof(flag));
+		#endif
+
+		conn->fd = fd;
+		conn->state = Connection::IDLE;
+		ev_io_init(&conn->readWatcher, onReadable, fd, EV_READ);
+		conn->readWatcher.data = conn;
+		ev_io_init(&conn->writeWatcher, onWritable, fd, EV_WRITE);
+		conn->writeWatcher.data = conn;
+		ev_io_start(loop, &conn->readWatcher);
+		return true;
+	}
+
+	void disconnect(Connection *conn) {
+		if (conn->state == Connection::DISCONNECTED) {
+			return;
+		}
+		ev_io_stop(loop, &conn->readWatcher);
+		ev_io_stop(loop, &conn->writeWatcher);
+		safelyClose(conn->fd, true);
+		P_LOG_FILE_DESCRIPTOR_CLOSE(conn->fd);
+		conn->fd = -1;
+		conn->state = Connection::DISCONNECTED;
+		conn->deinitializeResponse();
+	}
+
+	/**
+	 * Closes the connection and opens a new one. If that fails, the connection
+	 * is abandoned, and the test is stopped once no connections are left.
+	 */
+	void reconnect(Connection *conn) {
+		disconnect(conn);
+		if (stopping) {
+			return;
+		}
+		results.reconnects++;
+		if (connect(conn)) {
+			onConnectionIdle(conn);
+		} else {
+			liveConnections--;
+			if (liveConnections == 0) {
+				P_ERROR("Load generator worker " << number <<
+					": all connections failed; stopping");
+				stop();
+			}
+		}
+	}
+
+	void onRequestError(Connection *conn, const char *message, int errcode = 0) {
+		if (errcode == 0) {
+			P_DEBUG("Load generator connection " << conn->number << ": " << message);
+		} else {
+			P_DEBUG("Load generator connection " << conn->number << ": " << message <<
+				": " << strerror(errcode) << " (errno=" << errcode << ")");
+		}
+		results.errors++;
+		if (conn->state == Connection::SENDING || conn->state == Connection::RECEIVING) {
+			finished++;
+		}
+		reconnect(conn);
+		checkBudget();
+	}
+
+
+	/***** Sending *****/
+
+	void startRequest(Connection *conn, boost::uint64_t intendedTime) {
+		started++;
+		conn->reinitializeResponse(context, requestMethod);
+		conn->intendedTime = intendedTime;
+		conn->sendTime = getMonotonicUsec();
+		conn->written = 0;
+		conn->state = Connection::SENDING;
+		writeRequest(conn);
+	}
+
+	void writeRequest(Connection *conn) {
+		while (conn->written < request.size()) {
+			ssize_t ret;
+			#ifdef MSG_NOSIGNAL
+				ret = ::send(conn->fd, request.data() + conn->written,
+					request.size() - conn->written, MSG_NOSIGNAL);
+			#else
+				ret = ::send(conn->fd, request.data() + conn->written,
+					request.size() - conn->written, 0);
+			#endif
+			if (ret == -1) {
+				int e = errno;
+				if (e == EAGAIN || e == EWOULDBLOCK) {
+					ev_io_start(loop, &conn->writeWatcher);
+				} else if (e != EINTR) {
+					onRequestError(conn, "cannot send request", e);
+				}
+				return;
+			}
+			conn->written += ret;
+		}
+		ev_io_stop(loop, &conn->writeWatcher);
+		if (conn->state == Connection::SENDING) {
+			conn->state = Connection::RECEIVING;
+		}
+	}
+
+	static void onWritable(struct ev_loop *loop, ev_io *io, int revents) {
+		Connection *conn = static_cast<Connection *>(io->data);
+		conn->worker->writeRequest(conn);
+	}
+
+
+	/***** Receiving *****/
+
+	static void onReadable(struct ev_loop *loop, ev_io *io, int revents) {
+		Connection *conn = static_cast<Connection *>(io->data);
+		conn->worker->readResponse(conn);
+	}
+
+	void readResponse(Connection *conn) {
+		if (conn->buffer.empty() || conn->buffer.mbuf_block->refcount > 1) {
+			// The header parser still references the old buffer.
+			conn->buffer = MemoryKit::mbuf_get(&context->mbuf_pool);
+		}
+
+		ssize_t ret;
+		do {
+			ret = ::read(conn->fd, conn->buffer.start, conn->buffer.size());
+		} while (ret == -1 && errno == EINTR);
+
+		if (ret == -1) {
+			int e = errno;
+			if (e == EAGAIN || e == EWOULDBLOCK) {
+				return;
+			} else if (conn->state == Connection::IDLE && e == ECONNRESET) {
+				reconnect(conn);
+			} else {
+				onRequestError(conn, "cannot receive response", e);
+			}
+		} else if (ret == 0) {
+			onEof(conn);
+		} else if (conn->state == Connection::IDLE) {
+			onRequestError(conn, "unexpected data received on an idle connection");
+		} else {
+			MemoryKit::mbuf data(conn->buffer, 0, ret);
+			size_t consumed;
+
+			results.bytesReceived += ret;
+			switch (feedResponse(conn, data, consumed)) {
+			case NEED_MORE:
+				break;
+			case RESPONSE_COMPLETE:
+				if (consumed != data.size()) {
+					onRequestError(conn, "server sent data beyond the end of the response");
+				} else {
+					onResponseComplete(conn);
+				}
+				break;
+			case RESPONSE_ERROR:
+				onRequestError(conn, "cannot parse response");
+				break;
+			}
+		}
+	}
+
+	void onEof(Connection *conn) {
+		switch (conn->state) {
+		case Connection::IDLE:
+			// The server closed a keep-alive connection.
+			reconnect(conn);
+			break;
+		case Connection::SENDING:
+		case Connection::RECEIVING:
+			if (conn->response.httpState == Core::AppResponse::PARSING_BODY_UNTIL_EOF) {
+				conn->response.wantKeepAlive = false;
+				onResponseComplete(conn);
+			} else {
+				onRequestError(conn, "server closed the connection before "
+					"the response was complete");
+			}
+			break;
+		default:
+			break;
+		}
+	}
+
+	FeedResult feedResponse(Connection *conn, MemoryKit::mbuf data, size_t &consumed) {
+		Core::AppResponse *resp = &conn->response;
+
+		consumed = 0;
+		while (!data.empty()) {
+			switch (resp->httpState) {
+			case Core::AppResponse::PARSING_HEADERS: {
+				size_t ret = conn->createHeaderParser(context, requestMethod).feed(data);
+				consumed += ret;
+				switch (resp->httpState) {
+				case Core::AppResponse::PARSING_HEADERS:
+					return NEED_MORE;
+				case Core::AppResponse::COMPLETE:
+					return RESPONSE_COMPLETE;
+				case Core::AppResponse::PARSING_CHUNKED_BODY:
+					conn->createChunkedBodyParser().initialize();
+					break;
+				case Core::AppResponse::PARSING_BODY_WITH_LENGTH:
+				case Core::AppResponse::PARSING_BODY_UNTIL_EOF:
+					break;
+				case Core::AppResponse::ONEHUNDRED_CONTINUE:
+					// Ignore it and wait for the real response.
+					conn->deinitializeResponse();
+					conn->reinitializeResponse(context, requestMethod);
+					break;
+				default:
+					// Parse errors and upgrades.
+					return RESPONSE_ERROR;
+				}
+				data = MemoryKit::mbuf(data, ret);
+				break;
+			}
+			case Core::AppResponse::PARSING_BODY_WITH_LENGTH: {
+				boost::uint64_t remaining = std::min<boost::uint64_t>(data.size(),
+					resp->aux.bodyInfo.contentLength - resp->bodyAlreadyRead);
+				resp->bodyAlreadyRead += remaining;
+				consumed += remaining;
+				if (resp->bodyFullyRead()) {
+					return RESPONSE_COMPLETE;
+				}
+				return NEED_MORE;
+			}
+			case Core::AppResponse::PARSING_CHUNKED_BODY: {
+				ServerKit::HttpChunkedEvent event(conn->createChunkedBodyParser()
+					.feed(data, false));
+				resp->bodyAlreadyRead += event.consumed;
+				consumed += event.consumed;
+				switch (event.type) {
+				case ServerKit::HttpChunkedEvent::END:
+					return RESPONSE_COMPLETE;
+				case ServerKit::HttpChunkedEvent::ERROR:
+					return RESPONSE_ERROR;
+				default:
+					data = MemoryKit::mbuf(data, event.consumed);
+					break;
+				}
+				break;
+			}
+			case Core::AppResponse::PARSING_BODY_UNTIL_EOF:
+				resp->bodyAlreadyRead += data.size();
+				consumed += data.size();
+				return NEED_MORE;
+			default:
+				return RESPONSE_ERROR;
+			}
+		}
+		return NEED_MORE;
+	}
+
+	void onResponseComplete(Connection *conn) {
+		boost::uint64_t now = getMonotonicUsec();
+		unsigned int statusClass = conn->response.statusCode / 100;
+		bool keepAlive = conn->response.wantKeepAlive;
+
+		results.requests++;
+		if (statusClass < sizeof(results.statusClasses) / sizeof(results.statusClasses[0])) {
+			results.statusClasses[statusClass]++;
+		} else {
+			results.statusClasses[0]++;
+		}
+		results.serviceTime.record(now - conn->sendTime);
+		if (options.openLoop()) {
+			results.latency.record(now - conn->intendedTime);
+		}
+
+		finished++;
+		ev_io_stop(loop, &conn->writeWatcher);
+		conn->deinitializeResponse();
+		conn->state = Connection::IDLE;
+		if (keepAlive) {
+			onConnectionIdle(conn);
+		} else {
+			reconnect(conn);
+		}
+		checkBudget();
+	}
+
+
+	/***** Scheduling *****/
+
+	bool budgetExhausted() const {
+		return budget != 0 && started >= budget;
+	}
+
+	void checkBudget() {
+		if (budget != 0 && finished >= budget) {
+			stop();
+		}
+	}
+
+	void onConnectionIdle(Connection *conn) {
+		if (stopping) {
+			return;
+		} else if (!backlog.empty()) {
+			boost::uint64_t intendedTime = backlog.front();
+			backlog.pop_front();
+			startRequest(conn, intendedTime);
+		} else if (!options.openLoop() && !budgetExhausted()) {
+			startRequest(conn, getMonotonicUsec());
+		} else {
+			idleConnections.push_back(conn);
+		}
+	}
+
+	boost::uint64_t getIntendedTime(boost::uint64_t index) const {
+		return startTime + (boost::uint64_t) (index * interval);
+	}
+
+	/**
+	 * Sends all requests whose scheduled time has passed, then sleeps
+	 * until the next one. The time at which a request *should* have been
+	 * sent is remembered, so that delays caused by the server being slow
+	 * (and thus no connection being available) count towards latency.
+	 */
+	static void onScheduleTimer(struct ev_loop *loop, ev_timer *timer, int revents) {
+		Worker *self = static_cast<Worker *>(timer->data);
+		self->sendScheduledRequests();
+	}
+
+	void sendScheduledRequests() {
+		boost::uint64_t now = getMonotonicUsec();
+
+		while (!stopping && (budget == 0 || scheduled < budget)
+			&& getIntendedTime(scheduled) <= now)
+		{
+			boost::uint64_t intendedTime = getIntendedTime(scheduled);
+			scheduled++;
+			if (idleConnections.empty()) {
+				results.delayed++;
+				backlog.push_back(intendedTime);
+			} else {
+				Connection *conn = idleConnections.back();
+				idleConnections.pop_back();
+				startRequest(conn, intendedTime);
+			}
+		}
+
+		if (!stopping && (budget == 0 || scheduled < budget)) {
+			boost::uint64_t next = getIntendedTime(scheduled);
+			ev_timer_set(&scheduleTimer, (next - std::min(next, getMonotonicUsec())) / 1000000.0, 0);
+			ev_timer_start(loop, &scheduleTimer);
+		}
+	}
+
+	static void onWarmupTimer(struct ev_loop *loop, ev_timer *timer, int revents) {
+		Worker *self = static_cast<Worker *>(timer->data);
+		self->results.reset();
+		self->measureStartTime = getMonotonicUsec();
+	}
+
+	static void onEndTimer(struct ev_loop *loop, ev_timer *timer, int revents) {
+		Worker *self = static_cast<Worker *>(timer->data);
+		self->stop();
+	}
+
+	void stop() {
+		if (!stopping) {
+			stopping = true;
+			results.elapsed = getMonotonicUsec() - measureStartTime;
+			results.unsent = backlog.size();
+			ev_break(loop, EVBREAK_ALL);
+		}
+	}
+
+	void threadMain() {
+		ev_run(loop, 0);
+	}
+
+public:
+	Worker(const Options &_options, unsigned int _number, unsigned int firstConnectionNumber,
+		unsigned int nconnections, boost::uint64_t _budget)
+		: options(_options),
+		  number(_number),
+		  request(_options.buildRequest()),
+		  requestMethod(_options.method == "HEAD" ? HTTP_HEAD : HTTP_GET),
+		  budget(_budget),
+		  context(new ServerKit::Context(ev_loop_new(EVFLAG_AUTO))),
+		  loop(context->libev->getLoop()),
+		  thread(NULL),
+		  liveConnections(0),
+		  interval(0),
+		  startTime(0),
+		  measureStartTime(0),
+		  scheduled(0),
+		  started(0),
+		  finished(0),
+		  stopping(false)
+	{
+		ev_timer_init(&scheduleTimer, onScheduleTimer, 0, 0);
+		scheduleTimer.data = this;
+		ev_timer_init(&warmupTimer, onWarmupTimer, 0, 0);
+		warmupTimer.data = this;
+		ev_timer_init(&endTimer, onEndTimer, 0, 0);
+		endTimer.data = this;
+
+		for (unsigned int i = 0; i < nconnections; i++) {
+			connections.push_back(new Connection(this, firstConnectionNumber + i));
+		}
+	}
+
+	~Worker() {
+		join();
+		ev_timer_stop(loop, &scheduleTimer);
+		ev_timer_stop(loop, &warmupTimer);
+		ev_timer_stop(loop, &endTimer);
+		for (vector<Connection *>::iterator it = connections.begin(); it != connections.end(); it++) {
+			disconnect(*it);
+			delete *it;
+		}
+		delete context;
+	}
+
+	/**
+	 * Opens all connections. Returns false if none could be opened.
+	 */
+	bool connectAll() {
+		for (vector<Connection *>::iterator it = connections.begin(); it != connections.end(); it++) {
+			if (connect(*it)) {
+				liveConnections++;
+			}
+		}
+		return liveConnections > 0 || connections.empty();
+	}
+
+	/** Starts sending requests from a background thread. */
+	void start(boost::uint64_t _startTime, double ratePerWorker) {
+		startTime = _startTime;
+		measureStartTime = _startTime;
+		// The loop time is as old as the loop itself, and timers are
+		// relative to it.
+		ev_now_update(loop);
+		if (options.warmup > 0) {
+			ev_timer_set(&warmupTimer, options.warmup / 1000.0, 0);
+			ev_timer_start(loop, &warmupTimer);
+		}
+		if (options.duration > 0) {
+			ev_timer_set(&endTimer, (options.warmup + options.duration) / 1000.0, 0);
+			ev_timer_start(loop, &endTimer);
+		}
+
+		if (budget == 0 && options.maxRequests > 0) {
+			// Some other worker handles all the requests.
+			stopping = true;
+		} else if (liveConnections == 0) {
+			stopping = true;
+		} else {
+			for (vector<Connection *>::iterator it = connections.begin(); it != connections.end(); it++) {
+				if ((*it)->state == Connection::IDLE) {
+					onConnectionIdle(*it);
+				}
+			}
+			if (options.openLoop()) {
+				interval = 1000000.0 / ratePerWorker;
+				sendScheduledRequests();
+			}
+		}
+
+		if (!stopping) {
+			thread = new oxt::thread(boost::bind(&Worker::threadMain, this),
+				"Load generator worker " + toString(number), 1024 * 1024);
+		}
+	}
+
+	void join() {
+		if (thread != NULL) {
+			thread->join();
+			delete thread;
+			thread = NULL;
+		}
+	}
+
+	const Results &getResults() const {
+		return results;
+	}
+};
+
+
+/**
+ * Runs a load test against an HTTP server, such as the Core in one of its
+ * `--benchmark` modes, or an application behind it.
+ *
+ * The work is divided over `Options::threads` workers, each of which has
+ * its own event loop and a subset of the connections. Every connection has
+ * at most one request in flight; no pipelining is done. Both modes produce
+ * latencies that are corrected for coordinated omission (see `Results::latency`),
+ * so that a server that stalls cannot hide the stall by also stalling the
+ * load generator.
+ */
+class Generator {
+private:
+	Options options;
+	vector<Worker *> workers;
+
+public:
+	Generator(const Options &_options)
+		: options(_options)
+	{
+		if (options.threads == 0) {
+			options.threads = 1;
+		}
+		options.threads = std::min(options.threads, std::max(options.connections, 1u));
+	}
+
+	~Generator() {
+		for (vector<Worker *>::iterator it = workers.begin(); it != workers.end(); it++) {
+			delete *it;
+		}
+	}
+
+	const Options &getOptions() const {
+		return options;
+	}
+
+	/**
+	 * Runs the load test to completion and returns the aggregated results.
+	 *
+	 * @throws RuntimeException None of the connections could be established.
+	 */
+	Results run() {
+		unsigned int i, nextConnectionNumber = 0;
+
+		for (i = 0; i < options.threads; i++) {
+			unsigned int nconnections = options.connections / options.threads
+				+ (i < options.connections % options.threads);
+			boost::uint64_t budget = options.maxRequests / options.threads
+				+ (i < options.maxRequests % options.threads);
+			Worker *worker = new Worker(options, i, nextConnectionNumber,
+				nconnections, budget);
+			workers.push_back(worker);
+			nextConnectionNumber += nconnections;
+			if (!worker->connectAll()) {
+				throw RuntimeException("Cannot connect to " + options.address);
+			}
+		}
+
+		boost::uint64_t startTime = getMonotonicUsec();
+		for (i = 0; i < workers.size(); i++) {
+			workers[i]->start(startTime, options.rate / workers.size());
+		}
+
+		Results results;
+		for (i = 0; i < workers.size(); i++) {
+			workers[i]->join();
+			results.merge(workers[i]->getResults());
+		}
+
+		if (!options.openLoop()) {
+			results.expectedInterval = options.expectedInterval;
+			if (results.expectedInterval == 0) {
+				results.expectedInterval = results.serviceTime.getValueAtPercentile(50);
+			}
+			results.latency = results.serviceTime.correctedForCoordinatedOmission(
+				results.expectedInterval);
+		}
+		return results;
+	}
+};
+
+
+} // namespace LoadGenerator
+} // namespace Passenger
+
+#endif /* _PASSENGER_LOAD_GENERATOR_LOAD_GENERATOR_H_ */
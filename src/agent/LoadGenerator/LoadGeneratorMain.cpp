@@ -0,0 +1,362 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <signal.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <jsoncpp/json.h>
+#include <Constants.h>
+#include <Exceptions.h>
+#include <Utils/IOUtils.h>
+#include <Utils/StrIntUtils.h>
+#include <LoadGenerator/LoadGenerator.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::LoadGenerator;
+
+namespace {
+	struct MainOptions {
+		Options generator;
+		bool durationGiven;
+		string jsonFile;
+		bool help;
+
+		MainOptions() {
+			generator.connections = 10;
+			durationGiven = false;
+			help = false;
+		}
+	};
+
+	const double PERCENTILES[] = { 50, 75, 90, 99, 99.9, 99.99 };
+	const unsigned int NPERCENTILES = sizeof(PERCENTILES) / sizeof(double);
+}
+
+static bool
+isFlag(const char *arg, char shortFlagName, const char *longFlagName) {
+	return strcmp(arg, longFlagName) == 0
+		|| (shortFlagName != '\0' && arg[0] == '-'
+			&& arg[1] == shortFlagName && arg[2] == '\0');
+}
+
+static void
+usage() {
+	printf("Usage: " AGENT_EXE " loadgen [OPTIONS] <ADDRESS>\n");
+	printf("Sends HTTP requests to a server over keep-alive connections, and reports the\n");
+	printf("throughput and the latency distribution. ADDRESS is either unix:/path/to/socket\n");
+	printf("or tcp://host:port.\n");
+	printf("\n");
+	printf("To measure a specific layer of the " SHORT_PROGRAM_NAME " Core, start the Core with\n");
+	printf("--benchmark MODE and point this command at its server socket.\n");
+	printf("\n");
+	printf("By default the test is closed-loop: every connection sends its next request as\n");
+	printf("soon as it has received the previous response. With --rate, the test is\n");
+	printf("open-loop: requests are sent on a fixed schedule no matter how slow the\n");
+	printf("server is. Either way, latencies are corrected for coordinated omission.\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("  -c, --connections NUM   Total number of connections. Default: 10\n");
+	printf("  -t, --threads NUM       Number of worker threads. Default: 1\n");
+	printf("  -r, --rate NUM          Open-loop mode: send NUM requests per second in total\n");
+	printf("  -d, --duration SECONDS  Length of the measurement period. Default: 10, or\n");
+	printf("                          unlimited if --requests is given\n");
+	printf("  -w, --warmup SECONDS    Send requests for this long before starting to\n");
+	printf("                          measure. Default: 0\n");
+	printf("  -n, --requests NUM      Stop after completing NUM requests, including the\n");
+	printf("                          ones sent during the warmup period\n");
+	printf("      --expected-interval USEC\n");
+	printf("                          Closed-loop mode: the interval at which requests are\n");
+	printf("                          assumed to have been intended to be sent, for\n");
+	printf("                          correcting for coordinated omission. Default: the\n");
+	printf("                          median service time\n");
+	printf("\n");
+	printf("Request options:\n");
+	printf("  -X, --method METHOD     Default: GET\n");
+	printf("  -p, --path PATH         Default: /\n");
+	printf("      --host HOST         Value of the Host header. Default: derived from\n");
+	printf("                          ADDRESS\n");
+	printf("  -H, --header HEADER     Add a header, in \"Name: value\" format. Can be\n");
+	printf("                          specified multiple times\n");
+	printf("      --body-size BYTES   Send a request body of this size\n");
+	printf("\n");
+	printf("Output options:\n");
+	printf("      --json FILE         Also write the results as JSON to FILE. If FILE\n");
+	printf("                          is -, write only JSON to stdout\n");
+	printf("  -h, --help              Show this help\n");
+}
+
+static const char *
+requireValue(int argc, char *argv[], int i) {
+	if (i + 1 >= argc) {
+		fprintf(stderr, "ERROR: extra argument required for %s\n", argv[i]);
+		usage();
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static MainOptions
+parseOptions(int argc, char *argv[]) {
+	MainOptions options;
+	Options &gen = options.generator;
+	int i = 2;
+
+	while (i < argc) {
+		if (isFlag(argv[i], 'c', "--connections")) {
+			gen.connections = atoi(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], 't', "--threads")) {
+			gen.threads = atoi(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], 'r', "--rate")) {
+			gen.rate = atof(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], 'd', "--duration")) {
+			gen.duration = (unsigned int) (atof(requireValue(argc, argv, i)) * 1000);
+			options.durationGiven = true;
+			i += 2;
+		} else if (isFlag(argv[i], 'w', "--warmup")) {
+			gen.warmup = (unsigned int) (atof(requireValue(argc, argv, i)) * 1000);
+			i += 2;
+		} else if (isFlag(argv[i], 'n', "--requests")) {
+			gen.maxRequests = stringToULL(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], '\0', "--expected-interval")) {
+			gen.expectedInterval = stringToULL(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], 'X', "--method")) {
+			gen.method = requireValue(argc, argv, i);
+			i += 2;
+		} else if (isFlag(argv[i], 'p', "--path")) {
+			gen.path = requireValue(argc, argv, i);
+			i += 2;
+		} else if (isFlag(argv[i], '\0', "--host")) {
+			gen.host = requireValue(argc, argv, i);
+			i += 2;
+		} else if (isFlag(argv[i], 'H', "--header")) {
+			gen.headers.push_back(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], '\0', "--body-size")) {
+			gen.bodySize = atoi(requireValue(argc, argv, i));
+			i += 2;
+		} else if (isFlag(argv[i], '\0', "--json")) {
+			options.jsonFile = requireValue(argc, argv, i);
+			i += 2;
+		} else if (isFlag(argv[i], 'h', "--help")) {
+			options.help = true;
+			i++;
+		} else if (argv[i][0] == '-') {
+			fprintf(stderr, "ERROR: unrecognized argument %s\n", argv[i]);
+			usage();
+			exit(1);
+		} else if (gen.address.empty()) {
+			gen.address = argv[i];
+			i++;
+		} else {
+			fprintf(stderr, "ERROR: only one address may be given\n");
+			usage();
+			exit(1);
+		}
+	}
+
+	if (options.help) {
+		return options;
+	}
+	if (gen.address.empty()) {
+		fprintf(stderr, "ERROR: please specify an address\n");
+		usage();
+		exit(1);
+	}
+	if (getSocketAddressType(gen.address) == SAT_UNKNOWN) {
+		fprintf(stderr, "ERROR: unsupported address %s. Please use unix:/path/to/socket "
+			"or tcp://host:port\n", gen.address.c_str());
+		exit(1);
+	}
+	if (gen.connections == 0) {
+		fprintf(stderr, "ERROR: --connections must be at least 1\n");
+		exit(1);
+	}
+	if (gen.maxRequests > 0 && !options.durationGiven) {
+		gen.duration = 0;
+	}
+	if (gen.duration == 0 && gen.maxRequests == 0) {
+		fprintf(stderr, "ERROR: please specify a nonzero --duration or --requests\n");
+		exit(1);
+	}
+	return options;
+}
+
+static string
+formatLatency(boost::uint64_t usec) {
+	char buf[32];
+	snprintf(buf, sizeof(buf), "%.3f ms", usec / 1000.0);
+	return buf;
+}
+
+static void
+printHistogram(const char *title, const Histogram &histogram) {
+	printf("%s\n", title);
+	for (unsigned int i = 0; i < NPERCENTILES; i++) {
+		printf("  %-7s %s\n", (toString(PERCENTILES[i]) + "%").c_str(),
+			formatLatency(histogram.getValueAtPercentile(PERCENTILES[i])).c_str());
+	}
+	printf("  %-7s %s\n", "max", formatLatency(histogram.getMax()).c_str());
+	printf("  %-7s %s\n", "mean",
+		formatLatency((boost::uint64_t) histogram.getMean()).c_str());
+}
+
+static void
+printResults(const Options &options, const Results &results) {
+	printf("Target:    %s (%s, %u connections, %u threads)\n",
+		options.address.c_str(),
+		options.openLoop()
+			? ("open-loop at " + toString(options.rate) + " req/s").c_str()
+			: "closed-loop",
+		options.connections, options.threads);
+	printf("Duration:  %.2f s\n", results.elapsed / 1000000.0);
+	printf("Requests:  %llu (%.1f req/s)\n", (unsigned long long) results.requests,
+		results.getThroughput());
+	printf("Errors:    %llu request errors, %llu connect errors, %llu reconnects\n",
+		(unsigned long long) results.errors,
+		(unsigned long long) results.connectErrors,
+		(unsigned long long) results.reconnects);
+	printf("Responses: 1xx %llu, 2xx %llu, 3xx %llu, 4xx %llu, 5xx %llu, other %llu\n",
+		(unsigned long long) results.statusClasses[1],
+		(unsigned long long) results.statusClasses[2],
+		(unsigned long long) results.statusClasses[3],
+		(unsigned long long) results.statusClasses[4],
+		(unsigned long long) results.statusClasses[5],
+		(unsigned long long) results.statusClasses[0]);
+	printf("Received:  %llu bytes\n", (unsigned long long) results.bytesReceived);
+	if (options.openLoop()) {
+		printf("Delayed:   %llu requests waited for a free connection, "
+			"%llu were never sent\n",
+			(unsigned long long) results.delayed,
+			(unsigned long long) results.unsent);
+	}
+	printf("\n");
+
+	if (options.openLoop()) {
+		printHistogram("Latency (from the scheduled send time):", results.latency);
+	} else {
+		printHistogram(("Latency (corrected for coordinated omission, expected interval "
+			+ toString(results.expectedInterval) + " us):").c_str(),
+			results.latency);
+	}
+	printHistogram("Service time (from the actual send time, uncorrected):",
+		results.serviceTime);
+}
+
+static Json::Value
+histogramToJson(const Histogram &histogram) {
+	Json::Value doc;
+	doc["count"] = (Json::UInt64) histogram.getCount();
+	for (unsigned int i = 0; i < NPERCENTILES; i++) {
+		doc["p" + toString(PERCENTILES[i])] =
+			(Json::UInt64) histogram.getValueAtPercentile(PERCENTILES[i]);
+	}
+	doc["max"] = (Json::UInt64) histogram.getMax();
+	doc["mean"] = histogram.getMean();
+	return doc;
+}
+
+static Json::Value
+resultsToJson(const Options &options, const Results &results) {
+	Json::Value doc, statusClasses;
+
+	doc["address"] = options.address;
+	doc["mode"] = options.openLoop() ? "open-loop" : "closed-loop";
+	if (options.openLoop()) {
+		doc["rate"] = options.rate;
+	}
+	doc["connections"] = options.connections;
+	doc["threads"] = options.threads;
+	doc["elapsed_usec"] = (Json::UInt64) results.elapsed;
+	doc["requests"] = (Json::UInt64) results.requests;
+	doc["throughput"] = results.getThroughput();
+	doc["errors"] = (Json::UInt64) results.errors;
+	doc["connect_errors"] = (Json::UInt64) results.connectErrors;
+	doc["reconnects"] = (Json::UInt64) results.reconnects;
+	doc["bytes_received"] = (Json::UInt64) results.bytesReceived;
+	for (unsigned int i = 1; i <= 5; i++) {
+		statusClasses[toString(i) + "xx"] = (Json::UInt64) results.statusClasses[i];
+	}
+	statusClasses["other"] = (Json::UInt64) results.statusClasses[0];
+	doc["responses"] = statusClasses;
+	if (options.openLoop()) {
+		doc["delayed"] = (Json::UInt64) results.delayed;
+		doc["unsent"] = (Json::UInt64) results.unsent;
+	} else {
+		doc["expected_interval_usec"] = (Json::UInt64) results.expectedInterval;
+	}
+	doc["latency_usec"] = histogramToJson(results.latency);
+	doc["service_time_usec"] = histogramToJson(results.serviceTime);
+	return doc;
+}
+
+int
+loadGeneratorMain(int argc, char *argv[]) {
+	MainOptions options = parseOptions(argc, argv);
+	if (options.help) {
+		usage();
+		return 0;
+	}
+
+	// Connections use MSG_NOSIGNAL or SO_NOSIGPIPE where available;
+	// this covers the other platforms.
+	signal(SIGPIPE, SIG_IGN);
+
+	Generator generator(options.generator);
+	Results results;
+	try {
+		results = generator.run();
+	} catch (const tracable_exception &e) {
+		fprintf(stderr, "ERROR: %s\n", e.what());
+		return 1;
+	}
+
+	if (options.jsonFile != "-") {
+		printResults(generator.getOptions(), results);
+	}
+	if (!options.jsonFile.empty()) {
+		string json = resultsToJson(generator.getOptions(), results).toStyledString();
+		if (options.jsonFile == "-") {
+			cout << json;
+		} else {
+			ofstream f(options.jsonFile.c_str());
+			f << json;
+			if (!f) {
+				fprintf(stderr, "ERROR: cannot write %s\n", options.jsonFile.c_str());
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,346 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#include <iostream>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <boost/scoped_ptr.hpp>
+#include <jsoncpp/json.h>
+#include <Constants.h>
+#include <Exceptions.h>
+#include <StatsSegment.h>
+#include <Utils/StrIntUtils.h>
+#include <Utils/SystemTime.h>
+
+using namespace std;
+using namespace Passenger;
+
+namespace {
+	struct MainOptions {
+		string path;
+		bool json;
+		double watchInterval;
+		bool help;
+
+		MainOptions()
+			: json(false),
+			  watchInterval(0),
+			  help(false)
+			{ }
+	};
+}
+
+static bool
+isFlag(const char *arg, char shortFlagName, const char *longFlagName) {
+	return strcmp(arg, longFlagName) == 0
+		|| (shortFlagName != '\0' && arg[0] == '-'
+			&& arg[1] == shortFlagName && arg[2] == '\0');
+}
+
+static void
+usage() {
+	printf("Usage: " AGENT_EXE " stats [OPTIONS] <INSTANCE DIR or FILE>\n");
+	printf("Shows the statistics that the " SHORT_PROGRAM_NAME " core publishes in the core_stats\n");
+	printf("file in its instance directory. Reading them does not involve the core at all,\n");
+	printf("so this command may be run as often as desired.\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("      --json              Print JSON instead of a human-readable summary\n");
+	printf("  -w, --watch SECONDS     Keep printing the statistics at this interval\n");
+	printf("  -h, --help              Show this help\n");
+}
+
+static MainOptions
+parseOptions(int argc, char *argv[]) {
+	MainOptions options;
+	int i = 2;
+
+	while (i < argc) {
+		if (isFlag(argv[i], '\0', "--json")) {
+			options.json = true;
+			i++;
+		} else if (isFlag(argv[i], 'w', "--watch")) {
+			if (i + 1 >= argc) {
+				fprintf(stderr, "ERROR: extra argument required for %s\n", argv[i]);
+				usage();
+				exit(1);
+			}
+			options.watchInterval = atof(argv[i + 1]);
+			i += 2;
+		} else if (isFlag(argv[i], 'h', "--help")) {
+			options.help = true;
+			i++;
+		} else if (argv[i][0] == '-') {
+			fprintf(stderr, "ERROR: unrecognized argument %s\n", argv[i]);
+			usage();
+			exit(1);
+		} else if (options.path.empty()) {
+			options.path = argv[i];
+			i++;
+		} else {
+			fprintf(stderr, "ERROR: only one instance directory or file may be given\n");
+			usage();
+			exit(1);
+		}
+	}
+
+	if (options.help) {
+		return options;
+	}
+	if (options.path.empty()) {
+		fprintf(stderr, "ERROR: please specify an instance directory or a stats file\n");
+		usage();
+		exit(1);
+	}
+
+	struct stat buf;
+	if (stat(options.path.c_str(), &buf) == 0 && S_ISDIR(buf.st_mode)) {
+		options.path.append("/core_stats");
+	}
+	return options;
+}
+
+static const char *
+processLifeStatusString(boost::uint8_t status) {
+	switch (status) {
+	case StatsSegmentProcess::ALIVE:
+		return "ALIVE";
+	case StatsSegmentProcess::SHUTDOWN_TRIGGERED:
+		return "SHUTDOWN_TRIGGERED";
+	case StatsSegmentProcess::DEAD:
+		return "DEAD";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+static const char *
+processEnabledString(boost::uint8_t status) {
+	switch (status) {
+	case StatsSegmentProcess::ENABLED:
+		return "ENABLED";
+	case StatsSegmentProcess::DISABLING:
+		return "DISABLING";
+	case StatsSegmentProcess::DISABLED:
+		return "DISABLED";
+	case StatsSegmentProcess::DETACHED:
+		return "DETACHED";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+static const char *
+groupLifeStatusString(boost::uint8_t status) {
+	switch (status) {
+	case StatsSegmentGroup::ALIVE:
+		return "ALIVE";
+	case StatsSegmentGroup::SHUTTING_DOWN:
+		return "SHUTTING_DOWN";
+	case StatsSegmentGroup::SHUT_DOWN:
+		return "SHUT_DOWN";
+	default:
+		return "UNKNOWN";
+	}
+}
+
+static double
+secondsAgo(boost::uint64_t usec) {
+	boost::uint64_t now = SystemTime::getUsec();
+	if (usec == 0 || now < usec) {
+		return 0;
+	} else {
+		return (now - usec) / 1000000.0;
+	}
+}
+
+static void
+printStats(const StatsSegmentReader &reader, const StatsSegmentData &data) {
+	printf("Updated:     %.1f s ago (update #%llu, core PID %d)\n",
+		secondsAgo(data.updatedAt), (unsigned long long) data.updateCount,
+		(int) reader.getWriterPid());
+	printf("Pool:        %u/%u processes, capacity used %u, top-level queue %u\n",
+		data.poolProcessCount, data.poolMax, data.poolCapacityUsed,
+		data.poolGetWaitlistSize);
+	printf("Controllers: %u threads, %llu requests begun, %u active clients\n",
+		data.controllerCount, (unsigned long long) data.totalRequestsBegun,
+		data.activeClients);
+	printf("Turbocache:  %u hits, %u fetches\n", data.turboCacheHits,
+		data.turboCacheFetches);
+	printf("Buffers:     %u active mbuf blocks, %u free\n", data.mbufActiveBlocks,
+		data.mbufFreeBlocks);
+	if (data.groupsOmitted > 0 || data.processesOmitted > 0) {
+		printf("Omitted:     %u groups and %u processes did not fit\n",
+			data.groupsOmitted, data.processesOmitted);
+	}
+
+	unsigned int processIndex = 0;
+	for (unsigned int i = 0; i < data.groupCount; i++) {
+		const StatsSegmentGroup &group = data.groups[i];
+
+		printf("\n%s (%s%s%s):\n", group.name, groupLifeStatusString(group.lifeStatus),
+			group.spawning ? ", spawning" : "",
+			group.restarting ? ", restarting" : "");
+		printf("  Processes: %u enabled, %u disabling, %u disabled, %u being spawned\n",
+			group.enabledCount, group.disablingCount, group.disabledCount,
+			group.processesBeingSpawned);
+		printf("  Queue:     %u requests, capacity used %u\n",
+			group.getWaitlistSize, group.capacityUsed);
+		if (group.requestsHandled > 0) {
+			printf("  Requests:  %llu handled, mean duration %.3f ms\n",
+				(unsigned long long) group.requestsHandled,
+				group.requestDurationSum / 1000.0 / group.requestsHandled);
+		}
+		if (group.processCount > 0) {
+			printf("  %-8s %-9s %-9s %-5s %-10s %s\n", "PID", "Sessions",
+				"Processed", "CPU", "RSS", "Status");
+		}
+		for (unsigned int j = 0; j < group.processCount; j++, processIndex++) {
+			const StatsSegmentProcess &process = data.processes[processIndex];
+			printf("  %-8d %-9d %-9u %-5s %-10s %s/%s, last used %.0f s ago\n",
+				(int) process.pid, (int) process.sessions, process.processed,
+				process.cpu == -1 ? "-" : (toString(process.cpu) + "%").c_str(),
+				process.rss == -1 ? "-" : (toString(process.rss / 1024) + " MB").c_str(),
+				processEnabledString(process.enabled),
+				processLifeStatusString(process.lifeStatus),
+				secondsAgo(process.lastUsed));
+		}
+	}
+}
+
+static Json::Value
+statsToJson(const StatsSegmentReader &reader, const StatsSegmentData &data) {
+	Json::Value doc, pool, controllers, groups(Json::arrayValue);
+
+	doc["core_pid"] = (Json::Int) reader.getWriterPid();
+	doc["updated_at"] = (Json::UInt64) data.updatedAt;
+	doc["update_count"] = (Json::UInt64) data.updateCount;
+
+	pool["max"] = data.poolMax;
+	pool["process_count"] = data.poolProcessCount;
+	pool["capacity_used"] = data.poolCapacityUsed;
+	pool["get_wait_list_size"] = data.poolGetWaitlistSize;
+	doc["pool"] = pool;
+
+	controllers["count"] = data.controllerCount;
+	controllers["total_requests_begun"] = (Json::UInt64) data.totalRequestsBegun;
+	controllers["active_clients"] = data.activeClients;
+	controllers["turbocache_fetches"] = data.turboCacheFetches;
+	controllers["turbocache_hits"] = data.turboCacheHits;
+	controllers["mbuf_active_blocks"] = data.mbufActiveBlocks;
+	controllers["mbuf_free_blocks"] = data.mbufFreeBlocks;
+	doc["controllers"] = controllers;
+
+	unsigned int processIndex = 0;
+	for (unsigned int i = 0; i < data.groupCount; i++) {
+		const StatsSegmentGroup &group = data.groups[i];
+		Json::Value groupDoc, processes(Json::arrayValue);
+
+		groupDoc["name"] = group.name;
+		groupDoc["life_status"] = groupLifeStatusString(group.lifeStatus);
+		groupDoc["enabled_process_count"] = group.enabledCount;
+		groupDoc["disabling_process_count"] = group.disablingCount;
+		groupDoc["disabled_process_count"] = group.disabledCount;
+		groupDoc["processes_being_spawned"] = group.processesBeingSpawned;
+		groupDoc["capacity_used"] = group.capacityUsed;
+		groupDoc["get_wait_list_size"] = group.getWaitlistSize;
+		groupDoc["disable_wait_list_size"] = group.disableWaitlistSize;
+		groupDoc["spawning"] = (bool) group.spawning;
+		groupDoc["restarting"] = (bool) group.restarting;
+		groupDoc["requests_handled"] = (Json::UInt64) group.requestsHandled;
+		groupDoc["request_duration_sum_usec"] = (Json::UInt64) group.requestDurationSum;
+
+		for (unsigned int j = 0; j < group.processCount; j++, processIndex++) {
+			const StatsSegmentProcess &process = data.processes[processIndex];
+			Json::Value processDoc;
+
+			processDoc["pid"] = (Json::Int) process.pid;
+			processDoc["concurrency"] = (Json::Int) process.concurrency;
+			processDoc["sessions"] = (Json::Int) process.sessions;
+			processDoc["busyness"] = (Json::Int) process.busyness;
+			processDoc["processed"] = process.processed;
+			processDoc["spawn_end_time"] = (Json::UInt64) process.spawnEndTime;
+			processDoc["last_used"] = (Json::UInt64) process.lastUsed;
+			processDoc["rss"] = (Json::Int64) process.rss;
+			processDoc["cpu"] = (Json::Int) process.cpu;
+			processDoc["life_status"] = processLifeStatusString(process.lifeStatus);
+			processDoc["enabled"] = processEnabledString(process.enabled);
+			processes.append(processDoc);
+		}
+		groupDoc["processes"] = processes;
+		groups.append(groupDoc);
+	}
+	doc["groups"] = groups;
+	doc["groups_omitted"] = data.groupsOmitted;
+	doc["processes_omitted"] = data.processesOmitted;
+	return doc;
+}
+
+int
+statsReaderMain(int argc, char *argv[]) {
+	MainOptions options = parseOptions(argc, argv);
+	if (options.help) {
+		usage();
+		return 0;
+	}
+
+	boost::scoped_ptr<StatsSegmentReader> reader;
+	try {
+		reader.reset(new StatsSegmentReader(options.path));
+	} catch (const tracable_exception &e) {
+		fprintf(stderr, "ERROR: %s\n", e.what());
+		return 1;
+	}
+
+	// Too large for the stack.
+	boost::scoped_ptr<StatsSegmentData> data(new StatsSegmentData());
+	while (true) {
+		if (!reader->read(*data)) {
+			fprintf(stderr, "ERROR: the core did not finish updating %s\n",
+				options.path.c_str());
+			return 1;
+		}
+
+		if (options.json) {
+			cout << statsToJson(*reader, *data).toStyledString();
+		} else {
+			printStats(*reader, *data);
+		}
+
+		if (options.watchInterval <= 0) {
+			return 0;
+		}
+		cout.flush();
+		fflush(stdout);
+		usleep((useconds_t) (options.watchInterval * 1000000));
+		if (!options.json) {
+			printf("\n--------\n\n");
+		}
+	}
+}
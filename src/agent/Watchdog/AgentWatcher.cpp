@@ -29,80 +29,120 @@
  */
 class AgentWatcher: public boost::enable_shared_from_this<AgentWatcher> {
 private:
-	/** The watcher thread. */
-	oxt::thread *thr;
+	/** Whether this watcher is registered with the Watchdog's child reaper. */
+	bool watching;
 
-	void threadMain(boost::shared_ptr<AgentWatcher> self) {
-		try {
-			pid_t pid, ret;
-			int status, e;
+	/**
+	 * A pre-forked agent process that has been exec()ed, but that is still
+	 * waiting for its startup arguments. Used for replacing a crashed agent
+	 * without paying for fork() and exec(). 0 if there is none.
+	 */
+	pid_t standbyPid;
+	FileDescriptor standbyFeedbackFd;
 
-			while (!this_thread::interruption_requested()) {
-				{
-					boost::lock_guard<boost::mutex> l(lock);
-					pid = this->pid;
-				}
+	/**
+	 * The thread that restarts the agent process after it has exited, or
+	 * NULL if no restart has happened yet. Restarting involves a startup
+	 * handshake with the new process that may take a while, so it doesn't
+	 * run on the child reaper thread: that thread watches all agents.
+	 */
+	oxt::thread *restartThread;
 
-				// Process can be started before the watcher thread is launched.
-				if (pid == 0) {
-					pid = start();
-				}
-				ret = syscalls::waitpid(pid, &status, 0);
-				if (ret == -1 && errno == ECHILD) {
-					/* If the agent is attached to gdb then waitpid()
-					 * here can return -1 with errno == ECHILD.
-					 * Fallback to kill() polling for checking
-					 * whether the agent is alive.
-					 */
-					ret = pid;
-					status = 0;
-					P_WARN("waitpid() on " << name() << " (pid=" << pid <<
-						") returned -1 with " <<
-						"errno = ECHILD, falling back to kill polling");
-					waitpidUsingKillPolling(pid);
-					e = 0;
-				} else {
-					e = errno;
-				}
+	void watchCurrentProcess(pid_t pid) {
+		wo->childReaper.watch(pid, boost::bind(&AgentWatcher::onExit,
+			shared_from_this(), _1, _2));
+	}
 
-				{
-					boost::lock_guard<boost::mutex> l(lock);
-					this->pid = 0;
-				}
+	/**
+	 * Called from the child reaper thread when the agent process has exited.
+	 * Hands the restart off to a restart thread so that the reaper can keep
+	 * watching the other agents in the mean time.
+	 */
+	void onExit(pid_t pid, int status) {
+		oxt::thread *oldRestartThread;
+
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			if (this->pid != pid) {
+				// Stopped by forceShutdown().
+				return;
+			}
+			this->pid = 0;
+		}
+
+		if (status == -1) {
+			P_WARN(name() << " (pid=" << pid << ") crashed or killed for "
+				"an unknown reason, restarting it...");
+		} else if (WIFEXITED(status)) {
+			if (WEXITSTATUS(status) == 0) {
+				/* When the web server is gracefully exiting, it will
+				 * tell one or more agents to gracefully exit with exit
+				 * status 0. If we see this then it means the watchdog
+				 * is gracefully shutting down too and we should stop
+				 * watching.
+				 */
+				return;
+			} else {
+				P_WARN(name() << " (pid=" << pid <<
+					") crashed with exit status " <<
+					WEXITSTATUS(status) << ", restarting it...");
+			}
+		} else {
+			P_WARN(name() << " (pid=" << pid <<
+				") crashed with signal " <<
+				getSignalName(WTERMSIG(status)) <<
+				", restarting it...");
+		}
 
+		try {
+			boost::lock_guard<boost::mutex> l(lock);
+			if (!watching) {
+				// stopWatching() was called.
+				return;
+			}
+			// The previous restart thread, if any, is done: it started
+			// watching the process that just exited as its last step.
+			oldRestartThread = restartThread;
+			restartThread = new oxt::thread(
+				boost::bind(&AgentWatcher::restartAndWatch, shared_from_this()),
+				string(name()) + " restarter", 256 * 1024);
+		} catch (const std::exception &e) {
+			boost::lock_guard<boost::mutex> l(lock);
+			threadExceptionMessage = e.what();
+			wo->errorEvent.notify();
+			return;
+		}
+
+		if (oldRestartThread != NULL) {
+			oldRestartThread->join();
+			delete oldRestartThread;
+		}
+	}
+
+	/** Runs in the restart thread. */
+	void restartAndWatch() {
+		try {
+			{
 				this_thread::disable_interruption di;
 				this_thread::disable_syscall_interruption dsi;
-				if (ret == -1) {
-					P_WARN(name() << " (pid=" << pid << ") crashed or killed for "
-						"an unknown reason (errno = " <<
-						strerror(e) << "), restarting it...");
-				} else if (WIFEXITED(status)) {
-					if (WEXITSTATUS(status) == 0) {
-						/* When the web server is gracefully exiting, it will
-						 * tell one or more agents to gracefully exit with exit
-						 * status 0. If we see this then it means the watchdog
-						 * is gracefully shutting down too and we should stop
-						 * watching.
-						 */
-						return;
-					} else {
-						P_WARN(name() << " (pid=" << pid <<
-							") crashed with exit status " <<
-							WEXITSTATUS(status) << ", restarting it...");
-					}
-				} else {
-					P_WARN(name() << " (pid=" << pid <<
-						") crashed with signal " <<
-						getSignalName(WTERMSIG(status)) <<
-						", restarting it...");
-				}
-
 				const char *sleepTime;
 				if ((sleepTime = getenv("PASSENGER_AGENT_RESTART_SLEEP")) != NULL) {
 					sleep(atoi(sleepTime));
 				}
 			}
+
+			Timer timer;
+			pid_t pid = restart();
+			P_INFO(name() << " restarted (pid=" << pid << ") in " <<
+				timer.elapsed() << " msec");
+			prepareStandby();
+
+			boost::lock_guard<boost::mutex> l(lock);
+			if (watching) {
+				watchCurrentProcess(pid);
+			}
 		} catch (const boost::thread_interrupted &) {
+			// Interrupted by stopWatching().
 		} catch (const tracable_exception &e) {
 			boost::lock_guard<boost::mutex> l(lock);
 			threadExceptionMessage = e.what();
@@ -119,6 +159,77 @@ private:
 		}
 	}
 
+	/**
+	 * Starts a new agent process, by handing the startup arguments to the
+	 * standby process if there is one. Falls back to start() if the standby
+	 * process turns out to be unusable.
+	 */
+	pid_t restart() {
+		pid_t pid;
+		FileDescriptor feedbackFd;
+
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			pid = standbyPid;
+			feedbackFd = standbyFeedbackFd;
+			standbyPid = 0;
+			standbyFeedbackFd = FileDescriptor();
+		}
+
+		if (pid != 0) {
+			try {
+				initialize(pid, feedbackFd);
+				return pid;
+			} catch (const boost::thread_interrupted &) {
+				throw;
+			} catch (const std::exception &e) {
+				P_WARN("Could not start the " << name() << " from its standby "
+					"process (pid=" << pid << "): " << e.what() <<
+					"; starting a new one instead");
+			}
+		}
+		return start();
+	}
+
+	/**
+	 * Pre-forks a standby agent process if shouldPrefork() says so and if
+	 * there isn't one already. Failures are logged but otherwise ignored:
+	 * restart() simply starts a new process from scratch then.
+	 */
+	void prepareStandby() {
+		if (!shouldPrefork()) {
+			return;
+		}
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			if (standbyPid != 0) {
+				return;
+			}
+		}
+
+		try {
+			FileDescriptor feedbackFd;
+			pid_t pid = forkAgent(feedbackFd);
+			boost::lock_guard<boost::mutex> l(lock);
+			standbyPid = pid;
+			standbyFeedbackFd = feedbackFd;
+			P_DEBUG("Standby " << name() << " process forked (pid=" << pid << ")");
+		} catch (const boost::thread_interrupted &) {
+			throw;
+		} catch (const std::exception &e) {
+			P_WARN("Could not fork a standby " << name() << " process: " << e.what());
+		}
+	}
+
+	void discardStandby() {
+		boost::lock_guard<boost::mutex> l(lock);
+		if (standbyPid != 0) {
+			killProcessGroupAndWait(standbyPid);
+			standbyPid = 0;
+			standbyFeedbackFd = FileDescriptor();
+		}
+	}
+
 protected:
 	/** PID of the process we're watching. 0 if no process is started at this time. */
 	pid_t pid;
@@ -135,7 +246,7 @@ protected:
 
 	/**
 	 * Lock for protecting the exchange of data between the main thread and
-	 * the watcher thread.
+	 * the child reaper thread.
 	 */
 	mutable boost::mutex lock;
 
@@ -217,49 +328,17 @@ protected:
 		return 0; // timed out
 	}
 
-	static void waitpidUsingKillPolling(pid_t pid) {
-		bool done = false;
-
-		while (!done) {
-			int ret = syscalls::kill(pid, 0);
-			done = ret == -1;
-			if (!done) {
-				syscalls::usleep(20000);
-			}
-		}
-	}
-
-public:
-	AgentWatcher(const WorkingObjectsPtr &wo) {
-		thr = NULL;
-		pid = 0;
-		this->wo = wo;
-	}
-
-	virtual ~AgentWatcher() {
-		delete thr;
-	}
-
 	/**
-	 * Store information about the started agent process in the given report object.
-	 * May throw arbitrary exceptions.
-	 *
-	 * @pre start() has been called and succeeded.
+	 * Forks and exec()s a new agent process, which will then wait for its
+	 * startup arguments on `feedbackFd`. It is the caller's responsibility
+	 * to call initialize() or to kill the process.
 	 */
-	virtual void reportAgentsInformation(VariantMap &report) = 0;
-
-	/** Returns the name of the agent that this class is watching. */
-	virtual const char *name() const = 0;
-
-	/**
-	 * Starts the agent process. May throw arbitrary exceptions.
-	 */
-	virtual pid_t start() {
+	pid_t forkAgent(FileDescriptor &feedbackFd) {
 		this_thread::disable_interruption di;
 		this_thread::disable_syscall_interruption dsi;
 		string exeFilename = getExeFilename();
 		SocketPair fds;
-		int e, ret;
+		int e;
 		pid_t pid;
 
 		/* Create feedback fd for this agent process. We'll send some startup
@@ -335,108 +414,157 @@ public:
 			throw SystemException("Cannot fork a new process", e);
 		} else {
 			// Parent
-			FileDescriptor feedbackFd(fds[0]);
-			vector<string> args;
-
+			feedbackFd = FileDescriptor(fds[0]);
 			fds[1].close();
-			this_thread::restore_interruption ri(di);
-			this_thread::restore_syscall_interruption rsi(dsi);
-			ScopeGuard failGuard(boost::bind(killProcessGroupAndWait, pid));
+			return pid;
+		}
+	}
 
-			/* Send startup arguments. Ignore EPIPE and ECONNRESET here
-			 * because the child process might have sent an feedback message
-			 * without reading startup arguments.
-			 */
-			try {
-				sendStartupArguments(pid, feedbackFd);
-			} catch (const SystemException &ex) {
-				if (ex.code() != EPIPE && ex.code() != ECONNRESET) {
-					throw SystemException(string("Unable to start the ") + name() +
-						": an error occurred while sending startup arguments",
-						ex.code());
-				}
+	/**
+	 * Sends the startup arguments to an agent process that was created by
+	 * forkAgent(), and processes its startup information. Kills the process
+	 * if anything goes wrong.
+	 */
+	void initialize(pid_t pid, FileDescriptor &feedbackFd) {
+		vector<string> args;
+		int e, ret;
+
+		ScopeGuard failGuard(boost::bind(killProcessGroupAndWait, pid));
+
+		/* Send startup arguments. Ignore EPIPE and ECONNRESET here
+		 * because the child process might have sent an feedback message
+		 * without reading startup arguments.
+		 */
+		try {
+			sendStartupArguments(pid, feedbackFd);
+		} catch (const SystemException &ex) {
+			if (ex.code() != EPIPE && ex.code() != ECONNRESET) {
+				throw SystemException(string("Unable to start the ") + name() +
+					": an error occurred while sending startup arguments",
+					ex.code());
 			}
+		}
 
-			// Now read its feedback.
-			try {
-				ret = readArrayMessage(feedbackFd, args);
-			} catch (const SystemException &e) {
-				if (e.code() == ECONNRESET) {
-					ret = false;
-				} else {
-					throw SystemException(string("Unable to start the ") + name() +
-						": unable to read its startup information",
-						e.code());
-				}
+		// Now read its feedback.
+		try {
+			ret = readArrayMessage(feedbackFd, args);
+		} catch (const SystemException &e) {
+			if (e.code() == ECONNRESET) {
+				ret = false;
+			} else {
+				throw SystemException(string("Unable to start the ") + name() +
+					": unable to read its startup information",
+					e.code());
 			}
-			if (!ret) {
-				this_thread::disable_interruption di2;
-				this_thread::disable_syscall_interruption dsi2;
-				int status;
-
-				/* The feedback fd was prematurely closed for an unknown reason.
-				 * Did the agent process crash?
-				 *
-				 * We use timedWaitPid() here because if the process crashed
-				 * because of an uncaught exception, the file descriptor
-				 * might be closed before the process has printed an error
-				 * message, so we give it some time to print the error
-				 * before we kill it.
+		}
+		if (!ret) {
+			this_thread::disable_interruption di2;
+			this_thread::disable_syscall_interruption dsi2;
+			int status;
+
+			/* The feedback fd was prematurely closed for an unknown reason.
+			 * Did the agent process crash?
+			 *
+			 * We use timedWaitPid() here because if the process crashed
+			 * because of an uncaught exception, the file descriptor
+			 * might be closed before the process has printed an error
+			 * message, so we give it some time to print the error
+			 * before we kill it.
+			 */
+			ret = timedWaitPid(pid, &status, 5000);
+			if (ret == 0) {
+				/* Doesn't look like it; it seems it's still running.
+				 * We can't do anything without proper feedback so kill
+				 * the agent process and throw an exception.
 				 */
-				ret = timedWaitPid(pid, &status, 5000);
-				if (ret == 0) {
-					/* Doesn't look like it; it seems it's still running.
-					 * We can't do anything without proper feedback so kill
-					 * the agent process and throw an exception.
-					 */
-					failGuard.runNow();
-					throw RuntimeException(string("Unable to start the ") + name() +
-						": it froze and reported an unknown error during its startup");
-				} else if (ret != -1 && WIFSIGNALED(status)) {
-					/* Looks like a crash which caused a signal. */
-					throw RuntimeException(string("Unable to start the ") + name() +
-						": it seems to have been killed with signal " +
-						getSignalName(WTERMSIG(status)) + " during startup");
-				} else if (ret == -1) {
-					/* Looks like it exited after detecting an error. */
-					throw RuntimeException(string("Unable to start the ") + name() +
-						": it seems to have crashed during startup for an unknown reason");
-				} else {
-					/* Looks like it exited after detecting an error, but has an exit code. */
-					throw RuntimeException(string("Unable to start the ") + name() +
-						": it seems to have crashed during startup for an unknown reason, "
-						"with exit code " + toString(WEXITSTATUS(status)));
-				}
+				failGuard.runNow();
+				throw RuntimeException(string("Unable to start the ") + name() +
+					": it froze and reported an unknown error during its startup");
+			}
+			failGuard.clear();
+			if (ret != -1 && WIFSIGNALED(status)) {
+				/* Looks like a crash which caused a signal. */
+				throw RuntimeException(string("Unable to start the ") + name() +
+					": it seems to have been killed with signal " +
+					getSignalName(WTERMSIG(status)) + " during startup");
+			} else if (ret == -1) {
+				/* Looks like it exited after detecting an error. */
+				throw RuntimeException(string("Unable to start the ") + name() +
+					": it seems to have crashed during startup for an unknown reason");
+			} else {
+				/* Looks like it exited after detecting an error, but has an exit code. */
+				throw RuntimeException(string("Unable to start the ") + name() +
+					": it seems to have crashed during startup for an unknown reason, "
+					"with exit code " + toString(WEXITSTATUS(status)));
 			}
+		}
 
-			if (args[0] == "system error before exec") {
+		if (args[0] == "system error before exec") {
+			throw SystemException(string("Unable to start the ") + name() +
+				": " + args[1], atoi(args[2]));
+		} else if (args[0] == "exec error") {
+			e = atoi(args[1]);
+			if (e == ENOENT) {
+				throw RuntimeException(string("Unable to start the ") + name() +
+					" because its executable (" + getExeFilename() + ") "
+					"doesn't exist. This probably means that your "
+					PROGRAM_NAME " installation is broken or "
+					"incomplete. Please reinstall " PROGRAM_NAME);
+			} else {
 				throw SystemException(string("Unable to start the ") + name() +
-					": " + args[1], atoi(args[2]));
-			} else if (args[0] == "exec error") {
-				e = atoi(args[1]);
-				if (e == ENOENT) {
-					throw RuntimeException(string("Unable to start the ") + name() +
-						" because its executable (" + getExeFilename() + ") "
-						"doesn't exist. This probably means that your "
-						PROGRAM_NAME " installation is broken or "
-						"incomplete. Please reinstall " PROGRAM_NAME);
-				} else {
-					throw SystemException(string("Unable to start the ") + name() +
-						" because exec(\"" + getExeFilename() + "\") failed",
-						atoi(args[1]));
-				}
-			} else if (!processStartupInfo(pid, feedbackFd, args)) {
-				throw RuntimeException(string("The ") + name() +
-					" sent an unknown startup info message '" +
-					args[0] + "'");
+					" because exec(\"" + getExeFilename() + "\") failed",
+					atoi(args[1]));
 			}
-
-			boost::lock_guard<boost::mutex> l(lock);
-			this->feedbackFd = feedbackFd;
-			this->pid = pid;
-			failGuard.clear();
-			return pid;
+		} else if (!processStartupInfo(pid, feedbackFd, args)) {
+			throw RuntimeException(string("The ") + name() +
+				" sent an unknown startup info message '" +
+				args[0] + "'");
 		}
+
+		boost::lock_guard<boost::mutex> l(lock);
+		this->feedbackFd = feedbackFd;
+		this->pid = pid;
+		failGuard.clear();
+	}
+
+	/**
+	 * Whether a standby agent process should be kept around for replacing
+	 * the agent process quickly when it crashes.
+	 */
+	virtual bool shouldPrefork() const {
+		return false;
+	}
+
+public:
+	AgentWatcher(const WorkingObjectsPtr &wo) {
+		watching = false;
+		standbyPid = 0;
+		restartThread = NULL;
+		pid = 0;
+		this->wo = wo;
+	}
+
+	virtual ~AgentWatcher() { }
+
+	/**
+	 * Store information about the started agent process in the given report object.
+	 * May throw arbitrary exceptions.
+	 *
+	 * @pre start() has been called and succeeded.
+	 */
+	virtual void reportAgentsInformation(VariantMap &report) = 0;
+
+	/** Returns the name of the agent that this class is watching. */
+	virtual const char *name() const = 0;
+
+	/**
+	 * Starts the agent process. May throw arbitrary exceptions.
+	 */
+	virtual pid_t start() {
+		FileDescriptor feedbackFd;
+		pid_t pid = forkAgent(feedbackFd);
+		initialize(pid, feedbackFd);
+		return pid;
 	}
 
 	/**
@@ -449,32 +577,49 @@ public:
 	 * @throws thread_resource_error
 	 */
 	virtual void beginWatching() {
-		boost::lock_guard<boost::mutex> l(lock);
-		if (pid == 0) {
-			throw RuntimeException("start() hasn't been called yet");
-		}
-		if (thr != NULL) {
-			throw RuntimeException("Already started watching.");
+		pid_t pid;
+		{
+			boost::lock_guard<boost::mutex> l(lock);
+			if (this->pid == 0) {
+				throw RuntimeException("start() hasn't been called yet");
+			}
+			if (watching) {
+				throw RuntimeException("Already started watching.");
+			}
+			watching = true;
+			pid = this->pid;
 		}
 
-		thr = new oxt::thread(boost::bind(&AgentWatcher::threadMain, this, shared_from_this()),
-			name(), 256 * 1024);
+		watchCurrentProcess(pid);
+		prepareStandby();
 	}
 
+	/**
+	 * Stops watching the given agent processes, aborts restarts that are in
+	 * progress, and kills their standby processes, if any.
+	 */
 	static void stopWatching(vector< boost::shared_ptr<AgentWatcher> > &watchers) {
 		vector< boost::shared_ptr<AgentWatcher> >::const_iterator it;
-		vector<oxt::thread *> threads;
-		unsigned int i = 0;
-
-		for (it = watchers.begin(); it != watchers.end(); it++, i++) {
-			threads.push_back((*it)->thr);
-			threads[i] = (*it)->thr;
+		vector<oxt::thread *> restartThreads;
+
+		for (it = watchers.begin(); it != watchers.end(); it++) {
+			boost::lock_guard<boost::mutex> l((*it)->lock);
+			(*it)->watching = false;
+			if ((*it)->restartThread != NULL) {
+				restartThreads.push_back((*it)->restartThread);
+				(*it)->restartThread = NULL;
+			}
 		}
-
-		oxt::thread::interrupt_and_join_multiple(&threads[0], threads.size());
-		for (it = watchers.begin(); it != watchers.end(); it++, i++) {
-			delete (*it)->thr;
-			(*it)->thr = NULL;
+		// onExit() doesn't start new restart threads from now on.
+		if (!watchers.empty()) {
+			watchers.front()->wo->childReaper.stop();
+		}
+		for (unsigned int i = 0; i < restartThreads.size(); i++) {
+			restartThreads[i]->interrupt_and_join();
+			delete restartThreads[i];
+		}
+		for (it = watchers.begin(); it != watchers.end(); it++) {
+			(*it)->discardStandby();
 		}
 	}
 
@@ -497,6 +642,7 @@ public:
 	 * or false if it wasn't started.
 	 */
 	virtual bool forceShutdown() {
+		discardStandby();
 		boost::lock_guard<boost::mutex> l(lock);
 		if (pid == 0) {
 			return false;
@@ -0,0 +1,341 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_WATCHDOG_CHILD_REAPER_H_
+#define _PASSENGER_WATCHDOG_CHILD_REAPER_H_
+
+#include <boost/function.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <vector>
+#include <map>
+#include <cerrno>
+#include <cstring>
+#include <poll.h>
+#include <signal.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#ifdef __linux__
+	#include <sys/syscall.h>
+#endif
+#include <FileDescriptor.h>
+#include <Exceptions.h>
+#include <Logging.h>
+#include <Utils/IOUtils.h>
+
+namespace Passenger {
+namespace WatchdogAgent {
+
+using namespace std;
+using namespace oxt;
+
+
+/**
+ * Waits for the exit of a set of child processes from a single thread, and
+ * calls a callback as soon as one of them has exited and has been reaped.
+ *
+ * On Linux >= 5.3 every child is watched through a pidfd (see pidfd_open(2)),
+ * so that the thread sleeps in a single poll() until one of them exits. On
+ * other systems, or if pidfds are unavailable, children are polled for with
+ * `waitpid(WNOHANG)` every POLL_INTERVAL miliseconds instead.
+ *
+ * Only the watched PIDs are ever waited on, so this does not interfere with
+ * code that forks and waits on other child processes.
+ */
+class ChildReaper: public boost::noncopyable {
+public:
+	/**
+	 * Called from the reaper thread after the child has exited. `status` is as
+	 * reported by waitpid(), or -1 if the child could not be waited on (e.g.
+	 * because it is ptraced by gdb) and was only noticed to have disappeared.
+	 * May throw boost::thread_interrupted, but no other exceptions.
+	 */
+	typedef boost::function<void (pid_t pid, int status)> ExitCallback;
+
+private:
+	/** How often children without a pidfd are polled, in miliseconds. */
+	static const int POLL_INTERVAL = 20;
+
+	struct Child {
+		FileDescriptor pidfd;
+		ExitCallback callback;
+		bool killPolling;
+
+		Child()
+			: killPolling(false)
+			{ }
+	};
+
+	typedef std::map<pid_t, Child> ChildMap;
+
+	mutable boost::mutex syncher;
+	ChildMap children;
+	Pipe wakeupPipe;
+	oxt::thread *thr;
+	bool pidfdsEnabled;
+
+	static int openPidfd(pid_t pid) {
+		#if defined(__linux__) && defined(SYS_pidfd_open)
+			return syscall(SYS_pidfd_open, pid, 0);
+		#else
+			errno = ENOSYS;
+			return -1;
+		#endif
+	}
+
+	void wakeup() {
+		ssize_t ret;
+		do {
+			ret = ::write(wakeupPipe.second, "x", 1);
+		} while (ret == -1 && errno == EINTR);
+		// EAGAIN means that a wakeup is already pending.
+	}
+
+	void drainWakeupPipe() {
+		char buf[64];
+		ssize_t ret;
+		do {
+			ret = ::read(wakeupPipe.first, buf, sizeof(buf));
+		} while (ret == sizeof(buf) || (ret == -1 && errno == EINTR));
+	}
+
+	/**
+	 * Checks whether the given child has exited. `notified` indicates that
+	 * its pidfd became readable.
+	 */
+	bool checkChild(pid_t pid, Child &child, bool notified, int &status) {
+		if (child.killPolling) {
+			if (::kill(pid, 0) == -1 && errno == ESRCH) {
+				status = -1;
+				return true;
+			}
+			return false;
+		}
+
+		pid_t ret = ::waitpid(pid, &status, WNOHANG);
+		if (ret == pid) {
+			return true;
+		} else if (ret == 0) {
+			if (notified) {
+				// Should not happen, but don't spin on a readable pidfd.
+				child.pidfd.close(false);
+			}
+			return false;
+		} else if (errno == ECHILD) {
+			/* If the child is attached to gdb then waitpid() can return
+			 * -1 with errno == ECHILD. Fall back to kill() polling for
+			 * checking whether it's alive.
+			 */
+			P_WARN("waitpid() on PID " << pid << " returned -1 with "
+				"errno = ECHILD, falling back to kill polling");
+			child.killPolling = true;
+			child.pidfd.close(false);
+			return false;
+		} else {
+			int e = errno;
+			P_WARN("waitpid() on PID " << pid << " failed: " <<
+				strerror(e) << " (errno=" << e << ")");
+			status = -1;
+			return true;
+		}
+	}
+
+	void threadMain() {
+		vector<struct pollfd> fds;
+		vector<pid_t> fdPids;
+		vector< pair<pid_t, int> > exited;
+		vector<ExitCallback> callbacks;
+
+		try {
+			while (true) {
+				int timeout = -1;
+
+				fds.resize(1);
+				fds[0].fd = wakeupPipe.first;
+				fds[0].events = POLLIN;
+				fds[0].revents = 0;
+				fdPids.clear();
+				{
+					boost::lock_guard<boost::mutex> l(syncher);
+					ChildMap::const_iterator it, end = children.end();
+					for (it = children.begin(); it != end; it++) {
+						if (it->second.pidfd != -1) {
+							struct pollfd pfd;
+							pfd.fd = it->second.pidfd;
+							pfd.events = POLLIN;
+							pfd.revents = 0;
+							fds.push_back(pfd);
+							fdPids.push_back(it->first);
+						} else {
+							timeout = POLL_INTERVAL;
+						}
+					}
+				}
+
+				if (syscalls::poll(&fds[0], fds.size(), timeout) == -1) {
+					int e = errno;
+					throw SystemException("poll() failed", e);
+				}
+				if (fds[0].revents != 0) {
+					drainWakeupPipe();
+				}
+
+				exited.clear();
+				callbacks.clear();
+				{
+					boost::lock_guard<boost::mutex> l(syncher);
+					ChildMap::iterator it = children.begin();
+					while (it != children.end()) {
+						bool notified = false;
+						int status = 0;
+
+						for (unsigned int i = 0; i < fdPids.size(); i++) {
+							if (fdPids[i] == it->first) {
+								notified = fds[i + 1].revents != 0;
+								break;
+							}
+						}
+
+						if (checkChild(it->first, it->second, notified, status)) {
+							exited.push_back(make_pair(it->first, status));
+							callbacks.push_back(it->second.callback);
+							children.erase(it++);
+						} else {
+							it++;
+						}
+					}
+				}
+
+				// Callbacks may call watch() again, so don't hold the lock.
+				for (unsigned int i = 0; i < exited.size(); i++) {
+					callbacks[i](exited[i].first, exited[i].second);
+				}
+			}
+		} catch (const boost::thread_interrupted &) {
+			// Return.
+		} catch (const tracable_exception &e) {
+			P_CRITICAL("ERROR: " << e.what() << "\n" << e.backtrace());
+			abort();
+		}
+	}
+
+public:
+	ChildReaper(bool usePidfds = true)
+		: wakeupPipe(createPipe(__FILE__, __LINE__)),
+		  thr(NULL),
+		  pidfdsEnabled(usePidfds)
+	{
+		setNonBlocking(wakeupPipe.first);
+		setNonBlocking(wakeupPipe.second);
+	}
+
+	~ChildReaper() {
+		stop();
+	}
+
+	/**
+	 * Begins waiting for the given child process to exit. The callback is
+	 * called once, after which the PID is no longer watched. The reaper
+	 * thread is started on the first call. Thread-safe, and may be called
+	 * from within a callback.
+	 *
+	 * @pre `pid` is a child of this process, and is not yet being watched.
+	 */
+	void watch(pid_t pid, const ExitCallback &callback) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		Child &child = children[pid];
+
+		child.callback = callback;
+		if (pidfdsEnabled) {
+			int fd = openPidfd(pid);
+			if (fd != -1) {
+				child.pidfd = FileDescriptor(fd, __FILE__, __LINE__);
+			} else if (errno == ENOSYS || errno == EPERM) {
+				P_DEBUG("pidfd_open() is unavailable, falling back to "
+					"polling for child process exits");
+				pidfdsEnabled = false;
+			}
+		}
+
+		if (thr == NULL) {
+			thr = new oxt::thread(boost::bind(&ChildReaper::threadMain, this),
+				"Child reaper", 256 * 1024);
+		} else {
+			wakeup();
+		}
+	}
+
+	/**
+	 * Stops watching the given PID, without waiting on it. Thread-safe.
+	 */
+	void unwatch(pid_t pid) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		if (children.erase(pid) > 0) {
+			wakeup();
+		}
+	}
+
+	/**
+	 * Stops the reaper thread, interrupting any callback that is in progress,
+	 * and forgets about all watched children without waiting on them.
+	 */
+	void stop() {
+		oxt::thread *t;
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			t = thr;
+			thr = NULL;
+		}
+		if (t != NULL) {
+			t->interrupt_and_join();
+			delete t;
+		}
+
+		ChildMap tmp;
+		boost::lock_guard<boost::mutex> l(syncher);
+		children.swap(tmp);
+	}
+
+	/** Whether children are watched through pidfds instead of by polling. */
+	bool usingPidfds() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return pidfdsEnabled;
+	}
+
+	unsigned int getWatchCount() const {
+		boost::lock_guard<boost::mutex> l(syncher);
+		return children.size();
+	}
+};
+
+
+} // namespace WatchdogAgent
+} // namespace Passenger
+
+#endif /* _PASSENGER_WATCHDOG_CHILD_REAPER_H_ */
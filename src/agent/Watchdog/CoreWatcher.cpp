@@ -59,6 +59,15 @@ protected:
 		return args[0] == "initialized";
 	}
 
+	/**
+	 * The core is what serves requests, so optionally keep a standby process
+	 * that only has to read its startup arguments and initialize itself when
+	 * the core crashes. Off by default because the standby costs memory.
+	 */
+	virtual bool shouldPrefork() const {
+		return agentsOptions->getBool("prefork_core", false, false);
+	}
+
 public:
 	CoreWatcher(const WorkingObjectsPtr &wo)
 		: AgentWatcher(wo)
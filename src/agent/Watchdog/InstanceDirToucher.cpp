@@ -39,64 +39,13 @@ private:
 		while (!this_thread::interruption_requested()) {
 			syscalls::sleep(60 * 60);
 
-			begin_touch:
-
-			this_thread::disable_interruption di;
-			this_thread::disable_syscall_interruption dsi;
-			// Fork a process which touches everything in the server instance dir.
-			pid_t pid = syscalls::fork();
-			if (pid == 0) {
-				// Child
-				int prio, ret, e;
-
-				closeAllFileDescriptors(2);
-
-				// Make process nicer.
-				do {
-					prio = getpriority(PRIO_PROCESS, getpid());
-				} while (prio == -1 && errno == EINTR);
-				if (prio != -1) {
-					prio++;
-					if (prio > 20) {
-						prio = 20;
-					}
-					do {
-						ret = setpriority(PRIO_PROCESS, getpid(), prio);
-					} while (ret == -1 && errno == EINTR);
-				} else {
-					perror("getpriority");
-				}
-
-				do {
-					ret = chdir(wo->instanceDir->getPath().c_str());
-				} while (ret == -1 && errno == EINTR);
-				if (ret == -1) {
-					e = errno;
-					fprintf(stderr, "chdir(\"%s\") failed: %s (%d)\n",
-						wo->instanceDir->getPath().c_str(),
-						strerror(e), e);
-					fflush(stderr);
-					_exit(1);
-				}
-
-				setOomScore(oldOomScore);
-
-				execlp("/bin/sh", "/bin/sh", "-c", "find . | xargs touch", (char *) 0);
-				e = errno;
-				fprintf(stderr, "Cannot execute 'find . | xargs touch': %s (%d)\n",
-					strerror(e), e);
-				fflush(stderr);
-				_exit(1);
-			} else if (pid == -1) {
-				// Error
-				P_WARN("Could not touch the server instance directory because "
-					"fork() failed. Retrying in 2 minutes...");
-				this_thread::restore_interruption si(di);
-				this_thread::restore_syscall_interruption rsi(dsi);
-				syscalls::sleep(60 * 2);
-				goto begin_touch;
-			} else {
-				syscalls::waitpid(pid, NULL, 0);
+			const string &path = wo->instanceDir->getPath();
+			DirectoryTouchResult result = touchDirectoryTree(path);
+			P_DEBUG("Touched " << result.touched << " files in the server instance dir in "
+				<< result.duration / 1000 << " msec");
+			if (result.errors > 0) {
+				P_WARN("Could not touch " << result.errors << " files in the server"
+					" instance dir " << path << ". " << result.firstError);
 			}
 		}
 	}
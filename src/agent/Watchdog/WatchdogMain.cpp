@@ -64,6 +64,7 @@
 #include <Core/OptionParser.h>
 #include <UstRouter/OptionParser.h>
 #include <Watchdog/ApiServer.h>
+#include <Watchdog/ChildReaper.h>
 #include <Constants.h>
 #include <InstanceDirectory.h>
 #include <FileDescriptor.h>
@@ -82,6 +83,7 @@
 #include <Utils/MessageIO.h>
 #include <Utils/OptionParsing.h>
 #include <Utils/VariantMap.h>
+#include <Utils/DirectoryToucher.h>
 
 using namespace std;
 using namespace boost;
@@ -108,6 +110,7 @@ namespace WatchdogAgent {
 		RandomGenerator randomGenerator;
 		EventFd errorEvent;
 		EventFd exitEvent;
+		ChildReaper childReaper;
 		ResourceLocatorPtr resourceLocator;
 		uid_t defaultUid;
 		gid_t defaultGid;
@@ -592,6 +595,9 @@ usage() {
 	printf("      --pid-file PATH         Store the watchdog's PID in the given file. The\n");
 	printf("                              file is deleted on exit\n");
 	printf("      --no-delete-pid-file    Do not delete PID file on exit\n");
+	printf("      --prefork-core          Keep a standby core process around for quickly\n");
+	printf("                              replacing the core if it crashes. The standby\n");
+	printf("                              costs the memory of an extra, idle core process\n");
 	printf("      --log-file PATH         Log to the given file.\n");
 	printf("      --log-level LEVEL       Logging level. [A] Default: %d\n", DEFAULT_LOG_LEVEL);
 	printf("      --report-file PATH      Upon successful initialization, report instance\n");
@@ -716,6 +722,9 @@ parseOptions(int argc, const char *argv[], VariantMap &options) {
 		} else if (p.isFlag(argv[i], '\0', "--no-delete-pid-file")) {
 			options.setBool("delete_pid_file", false);
 			i++;
+		} else if (p.isFlag(argv[i], '\0', "--prefork-core")) {
+			options.setBool("prefork_core", true);
+			i++;
 		} else if (p.isValueFlag(argc, i, argv[i], '\0', "--log-level")) {
 			options.setInt("log_level", atoi(argv[i + 1]));
 			i += 2;
@@ -808,6 +817,7 @@ setAgentsOptionsDefaults() {
 	options.setDefaultStrSet("cleanup_pidfiles", vector<string>());
 	options.setDefault("data_buffer_dir", getSystemTempDir());
 	options.setDefaultBool("delete_pid_file", true);
+	options.setDefaultBool("prefork_core", false);
 }
 
 static void
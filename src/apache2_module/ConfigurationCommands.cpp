@@ -146,6 +146,48 @@
 		"The maximum number of queued requests."),
 
 	
+	AP_INIT_TAKE1("PassengerRequestQueueTimeout",
+		(Take1Func) cmd_passenger_request_queue_timeout,
+		NULL,
+		OR_ALL,
+		"The maximum time, in milliseconds, that a request may be queued."),
+
+	
+	AP_INIT_TAKE1("PassengerRequestQueueTargetDelay",
+		(Take1Func) cmd_passenger_request_queue_target_delay,
+		NULL,
+		OR_ALL,
+		"The queueing delay, in milliseconds, above which queued requests are shed."),
+
+	
+	AP_INIT_TAKE1("PassengerUploadStreamingThreshold",
+		(Take1Func) cmd_passenger_upload_streaming_threshold,
+		NULL,
+		OR_ALL,
+		"The upload rate, in KB per second, above which request bodies are streamed to the application."),
+
+	
+	AP_INIT_TAKE1("PassengerOobwMinSpareConcurrency",
+		(Take1Func) cmd_passenger_oobw_min_spare_concurrency,
+		NULL,
+		OR_ALL,
+		"The number of free session slots that must remain when starting out-of-band work."),
+
+	
+	AP_INIT_TAKE1("PassengerMemoryRecycleLimit",
+		(Take1Func) cmd_passenger_memory_recycle_limit,
+		NULL,
+		OR_ALL,
+		"The amount of memory, in MB, above which application processes are replaced."),
+
+	
+	AP_INIT_TAKE1("PassengerMemoryRecyclePressureThreshold",
+		(Take1Func) cmd_passenger_memory_recycle_pressure_threshold,
+		NULL,
+		OR_ALL,
+		"The system memory pressure percentage at which the most grown application process is replaced."),
+
+	
 	AP_INIT_TAKE1("PassengerMaxPreloaderIdleTime",
 		(Take1Func) cmd_passenger_max_preloader_idle_time,
 		NULL,
@@ -69,10 +69,22 @@ struct GeneratedDirConfigPart {
 	int maxRequestQueueSize;
 	/** The maximum number of requests that an application instance may process. */
 	int maxRequests;
+	/** The amount of memory, in MB, above which application processes are replaced. */
+	int memoryRecycleLimit;
+	/** The system memory pressure percentage at which the most grown application process is replaced. */
+	int memoryRecyclePressureThreshold;
 	/** The minimum number of application instances to keep when cleaning idle instances. */
 	int minInstances;
+	/** The number of free session slots that must remain when starting out-of-band work. */
+	int oobwMinSpareConcurrency;
+	/** The queueing delay, in milliseconds, above which queued requests are shed. */
+	int requestQueueTargetDelay;
+	/** The maximum time, in milliseconds, that a request may be queued. */
+	int requestQueueTimeout;
 	/** A timeout for application startup. */
 	int startTimeout;
+	/** The upload rate, in KB per second, above which request bodies are streamed to the application. */
+	int uploadStreamingThreshold;
 	/** The environment under which applications are run. */
 	const char *appEnv;
 	/** Application process group name. */
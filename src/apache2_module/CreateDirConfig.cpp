@@ -54,6 +54,12 @@
 				config->highPerformance = DirConfig::UNSET;
 				config->enabled = DirConfig::UNSET;
 				config->maxRequestQueueSize = UNSET_INT_VALUE;
+				config->requestQueueTimeout = UNSET_INT_VALUE;
+				config->requestQueueTargetDelay = UNSET_INT_VALUE;
+				config->uploadStreamingThreshold = UNSET_INT_VALUE;
+				config->oobwMinSpareConcurrency = UNSET_INT_VALUE;
+				config->memoryRecycleLimit = UNSET_INT_VALUE;
+				config->memoryRecyclePressureThreshold = UNSET_INT_VALUE;
 				config->maxPreloaderIdleTime = UNSET_INT_VALUE;
 				config->loadShellEnvvars = DirConfig::UNSET;
 				config->bufferUpload = DirConfig::UNSET;
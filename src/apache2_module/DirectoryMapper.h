@@ -32,11 +32,14 @@
 
 #include <oxt/backtrace.hpp>
 #include <boost/thread.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
 
 #include "Configuration.hpp"
+#include "DirectoryMapperCache.h"
 #include <AppTypes.h>
 #include <Utils.h>
-#include <Utils/CachedFileStat.hpp>
+#include <Utils/ConcurrentCachedFileStat.hpp>
 
 // The Apache/APR headers *must* come after the Boost headers, otherwise
 // compilation will fail on OpenBSD.
@@ -72,14 +75,10 @@ class DirectoryMapper {
 private:
 	DirConfig *config;
 	request_rec *r;
-	CachedFileStat *cstat;
-	boost::mutex *cstatMutex;
-	const char *baseURI;
-	string publicDir;
-	string appRoot;
+	ConcurrentCachedFileStat *cstat;
+	DirectoryMapperCache *cache;
+	DirectoryMappingPtr mapping;
 	unsigned int throttleRate;
-	PassengerAppType appType: 7;
-	bool autoDetectionDone: 1;
 
 	const char *findBaseURI() const {
 		set<string>::const_iterator it, end = config->baseURIs.end();
@@ -107,6 +106,23 @@ private:
 		return NULL;
 	}
 
+	DirectoryMapperCache::Key makeCacheKey(const StaticString &docRoot,
+		const char *baseURI) const
+	{
+		DirectoryMapperCache::Key key;
+		key.server = r->server;
+		key.docRoot.assign(docRoot.data(), docRoot.size());
+		if (baseURI != NULL) {
+			key.baseURI = baseURI;
+		}
+		key.setAppRoot(config->appRoot);
+		key.setAppType(config->appType);
+		key.setAppGroupName(config->appGroupName);
+		key.setAppEnv(config->appEnv);
+		key.resolveSymlinksInDocRoot = (int) config->resolveSymlinksInDocRoot;
+		return key;
+	}
+
 	/**
 	 * @throws FileSystemException An error occured while examening the filesystem.
 	 * @throws DocumentRootDeterminationError Unable to query the location of the document root.
@@ -114,7 +130,7 @@ private:
 	 * @throws boost::thread_interrupted
 	 */
 	void autoDetect() {
-		if (autoDetectionDone) {
+		if (mapping != NULL) {
 			return;
 		}
 
@@ -131,6 +147,17 @@ private:
 
 		/* Find the base URI for this web application, if any. */
 		const char *baseURI = findBaseURI();
+		DirectoryMapperCache::Key cacheKey;
+		if (cache != NULL) {
+			cacheKey = makeCacheKey(docRoot, baseURI);
+			mapping = cache->lookup(cacheKey);
+			if (mapping != NULL) {
+				return;
+			}
+		}
+
+		boost::shared_ptr<DirectoryMapping> result = boost::make_shared<DirectoryMapping>();
+		string &publicDir = result->publicDir;
 		if (baseURI != NULL) {
 			/* We infer that the 'public' directory of the web application
 			 * is document root + base URI.
@@ -144,9 +171,9 @@ private:
 		}
 
 		UPDATE_TRACE_POINT();
-		AppTypeDetector detector(cstat, cstatMutex, throttleRate);
+		AppTypeDetector detector(cstat, throttleRate);
 		PassengerAppType appType;
-		string appRoot;
+		string &appRoot = result->appRoot;
 		if (config->appType == NULL) {
 			if (config->appRoot == NULL) {
 				appType = detector.checkDocumentRoot(publicDir,
@@ -165,33 +192,44 @@ private:
 			}
 		}
 
-		this->appRoot = appRoot;
-		this->baseURI = baseURI;
-		this->appType = appType;
-		autoDetectionDone = true;
+		if (config->appGroupName == NULL) {
+			result->appGroupName = appRoot;
+			if (config->appEnv != NULL) {
+				result->appGroupName.append(" (", 2);
+				result->appGroupName.append(config->appEnv);
+				result->appGroupName.append(")", 1);
+			}
+		} else {
+			result->appGroupName = config->appGroupName;
+		}
+
+		if (baseURI != NULL) {
+			result->baseURI = baseURI;
+		}
+		result->appType = appType;
+		mapping = result;
+		if (cache != NULL) {
+			cache->store(cacheKey, mapping, throttleRate);
+		}
 	}
 
 public:
 	/**
 	 * Create a new DirectoryMapper object.
 	 *
-	 * @param cstat A CachedFileStat object used for statting files.
-	 * @param cstatMutex A mutex for locking CachedFileStat, making its
-	 *                   usage thread-safe.
+	 * @param cstat A ConcurrentCachedFileStat object used for statting files.
 	 * @param throttleRate A throttling rate for cstat.
+	 * @param cache If not NULL, results are looked up in and stored in this cache.
 	 * @warning Do not use this object after the destruction of <tt>r</tt>,
-	 *          <tt>config</tt> or <tt>cstat</tt>.
+	 *          <tt>config</tt>, <tt>cstat</tt> or <tt>cache</tt>.
 	 */
-	DirectoryMapper(request_rec *r, DirConfig *config, CachedFileStat *cstat,
-	                boost::mutex *cstatMutex, unsigned int throttleRate) {
+	DirectoryMapper(request_rec *r, DirConfig *config, ConcurrentCachedFileStat *cstat,
+	                unsigned int throttleRate, DirectoryMapperCache *cache = NULL) {
 		this->r = r;
 		this->config = config;
 		this->cstat = cstat;
-		this->cstatMutex = cstatMutex;
+		this->cache = cache;
 		this->throttleRate = throttleRate;
-		appType = PAT_NONE;
-		baseURI = NULL;
-		autoDetectionDone = false;
 	}
 
 	/**
@@ -203,13 +241,17 @@ public:
 	 * @throws DocumentRoot
 	 * @throws TimeRetrievalException
 	 * @throws boost::thread_interrupted
-	 * @warning The return value may only be used as long as <tt>config</tt>
-	 *          hasn't been destroyed.
+	 * @warning The return value may only be used as long as this
+	 *          DirectoryMapper hasn't been destroyed.
 	 */
 	const char *getBaseURI() {
 		TRACE_POINT();
 		autoDetect();
-		return baseURI;
+		if (mapping->baseURI.empty()) {
+			return NULL;
+		} else {
+			return mapping->baseURI.c_str();
+		}
 	}
 
 	/**
@@ -223,7 +265,7 @@ public:
 	 */
 	const string &getPublicDirectory() {
 		autoDetect();
-		return publicDir;
+		return mapping->publicDir;
 	}
 
 	/**
@@ -237,7 +279,7 @@ public:
 	 */
 	const string &getAppRoot() {
 		autoDetect();
-		return appRoot;
+		return mapping->appRoot;
 	}
 
 	/**
@@ -250,7 +292,7 @@ public:
 	 */
 	PassengerAppType getApplicationType() {
 		autoDetect();
-		return appType;
+		return mapping->appType;
 	}
 
 	/**
@@ -264,7 +306,20 @@ public:
 	 */
 	const char *getApplicationTypeName() {
 		autoDetect();
-		return getAppTypeName(appType);
+		return getAppTypeName(mapping->appType);
+	}
+
+	/**
+	 * Returns the name of the application group that the HTTP request belongs to.
+	 *
+	 * @throws FileSystemException An error occured while examening the filesystem.
+	 * @throws DocumentRootDeterminationError Unable to query the location of the document root.
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	const string &getAppGroupName() {
+		autoDetect();
+		return mapping->appGroupName;
 	}
 };
 
@@ -0,0 +1,220 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_DIRECTORY_MAPPER_CACHE_H_
+#define _PASSENGER_DIRECTORY_MAPPER_CACHE_H_
+
+#include <string>
+#include <map>
+#include <ctime>
+
+#include <boost/thread.hpp>
+#include <boost/shared_ptr.hpp>
+
+#include <AppTypes.h>
+#include <Utils/SystemTime.h>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/** The result of mapping a request to an application. */
+struct DirectoryMapping {
+	string publicDir;
+	string appRoot;
+	string appGroupName;
+	/** The matching PassengerBaseURI, or the empty string if none applies. */
+	string baseURI;
+	PassengerAppType appType;
+};
+
+typedef boost::shared_ptr<const DirectoryMapping> DirectoryMappingPtr;
+
+
+/**
+ * Remembers DirectoryMapper results, so that requests don't have to run the
+ * application type detector every time. The answers almost never change,
+ * but the detector stats several files per request.
+ *
+ * Entries are keyed on the contents of the configuration that the mapper
+ * reads, not on the address of the DirConfig: Apache merges a fresh
+ * DirConfig into every request's pool, so its address means nothing once
+ * the request is over.
+ *
+ * A result is reused for `throttleRate` seconds, the same interval at which
+ * the detector's stat() results are cached, so changes to the application
+ * directory are noticed at most one throttling interval later than without
+ * this cache. With a throttle rate of 0 nothing is cached. Failed
+ * detections aren't cached either.
+ *
+ * This class doesn't depend on the Apache headers so that it can be
+ * unit tested.
+ *
+ * Thread-safe. Lookups only take a shared lock, so that the worker threads
+ * don't serialize on cache hits.
+ */
+class DirectoryMapperCache {
+public:
+	/**
+	 * Everything that a DirectoryMapper result depends on. The optional
+	 * configuration options are stored together with a flag in `setOptions`,
+	 * so that an unset option and an option set to the empty string are
+	 * told apart.
+	 */
+	struct Key {
+		enum {
+			APP_ROOT_SET       = 1 << 0,
+			APP_TYPE_SET       = 1 << 1,
+			APP_GROUP_NAME_SET = 1 << 2,
+			APP_ENV_SET        = 1 << 3
+		};
+
+		/** The server_rec. Only compared, never dereferenced. */
+		const void *server;
+		string docRoot;
+		string baseURI;
+		string appRoot;
+		string appType;
+		string appGroupName;
+		string appEnv;
+		unsigned int setOptions;
+		int resolveSymlinksInDocRoot;
+
+		Key()
+			: server(NULL),
+			  setOptions(0),
+			  resolveSymlinksInDocRoot(0)
+			{ }
+
+		void setAppRoot(const char *value) {
+			setOption(APP_ROOT_SET, appRoot, value);
+		}
+
+		void setAppType(const char *value) {
+			setOption(APP_TYPE_SET, appType, value);
+		}
+
+		void setAppGroupName(const char *value) {
+			setOption(APP_GROUP_NAME_SET, appGroupName, value);
+		}
+
+		void setAppEnv(const char *value) {
+			setOption(APP_ENV_SET, appEnv, value);
+		}
+
+		bool operator<(const Key &other) const {
+			if (server != other.server) {
+				return server < other.server;
+			} else if (setOptions != other.setOptions) {
+				return setOptions < other.setOptions;
+			} else if (resolveSymlinksInDocRoot != other.resolveSymlinksInDocRoot) {
+				return resolveSymlinksInDocRoot < other.resolveSymlinksInDocRoot;
+			} else if (docRoot != other.docRoot) {
+				return docRoot < other.docRoot;
+			} else if (baseURI != other.baseURI) {
+				return baseURI < other.baseURI;
+			} else if (appRoot != other.appRoot) {
+				return appRoot < other.appRoot;
+			} else if (appType != other.appType) {
+				return appType < other.appType;
+			} else if (appGroupName != other.appGroupName) {
+				return appGroupName < other.appGroupName;
+			} else {
+				return appEnv < other.appEnv;
+			}
+		}
+
+	private:
+		void setOption(unsigned int flag, string &field, const char *value) {
+			if (value == NULL) {
+				setOptions &= ~flag;
+				field.clear();
+			} else {
+				setOptions |= flag;
+				field = value;
+			}
+		}
+	};
+
+private:
+	/** When the cache is full, it's cleared as a whole. */
+	static const unsigned int MAX_SIZE = 1024;
+
+	struct Entry {
+		DirectoryMappingPtr mapping;
+		time_t expiryTime;
+	};
+
+	boost::shared_mutex syncher;
+	std::map<Key, Entry> entries;
+
+public:
+	/**
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	DirectoryMappingPtr lookup(const Key &key) {
+		time_t now = SystemTime::get();
+		boost::shared_lock<boost::shared_mutex> l(syncher);
+		std::map<Key, Entry>::const_iterator it = entries.find(key);
+		if (it != entries.end() && now < it->second.expiryTime) {
+			return it->second.mapping;
+		} else {
+			return DirectoryMappingPtr();
+		}
+	}
+
+	/**
+	 * @throws TimeRetrievalException
+	 * @throws boost::thread_interrupted
+	 */
+	void store(const Key &key, const DirectoryMappingPtr &mapping,
+		unsigned int throttleRate)
+	{
+		if (throttleRate == 0) {
+			return;
+		}
+
+		time_t now = SystemTime::get();
+		boost::unique_lock<boost::shared_mutex> l(syncher);
+		if (entries.size() >= MAX_SIZE) {
+			entries.clear();
+		}
+		Entry &entry = entries[key];
+		entry.mapping = mapping;
+		entry.expiryTime = now + throttleRate;
+	}
+
+	unsigned int size() {
+		boost::shared_lock<boost::shared_mutex> l(syncher);
+		return entries.size();
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_DIRECTORY_MAPPER_CACHE_H_ */
@@ -223,9 +223,9 @@ private:
 	enum Threeway { YES, NO, UNKNOWN };
 
 	Threeway m_hasModRewrite, m_hasModDir, m_hasModAutoIndex, m_hasModXsendfile;
-	CachedFileStat cstat;
+	ConcurrentCachedFileStat cstat;
+	DirectoryMapperCache mapperCache;
 	WatchdogLauncher watchdogLauncher;
-	boost::mutex cstatMutex;
 
 	inline DirConfig *getDirConfig(request_rec *r) {
 		return (DirConfig *) ap_get_module_config(r->per_dir_config, &passenger_module);
@@ -401,7 +401,8 @@ private:
 	bool prepareRequest(request_rec *r, DirConfig *config, const char *filename, bool coreModuleWillBeRun = false) {
 		TRACE_POINT();
 
-		DirectoryMapper mapper(r, config, &cstat, &cstatMutex, serverConfig.statThrottleRate);
+		DirectoryMapper mapper(r, config, &cstat, serverConfig.statThrottleRate,
+			&mapperCache);
 		try {
 			if (mapper.getApplicationType() == PAT_NONE) {
 				// (B) is not true.
@@ -967,15 +968,8 @@ private:
 
 		// App group name.
 		if (config->appGroupName == NULL) {
-			result.append("!~PASSENGER_APP_GROUP_NAME: ",
-				sizeof("!~PASSENGER_APP_GROUP_NAME: ") - 1);
-			result.append(mapper.getAppRoot());
-			if (config->appEnv != NULL) {
-				result.append(" (", 2);
-				result.append(config->appEnv);
-				result.append(")", 1);
-			}
-			result.append("\r\n", 2);
+			addHeader(result, P_STATIC_STRING("!~PASSENGER_APP_GROUP_NAME"),
+				mapper.getAppGroupName());
 		}
 
 		// Phusion Passenger options.
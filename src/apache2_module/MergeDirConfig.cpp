@@ -146,6 +146,48 @@
 	
 
 	
+		config->requestQueueTimeout =
+			(add->requestQueueTimeout == UNSET_INT_VALUE) ?
+			base->requestQueueTimeout :
+			add->requestQueueTimeout;
+	
+
+	
+		config->requestQueueTargetDelay =
+			(add->requestQueueTargetDelay == UNSET_INT_VALUE) ?
+			base->requestQueueTargetDelay :
+			add->requestQueueTargetDelay;
+	
+
+	
+		config->uploadStreamingThreshold =
+			(add->uploadStreamingThreshold == UNSET_INT_VALUE) ?
+			base->uploadStreamingThreshold :
+			add->uploadStreamingThreshold;
+	
+
+	
+		config->oobwMinSpareConcurrency =
+			(add->oobwMinSpareConcurrency == UNSET_INT_VALUE) ?
+			base->oobwMinSpareConcurrency :
+			add->oobwMinSpareConcurrency;
+	
+
+	
+		config->memoryRecycleLimit =
+			(add->memoryRecycleLimit == UNSET_INT_VALUE) ?
+			base->memoryRecycleLimit :
+			add->memoryRecycleLimit;
+	
+
+	
+		config->memoryRecyclePressureThreshold =
+			(add->memoryRecyclePressureThreshold == UNSET_INT_VALUE) ?
+			base->memoryRecyclePressureThreshold :
+			add->memoryRecyclePressureThreshold;
+	
+
+	
 		config->maxPreloaderIdleTime =
 			(add->maxPreloaderIdleTime == UNSET_INT_VALUE) ?
 			base->maxPreloaderIdleTime :
@@ -101,6 +101,36 @@
 	
 
 	
+		addHeader(r, result, StaticString("!~PASSENGER_REQUEST_QUEUE_TIMEOUT",
+			sizeof("!~PASSENGER_REQUEST_QUEUE_TIMEOUT") - 1), config->requestQueueTimeout);
+	
+
+	
+		addHeader(r, result, StaticString("!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY",
+			sizeof("!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY") - 1), config->requestQueueTargetDelay);
+	
+
+	
+		addHeader(r, result, StaticString("!~PASSENGER_UPLOAD_STREAMING_THRESHOLD",
+			sizeof("!~PASSENGER_UPLOAD_STREAMING_THRESHOLD") - 1), config->uploadStreamingThreshold);
+	
+
+	
+		addHeader(r, result, StaticString("!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY",
+			sizeof("!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY") - 1), config->oobwMinSpareConcurrency);
+	
+
+	
+		addHeader(r, result, StaticString("!~PASSENGER_MEMORY_RECYCLE_LIMIT",
+			sizeof("!~PASSENGER_MEMORY_RECYCLE_LIMIT") - 1), config->memoryRecycleLimit);
+	
+
+	
+		addHeader(r, result, StaticString("!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD",
+			sizeof("!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD") - 1), config->memoryRecyclePressureThreshold);
+	
+
+	
 		addHeader(r, result, StaticString("!~PASSENGER_MAX_PRELOADER_IDLE_TIME",
 			sizeof("!~PASSENGER_MAX_PRELOADER_IDLE_TIME") - 1), config->maxPreloaderIdleTime);
 	
@@ -0,0 +1,142 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_ALGORITHMS_CODEL_H_
+#define _PASSENGER_ALGORITHMS_CODEL_H_
+
+#include <boost/cstdint.hpp>
+#include <cmath>
+
+namespace Passenger {
+
+
+/**
+ * The dropping state machine of the CoDel ("controlled delay") queue
+ * management algorithm, RFC 8289, applied to request queues instead of
+ * packet queues.
+ *
+ * CoDel doesn't look at the queue length, but at the time that items spent
+ * in the queue (their "sojourn time"), which it is told about whenever an item
+ * is dequeued. As long as the sojourn time drops below `target` at least once
+ * per `interval`, the queue is considered to be absorbing a burst and nothing
+ * is dropped. If the sojourn time stays above `target` for a whole `interval`
+ * then the queue is considered to be a standing queue, and CoDel starts
+ * dropping items, at a rate that increases with the square root of the number
+ * of drops, until the sojourn time falls below `target` again.
+ *
+ * All times are in microseconds. This class is not thread-safe.
+ */
+class CoDel {
+private:
+	boost::uint64_t firstAboveTime;
+	boost::uint64_t dropNext;
+	unsigned int count;
+	unsigned int lastCount;
+	bool dropping;
+
+	static boost::uint64_t controlLaw(boost::uint64_t t, boost::uint64_t interval,
+		unsigned int count)
+	{
+		return t + (boost::uint64_t) (interval / std::sqrt((double) count));
+	}
+
+	bool okToDrop(boost::uint64_t sojournTime, boost::uint64_t now,
+		boost::uint64_t target, boost::uint64_t interval)
+	{
+		if (sojournTime < target) {
+			firstAboveTime = 0;
+			return false;
+		} else if (firstAboveTime == 0) {
+			firstAboveTime = now + interval;
+			return false;
+		} else {
+			return now >= firstAboveTime;
+		}
+	}
+
+public:
+	CoDel()
+		: firstAboveTime(0),
+		  dropNext(0),
+		  count(0),
+		  lastCount(0),
+		  dropping(false)
+		{ }
+
+	/**
+	 * Called when an item is dequeued. Returns whether it should be dropped.
+	 */
+	bool shouldDrop(boost::uint64_t sojournTime, boost::uint64_t now,
+		boost::uint64_t target, boost::uint64_t interval)
+	{
+		bool ok = okToDrop(sojournTime, now, target, interval);
+		if (dropping) {
+			if (!ok) {
+				dropping = false;
+				return false;
+			} else if (now >= dropNext) {
+				count++;
+				dropNext = controlLaw(dropNext, interval, count);
+				return true;
+			} else {
+				return false;
+			}
+		} else if (ok) {
+			dropping = true;
+			// If we were dropping recently, resume at the rate we were
+			// dropping at, instead of starting all over.
+			unsigned int delta = count - lastCount;
+			if (delta > 1 && (now < dropNext || now - dropNext < 16 * interval)) {
+				count = delta;
+			} else {
+				count = 1;
+			}
+			lastCount = count;
+			dropNext = controlLaw(now, interval, count);
+			return true;
+		} else {
+			return false;
+		}
+	}
+
+	/** Called when the queue becomes empty. */
+	void reset() {
+		firstAboveTime = 0;
+		dropping = false;
+	}
+
+	bool isDropping() const {
+		return dropping;
+	}
+
+	unsigned int getDropCount() const {
+		return count;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_ALGORITHMS_CODEL_H_ */
@@ -0,0 +1,355 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_ALGORITHMS_HISTOGRAM_H_
+#define _PASSENGER_ALGORITHMS_HISTOGRAM_H_
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <oxt/macros.hpp>
+#include <algorithm>
+#include <cstring>
+
+namespace Passenger {
+
+using namespace std;
+
+
+/**
+ * A fixed-size, log-linear histogram of unsigned integers (typically durations
+ * in microseconds), in the spirit of HdrHistogram.
+ *
+ * Values are grouped by their power-of-two magnitude, and every magnitude is
+ * split into SUB_BUCKET_COUNT linear sub-buckets. Values smaller than
+ * SUB_BUCKET_COUNT are recorded exactly; larger values are recorded with a
+ * relative error of at most 1/SUB_BUCKET_COUNT (12.5%). Values larger than
+ * MAX_VALUE are clamped into the last bucket.
+ *
+ * Recording a value never allocates memory and never grabs a lock. All counters
+ * are atomic so that other threads may read the histogram at any time (they
+ * will see a slightly stale, but never torn, state). There are two ways to
+ * record a value:
+ *
+ *  * `record()` is for histograms that have only one writer at a time, such as
+ *    histograms owned by a single event loop thread, or histograms only written
+ *    to while holding some other lock. It compiles to plain loads and stores.
+ *  * `recordConcurrently()` is for histograms that are written to by multiple
+ *    threads at the same time. It uses atomic read-modify-write instructions.
+ *
+ * Histograms can be copied (which takes a snapshot) and merged, so that
+ * per-thread histograms can be aggregated at inspection time.
+ */
+class Histogram {
+public:
+	static const unsigned int SUB_BUCKET_BITS = 3;
+	static const unsigned int SUB_BUCKET_COUNT = 1 << SUB_BUCKET_BITS;
+	/** The largest power-of-two magnitude that is tracked. */
+	static const unsigned int MAX_MAGNITUDE = 39;
+	static const boost::uint64_t MAX_VALUE = (((boost::uint64_t) 1) << (MAX_MAGNITUDE + 1)) - 1;
+	static const unsigned int BUCKET_COUNT =
+		(MAX_MAGNITUDE - SUB_BUCKET_BITS + 2) * SUB_BUCKET_COUNT;
+
+private:
+	boost::atomic<boost::uint64_t> buckets[BUCKET_COUNT];
+	boost::atomic<boost::uint64_t> totalCount;
+	boost::atomic<boost::uint64_t> totalSum;
+	boost::atomic<boost::uint64_t> maxValue;
+
+	static unsigned int magnitudeOf(boost::uint64_t value) {
+		#if defined(__GNUC__) || defined(__clang__)
+			return 63 - __builtin_clzll((unsigned long long) value);
+		#else
+			unsigned int result = 0;
+			while (value >>= 1) {
+				result++;
+			}
+			return result;
+		#endif
+	}
+
+	OXT_FORCE_INLINE
+	static void increment(boost::atomic<boost::uint64_t> &counter, boost::uint64_t amount) {
+		counter.store(counter.load(boost::memory_order_relaxed) + amount,
+			boost::memory_order_relaxed);
+	}
+
+	void copyFrom(const Histogram &other) {
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			buckets[i].store(other.buckets[i].load(boost::memory_order_relaxed),
+				boost::memory_order_relaxed);
+		}
+		totalCount.store(other.totalCount.load(boost::memory_order_relaxed),
+			boost::memory_order_relaxed);
+		totalSum.store(other.totalSum.load(boost::memory_order_relaxed),
+			boost::memory_order_relaxed);
+		maxValue.store(other.maxValue.load(boost::memory_order_relaxed),
+			boost::memory_order_relaxed);
+	}
+
+public:
+	Histogram() {
+		reset();
+	}
+
+	Histogram(const Histogram &other) {
+		copyFrom(other);
+	}
+
+	Histogram &operator=(const Histogram &other) {
+		if (this != &other) {
+			copyFrom(other);
+		}
+		return *this;
+	}
+
+	/** Returns the index of the bucket that the given value belongs to. */
+	OXT_FORCE_INLINE
+	static unsigned int bucketIndexOf(boost::uint64_t value) {
+		if (value < SUB_BUCKET_COUNT) {
+			return (unsigned int) value;
+		} else if (OXT_UNLIKELY(value > MAX_VALUE)) {
+			return BUCKET_COUNT - 1;
+		} else {
+			unsigned int magnitude = magnitudeOf(value);
+			unsigned int shift = magnitude - SUB_BUCKET_BITS;
+			return (shift + 1) * SUB_BUCKET_COUNT
+				+ (unsigned int) ((value >> shift) - SUB_BUCKET_COUNT);
+		}
+	}
+
+	/** Returns the smallest value that belongs to the given bucket. */
+	static boost::uint64_t bucketLowerBound(unsigned int index) {
+		if (index < SUB_BUCKET_COUNT) {
+			return index;
+		} else {
+			unsigned int shift = index / SUB_BUCKET_COUNT - 1;
+			boost::uint64_t sub = index % SUB_BUCKET_COUNT;
+			return (SUB_BUCKET_COUNT + sub) << shift;
+		}
+	}
+
+	/** Returns the largest value that belongs to the given bucket. */
+	static boost::uint64_t bucketUpperBound(unsigned int index) {
+		if (index == BUCKET_COUNT - 1) {
+			return MAX_VALUE;
+		} else {
+			return bucketLowerBound(index + 1) - 1;
+		}
+	}
+
+	OXT_FORCE_INLINE
+	void record(boost::uint64_t value) {
+		increment(buckets[bucketIndexOf(value)], 1);
+		increment(totalCount, 1);
+		increment(totalSum, value);
+		if (value > maxValue.load(boost::memory_order_relaxed)) {
+			maxValue.store(value, boost::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Records `count` occurrences of the same value. Same threading rules
+	 * as `record()`.
+	 */
+	void recordMultiple(boost::uint64_t value, boost::uint64_t count) {
+		if (count == 0) {
+			return;
+		}
+		increment(buckets[bucketIndexOf(value)], count);
+		increment(totalCount, count);
+		increment(totalSum, value * count);
+		if (value > maxValue.load(boost::memory_order_relaxed)) {
+			maxValue.store(value, boost::memory_order_relaxed);
+		}
+	}
+
+	/**
+	 * Records a latency that was measured by a client that sends its next
+	 * request only after receiving the previous response (a closed-loop
+	 * load generator), while correcting for coordinated omission.
+	 *
+	 * Such a client would have sent a request every `expectedInterval`,
+	 * but while it was waiting for a slow response it didn't send any.
+	 * Those requests would have seen latencies of `value - expectedInterval`,
+	 * `value - 2 * expectedInterval`, etc. This method records those as
+	 * well, so that a stall shows up in the high percentiles in proportion
+	 * to its duration, instead of as a single sample. This is the same
+	 * correction that HdrHistogram performs. Same threading rules as
+	 * `record()`.
+	 */
+	void recordWithExpectedInterval(boost::uint64_t value, boost::uint64_t expectedInterval) {
+		record(value);
+		if (expectedInterval == 0 || value <= expectedInterval) {
+			return;
+		}
+		for (boost::uint64_t missing = value - expectedInterval;
+			missing >= expectedInterval;
+			missing -= expectedInterval)
+		{
+			record(missing);
+		}
+	}
+
+	/**
+	 * Returns a copy of this histogram as if every value had been recorded
+	 * with `recordWithExpectedInterval()`. This is for applying the
+	 * correction after the fact, e.g. when the expected interval is only
+	 * known at the end of a run. Because the individual values are no longer
+	 * known, every value in a bucket is assumed to be equal to the bucket's
+	 * upper bound (capped by the maximum), so the sum of the result is an
+	 * approximation.
+	 */
+	Histogram correctedForCoordinatedOmission(boost::uint64_t expectedInterval) const {
+		Histogram result;
+		boost::uint64_t max = getMax();
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			boost::uint64_t count = buckets[i].load(boost::memory_order_relaxed);
+			if (count == 0) {
+				continue;
+			}
+			boost::uint64_t value = std::min(bucketUpperBound(i), max);
+			result.recordMultiple(value, count);
+			if (expectedInterval == 0 || value <= expectedInterval) {
+				continue;
+			}
+			for (boost::uint64_t missing = value - expectedInterval;
+				missing >= expectedInterval;
+				missing -= expectedInterval)
+			{
+				result.recordMultiple(missing, count);
+			}
+		}
+		return result;
+	}
+
+	void recordConcurrently(boost::uint64_t value) {
+		buckets[bucketIndexOf(value)].fetch_add(1, boost::memory_order_relaxed);
+		totalCount.fetch_add(1, boost::memory_order_relaxed);
+		totalSum.fetch_add(value, boost::memory_order_relaxed);
+		boost::uint64_t prevMax = maxValue.load(boost::memory_order_relaxed);
+		while (value > prevMax
+			&& !maxValue.compare_exchange_weak(prevMax, value, boost::memory_order_relaxed))
+		{
+			// Retry.
+		}
+	}
+
+	/** Adds the contents of another histogram to this one. Not thread-safe
+	 * with respect to other writers of this histogram.
+	 */
+	void merge(const Histogram &other) {
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			increment(buckets[i], other.buckets[i].load(boost::memory_order_relaxed));
+		}
+		increment(totalCount, other.totalCount.load(boost::memory_order_relaxed));
+		increment(totalSum, other.totalSum.load(boost::memory_order_relaxed));
+		maxValue.store(std::max(maxValue.load(boost::memory_order_relaxed),
+			other.maxValue.load(boost::memory_order_relaxed)),
+			boost::memory_order_relaxed);
+	}
+
+	void reset() {
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			buckets[i].store(0, boost::memory_order_relaxed);
+		}
+		totalCount.store(0, boost::memory_order_relaxed);
+		totalSum.store(0, boost::memory_order_relaxed);
+		maxValue.store(0, boost::memory_order_relaxed);
+	}
+
+	boost::uint64_t getCount() const {
+		return totalCount.load(boost::memory_order_relaxed);
+	}
+
+	boost::uint64_t getSum() const {
+		return totalSum.load(boost::memory_order_relaxed);
+	}
+
+	boost::uint64_t getMax() const {
+		return maxValue.load(boost::memory_order_relaxed);
+	}
+
+	boost::uint64_t getBucketCount(unsigned int index) const {
+		return buckets[index].load(boost::memory_order_relaxed);
+	}
+
+	/** Returns the number of recorded values that are smaller than or equal to `value`. */
+	boost::uint64_t getCountAtOrBelow(boost::uint64_t value) const {
+		unsigned int last = bucketIndexOf(value);
+		boost::uint64_t result = 0;
+		if (bucketUpperBound(last) > value && last > 0) {
+			// The bucket also contains values larger than `value`,
+			// so don't count it.
+			last--;
+		} else if (bucketUpperBound(last) > value) {
+			return 0;
+		}
+		for (unsigned int i = 0; i <= last; i++) {
+			result += buckets[i].load(boost::memory_order_relaxed);
+		}
+		return result;
+	}
+
+	/**
+	 * Returns an approximation of the value at the given percentile (0..100).
+	 * The result is the upper bound of the bucket that contains that percentile,
+	 * capped by the largest value ever recorded. Returns 0 if nothing is recorded.
+	 */
+	boost::uint64_t getValueAtPercentile(double percentile) const {
+		boost::uint64_t count = getCount();
+		if (count == 0) {
+			return 0;
+		}
+
+		percentile = std::min(std::max(percentile, 0.0), 100.0);
+		boost::uint64_t target = (boost::uint64_t) (percentile / 100.0 * count + 0.5);
+		if (target == 0) {
+			target = 1;
+		}
+
+		boost::uint64_t seen = 0;
+		for (unsigned int i = 0; i < BUCKET_COUNT; i++) {
+			seen += buckets[i].load(boost::memory_order_relaxed);
+			if (seen >= target) {
+				return std::min(bucketUpperBound(i), getMax());
+			}
+		}
+		return getMax();
+	}
+
+	double getMean() const {
+		boost::uint64_t count = getCount();
+		if (count == 0) {
+			return 0;
+		} else {
+			return getSum() / (double) count;
+		}
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_ALGORITHMS_HISTOGRAM_H_ */
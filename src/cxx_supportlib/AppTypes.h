@@ -82,6 +82,7 @@ PassengerAppType pp_get_app_type2(const char *name, unsigned int len);
 #include <Utils.h>
 #include <Utils/StrIntUtils.h>
 #include <Utils/CachedFileStat.hpp>
+#include <Utils/ConcurrentCachedFileStat.hpp>
 
 namespace Passenger {
 
@@ -102,6 +103,7 @@ class AppTypeDetector {
 private:
 	CachedFileStat *cstat;
 	boost::mutex *cstatMutex;
+	ConcurrentCachedFileStat *concurrentCstat;
 	unsigned int throttleRate;
 	bool ownsCstat;
 
@@ -115,13 +117,19 @@ private:
 			TRACE_POINT();
 			throw RuntimeException("Not enough buffer space");
 		}
-		return getFileType(StaticString(buf, pos - buf - 1), cstat, cstatMutex, throttleRate) != FT_NONEXISTANT;
+		StaticString filename(buf, pos - buf - 1);
+		if (concurrentCstat != NULL) {
+			return getFileType(filename, concurrentCstat, throttleRate) != FT_NONEXISTANT;
+		} else {
+			return getFileType(filename, cstat, cstatMutex, throttleRate) != FT_NONEXISTANT;
+		}
 	}
 
 public:
 	AppTypeDetector(CachedFileStat *_cstat = NULL, boost::mutex *_cstatMutex = NULL, unsigned int _throttleRate = 1)
 		: cstat(_cstat),
 		  cstatMutex(_cstatMutex),
+		  concurrentCstat(NULL),
 		  throttleRate(_throttleRate),
 		  ownsCstat(false)
 	{
@@ -131,6 +139,14 @@ public:
 		}
 	}
 
+	AppTypeDetector(ConcurrentCachedFileStat *_cstat, unsigned int _throttleRate)
+		: cstat(NULL),
+		  cstatMutex(NULL),
+		  concurrentCstat(_cstat),
+		  throttleRate(_throttleRate),
+		  ownsCstat(false)
+		{ }
+
 	~AppTypeDetector() {
 		if (ownsCstat) {
 			delete cstat;
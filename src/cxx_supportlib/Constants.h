@@ -53,6 +53,8 @@
 
 	#define DEFAULT_APP_ENV "production"
 
+	#define DEFAULT_APP_OUTPUT_RATE_LIMIT 1000
+
 	#define DEFAULT_APP_THREAD_COUNT 1
 
 	#define DEFAULT_CONCURRENCY_MODEL "process"
@@ -75,12 +77,16 @@
 
 	#define DEFAULT_NODEJS "node"
 
+	#define DEFAULT_OOBW_MIN_SPARE_CONCURRENCY 0
+
 	#define DEFAULT_POOL_IDLE_TIME 300
 
 	#define DEFAULT_PYTHON "python"
 
 	#define DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK 134217728
 
+	#define DEFAULT_RESPONSE_COMPRESSION_LEVEL 1
+
 	#define DEFAULT_RUBY "ruby"
 
 	#define DEFAULT_SOCKET_BACKLOG 2048
@@ -89,6 +95,8 @@
 
 	#define DEFAULT_START_TIMEOUT 90000
 
+	#define DEFAULT_STATS_SEGMENT_INTERVAL 1000
+
 	#define DEFAULT_STAT_THROTTLE_RATE 10
 
 	#define DEFAULT_STICKY_SESSIONS_COOKIE_NAME "_passenger_route"
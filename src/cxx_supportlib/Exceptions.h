@@ -416,6 +416,28 @@ public:
 	}
 };
 
+/**
+ * Indicates that a Pool::get() or Pool::asyncGet() request was dropped from
+ * the getWaitlist queue, either because it passed its deadline, or because
+ * the queue was shedding load.
+ */
+class RequestQueueTimeoutException: public GetAbortedException {
+private:
+	string msg;
+
+public:
+	RequestQueueTimeoutException(const string &message)
+		: GetAbortedException(oxt::tracable_exception::no_backtrace()),
+		  msg(message)
+		{ }
+
+	virtual ~RequestQueueTimeoutException() throw() {}
+
+	virtual const char *what() const throw() {
+		return msg.c_str();
+	}
+};
+
 /**
  * Indicates that a specified argument is incorrect or violates a requirement.
  *
@@ -286,6 +286,49 @@ printAppOutput(pid_t pid, const char *channelName, const char *message, unsigned
 	}
 }
 
+void
+printAppOutputLines(pid_t pid, const char *channelName, const StaticString *lines,
+	unsigned int count)
+{
+	if (printAppOutputAsDebuggingMessages || count == 1) {
+		for (unsigned int i = 0; i < count; i++) {
+			printAppOutput(pid, channelName, lines[i].data(), lines[i].size());
+		}
+	} else if (count > 0) {
+		char pidStr[sizeof("4294967295")];
+		unsigned int pidStrLen, channelNameLen, totalLen, i;
+
+		try {
+			pidStrLen = integerToOtherBase<pid_t, 10>(pid, pidStr, sizeof(pidStr));
+		} catch (const std::length_error &) {
+			pidStr[0] = '?';
+			pidStr[1] = '\0';
+			pidStrLen = 1;
+		}
+
+		channelNameLen = strlen(channelName);
+		totalLen = 0;
+		for (i = 0; i < count; i++) {
+			totalLen += (sizeof("App X Y: \n") - 2) + pidStrLen + channelNameLen
+				+ lines[i].size();
+		}
+
+		DynamicBuffer buf(totalLen);
+		char *pos = buf.data;
+		char *end = buf.data + totalLen;
+		for (i = 0; i < count; i++) {
+			pos = appendData(pos, end, "App ");
+			pos = appendData(pos, end, pidStr, pidStrLen);
+			pos = appendData(pos, end, " ");
+			pos = appendData(pos, end, channelName, channelNameLen);
+			pos = appendData(pos, end, ": ");
+			pos = appendData(pos, end, lines[i]);
+			pos = appendData(pos, end, "\n");
+		}
+		_writeLogEntry(buf.data, pos - buf.data);
+	}
+}
+
 void
 setPrintAppOutputAsDebuggingMessages(bool enabled) {
 	printAppOutputAsDebuggingMessages = enabled;
@@ -56,6 +56,8 @@ using namespace std;
 using namespace boost;
 using namespace oxt;
 
+class StaticString;
+
 
 struct AssertionFailureInfo {
 	const char *filename;
@@ -326,6 +328,13 @@ enum PassengerLogLevel {
  */
 void printAppOutput(pid_t pid, const char *channelName, const char *message, unsigned int size);
 
+/**
+ * Like `printAppOutput()`, but prints multiple lines that were received from
+ * the same channel with a single write to the log file.
+ */
+void printAppOutputLines(pid_t pid, const char *channelName, const StaticString *lines,
+	unsigned int count);
+
 /**
  * Controls how messages that are received from applications are printed.
  *
@@ -0,0 +1,245 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_MEMORY_KIT_OBJECT_SLAB_H_
+#define _PASSENGER_MEMORY_KIT_OBJECT_SLAB_H_
+
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/alignment_of.hpp>
+#include <boost/type_traits/aligned_storage.hpp>
+#include <oxt/macros.hpp>
+#include <psg_sysqueue.h>
+#include <new>
+#include <cassert>
+#include <cstdlib>
+
+namespace Passenger {
+namespace MemoryKit {
+
+
+/**
+ * An allocator for objects of a single type, with O(1) construct() and
+ * destroy(). It is not thread-safe: it is meant to be owned by a single
+ * event loop thread, e.g. one per Core::Controller.
+ *
+ * Objects are carved out of CHUNK_SIZE-sized chunks. Chunks are aligned to
+ * their size, so destroy() finds the chunk that an object belongs to by
+ * masking the object's address. Slots are handed out lazily, so a fresh chunk
+ * only consumes resident memory for the slots that are actually used.
+ *
+ * A chunk is returned to the system as soon as all its objects are destroyed,
+ * except for one empty chunk that is kept around so that alternating
+ * construct() and destroy() calls don't hit malloc each time. After a burst
+ * of concurrent requests, memory usage therefore drops back to what is
+ * actually in use (modulo fragmentation within chunks).
+ */
+template<typename T, unsigned int CHUNK_SIZE = 16 * 1024>
+class ObjectSlab {
+private:
+	union Slot {
+		Slot *next;
+		typename boost::aligned_storage<sizeof(T),
+			boost::alignment_of<T>::value>::type storage;
+	};
+
+	struct Chunk {
+		LIST_ENTRY(Chunk) allChunks;
+		LIST_ENTRY(Chunk) availableChunks;
+		Slot *freeSlots;
+		/** Number of slots at the end of the chunk that have never been handed out. */
+		unsigned int uncarvedSlots;
+		unsigned int live;
+	};
+
+	LIST_HEAD(ChunkList, Chunk);
+
+	static const unsigned int HEADER_SIZE =
+		(sizeof(Chunk) + boost::alignment_of<Slot>::value - 1)
+		/ boost::alignment_of<Slot>::value
+		* boost::alignment_of<Slot>::value;
+
+public:
+	static const unsigned int SLOTS_PER_CHUNK = (CHUNK_SIZE - HEADER_SIZE) / sizeof(Slot);
+
+private:
+	BOOST_STATIC_ASSERT((CHUNK_SIZE & (CHUNK_SIZE - 1)) == 0);
+	BOOST_STATIC_ASSERT(SLOTS_PER_CHUNK > 0);
+
+	/** All chunks. */
+	ChunkList chunks;
+	/** Chunks with at least one free slot. */
+	ChunkList available;
+	unsigned int chunkCount;
+	unsigned int emptyChunkCount;
+	unsigned int liveCount;
+
+	static Slot *slotAt(Chunk *chunk, unsigned int index) {
+		return reinterpret_cast<Slot *>(reinterpret_cast<char *>(chunk)
+			+ HEADER_SIZE) + index;
+	}
+
+	static Chunk *chunkOf(void *object) {
+		return reinterpret_cast<Chunk *>(reinterpret_cast<boost::uintptr_t>(object)
+			& ~(boost::uintptr_t) (CHUNK_SIZE - 1));
+	}
+
+	Chunk *createChunk() {
+		void *memory;
+		if (posix_memalign(&memory, CHUNK_SIZE, CHUNK_SIZE) != 0) {
+			throw std::bad_alloc();
+		}
+
+		Chunk *chunk = static_cast<Chunk *>(memory);
+		chunk->freeSlots = NULL;
+		chunk->uncarvedSlots = SLOTS_PER_CHUNK;
+		chunk->live = 0;
+		LIST_INSERT_HEAD(&chunks, chunk, allChunks);
+		LIST_INSERT_HEAD(&available, chunk, availableChunks);
+		chunkCount++;
+		emptyChunkCount++;
+		return chunk;
+	}
+
+	void destroyChunk(Chunk *chunk) {
+		LIST_REMOVE(chunk, allChunks);
+		LIST_REMOVE(chunk, availableChunks);
+		chunkCount--;
+		free(chunk);
+	}
+
+	void *allocateSlot() {
+		Chunk *chunk = LIST_FIRST(&available);
+		if (chunk == NULL) {
+			chunk = createChunk();
+		}
+
+		Slot *slot;
+		if (chunk->freeSlots != NULL) {
+			slot = chunk->freeSlots;
+			chunk->freeSlots = slot->next;
+		} else {
+			assert(chunk->uncarvedSlots > 0);
+			slot = slotAt(chunk, SLOTS_PER_CHUNK - chunk->uncarvedSlots);
+			chunk->uncarvedSlots--;
+		}
+
+		if (chunk->live == 0) {
+			emptyChunkCount--;
+		}
+		chunk->live++;
+		liveCount++;
+		if (chunk->live == SLOTS_PER_CHUNK) {
+			LIST_REMOVE(chunk, availableChunks);
+		}
+		return slot;
+	}
+
+	void freeSlot(void *memory) {
+		Chunk *chunk = chunkOf(memory);
+		Slot *slot = static_cast<Slot *>(memory);
+
+		assert(chunk->live > 0);
+		if (chunk->live == SLOTS_PER_CHUNK) {
+			LIST_INSERT_HEAD(&available, chunk, availableChunks);
+		}
+		slot->next = chunk->freeSlots;
+		chunk->freeSlots = slot;
+		chunk->live--;
+		liveCount--;
+
+		if (chunk->live == 0) {
+			if (emptyChunkCount > 0) {
+				destroyChunk(chunk);
+			} else {
+				emptyChunkCount++;
+			}
+		}
+	}
+
+public:
+	ObjectSlab()
+		: chunkCount(0),
+		  emptyChunkCount(0),
+		  liveCount(0)
+	{
+		LIST_INIT(&chunks);
+		LIST_INIT(&available);
+	}
+
+	/**
+	 * Frees all chunks. Objects that are still alive are not destructed,
+	 * so the owner must destroy() them first.
+	 */
+	~ObjectSlab() {
+		assert(liveCount == 0);
+		Chunk *chunk, *next;
+		LIST_FOREACH_SAFE(chunk, &chunks, allChunks, next) {
+			free(chunk);
+		}
+	}
+
+	/** Allocates and default-constructs an object. */
+	T *construct() {
+		void *memory = allocateSlot();
+		try {
+			return new (memory) T();
+		} catch (...) {
+			freeSlot(memory);
+			throw;
+		}
+	}
+
+	/** Destructs an object that was created by this slab's construct(). */
+	void destroy(T *object) {
+		object->~T();
+		freeSlot(object);
+	}
+
+	/** The number of objects currently alive. */
+	unsigned int getLiveCount() const {
+		return liveCount;
+	}
+
+	unsigned int getChunkCount() const {
+		return chunkCount;
+	}
+
+	/** The number of bytes allocated from the system. */
+	size_t getAllocatedSize() const {
+		return (size_t) chunkCount * CHUNK_SIZE;
+	}
+
+private:
+	// Not copyable.
+	ObjectSlab(const ObjectSlab &);
+	ObjectSlab &operator=(const ObjectSlab &);
+};
+
+
+} // namespace MemoryKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_MEMORY_KIT_OBJECT_SLAB_H_ */
@@ -363,3 +363,26 @@ psg_pcalloc(psg_pool_t *pool, size_t size)
 
 	return p;
 }
+
+
+void
+psg_pool_usage(const psg_pool_t *pool, size_t *reserved, size_t *used, size_t *nlarge)
+{
+	const psg_pool_t        *p;
+	const psg_pool_large_t  *l;
+
+	*reserved = 0;
+	*used = 0;
+	*nlarge = 0;
+
+	for (p = pool; p; p = p->data.next) {
+		*reserved += p->data.end - (const char *) p;
+		*used += p->data.last - (const char *) p;
+	}
+
+	for (l = pool->large; l; l = l->next) {
+		if (l->alloc) {
+			(*nlarge)++;
+		}
+	}
+}
@@ -124,5 +124,14 @@ Passenger::StaticString psg_pstrdup(psg_pool_t *pool, const Passenger::StaticStr
  */
 bool  psg_pfree(psg_pool_t *pool, void *p);
 
+/** Calculates how much memory the given pool has reserved in its blocks
+ * (`reserved`), how much of that is actually in use (`used`), and how many
+ * allocations were made through the large memory allocator (`nlarge`).
+ * The size of large allocations is not tracked, so they are not included
+ * in `reserved` or `used`.
+ */
+void  psg_pool_usage(const psg_pool_t *pool, size_t *reserved, size_t *used,
+	size_t *nlarge);
+
 
 #endif /* _PASSENGER_MEMORY_KIT_PALLOC_H_INCLUDED_ */
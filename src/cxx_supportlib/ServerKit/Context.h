@@ -32,6 +32,7 @@
 #include <jsoncpp/json.h>
 #include <MemoryKit/mbuf.h>
 #include <SafeLibev.h>
+#include <ServerKit/TimerWheel.h>
 #include <Constants.h>
 #include <Utils/StrIntUtils.h>
 #include <Utils/JsonUtils.h>
@@ -72,19 +73,25 @@ private:
 public:
 	SafeLibevPtr libev;
 	struct uv_loop_s *libuv;
+	/** Drives all coarse-grained timeouts (idle clients, stalled requests)
+	 * of all servers that use this Context.
+	 */
+	TimerWheel timerWheel;
 	struct MemoryKit::mbuf_pool mbuf_pool;
 	string secureModePassword;
 	FileBufferedChannelConfig defaultFileBufferedChannelConfig;
 
 	Context(const SafeLibevPtr &_libev, struct uv_loop_s *_libuv)
 		: libev(_libev),
-		  libuv(_libuv)
+		  libuv(_libuv),
+		  timerWheel(_libev->getLoop())
 	{
 		initialize();
 	}
 
 	Context(struct ev_loop *loop)
-		: libev(boost::make_shared<SafeLibev>(loop))
+		: libev(boost::make_shared<SafeLibev>(loop)),
+		  timerWheel(loop)
 	{
 		initialize();
 	}
@@ -127,6 +134,7 @@ public:
 		#endif
 
 		doc["mbuf_pool"] = mbufDoc;
+		doc["timer_wheel"] = timerWheel.inspectStateAsJson();
 
 		return doc;
 	}
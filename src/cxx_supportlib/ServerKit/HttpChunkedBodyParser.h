@@ -26,11 +26,19 @@
 #ifndef _PASSENGER_SERVER_KIT_CHUNKED_BODY_PARSER_H_
 #define _PASSENGER_SERVER_KIT_CHUNKED_BODY_PARSER_H_
 
+#include <boost/cstdint.hpp>
 #include <algorithm>
 #include <cstdio>
 #include <cstddef>
 #include <cstring>
-
+#ifdef __SSE2__
+	#include <emmintrin.h>
+#endif
+
+#include <oxt/backtrace.hpp>
+#include <Logging.h>
+#include <StaticString.h>
+#include <MemoryKit/mbuf.h>
 #include <ServerKit/Errors.h>
 #include <ServerKit/HttpChunkedBodyParserState.h>
 
@@ -93,15 +101,34 @@ struct HttpChunkedEvent {
  * Parses data in HTTP/1.1 chunked transfer encoding.
  *
  * This is a POD struct so that we can put it in a union.
+ *
+ * The parser is a byte-at-a-time state machine, but it has a fast path for
+ * the common case of a chunk header that is entirely in the buffer and that
+ * has no chunk extension: the CR that ends the size line is located with
+ * SSE2 (or memchr on other platforms) and the size is parsed in one go.
+ * Whenever the fast path sees something unusual (a chunk extension, an
+ * invalid or overly long size, a header split over two buffers) it leaves
+ * the input untouched and the state machine handles it, so errors are
+ * always detected and reported by the state machine.
+ *
+ * With the fast path, a DATA event that completes a chunk also consumes
+ * the CRLF after the data and the next chunk header, if they are in the
+ * buffer. That way, a stream of small chunks takes one `feed()` call per
+ * chunk instead of one per chunk plus one per chunk header.
  */
 class HttpChunkedBodyParser {
 public:
 	typedef unsigned int (*LoggingPrefixFormatter)(char *buf, unsigned int bufsize, void *userData);
 
 private:
+	/** A chunk header without extension is at most 8 hex digits and a CR. */
+	static const unsigned int FAST_PATH_WINDOW = 16;
+	static const unsigned int FAST_PATH_MAX_SIZE_DIGITS = 8;
+
 	HttpChunkedBodyParserState *state;
 	LoggingPrefixFormatter loggingPrefixFormatter;
 	void *userData;
+	bool fastPath;
 
 	static bool isHexDigit(char ch) {
 		return (ch >= '0' && ch <= '9')
@@ -119,6 +146,109 @@ private:
 		}
 	}
 
+	/** Returns -1 if `ch` is not a hex digit. */
+	static int hexDigitValue(unsigned char ch) {
+		static const signed char table[256] = {
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, -1, -1, -1, -1, -1, -1,
+			-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+			-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1
+		};
+		return table[ch];
+	}
+
+	/**
+	 * Returns the offset of the first CR within the first FAST_PATH_WINDOW
+	 * bytes of the given data, or -1 if there is none.
+	 */
+	static int findCrInWindow(const char *data, size_t size) {
+		#ifdef __SSE2__
+			if (size >= FAST_PATH_WINDOW) {
+				__m128i bytes = _mm_loadu_si128((const __m128i *) data);
+				int mask = _mm_movemask_epi8(_mm_cmpeq_epi8(bytes,
+					_mm_set1_epi8(HttpChunkedBodyParserState::CR)));
+				if (mask == 0) {
+					return -1;
+				} else {
+					return __builtin_ctz(mask);
+				}
+			}
+		#endif
+		const char *pos = (const char *) memchr(data, HttpChunkedBodyParserState::CR,
+			std::min<size_t>(size, FAST_PATH_WINDOW));
+		if (pos == NULL) {
+			return -1;
+		} else {
+			return pos - data;
+		}
+	}
+
+	/**
+	 * Parses a complete "<hex size>\r\n" chunk header at `current`.
+	 * On success, advances `current` past it and transitions to
+	 * EXPECTING_DATA. Otherwise leaves everything untouched.
+	 *
+	 * Only up to FAST_PATH_MAX_SIZE_DIGITS digits are accepted, so the
+	 * size never reaches MAX_CHUNK_SIZE before the last digit is added,
+	 * just like in the state machine.
+	 */
+	bool parseChunkHeaderFast(const char *&current, const char *end) {
+		size_t available = end - current;
+		int crOffset = findCrInWindow(current, available);
+		if (crOffset < 1 || crOffset > (int) FAST_PATH_MAX_SIZE_DIGITS
+		 || (size_t) crOffset + 1 >= available
+		 || current[crOffset + 1] != HttpChunkedBodyParserState::LF)
+		{
+			return false;
+		}
+
+		boost::uint32_t size = 0;
+		for (int i = 0; i < crOffset; i++) {
+			int digit = hexDigitValue(current[i]);
+			if (digit < 0) {
+				return false;
+			}
+			size = 16 * size + digit;
+		}
+
+		CBP_DEBUG("parsing new chunk");
+		state->remainingDataSize = size;
+		logChunkSize();
+		state->state = HttpChunkedBodyParserState::EXPECTING_DATA;
+		current += crOffset + 2;
+		return true;
+	}
+
+	/**
+	 * Called right after the last data byte of a chunk. Consumes the CRLF
+	 * that follows it and the next chunk header, as far as they are
+	 * complete and valid.
+	 */
+	const char *skipChunkBoundaryFast(const char *current, const char *end) {
+		if (end - current >= 2
+		 && current[0] == HttpChunkedBodyParserState::CR
+		 && current[1] == HttpChunkedBodyParserState::LF)
+		{
+			CBP_DEBUG("done parsing a chunk");
+			state->state = HttpChunkedBodyParserState::EXPECTING_SIZE_FIRST_DIGIT;
+			current += 2;
+			parseChunkHeaderFast(current, end);
+		}
+		return current;
+	}
+
 	void logChunkSize() {
 		CBP_DEBUG("chunk size determined: " << state->remainingDataSize << " bytes");
 	}
@@ -131,11 +261,17 @@ private:
 	}
 
 public:
+	/**
+	 * @param _fastPath Whether to enable the fast path. Only unit tests
+	 *   disable it, to compare against the plain state machine.
+	 */
 	HttpChunkedBodyParser(HttpChunkedBodyParserState *_state,
-		LoggingPrefixFormatter formatter, void *_userData)
+		LoggingPrefixFormatter formatter, void *_userData,
+		bool _fastPath = true)
 		: state(_state),
 		  loggingPrefixFormatter(formatter),
-		  userData(_userData)
+		  userData(_userData),
+		  fastPath(_fastPath)
 		{ }
 
 	void initialize() {
@@ -170,16 +306,26 @@ public:
 						state->state = HttpChunkedBodyParserState::EXPECTING_NON_FINAL_CR;
 					}
 					if (outputDataEvents) {
+						const char *next = current + dataSize;
+						if (fastPath && state->remainingDataSize == 0) {
+							next = skipChunkBoundaryFast(next, end);
+						}
 						return HttpChunkedEvent(HttpChunkedEvent::DATA,
 							MemoryKit::mbuf(buffer, current - buffer.start, dataSize),
-							current + dataSize - buffer.start, false);
+							next - buffer.start, false);
 					} else {
 						current += dataSize;
+						if (fastPath && state->remainingDataSize == 0) {
+							current = skipChunkBoundaryFast(current, end);
+						}
 						break;
 					}
 				}
 
 			case HttpChunkedBodyParserState::EXPECTING_SIZE_FIRST_DIGIT:
+				if (fastPath && parseChunkHeaderFast(current, end)) {
+					break;
+				}
 				CBP_DEBUG("parsing new chunk");
 				if (isHexDigit(*current)) {
 					state->remainingDataSize = parseHexDigit(*current);
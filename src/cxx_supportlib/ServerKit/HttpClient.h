@@ -29,6 +29,7 @@
 #include <psg_sysqueue.h>
 #include <ServerKit/Client.h>
 #include <ServerKit/HttpRequest.h>
+#include <ServerKit/TimerWheel.h>
 
 namespace Passenger {
 namespace ServerKit {
@@ -39,6 +40,7 @@ class BaseHttpClient: public BaseClient {
 public:
 	typedef Request RequestType;
 	LIST_HEAD(RequestList, Request);
+	TAILQ_HEAD(PipelinedRequestList, Request);
 
 	/**
 	 * @invariant
@@ -48,12 +50,32 @@ public:
 	 */
 	Request *currentRequest;
 	unsigned int requestsBegun;
+	/** Implements the keep-alive idle timeout and the header read timeout. */
+	TimerWheel::Entry timeoutTimer;
+	/** Whether we've received any part of the current request's header. */
+	bool readingHeader;
+	/**
+	 * Requests that the client pipelined after `currentRequest`, in the order
+	 * in which they were received. Their headers have already been parsed
+	 * (the last one's possibly only partially), but they have not begun yet.
+	 * See HttpServer::processClientDataWhenPipelining().
+	 */
+	PipelinedRequestList pipelinedRequests;
+	unsigned int pipelinedRequestCount;
 
 	BaseHttpClient(void *server)
 		: BaseClient(server),
 		  currentRequest(NULL),
-		  requestsBegun(0)
-		{ }
+		  requestsBegun(0),
+		  readingHeader(false),
+		  pipelinedRequestCount(0)
+	{
+		TAILQ_INIT(&pipelinedRequests);
+	}
+
+	Request *lastPipelinedRequest() const {
+		return TAILQ_LAST(&pipelinedRequests, PipelinedRequestList);
+	}
 };
 
 
@@ -0,0 +1,519 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_HTTP_COMPRESSION_H_
+#define _PASSENGER_SERVER_KIT_HTTP_COMPRESSION_H_
+
+#include <cstddef>
+#include <cstring>
+#include <cassert>
+#include <zlib.h>
+#include <StaticString.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+using namespace std;
+
+
+inline bool isHttpWhitespace(char ch);
+inline bool httpTokenEquals(const StaticString &token, const StaticString &lowercaseValue);
+inline bool qvalueIsZero(const StaticString &qvalue);
+
+
+/**
+ * Given the value of an Accept-Encoding request header, returns whether the
+ * client accepts the gzip content coding. Implements the negotiation rules of
+ * RFC 7231 section 5.3.4: an explicit "gzip" (or "x-gzip") element wins over
+ * "*", and an element with q=0 means "not acceptable".
+ */
+inline bool
+acceptEncodingAllowsGzip(const StaticString &value) {
+	const char *pos = value.data();
+	const char *end = value.data() + value.size();
+	// -1: not mentioned, 0: not acceptable, 1: acceptable
+	int gzip = -1, wildcard = -1;
+
+	while (pos < end) {
+		while (pos < end && isHttpWhitespace(*pos)) {
+			pos++;
+		}
+
+		const char *codingStart = pos;
+		while (pos < end && *pos != ',' && *pos != ';' && !isHttpWhitespace(*pos)) {
+			pos++;
+		}
+		StaticString coding(codingStart, pos - codingStart);
+		bool acceptable = true;
+
+		while (pos < end && *pos != ',') {
+			if (*pos == ';') {
+				pos++;
+				while (pos < end && isHttpWhitespace(*pos)) {
+					pos++;
+				}
+				if (end - pos >= 2 && (*pos == 'q' || *pos == 'Q') && pos[1] == '=') {
+					pos += 2;
+					const char *qvalueStart = pos;
+					while (pos < end && *pos != ',' && *pos != ';' && !isHttpWhitespace(*pos)) {
+						pos++;
+					}
+					acceptable = !qvalueIsZero(StaticString(qvalueStart, pos - qvalueStart));
+				}
+			} else {
+				pos++;
+			}
+		}
+		if (pos < end) {
+			// Skip the ','.
+			pos++;
+		}
+
+		if (httpTokenEquals(coding, P_STATIC_STRING("gzip"))
+		 || httpTokenEquals(coding, P_STATIC_STRING("x-gzip")))
+		{
+			gzip = acceptable;
+		} else if (coding == P_STATIC_STRING("*")) {
+			wildcard = acceptable;
+		}
+	}
+
+	if (gzip != -1) {
+		return gzip;
+	} else {
+		return wildcard == 1;
+	}
+}
+
+/**
+ * Given the value of a Content-Type response header, returns whether the
+ * body is textual enough to be worth compressing. Media types that are
+ * already compressed (images, video, archives) are not, and neither is
+ * text/event-stream: its events must reach the client without delay.
+ */
+inline bool
+contentTypeIsCompressible(const StaticString &value) {
+	static const char *const COMPRESSIBLE_TYPES[] = {
+		"application/json",
+		"application/javascript",
+		"application/x-javascript",
+		"application/ecmascript",
+		"application/xml",
+		"application/wasm",
+		"application/vnd.ms-fontobject",
+		"application/x-font-ttf",
+		"font/ttf",
+		"font/otf",
+		"image/x-icon",
+		"image/vnd.microsoft.icon"
+	};
+	static const unsigned int NCOMPRESSIBLE_TYPES =
+		sizeof(COMPRESSIBLE_TYPES) / sizeof(COMPRESSIBLE_TYPES[0]);
+
+	const char *pos = value.data();
+	const char *end = value.data() + value.size();
+
+	while (pos < end && isHttpWhitespace(*pos)) {
+		pos++;
+	}
+	const char *typeEnd = (const char *) memchr(pos, ';', end - pos);
+	if (typeEnd == NULL) {
+		typeEnd = end;
+	}
+	while (typeEnd > pos && isHttpWhitespace(typeEnd[-1])) {
+		typeEnd--;
+	}
+	StaticString type(pos, typeEnd - pos);
+
+	if (type.size() > 5 && httpTokenEquals(type.substr(0, 5), P_STATIC_STRING("text/"))) {
+		return !httpTokenEquals(type, P_STATIC_STRING("text/event-stream"));
+	}
+	if ((type.size() > 5
+	  && httpTokenEquals(type.substr(type.size() - 5), P_STATIC_STRING("+json")))
+	 || (type.size() > 4
+	  && httpTokenEquals(type.substr(type.size() - 4), P_STATIC_STRING("+xml"))))
+	{
+		return true;
+	}
+	for (unsigned int i = 0; i < NCOMPRESSIBLE_TYPES; i++) {
+		if (httpTokenEquals(type, COMPRESSIBLE_TYPES[i])) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Given the value of a Cache-Control response header, returns whether it
+ * contains the no-transform directive, which forbids intermediaries from
+ * changing the content coding (RFC 7234 section 5.2.2.4).
+ */
+inline bool
+cacheControlForbidsTransform(const StaticString &value) {
+	const char *pos = value.data();
+	const char *end = value.data() + value.size();
+
+	while (pos < end) {
+		while (pos < end && (isHttpWhitespace(*pos) || *pos == ',')) {
+			pos++;
+		}
+		const char *directiveStart = pos;
+		while (pos < end && *pos != ',' && *pos != '=' && !isHttpWhitespace(*pos)) {
+			pos++;
+		}
+		if (httpTokenEquals(StaticString(directiveStart, pos - directiveStart),
+			P_STATIC_STRING("no-transform")))
+		{
+			return true;
+		}
+
+		// Skip the directive's argument, which may be a quoted string
+		// containing commas.
+		bool quoted = false;
+		while (pos < end && (quoted || *pos != ',')) {
+			if (*pos == '"') {
+				quoted = !quoted;
+			} else if (*pos == '\\' && quoted && pos + 1 < end) {
+				pos++;
+			}
+			pos++;
+		}
+	}
+	return false;
+}
+
+/**
+ * Given the value of a Vary response header, returns whether it already
+ * covers Accept-Encoding: either by listing it, or by being "*", which
+ * means that the response varies on more than just request headers.
+ */
+inline bool
+varyCoversAcceptEncoding(const StaticString &value) {
+	const char *pos = value.data();
+	const char *end = value.data() + value.size();
+
+	while (pos < end) {
+		while (pos < end && (isHttpWhitespace(*pos) || *pos == ',')) {
+			pos++;
+		}
+		const char *fieldStart = pos;
+		while (pos < end && *pos != ',' && !isHttpWhitespace(*pos)) {
+			pos++;
+		}
+		StaticString field(fieldStart, pos - fieldStart);
+		if (field == P_STATIC_STRING("*")
+		 || httpTokenEquals(field, P_STATIC_STRING("accept-encoding")))
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+
+/**
+ * A streaming gzip (RFC 1952) compressor on top of zlib's deflate.
+ *
+ * The deflate state is allocated by the first start() call and is reused by
+ * subsequent start() calls with the same parameters, so a single compressor
+ * can compress many bodies without reallocating. With the default window,
+ * the state takes about 256 KB. When the body size is known in advance, a
+ * smaller window is used for small bodies, like Nginx's gzip module does.
+ *
+ * Usage:
+ *
+ *   compressor.start(level, bodySize);
+ *   compressor.feed(data, size);
+ *   do {
+ *       size_t n = compressor.compress(output, sizeof(output),
+ *           GzipCompressor::SYNC_FLUSH, done);
+ *       // ...write n bytes of output...
+ *   } while (!done);
+ */
+class GzipCompressor {
+public:
+	enum Flush {
+		/** Let deflate decide how much to buffer internally. */
+		NO_FLUSH = Z_NO_FLUSH,
+		/** Produce output for all input so far, on a byte boundary. */
+		SYNC_FLUSH = Z_SYNC_FLUSH,
+		/** Produce output for all input so far and end the gzip stream. */
+		FINISH = Z_FINISH
+	};
+
+	static const int MAX_WINDOW_BITS = 15;
+	static const int MIN_WINDOW_BITS = 9;
+	static const int DEFAULT_MEM_LEVEL = 8;
+
+private:
+	z_stream stream;
+	int level, windowBits, memLevel;
+	bool initialized: 1;
+	bool finished: 1;
+	/** Whether input has been consumed since the last flush. */
+	bool unflushed: 1;
+
+	void deinitialize() {
+		if (initialized) {
+			deflateEnd(&stream);
+			initialized = false;
+		}
+	}
+
+	static void determineWindow(size_t sizeHint, int &windowBits, int &memLevel) {
+		windowBits = MAX_WINDOW_BITS;
+		memLevel = DEFAULT_MEM_LEVEL;
+		if (sizeHint > 0) {
+			// The usable window is 262 bytes smaller than its nominal size.
+			while (windowBits > MIN_WINDOW_BITS
+			 && sizeHint < (size_t) (1 << (windowBits - 1)) - 262)
+			{
+				windowBits--;
+				memLevel--;
+			}
+			if (memLevel < 1) {
+				memLevel = 1;
+			}
+		}
+	}
+
+public:
+	GzipCompressor()
+		: level(0),
+		  windowBits(0),
+		  memLevel(0),
+		  initialized(false),
+		  finished(false),
+		  unflushed(false)
+	{
+		memset(&stream, 0, sizeof(stream));
+	}
+
+	~GzipCompressor() {
+		deinitialize();
+	}
+
+	/**
+	 * Begins a new gzip stream. `sizeHint` is the size of the body if known,
+	 * or 0 otherwise. Returns false if zlib could not allocate memory.
+	 */
+	bool start(int level, size_t sizeHint = 0) {
+		int windowBits, memLevel;
+		determineWindow(sizeHint, windowBits, memLevel);
+
+		if (initialized
+		 && this->windowBits == windowBits
+		 && this->memLevel == memLevel)
+		{
+			if (deflateReset(&stream) != Z_OK) {
+				deinitialize();
+				return false;
+			}
+			if (this->level != level) {
+				if (deflateParams(&stream, level, Z_DEFAULT_STRATEGY) != Z_OK) {
+					deinitialize();
+					return false;
+				}
+			}
+		} else {
+			deinitialize();
+			memset(&stream, 0, sizeof(stream));
+			// 16 + windowBits selects the gzip wrapper instead of the zlib one.
+			if (deflateInit2(&stream, level, Z_DEFLATED, 16 + windowBits, memLevel,
+				Z_DEFAULT_STRATEGY) != Z_OK)
+			{
+				return false;
+			}
+			initialized = true;
+		}
+
+		this->level = level;
+		this->windowBits = windowBits;
+		this->memLevel = memLevel;
+		finished = false;
+		unflushed = false;
+		return true;
+	}
+
+	/**
+	 * Sets the next input to compress. The data must stay valid until
+	 * compress() has reported that it is done.
+	 *
+	 * @pre start() succeeded
+	 * @pre !isFinished()
+	 */
+	void feed(const char *data, size_t size) {
+		assert(initialized);
+		assert(!finished);
+		stream.next_in = (Bytef *) data;
+		stream.avail_in = size;
+	}
+
+	/**
+	 * Compresses the input given to feed() into `output`, which has room for
+	 * `size` bytes. Returns the number of bytes written, which may be 0.
+	 *
+	 * `done` is set to true once all input has been consumed and, in case of
+	 * SYNC_FLUSH and FINISH, all the corresponding output has been produced.
+	 * Otherwise, call this method again with the same `flush` value and more
+	 * output space.
+	 *
+	 * @pre start() succeeded
+	 * @pre size > 0
+	 */
+	size_t compress(char *output, size_t size, Flush flush, bool &done) {
+		assert(initialized);
+		assert(size > 0);
+
+		if (finished) {
+			done = true;
+			return 0;
+		}
+
+		stream.next_out = (Bytef *) output;
+		stream.avail_out = size;
+		if (stream.avail_in > 0) {
+			unflushed = true;
+		}
+
+		int ret = deflate(&stream, flush);
+		// Z_BUF_ERROR only means that no progress was possible, e.g. when
+		// flushing twice in a row.
+		assert(ret == Z_OK || ret == Z_STREAM_END || ret == Z_BUF_ERROR);
+		(void) ret;
+
+		switch (flush) {
+		case NO_FLUSH:
+			done = stream.avail_in == 0;
+			break;
+		case SYNC_FLUSH:
+			done = stream.avail_in == 0 && stream.avail_out > 0;
+			if (done) {
+				unflushed = false;
+			}
+			break;
+		default:
+			done = ret == Z_STREAM_END;
+			if (done) {
+				finished = true;
+				unflushed = false;
+			}
+			break;
+		}
+		return size - stream.avail_out;
+	}
+
+	/**
+	 * Compresses `data` as a complete gzip stream into `output`, which has
+	 * room for `outputSize` bytes. Returns the compressed size, or 0 if it
+	 * does not fit or if zlib could not allocate memory.
+	 */
+	size_t compressAll(int level, const char *data, size_t size, char *output,
+		size_t outputSize)
+	{
+		bool done;
+		if (!start(level, size) || outputSize == 0) {
+			return 0;
+		}
+		feed(data, size);
+		size_t result = compress(output, outputSize, FINISH, done);
+		if (done) {
+			return result;
+		} else {
+			return 0;
+		}
+	}
+
+	/** Whether the gzip stream has been ended with FINISH. */
+	bool isFinished() const {
+		return finished;
+	}
+
+	/**
+	 * Whether input has been compressed since the last SYNC_FLUSH or
+	 * FINISH, in which case deflate may be holding back output.
+	 */
+	bool hasUnflushedInput() const {
+		return unflushed;
+	}
+
+	/** The number of input bytes consumed since start(). */
+	size_t getTotalIn() const {
+		return stream.total_in;
+	}
+
+	/** The number of output bytes produced since start(). */
+	size_t getTotalOut() const {
+		return stream.total_out;
+	}
+};
+
+
+inline bool
+isHttpWhitespace(char ch) {
+	return ch == ' ' || ch == '\t';
+}
+
+inline bool
+httpTokenEquals(const StaticString &token, const StaticString &lowercaseValue) {
+	if (token.size() != lowercaseValue.size()) {
+		return false;
+	}
+
+	const char *data = token.data();
+	const char *value = lowercaseValue.data();
+	for (size_t i = 0; i < token.size(); i++) {
+		char ch = data[i];
+		if (ch >= 'A' && ch <= 'Z') {
+			ch = ch - 'A' + 'a';
+		}
+		if (ch != value[i]) {
+			return false;
+		}
+	}
+	return true;
+}
+
+/**
+ * A qvalue is zero if it's "0", optionally followed by a dot and zeroes.
+ */
+inline bool
+qvalueIsZero(const StaticString &qvalue) {
+	if (qvalue.empty() || qvalue[0] != '0') {
+		return false;
+	}
+	for (size_t i = 1; i < qvalue.size(); i++) {
+		if (qvalue[i] != '0' && !(i == 1 && qvalue[i] == '.')) {
+			return false;
+		}
+	}
+	return true;
+}
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_HTTP_COMPRESSION_H_ */
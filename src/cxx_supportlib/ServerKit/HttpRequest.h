@@ -281,6 +281,7 @@ public:
 	union { \
 		STAILQ_ENTRY(RequestType) freeRequest; \
 		LIST_ENTRY(RequestType) lingeringRequest; \
+		TAILQ_ENTRY(RequestType) pipelinedRequest; \
 	} nextRequest
 
 
@@ -69,6 +69,15 @@ public:
 
 	FreeRequestList freeRequests;
 	unsigned int freeRequestCount, requestFreelistLimit;
+	/** In seconds. 0 means disabled, which is the default. */
+	ev_tstamp keepAliveTimeout, headerReadTimeout;
+	/**
+	 * The maximum number of pipelined requests per client whose headers are
+	 * parsed ahead while an earlier request is still being processed.
+	 * 0 means that pipelined requests are only parsed once the earlier
+	 * requests have been fully processed.
+	 */
+	unsigned int maxPipelinedRequests;
 	unsigned long totalRequestsBegun, lastTotalRequestsBegun;
 	double requestBeginSpeed1m, requestBeginSpeed1h;
 
@@ -153,6 +162,7 @@ private:
 		LIST_REMOVE(request, nextRequest.lingeringRequest);
 		assert(client->lingeringRequestCount > 0);
 		client->lingeringRequestCount--;
+		onRequestObjectReleased(client, request);
 		request->client = NULL;
 
 		if (addRequestToFreelist(request)) {
@@ -237,6 +247,27 @@ private:
 	}
 
 	void handleNextRequest(Client *client) {
+		client->output.deinitialize();
+		client->output.reinitialize(client->getFd());
+
+		if (!TAILQ_EMPTY(&client->pipelinedRequests)) {
+			beginPipelinedRequest(client);
+			return;
+		}
+
+		client->input.start();
+		client->currentRequest = checkoutAndReinitializeRequest(client);
+
+		// The first request's header is expected to arrive right after
+		// accepting the client. Subsequent requests may arrive after
+		// some idle time.
+		client->readingHeader = client->requestsBegun == 0;
+		armClientTimeout(client, client->readingHeader
+			? headerReadTimeout
+			: keepAliveTimeout);
+	}
+
+	Request *checkoutAndReinitializeRequest(Client *client) {
 		Request *req;
 
 		// A request object references its client object.
@@ -244,13 +275,160 @@ private:
 		// in requestReachedZeroRefcount().
 		this->refClient(client, __FILE__, __LINE__);
 
-		client->input.start();
-		client->output.deinitialize();
-		client->output.reinitialize(client->getFd());
-
-		client->currentRequest = req = checkoutRequestObject(client);
+		req = checkoutRequestObject(client);
 		req->client = client;
 		reinitializeRequest(client, req);
+		return req;
+	}
+
+
+	/***** Pipelining *****/
+
+	bool canParsePipelinedRequests(Client *client, Request *req) const {
+		return maxPipelinedRequests > 0
+			&& req->wantKeepAlive
+			&& HttpServer::serverState < HttpServer::SHUTTING_DOWN;
+	}
+
+	/**
+	 * Called when data arrives while the client has pipelined requests, or
+	 * when the first data after a request without body arrives. Parses the
+	 * data as the headers of the requests that follow, and queues those
+	 * requests in `client->pipelinedRequests`. They are begun in order by
+	 * handleNextRequest(), so responses are always written in request order.
+	 *
+	 * Parsing stops, by stopping the client input, after a request that has
+	 * a body, upgrades the connection or is invalid: the data after its header
+	 * can only be processed once it has begun. Parsing also stops when
+	 * `maxPipelinedRequests` requests are queued.
+	 */
+	Channel::Result processClientDataWhenPipelining(Client *client,
+		const MemoryKit::mbuf &buffer, int errcode)
+	{
+		Request *req = client->lastPipelinedRequest();
+
+		if (buffer.empty()) {
+			// This is an early read error for the last pipelined request.
+			// It is processed when that request begins.
+			assert(req != NULL);
+			SKC_TRACE(client, 3, "Early read EOF or error detected after "
+				"pipelined request");
+			req->nextRequestEarlyReadError = (errcode == 0)
+				? (int) EARLY_EOF_DETECTED
+				: errcode;
+			client->input.stop();
+			return Channel::Result(0, false);
+		}
+
+		if (req == NULL || req->httpState != Request::PARSING_HEADERS) {
+			if (client->pipelinedRequestCount >= maxPipelinedRequests) {
+				SKC_TRACE(client, 3, "Pipelined request queue full; "
+					"not parsing more requests ahead");
+				client->input.stop();
+				return Channel::Result(0, false);
+			}
+			req = checkoutAndReinitializeRequest(client);
+			TAILQ_INSERT_TAIL(&client->pipelinedRequests, req,
+				nextRequest.pipelinedRequest);
+			client->pipelinedRequestCount++;
+		}
+
+		SKC_TRACE(client, 3, "Parsing " << buffer.size() <<
+			" bytes of pipelined HTTP header: \"" << cEscapeString(StaticString(
+				buffer.start, buffer.size())) << "\"");
+		size_t ret = createRequestHeaderParser(this->getContext(), req).
+			feed(buffer);
+		if (req->httpState == Request::PARSING_HEADERS) {
+			// Not yet done parsing.
+			return Channel::Result(buffer.size(), false);
+		}
+
+		SKC_TRACE(client, 2, "Pipelined request received (" <<
+			client->pipelinedRequestCount << " queued)");
+		headerParserStatePool.destroy(req->parserState.headerParser);
+		req->parserState.headerParser = NULL;
+		if (req->httpState != Request::COMPLETE) {
+			client->input.stop();
+		}
+		return Channel::Result(ret, false);
+	}
+
+	void beginPipelinedRequest(Client *client) {
+		Request *req = TAILQ_FIRST(&client->pipelinedRequests);
+		TAILQ_REMOVE(&client->pipelinedRequests, req, nextRequest.pipelinedRequest);
+		client->pipelinedRequestCount--;
+		client->currentRequest = req;
+
+		if (req->httpState == Request::PARSING_HEADERS) {
+			if (req->nextRequestEarlyReadError != 0) {
+				SKC_TRACE(client, 3, "Client closed the connection in the middle "
+					"of a pipelined request header; disconnecting client");
+				this->disconnect(&client);
+			} else {
+				SKC_TRACE(client, 3, "Continuing parsing pipelined request header");
+				client->input.start();
+				client->readingHeader = true;
+				armClientTimeout(client, headerReadTimeout);
+			}
+			return;
+		}
+
+		// The request may end, and the next pipelined request may begin,
+		// inside beginRequest().
+		RequestRef ref(req, __FILE__, __LINE__);
+		int nextRequestEarlyReadError = req->nextRequestEarlyReadError;
+
+		SKC_TRACE(client, 2, "Beginning pipelined request: #" << (totalRequestsBegun + 1));
+		if (beginRequest(client, req) && client->connected()) {
+			client->input.start();
+		}
+		if (nextRequestEarlyReadError != 0
+		 && req->detectingNextRequestEarlyReadError
+		 && !req->ended())
+		{
+			req->detectingNextRequestEarlyReadError = false;
+			onNextRequestEarlyReadError(client, req, nextRequestEarlyReadError);
+		}
+	}
+
+	void discardPipelinedRequests(Client *client) {
+		while (!TAILQ_EMPTY(&client->pipelinedRequests)) {
+			Request *req = TAILQ_FIRST(&client->pipelinedRequests);
+			TAILQ_REMOVE(&client->pipelinedRequests, req, nextRequest.pipelinedRequest);
+			client->pipelinedRequestCount--;
+
+			deinitializeRequest(client, req);
+			LIST_INSERT_HEAD(&client->lingeringRequests, req,
+				nextRequest.lingeringRequest);
+			client->lingeringRequestCount++;
+			unrefRequest(req, __FILE__, __LINE__);
+		}
+	}
+
+
+	/***** Client timeouts *****/
+
+	void armClientTimeout(Client *client, ev_tstamp timeout) {
+		if (timeout > 0) {
+			this->getContext()->timerWheel.arm(&client->timeoutTimer, timeout);
+		} else {
+			this->getContext()->timerWheel.cancel(&client->timeoutTimer);
+		}
+	}
+
+	static void onClientTimeout(TimerWheel::Entry *entry) {
+		Client *client = static_cast<Client *>(entry->userData);
+		HttpServer *self = static_cast<HttpServer *>(HttpServer::getServerFromClient(client));
+		SKC_LOG_EVENT_FROM_STATIC(self, HttpServer, client, "onClientTimeout");
+
+		if (client->readingHeader) {
+			SKC_INFO_FROM_STATIC(self, client, "Timed out reading request header; "
+				"disconnecting client");
+		} else {
+			SKC_DEBUG_FROM_STATIC(self, client, "Keep-alive connection idle for too long; "
+				"disconnecting client");
+		}
+		self->disconnect(&client);
 	}
 
 
@@ -261,6 +439,10 @@ private:
 	{
 		if (buffer.size() > 0) {
 			size_t ret;
+			if (!client->readingHeader) {
+				client->readingHeader = true;
+				armClientTimeout(client, headerReadTimeout);
+			}
 			SKC_TRACE(client, 3, "Parsing " << buffer.size() <<
 				" bytes of HTTP header: \"" << cEscapeString(StaticString(
 					buffer.start, buffer.size())) << "\"");
@@ -277,6 +459,7 @@ private:
 			SKC_TRACE(client, 2, "New request received: #" << (totalRequestsBegun + 1));
 			headerParserStatePool.destroy(req->parserState.headerParser);
 			req->parserState.headerParser = NULL;
+			this->getContext()->timerWheel.cancel(&client->timeoutTimer);
 
 			if (HttpServer::serverState == HttpServer::SHUTTING_DOWN
 			 && shouldDisconnectClientOnShutdown(client))
@@ -285,42 +468,9 @@ private:
 				return Channel::Result(buffer.size(), false);
 			}
 
-			switch (req->httpState) {
-			case Request::COMPLETE:
-				req->detectingNextRequestEarlyReadError = true;
-				onRequestBegin(client, req);
-				return Channel::Result(ret, false);
-			case Request::PARSING_BODY:
-				SKC_TRACE(client, 2, "Expecting a request body");
-				onRequestBegin(client, req);
+			if (beginRequest(client, req)) {
 				return Channel::Result(ret, false);
-			case Request::PARSING_CHUNKED_BODY:
-				SKC_TRACE(client, 2, "Expecting a chunked request body");
-				prepareChunkedBodyParsing(client, req);
-				onRequestBegin(client, req);
-				return Channel::Result(ret, false);
-			case Request::UPGRADED:
-				assert(!req->wantKeepAlive);
-				if (supportsUpgrade(client, req)) {
-					SKC_TRACE(client, 2, "Expecting connection upgrade");
-					onRequestBegin(client, req);
-					return Channel::Result(ret, false);
-				} else {
-					endWithErrorResponse(&client, &req, 422,
-						"Connection upgrading not allowed for this request");
-					return Channel::Result(0, true);
-				}
-			case Request::ERROR:
-				// Change state so that the response body will be written.
-				req->httpState = Request::COMPLETE;
-				if (req->aux.parseError == HTTP_VERSION_NOT_SUPPORTED) {
-					endWithErrorResponse(&client, &req, 505, "HTTP version not supported\n");
-				} else {
-					endAsBadRequest(&client, &req, getErrorDesc(req->aux.parseError));
-				}
-				return Channel::Result(0, true);
-			default:
-				P_BUG("Invalid request HTTP state " << (int) req->httpState);
+			} else {
 				return Channel::Result(0, true);
 			}
 		} else {
@@ -329,6 +479,52 @@ private:
 		}
 	}
 
+	/**
+	 * Begins processing a request whose header has been fully parsed.
+	 * Returns false if the request has been ended with an error response,
+	 * in which case no more data should be read from the client.
+	 */
+	bool beginRequest(Client *client, Request *req) {
+		switch (req->httpState) {
+		case Request::COMPLETE:
+			req->detectingNextRequestEarlyReadError = true;
+			onRequestBegin(client, req);
+			return true;
+		case Request::PARSING_BODY:
+			SKC_TRACE(client, 2, "Expecting a request body");
+			onRequestBegin(client, req);
+			return true;
+		case Request::PARSING_CHUNKED_BODY:
+			SKC_TRACE(client, 2, "Expecting a chunked request body");
+			prepareChunkedBodyParsing(client, req);
+			onRequestBegin(client, req);
+			return true;
+		case Request::UPGRADED:
+			assert(!req->wantKeepAlive);
+			if (supportsUpgrade(client, req)) {
+				SKC_TRACE(client, 2, "Expecting connection upgrade");
+				onRequestBegin(client, req);
+				return true;
+			} else {
+				endWithErrorResponse(&client, &req, 422,
+					"Connection upgrading not allowed for this request");
+				return false;
+			}
+		case Request::ERROR:
+			// Change state so that the response body will be written.
+			req->httpState = Request::COMPLETE;
+			if (req->aux.parseError == HTTP_VERSION_NOT_SUPPORTED) {
+				endWithErrorResponse(&client, &req, 505, "HTTP version not supported\n");
+			} else {
+				endAsBadRequest(&client, &req, getErrorDesc(req->aux.parseError));
+			}
+			return false;
+		default:
+			P_BUG("Invalid request HTTP state " << (int) req->httpState);
+			return false;
+		}
+	}
+
 	Channel::Result processClientDataWhenParsingBody(Client *client, Request *req,
 		const MemoryKit::mbuf &buffer, int errcode)
 	{
@@ -699,6 +895,8 @@ protected:
 	virtual void onClientObjectCreated(Client *client) {
 		ParentClass::onClientObjectCreated(client);
 		client->output.setDataFlushedCallback(_onClientOutputDataFlushed);
+		client->timeoutTimer.callback = onClientTimeout;
+		client->timeoutTimer.userData = client;
 	}
 
 	virtual void onClientAccepted(Client *client) {
@@ -719,6 +917,17 @@ protected:
 		if (!ended) {
 			req->lastDataReceiveTime = ev_now(this->getLoop());
 		}
+		if (OXT_UNLIKELY(client->pipelinedRequestCount > 0)) {
+			return processClientDataWhenPipelining(client, buffer, errcode);
+		} else if (req->detectingNextRequestEarlyReadError
+			&& !buffer.empty()
+			&& canParsePipelinedRequests(client, req))
+		{
+			SKC_TRACE(client, 3, "Next request received while processing "
+				"the current one; parsing it ahead");
+			req->detectingNextRequestEarlyReadError = false;
+			return processClientDataWhenPipelining(client, buffer, errcode);
+		}
 		if (detectNextRequestEarlyReadError(client, req, buffer, errcode)) {
 			return Channel::Result(0, false);
 		}
@@ -760,6 +969,7 @@ protected:
 
 	virtual void onClientDisconnecting(Client *client) {
 		ParentClass::onClientDisconnecting(client);
+		this->getContext()->timerWheel.cancel(&client->timeoutTimer);
 
 		// Handle client being disconnect()'ed without endRequest().
 
@@ -769,6 +979,7 @@ protected:
 			client->currentRequest = NULL;
 			unrefRequest(req, __FILE__, __LINE__);
 		}
+		discardPipelinedRequests(client);
 	}
 
 	virtual void deinitializeClient(Client *client) {
@@ -815,6 +1026,17 @@ protected:
 		req->bodyChannel.dataCallback = onRequestBodyChannelData;
 	}
 
+	/**
+	 * Called when a request's reference count drops to 0, right before the
+	 * request object is put into the freelist or destroyed. Unlike
+	 * deinitializeRequest(), nothing can refer to the request anymore at this
+	 * point, so this is the place to free memory that callbacks may still
+	 * touch after the request has ended.
+	 */
+	virtual void onRequestObjectReleased(Client *client, Request *req) {
+		// Do nothing.
+	}
+
 	virtual void onRequestBegin(Client *client, Request *req) {
 		totalRequestsBegun++;
 		client->requestsBegun++;
@@ -851,6 +1073,7 @@ protected:
 		ParentClass::reinitializeClient(client, fd);
 		client->requestsBegun = 0;
 		assert(client->currentRequest == NULL);
+		assert(client->pipelinedRequestCount == 0);
 	}
 
 	virtual void reinitializeRequest(Client *client, Request *req) {
@@ -935,6 +1158,9 @@ public:
 		: ParentClass(context),
 		  freeRequestCount(0),
 		  requestFreelistLimit(1024),
+		  keepAliveTimeout(0),
+		  headerReadTimeout(0),
+		  maxPipelinedRequests(16),
 		  totalRequestsBegun(0),
 		  lastTotalRequestsBegun(0),
 		  requestBeginSpeed1m(-1),
@@ -1188,11 +1414,23 @@ public:
 		if (doc.isMember("request_freelist_limit")) {
 			requestFreelistLimit = doc["request_freelist_limit"].asUInt();
 		}
+		if (doc.isMember("keepalive_timeout")) {
+			keepAliveTimeout = doc["keepalive_timeout"].asDouble();
+		}
+		if (doc.isMember("header_read_timeout")) {
+			headerReadTimeout = doc["header_read_timeout"].asDouble();
+		}
+		if (doc.isMember("max_pipelined_requests")) {
+			maxPipelinedRequests = doc["max_pipelined_requests"].asUInt();
+		}
 	}
 
 	virtual Json::Value getConfigAsJson() const {
 		Json::Value doc = ParentClass::getConfigAsJson();
 		doc["request_freelist_limit"] = requestFreelistLimit;
+		doc["keepalive_timeout"] = keepAliveTimeout;
+		doc["header_read_timeout"] = headerReadTimeout;
+		doc["max_pipelined_requests"] = maxPipelinedRequests;
 		return doc;
 	}
 
@@ -1215,6 +1453,7 @@ public:
 			doc["current_request"] = inspectRequestStateAsJson(client->currentRequest);
 		}
 		doc["requests_begun"] = client->requestsBegun;
+		doc["pipelined_request_count"] = client->pipelinedRequestCount;
 		doc["lingering_request_count"] = client->lingeringRequestCount;
 		return doc;
 	}
@@ -0,0 +1,230 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_SERVER_KIT_TIMER_WHEEL_H_
+#define _PASSENGER_SERVER_KIT_TIMER_WHEEL_H_
+
+#include <psg_sysqueue.h>
+#include <ev++.h>
+#include <cassert>
+#include <cmath>
+#include <algorithm>
+#include <oxt/macros.hpp>
+#include <jsoncpp/json.h>
+
+namespace Passenger {
+namespace ServerKit {
+
+
+/**
+ * A hashed timer wheel, for managing large numbers of coarse-grained timeouts
+ * (idle connections, stalled requests, etc) with a single libev timer.
+ *
+ * The wheel consists of SLOT_COUNT slots, each representing one `resolution`
+ * interval. Arming an entry puts it in the slot that the wheel will reach
+ * after the timeout has passed, remembering how many full revolutions must
+ * pass first. Both arming and cancelling are O(1) and never allocate memory:
+ * entries are intrusive and are usually embedded in client or request objects.
+ *
+ * Timeouts are never triggered early, and are triggered at most one
+ * `resolution` interval late. The libev timer only runs while at least one
+ * entry is armed, so an idle wheel causes no wakeups.
+ *
+ * Not thread-safe; must only be used from the event loop thread.
+ */
+class TimerWheel {
+public:
+	static const unsigned int SLOT_COUNT = 256;
+
+	struct Entry;
+	typedef void (*Callback)(Entry *entry);
+
+	struct Entry {
+		TAILQ_ENTRY(Entry) next;
+		Callback callback;
+		void *userData;
+		unsigned int rounds;
+		/**
+		 * SLOT_COUNT if not armed. EXPIRED_SLOT if it has expired and is
+		 * waiting in the expired list for its callback to be called.
+		 */
+		unsigned int slot;
+
+		Entry()
+			: callback(NULL),
+			  userData(NULL),
+			  rounds(0),
+			  slot(SLOT_COUNT)
+			{ }
+
+		bool armed() const {
+			return slot != SLOT_COUNT;
+		}
+	};
+
+private:
+	TAILQ_HEAD(EntryList, Entry);
+
+	static const unsigned int EXPIRED_SLOT = SLOT_COUNT + 1;
+
+	struct ev_loop *loop;
+	ev::timer watcher;
+	EntryList slots[SLOT_COUNT];
+	/**
+	 * Entries that expired during the current tick and whose callbacks
+	 * haven't been called yet. A member rather than a local so that
+	 * `cancel()` can unlink them when a callback cancels or re-arms one
+	 * of its siblings.
+	 */
+	EntryList expired;
+	ev_tstamp resolution;
+	ev_tstamp lastTickTime;
+	unsigned int currentSlot;
+	unsigned int nArmed;
+	unsigned long long nTriggered;
+
+	void onTick(ev::timer &timer, int revents) {
+		EntryList *list;
+		Entry *entry, *nextEntry;
+
+		currentSlot = (currentSlot + 1) % SLOT_COUNT;
+		lastTickTime = ev_now(loop);
+		list = &slots[currentSlot];
+
+		// Move expired entries out of the slot first, so that callbacks
+		// are free to arm and cancel entries.
+		for (entry = TAILQ_FIRST(list); entry != NULL; entry = nextEntry) {
+			nextEntry = TAILQ_NEXT(entry, next);
+			if (entry->rounds > 0) {
+				entry->rounds--;
+			} else {
+				TAILQ_REMOVE(list, entry, next);
+				TAILQ_INSERT_TAIL(&expired, entry, next);
+				entry->slot = EXPIRED_SLOT;
+			}
+		}
+
+		while (!TAILQ_EMPTY(&expired)) {
+			entry = TAILQ_FIRST(&expired);
+			TAILQ_REMOVE(&expired, entry, next);
+			entry->slot = SLOT_COUNT;
+			nArmed--;
+			nTriggered++;
+			entry->callback(entry);
+		}
+
+		if (nArmed == 0) {
+			watcher.stop();
+		}
+	}
+
+public:
+	TimerWheel(struct ev_loop *_loop, ev_tstamp _resolution = 0.5)
+		: loop(_loop),
+		  resolution(_resolution),
+		  lastTickTime(0),
+		  currentSlot(0),
+		  nArmed(0),
+		  nTriggered(0)
+	{
+		for (unsigned int i = 0; i < SLOT_COUNT; i++) {
+			TAILQ_INIT(&slots[i]);
+		}
+		TAILQ_INIT(&expired);
+		watcher.set(loop);
+		watcher.set<TimerWheel, &TimerWheel::onTick>(this);
+	}
+
+	/**
+	 * Arms the given entry, so that its callback is called after `timeout`
+	 * seconds. If the entry is already armed then it is rescheduled.
+	 */
+	void arm(Entry *entry, ev_tstamp timeout) {
+		assert(entry->callback != NULL);
+		if (entry->armed()) {
+			cancel(entry);
+		}
+
+		if (nArmed == 0) {
+			lastTickTime = ev_now(loop);
+			watcher.start(resolution, resolution);
+		}
+
+		// Account for the part of the current interval that has already elapsed.
+		ev_tstamp elapsed = std::max(ev_now(loop) - lastTickTime, 0.0);
+		unsigned long long ticks = (unsigned long long) ceil((timeout + elapsed) / resolution);
+		if (ticks == 0) {
+			ticks = 1;
+		}
+		entry->slot = (unsigned int) ((currentSlot + ticks) % SLOT_COUNT);
+		entry->rounds = (unsigned int) ((ticks - 1) / SLOT_COUNT);
+		TAILQ_INSERT_TAIL(&slots[entry->slot], entry, next);
+		nArmed++;
+	}
+
+	/** Cancels the given entry. Does nothing if it's not armed. */
+	void cancel(Entry *entry) {
+		if (entry->armed()) {
+			if (entry->slot == EXPIRED_SLOT) {
+				TAILQ_REMOVE(&expired, entry, next);
+			} else {
+				TAILQ_REMOVE(&slots[entry->slot], entry, next);
+			}
+			entry->slot = SLOT_COUNT;
+			nArmed--;
+			if (nArmed == 0) {
+				watcher.stop();
+			}
+		}
+	}
+
+	ev_tstamp getResolution() const {
+		return resolution;
+	}
+
+	/** Changes the resolution. Only allowed while no entries are armed. */
+	void setResolution(ev_tstamp value) {
+		assert(nArmed == 0);
+		resolution = value;
+	}
+
+	unsigned int getArmedCount() const {
+		return nArmed;
+	}
+
+	Json::Value inspectStateAsJson() const {
+		Json::Value doc;
+		doc["resolution"] = resolution;
+		doc["armed"] = nArmed;
+		doc["triggered"] = (Json::UInt64) nTriggered;
+		return doc;
+	}
+};
+
+
+} // namespace ServerKit
+} // namespace Passenger
+
+#endif /* _PASSENGER_SERVER_KIT_TIMER_WHEEL_H_ */
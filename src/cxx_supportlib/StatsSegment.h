@@ -0,0 +1,422 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_STATS_SEGMENT_H_
+#define _PASSENGER_STATS_SEGMENT_H_
+
+#include <boost/atomic.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/static_assert.hpp>
+#include <oxt/system_calls.hpp>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+#include <string>
+#include <Exceptions.h>
+#include <StaticString.h>
+#include <Utils/StrIntUtils.h>
+#include <Utils/SystemTime.h>
+
+namespace Passenger {
+
+using namespace std;
+using namespace oxt;
+
+
+/*
+ * A fixed-size, memory-mappable file through which the Core publishes
+ * pool, group, process and controller counters. External tools can read
+ * it at any frequency without talking to the Core at all: no connection,
+ * no serialization and no Pool lock.
+ *
+ * Consistency is provided by a sequence lock. The writer increments
+ * `StatsSegmentHeader::sequence` to an odd value before it modifies the
+ * data, and to an even value afterwards. A reader copies the data and
+ * retries if the sequence number was odd or changed during the copy.
+ * Readers therefore never block the writer.
+ *
+ * The layout is versioned through `STATS_SEGMENT_VERSION`. Any change to
+ * the structures below must increment it; readers refuse files with a
+ * different version or size.
+ */
+
+#define STATS_SEGMENT_MAGIC "PSGSTATS"
+#define STATS_SEGMENT_VERSION 1
+#define STATS_SEGMENT_MAX_GROUPS 64
+#define STATS_SEGMENT_MAX_PROCESSES 1024
+#define STATS_SEGMENT_GROUP_NAME_SIZE 128
+
+// The sequence number lives in memory that is shared between processes,
+// which is only safe if the atomic does not use a lock.
+BOOST_STATIC_ASSERT(BOOST_ATOMIC_INT32_LOCK_FREE == 2);
+
+
+struct StatsSegmentHeader {
+	char magic[8];
+	boost::uint32_t version;
+	/** Size of the entire file. */
+	boost::uint32_t size;
+	/** PID of the writer. */
+	boost::int32_t pid;
+	boost::atomic<boost::uint32_t> sequence;
+	/** Keeps the data off the cache line that `sequence` lives in. */
+	char reserved[40];
+};
+
+struct StatsSegmentProcess {
+	enum LifeStatus {
+		ALIVE,
+		SHUTDOWN_TRIGGERED,
+		DEAD
+	};
+
+	enum EnabledStatus {
+		ENABLED,
+		DISABLING,
+		DISABLED,
+		DETACHED
+	};
+
+	boost::int32_t pid;
+	/** Index into `StatsSegmentData::groups`. */
+	boost::uint32_t groupIndex;
+	boost::int32_t concurrency;
+	boost::int32_t sessions;
+	boost::int32_t busyness;
+	boost::uint32_t processed;
+	/** In microseconds since the Epoch. */
+	boost::uint64_t spawnEndTime;
+	boost::uint64_t lastUsed;
+	/** In KB. -1 if not yet known. */
+	boost::int64_t rss;
+	/** CPU usage percentage. -1 if not yet known. */
+	boost::int32_t cpu;
+	boost::uint8_t lifeStatus;
+	boost::uint8_t enabled;
+	boost::uint8_t reserved[2];
+};
+
+struct StatsSegmentGroup {
+	enum LifeStatus {
+		ALIVE,
+		SHUTTING_DOWN,
+		SHUT_DOWN
+	};
+
+	/** NUL-terminated. Truncated if it doesn't fit. */
+	char name[STATS_SEGMENT_GROUP_NAME_SIZE];
+	boost::uint32_t enabledCount;
+	boost::uint32_t disablingCount;
+	boost::uint32_t disabledCount;
+	boost::uint32_t capacityUsed;
+	boost::uint32_t getWaitlistSize;
+	boost::uint32_t disableWaitlistSize;
+	boost::uint32_t processesBeingSpawned;
+	/** The number of entries in `StatsSegmentData::processes` that belong
+	 * to this group.
+	 */
+	boost::uint32_t processCount;
+	/** Requests handled by this group, summed over all Controllers,
+	 * and their total duration in microseconds. Both only ever increase,
+	 * so monitors can derive rates and mean durations from two samples.
+	 */
+	boost::uint64_t requestsHandled;
+	boost::uint64_t requestDurationSum;
+	boost::uint8_t lifeStatus;
+	boost::uint8_t spawning;
+	boost::uint8_t restarting;
+	boost::uint8_t reserved[5];
+};
+
+struct StatsSegmentData {
+	/** When this data was published, in microseconds since the Epoch. */
+	boost::uint64_t updatedAt;
+	/** Incremented every time this data is published. */
+	boost::uint64_t updateCount;
+
+	boost::uint32_t poolMax;
+	boost::uint32_t poolProcessCount;
+	boost::uint32_t poolCapacityUsed;
+	boost::uint32_t poolGetWaitlistSize;
+
+	/** Summed over all Controllers. */
+	boost::uint64_t totalRequestsBegun;
+	boost::uint32_t controllerCount;
+	boost::uint32_t activeClients;
+	boost::uint32_t turboCacheFetches;
+	boost::uint32_t turboCacheHits;
+	boost::uint32_t mbufFreeBlocks;
+	boost::uint32_t mbufActiveBlocks;
+
+	/** The number of valid entries in `groups` and `processes`. Groups
+	 * and processes that don't fit are counted in the `omitted` fields.
+	 * Processes are stored grouped by group, in the order of `groups`.
+	 */
+	boost::uint32_t groupCount;
+	boost::uint32_t processCount;
+	boost::uint32_t groupsOmitted;
+	boost::uint32_t processesOmitted;
+
+	StatsSegmentGroup groups[STATS_SEGMENT_MAX_GROUPS];
+	StatsSegmentProcess processes[STATS_SEGMENT_MAX_PROCESSES];
+};
+
+struct StatsSegment {
+	StatsSegmentHeader header;
+	StatsSegmentData data;
+};
+
+BOOST_STATIC_ASSERT(sizeof(StatsSegmentHeader) == 64);
+BOOST_STATIC_ASSERT(sizeof(StatsSegmentProcess) == 56);
+BOOST_STATIC_ASSERT(sizeof(StatsSegmentGroup) == 184);
+
+
+inline void
+setStatsSegmentGroupName(StatsSegmentGroup &group, const StaticString &name) {
+	size_t size = std::min<size_t>(name.size(), STATS_SEGMENT_GROUP_NAME_SIZE - 1);
+	memcpy(group.name, name.data(), size);
+	group.name[size] = '\0';
+}
+
+
+/**
+ * Creates a stats segment file and publishes data into it. Only one
+ * StatsSegmentWriter may exist per file. Not thread-safe.
+ *
+ * The file is first created under a temporary name and then renamed into
+ * place, so readers never see a partially initialized file. It is removed
+ * when the writer is destroyed.
+ */
+class StatsSegmentWriter {
+private:
+	string path;
+	StatsSegment *segment;
+	boost::uint32_t sequence;
+
+public:
+	StatsSegmentWriter(const string &_path, mode_t mode = S_IRUSR | S_IWUSR)
+		: path(_path),
+		  segment(NULL),
+		  sequence(0)
+	{
+		string tmpPath = path + ".tmp";
+		int fd, e;
+
+		fd = syscalls::open(tmpPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, mode);
+		if (fd == -1) {
+			e = errno;
+			throw FileSystemException("Cannot create stats segment file " + tmpPath,
+				e, tmpPath);
+		}
+		if (ftruncate(fd, sizeof(StatsSegment)) == -1) {
+			e = errno;
+			syscalls::close(fd);
+			syscalls::unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot resize stats segment file " + tmpPath,
+				e, tmpPath);
+		}
+
+		void *addr = mmap(NULL, sizeof(StatsSegment), PROT_READ | PROT_WRITE,
+			MAP_SHARED, fd, 0);
+		e = errno;
+		syscalls::close(fd);
+		if (addr == MAP_FAILED) {
+			syscalls::unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot map stats segment file " + tmpPath,
+				e, tmpPath);
+		}
+		segment = (StatsSegment *) addr;
+
+		// ftruncate() zero-filled the file, so only the header needs
+		// to be set.
+		memcpy(segment->header.magic, STATS_SEGMENT_MAGIC, sizeof(segment->header.magic));
+		segment->header.version = STATS_SEGMENT_VERSION;
+		segment->header.size = sizeof(StatsSegment);
+		segment->header.pid = getpid();
+		segment->header.sequence.store(0, boost::memory_order_release);
+
+		if (rename(tmpPath.c_str(), path.c_str()) == -1) {
+			e = errno;
+			munmap(segment, sizeof(StatsSegment));
+			syscalls::unlink(tmpPath.c_str());
+			throw FileSystemException("Cannot rename stats segment file " + tmpPath,
+				e, tmpPath);
+		}
+	}
+
+	~StatsSegmentWriter() {
+		syscalls::unlink(path.c_str());
+		munmap(segment, sizeof(StatsSegment));
+	}
+
+	const string &getPath() const {
+		return path;
+	}
+
+	/**
+	 * Copies `data` into the segment. `updatedAt` and `updateCount` are
+	 * set by this method.
+	 */
+	void publish(const StatsSegmentData &data) {
+		StatsSegmentHeader &header = segment->header;
+
+		header.sequence.store(++sequence, boost::memory_order_relaxed);
+		boost::atomic_thread_fence(boost::memory_order_release);
+
+		boost::uint64_t updateCount = segment->data.updateCount;
+		memcpy(&segment->data, &data, sizeof(StatsSegmentData));
+		segment->data.updatedAt = SystemTime::getUsec();
+		segment->data.updateCount = updateCount + 1;
+
+		header.sequence.store(++sequence, boost::memory_order_release);
+	}
+
+	/**
+	 * Marks the segment as being written to without finishing the write.
+	 * Used by unit tests to simulate a writer that got descheduled, or
+	 * that crashed, halfway through an update.
+	 */
+	void beginPublishingForever() {
+		segment->header.sequence.store(++sequence, boost::memory_order_relaxed);
+		boost::atomic_thread_fence(boost::memory_order_release);
+	}
+};
+
+
+/**
+ * Maps a stats segment file read-only and takes consistent snapshots
+ * of its data. Reading a snapshot involves no system calls. A single
+ * StatsSegmentReader is not thread-safe, but any number of readers, in
+ * any number of processes, may read the same file.
+ */
+class StatsSegmentReader {
+private:
+	string path;
+	const StatsSegment *segment;
+
+public:
+	/**
+	 * @throws FileSystemException The file cannot be opened or mapped.
+	 * @throws RuntimeException The file is not a stats segment, or one
+	 *   with a different layout version.
+	 */
+	StatsSegmentReader(const string &_path)
+		: path(_path),
+		  segment(NULL)
+	{
+		struct stat buf;
+		int fd, e;
+
+		fd = syscalls::open(path.c_str(), O_RDONLY);
+		if (fd == -1) {
+			e = errno;
+			throw FileSystemException("Cannot open stats segment file " + path,
+				e, path);
+		}
+		if (fstat(fd, &buf) == -1) {
+			e = errno;
+			syscalls::close(fd);
+			throw FileSystemException("Cannot stat stats segment file " + path,
+				e, path);
+		}
+		if (buf.st_size < (off_t) sizeof(StatsSegmentHeader)) {
+			syscalls::close(fd);
+			throw RuntimeException(path + " is not a stats segment file");
+		}
+
+		void *addr = mmap(NULL, buf.st_size, PROT_READ, MAP_SHARED, fd, 0);
+		e = errno;
+		syscalls::close(fd);
+		if (addr == MAP_FAILED) {
+			throw FileSystemException("Cannot map stats segment file " + path,
+				e, path);
+		}
+
+		const StatsSegmentHeader *header = (const StatsSegmentHeader *) addr;
+		if (memcmp(header->magic, STATS_SEGMENT_MAGIC, sizeof(header->magic)) != 0) {
+			munmap(addr, buf.st_size);
+			throw RuntimeException(path + " is not a stats segment file");
+		}
+		if (header->version != STATS_SEGMENT_VERSION
+		 || header->size != sizeof(StatsSegment)
+		 || buf.st_size != (off_t) sizeof(StatsSegment))
+		{
+			unsigned int version = header->version;
+			munmap(addr, buf.st_size);
+			throw RuntimeException("Stats segment file " + path + " has layout version "
+				+ toString(version) + ", but this program only supports version "
+				+ toString(STATS_SEGMENT_VERSION));
+		}
+		segment = (const StatsSegment *) addr;
+	}
+
+	~StatsSegmentReader() {
+		munmap((void *) segment, sizeof(StatsSegment));
+	}
+
+	const string &getPath() const {
+		return path;
+	}
+
+	pid_t getWriterPid() const {
+		return segment->header.pid;
+	}
+
+	/**
+	 * Copies a consistent snapshot of the data into `result`. Retries while
+	 * the writer is busy. Returns false if no consistent snapshot could be
+	 * obtained within `maxTries` attempts, e.g. because the writer crashed
+	 * in the middle of an update.
+	 */
+	bool read(StatsSegmentData &result, unsigned int maxTries = 100000) const {
+		const StatsSegmentHeader &header = segment->header;
+
+		for (unsigned int i = 0; i < maxTries; i++) {
+			boost::uint32_t before = header.sequence.load(boost::memory_order_acquire);
+			if (before % 2 == 1) {
+				continue;
+			}
+
+			memcpy(&result, &segment->data, sizeof(StatsSegmentData));
+			boost::atomic_thread_fence(boost::memory_order_acquire);
+
+			if (header.sequence.load(boost::memory_order_relaxed) == before) {
+				return true;
+			}
+		}
+		return false;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_STATS_SEGMENT_H_ */
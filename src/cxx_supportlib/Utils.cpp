@@ -57,6 +57,7 @@
 #include <Exceptions.h>
 #include <Utils.h>
 #include <Utils/CachedFileStat.hpp>
+#include <Utils/ConcurrentCachedFileStat.hpp>
 #include <Utils/StrIntUtils.h>
 #include <Utils/IOUtils.h>
 
@@ -116,22 +117,8 @@ fileExists(const StaticString &filename, CachedFileStat *cstat, boost::mutex *cs
 	return getFileType(filename, cstat, cstatMutex, throttleRate) == FT_REGULAR;
 }
 
-FileType
-getFileType(const StaticString &filename, CachedFileStat *cstat, boost::mutex *cstatMutex,
-	unsigned int throttleRate)
-{
-	struct stat buf;
-	int ret;
-
-	if (cstat != NULL) {
-		boost::unique_lock<boost::mutex> l;
-		if (cstatMutex != NULL) {
-			l = boost::unique_lock<boost::mutex>(*cstatMutex);
-		}
-		ret = cstat->stat(filename, &buf, throttleRate);
-	} else {
-		ret = stat(filename.c_str(), &buf);
-	}
+static FileType
+statResultToFileType(const StaticString &filename, int ret, const struct stat &buf) {
 	if (ret == 0) {
 		if (S_ISREG(buf.st_mode)) {
 			return FT_REGULAR;
@@ -153,6 +140,34 @@ getFileType(const StaticString &filename, CachedFileStat *cstat, boost::mutex *c
 	}
 }
 
+FileType
+getFileType(const StaticString &filename, CachedFileStat *cstat, boost::mutex *cstatMutex,
+	unsigned int throttleRate)
+{
+	struct stat buf;
+	int ret;
+
+	if (cstat != NULL) {
+		boost::unique_lock<boost::mutex> l;
+		if (cstatMutex != NULL) {
+			l = boost::unique_lock<boost::mutex>(*cstatMutex);
+		}
+		ret = cstat->stat(filename, &buf, throttleRate);
+	} else {
+		ret = stat(filename.c_str(), &buf);
+	}
+	return statResultToFileType(filename, ret, buf);
+}
+
+FileType
+getFileType(const StaticString &filename, ConcurrentCachedFileStat *cstat,
+	unsigned int throttleRate)
+{
+	struct stat buf;
+	int ret = cstat->stat(filename, &buf, throttleRate);
+	return statResultToFileType(filename, ret, buf);
+}
+
 void
 createFile(const string &filename, const StaticString &contents, mode_t permissions, uid_t owner,
 	gid_t group, bool overwrite)
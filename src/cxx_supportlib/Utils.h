@@ -57,6 +57,7 @@ static const uid_t USER_NOT_GIVEN = (uid_t) -1;
 static const gid_t GROUP_NOT_GIVEN = (gid_t) -1;
 
 class CachedFileStat;
+class ConcurrentCachedFileStat;
 class ResourceLocator;
 
 /** Enumeration which indicates what kind of file a file is. */
@@ -128,6 +129,18 @@ bool fileExists(const StaticString &filename, CachedFileStat *cstat = 0,
 FileType getFileType(const StaticString &filename, CachedFileStat *cstat = 0,
                      boost::mutex *cstatMutex = NULL, unsigned int throttleRate = 0);
 
+/**
+ * Like `getFileType()`, but uses a ConcurrentCachedFileStat, which needs no
+ * external lock.
+ *
+ * @throws FileSystemException Unable to check because of a filesystem error.
+ * @throws TimeRetrievalException
+ * @throws boost::thread_interrupted
+ * @ingroup Support
+ */
+FileType getFileType(const StaticString &filename, ConcurrentCachedFileStat *cstat,
+                     unsigned int throttleRate);
+
 /**
  * Create the given file with the given contents, permissions and ownership.
  * This function does not leave behind junk files: if the ownership cannot be set
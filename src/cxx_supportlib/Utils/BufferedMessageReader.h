@@ -0,0 +1,266 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_BUFFERED_MESSAGE_READER_H_
+#define _PASSENGER_BUFFERED_MESSAGE_READER_H_
+
+// For ntohl/ntohs.
+#include <sys/types.h>
+#include <arpa/inet.h>
+#include <netinet/in.h>
+
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/system_calls.hpp>
+#include <oxt/macros.hpp>
+#include <algorithm>
+#include <string>
+#include <new>
+#include <climits>
+#include <cstdlib>
+#include <cstring>
+#include <cerrno>
+
+#include <StaticString.h>
+#include <Exceptions.h>
+#include <Utils/IOUtils.h>
+
+namespace Passenger {
+
+using namespace std;
+using namespace oxt;
+
+
+/**
+ * Reads array messages and scalar messages, as defined in MessageIO.h, from
+ * a file descriptor. Unlike readArrayMessage() and readScalarMessage(), which
+ * read the size header and the body with separate read() calls, this class
+ * reads as much data as is available into a reusable buffer, so that a
+ * message usually takes a single read() call, and multiple pipelined messages
+ * may take only one read() call in total. The message contents are returned
+ * as StaticStrings that point into the buffer, so no copies are made.
+ *
+ * Because it reads ahead, this class must be the only one that reads from
+ * the file descriptor, and file descriptors must not be passed over it:
+ * a read-ahead may consume the data that a file descriptor is attached to.
+ *
+ * The returned StaticStrings are only valid until the next read method call.
+ *
+ * Not thread-safe.
+ */
+class BufferedMessageReader: public boost::noncopyable {
+private:
+	int fd;
+	char *buffer;
+	unsigned int capacity;
+	unsigned int start;
+	unsigned int end;
+
+	/**
+	 * Makes room for `needed` bytes, counted from `start`, by moving the
+	 * buffered data to the beginning of the buffer and by growing it.
+	 */
+	void makeRoom(unsigned int needed) {
+		if (start > 0) {
+			memmove(buffer, buffer + start, end - start);
+			end -= start;
+			start = 0;
+		}
+		if (capacity < needed) {
+			unsigned int newCapacity = std::max(needed, capacity * 2);
+			char *newBuffer = (char *) realloc(buffer, newCapacity);
+			if (newBuffer == NULL) {
+				throw std::bad_alloc();
+			}
+			buffer = newBuffer;
+			capacity = newCapacity;
+		}
+	}
+
+	/**
+	 * Ensures that at least `needed` bytes are buffered.
+	 *
+	 * @return False if EOF was reached first.
+	 */
+	bool fill(unsigned int needed, unsigned long long *timeout) {
+		if (start == end) {
+			start = end = 0;
+		}
+		if (capacity - start < needed) {
+			makeRoom(needed);
+		}
+
+		while (end - start < needed) {
+			if (OXT_UNLIKELY(timeout != NULL && !waitUntilReadable(fd, timeout))) {
+				throw TimeoutException("Cannot read enough data within the specified timeout");
+			}
+			ssize_t ret = syscalls::read(fd, buffer + end, capacity - end);
+			if (ret == -1) {
+				int e = errno;
+				throw SystemException("read() failed", e);
+			} else if (ret == 0) {
+				return false;
+			} else {
+				end += ret;
+			}
+		}
+		return true;
+	}
+
+	void clearBuffer() {
+		if (buffer != NULL) {
+			memset(buffer, 0, end);
+		}
+		start = end = 0;
+	}
+
+public:
+	static const unsigned int DEFAULT_INITIAL_CAPACITY = 1024 * 16;
+
+	BufferedMessageReader(int _fd = -1, unsigned int initialCapacity = DEFAULT_INITIAL_CAPACITY)
+		: fd(_fd),
+		  buffer((char *) malloc(initialCapacity)),
+		  capacity(initialCapacity),
+		  start(0),
+		  end(0)
+	{
+		if (buffer == NULL) {
+			throw std::bad_alloc();
+		}
+	}
+
+	~BufferedMessageReader() {
+		// The buffer may contain passwords.
+		clearBuffer();
+		free(buffer);
+	}
+
+	/**
+	 * Starts reading from another file descriptor, discarding any
+	 * buffered data.
+	 */
+	void reset(int newFd) {
+		clearBuffer();
+		fd = newFd;
+	}
+
+	int getFd() const {
+		return fd;
+	}
+
+	/** The number of bytes that have been read ahead, but not consumed yet. */
+	unsigned int getBufferedSize() const {
+		return end - start;
+	}
+
+	unsigned int getCapacity() const {
+		return capacity;
+	}
+
+	/**
+	 * Reads an array message. Each element is added to `output` as a
+	 * StaticString (or something constructible from one) that points
+	 * into the buffer.
+	 *
+	 * @param timeout Like readArrayMessage() in MessageIO.h.
+	 * @return True if an array message was read, false if end-of-file was reached
+	 *         before a full array message could be read.
+	 * @throws SystemException Something went wrong.
+	 * @throws TimeoutException Unable to read the necessary data within
+	 *                          <tt>timeout</tt> microseconds.
+	 * @throws boost::thread_interrupted
+	 */
+	template<typename Collection>
+	bool readArrayMessage(Collection &output, unsigned long long *timeout = NULL) {
+		boost::uint16_t size;
+
+		if (!fill(sizeof(size), timeout)) {
+			return false;
+		}
+		memcpy(&size, buffer + start, sizeof(size));
+		size = ntohs(size);
+		if (!fill(sizeof(size) + size, timeout)) {
+			return false;
+		}
+
+		const char *body = buffer + start + sizeof(size);
+		const char *bodyEnd = body + size;
+		start += sizeof(size) + size;
+
+		output.clear();
+		while (body < bodyEnd) {
+			const char *terminator = (const char *) memchr(body, '\0', bodyEnd - body);
+			if (terminator == NULL) {
+				break;
+			}
+			output.push_back(StaticString(body, terminator - body));
+			body = terminator + 1;
+		}
+		return true;
+	}
+
+	/**
+	 * Reads a scalar message. `output` is set to a StaticString that
+	 * points into the buffer.
+	 *
+	 * @param maxSize Like readScalarMessage() in MessageIO.h.
+	 * @param timeout Like readScalarMessage() in MessageIO.h.
+	 * @return True if a scalar message was read, false if EOF was encountered.
+	 * @throws SystemException Something went wrong.
+	 * @throws SecurityException The message body is larger than allowed by maxSize.
+	 * @throws TimeoutException Unable to read the necessary data within
+	 *                          <tt>timeout</tt> microseconds.
+	 * @throws boost::thread_interrupted
+	 */
+	bool readScalarMessage(StaticString &output, unsigned int maxSize = 0,
+		unsigned long long *timeout = NULL)
+	{
+		boost::uint32_t size;
+
+		if (!fill(sizeof(size), timeout)) {
+			return false;
+		}
+		memcpy(&size, buffer + start, sizeof(size));
+		size = ntohl(size);
+		if (maxSize != 0 && size > (boost::uint32_t) maxSize) {
+			throw SecurityException("The scalar message body is larger than the size limit");
+		}
+		if (OXT_UNLIKELY(size > (boost::uint32_t) (UINT_MAX - sizeof(size)))) {
+			throw SecurityException("The scalar message body is too large");
+		}
+		if (!fill(sizeof(size) + size, timeout)) {
+			return false;
+		}
+
+		output = StaticString(buffer + start + sizeof(size), size);
+		start += sizeof(size) + size;
+		return true;
+	}
+};
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_BUFFERED_MESSAGE_READER_H_ */
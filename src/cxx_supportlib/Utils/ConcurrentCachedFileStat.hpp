@@ -0,0 +1,346 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_CONCURRENT_CACHED_FILE_STAT_HPP_
+#define _PASSENGER_CONCURRENT_CACHED_FILE_STAT_HPP_
+
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <limits.h>
+#include <time.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+#include <boost/thread.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/noncopyable.hpp>
+#include <oxt/system_calls.hpp>
+#include <oxt/macros.hpp>
+
+#include <StaticString.h>
+#include <Utils/SystemTime.h>
+
+namespace Passenger {
+
+using namespace std;
+using namespace oxt;
+
+
+/**
+ * A CachedFileStat that may be used by many threads at the same time, such
+ * as by all worker threads of an Apache process.
+ *
+ * The cache is split into a fixed number of shards, each with its own lock,
+ * so that threads statting different files rarely contend. The lock is never
+ * held while calling stat(). Every shard preallocates its entries and indexes
+ * them with an open addressing hash table, so that lookups don't allocate
+ * memory. When a shard is full, an entry is evicted with the CLOCK algorithm,
+ * which approximates LRU without having to reorder anything on a cache hit.
+ *
+ * Unlike CachedFileStat, the cache size is fixed, and is not exactly LRU.
+ */
+class ConcurrentCachedFileStat: public boost::noncopyable {
+private:
+	static const unsigned int SHARD_BITS = 4;
+	static const unsigned int SHARD_COUNT = 1 << SHARD_BITS;
+
+	struct Entry {
+		string filename;
+		boost::uint32_t hash;
+		bool referenced;
+		int lastResult;
+		int lastErrno;
+		time_t lastTime;
+		struct stat info;
+	};
+
+	struct Shard {
+		boost::mutex syncher;
+		/**
+		 * Open addressing table with linear probing. Contains indices into
+		 * `entries`, or -1 for empty slots. It's at least twice as large as
+		 * `entries`, and its size is a power of 2.
+		 */
+		vector<int> index;
+		vector<Entry> entries;
+		unsigned int count;
+		unsigned int clockHand;
+		/** Lookups that were answered from the cache, and those that called stat(). */
+		unsigned long long hits;
+		unsigned long long misses;
+		// Keeps the locks of adjacent shards in different cache lines.
+		char padding[64];
+	};
+
+	Shard shards[SHARD_COUNT];
+
+	static boost::uint32_t hashFilename(const StaticString &filename) {
+		// FNV-1a
+		boost::uint32_t hash = 2166136261u;
+		const char *data = filename.data();
+		const char *end = data + filename.size();
+		while (data < end) {
+			hash ^= (unsigned char) *data;
+			hash *= 16777619u;
+			data++;
+		}
+		return hash;
+	}
+
+	Shard &getShard(boost::uint32_t hash) {
+		return shards[hash >> (32 - SHARD_BITS)];
+	}
+
+	/** Returns the index table slot for the given file, or -1 if it's not cached. */
+	static int lookup(const Shard &shard, boost::uint32_t hash, const StaticString &filename) {
+		unsigned int mask = shard.index.size() - 1;
+		unsigned int i = hash & mask;
+
+		while (shard.index[i] != -1) {
+			const Entry &entry = shard.entries[shard.index[i]];
+			if (entry.hash == hash && filename == entry.filename) {
+				return i;
+			}
+			i = (i + 1) & mask;
+		}
+		return -1;
+	}
+
+	/**
+	 * Removes the given slot from the index table, moving subsequent
+	 * entries of the same probe sequence back so that lookups still find them.
+	 */
+	static void removeFromIndex(Shard &shard, unsigned int i) {
+		unsigned int mask = shard.index.size() - 1;
+		unsigned int j = i;
+
+		while (true) {
+			j = (j + 1) & mask;
+			if (shard.index[j] == -1) {
+				break;
+			}
+
+			unsigned int home = shard.entries[shard.index[j]].hash & mask;
+			bool inPlace = (i <= j)
+				? (i < home && home <= j)
+				: (i < home || home <= j);
+			if (!inPlace) {
+				shard.index[i] = shard.index[j];
+				i = j;
+			}
+		}
+		shard.index[i] = -1;
+	}
+
+	static Entry &insert(Shard &shard, boost::uint32_t hash, const StaticString &filename) {
+		unsigned int entryIndex;
+
+		if (shard.count < shard.entries.size()) {
+			entryIndex = shard.count;
+			shard.count++;
+		} else {
+			// CLOCK: skip over (and clear) recently referenced entries.
+			while (shard.entries[shard.clockHand].referenced) {
+				shard.entries[shard.clockHand].referenced = false;
+				shard.clockHand = (shard.clockHand + 1) % shard.entries.size();
+			}
+			entryIndex = shard.clockHand;
+			shard.clockHand = (shard.clockHand + 1) % shard.entries.size();
+
+			Entry &victim = shard.entries[entryIndex];
+			removeFromIndex(shard, lookup(shard, victim.hash, victim.filename));
+		}
+
+		Entry &entry = shard.entries[entryIndex];
+		entry.filename.assign(filename.data(), filename.size());
+		entry.hash = hash;
+		entry.referenced = false;
+		entry.lastResult = -1;
+		entry.lastErrno = 0;
+		entry.lastTime = 0;
+		memset(&entry.info, 0, sizeof(struct stat));
+
+		unsigned int mask = shard.index.size() - 1;
+		unsigned int i = hash & mask;
+		while (shard.index[i] != -1) {
+			i = (i + 1) & mask;
+		}
+		shard.index[i] = entryIndex;
+		return entry;
+	}
+
+public:
+	/**
+	 * @param maxSize The maximum number of files to cache. Must be at least 1.
+	 */
+	ConcurrentCachedFileStat(unsigned int maxSize = 1024) {
+		unsigned int entriesPerShard = (maxSize + SHARD_COUNT - 1) / SHARD_COUNT;
+		unsigned int indexSize = 2;
+
+		if (entriesPerShard == 0) {
+			entriesPerShard = 1;
+		}
+		while (indexSize < entriesPerShard * 2) {
+			indexSize *= 2;
+		}
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			shards[i].index.resize(indexSize, -1);
+			shards[i].entries.resize(entriesPerShard);
+			shards[i].count = 0;
+			shards[i].clockHand = 0;
+			shards[i].hits = 0;
+			shards[i].misses = 0;
+		}
+	}
+
+	/**
+	 * Stats the given file, with the same semantics as `CachedFileStat::stat()`.
+	 * Thread-safe.
+	 *
+	 * @throws TimeRetrievalException Something went wrong while retrieving the
+	 *         system time. stat() errors will <em>not</em> result in an exception.
+	 * @throws boost::thread_interrupted
+	 */
+	int stat(const StaticString &filename, struct stat *buf, unsigned int throttleRate = 0) {
+		char path[PATH_MAX + 1];
+		int ret, e;
+
+		if (OXT_UNLIKELY(filename.size() > PATH_MAX)) {
+			errno = ENAMETOOLONG;
+			return -1;
+		}
+		memcpy(path, filename.data(), filename.size());
+		path[filename.size()] = '\0';
+		if (throttleRate == 0) {
+			return syscalls::stat(path, buf);
+		}
+
+		boost::uint32_t hash = hashFilename(filename);
+		Shard &shard = getShard(hash);
+		time_t currentTime = SystemTime::get();
+
+		{
+			boost::lock_guard<boost::mutex> l(shard.syncher);
+			int slot = lookup(shard, hash, filename);
+			if (slot != -1) {
+				Entry &entry = shard.entries[shard.index[slot]];
+				entry.referenced = true;
+				if ((unsigned int) (currentTime - entry.lastTime) < throttleRate) {
+					shard.hits++;
+					*buf = entry.info;
+					errno = entry.lastErrno;
+					return entry.lastResult;
+				}
+			}
+		}
+
+		// Other threads may stat the same file at the same time. That's
+		// harmless, and better than blocking the shard during a slow stat().
+		struct stat info;
+		ret = syscalls::stat(path, &info);
+		e = errno;
+
+		{
+			boost::lock_guard<boost::mutex> l(shard.syncher);
+			int slot = lookup(shard, hash, filename);
+			Entry &entry = (slot == -1)
+				? insert(shard, hash, filename)
+				: shard.entries[shard.index[slot]];
+			shard.misses++;
+			entry.lastResult = ret;
+			entry.lastErrno = e;
+			entry.lastTime = currentTime;
+			if (ret == 0) {
+				entry.info = info;
+			}
+			*buf = entry.info;
+		}
+
+		errno = e;
+		return ret;
+	}
+
+	/**
+	 * Returns whether `filename` is in the cache.
+	 */
+	bool knows(const StaticString &filename) {
+		boost::uint32_t hash = hashFilename(filename);
+		Shard &shard = getShard(hash);
+		boost::lock_guard<boost::mutex> l(shard.syncher);
+		return lookup(shard, hash, filename) != -1;
+	}
+
+	/**
+	 * Returns the number of cached files.
+	 */
+	unsigned int size() {
+		unsigned int result = 0;
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			boost::lock_guard<boost::mutex> l(shards[i].syncher);
+			result += shards[i].count;
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the number of cached lookups that were answered from the cache.
+	 * Lookups with a throttle rate of 0 are not counted.
+	 */
+	unsigned long long getHits() {
+		unsigned long long result = 0;
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			boost::lock_guard<boost::mutex> l(shards[i].syncher);
+			result += shards[i].hits;
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the number of cached lookups that had to call stat(), because
+	 * the file wasn't cached or its cache entry had expired.
+	 */
+	unsigned long long getMisses() {
+		unsigned long long result = 0;
+		for (unsigned int i = 0; i < SHARD_COUNT; i++) {
+			boost::lock_guard<boost::mutex> l(shards[i].syncher);
+			result += shards[i].misses;
+		}
+		return result;
+	}
+
+	/**
+	 * Returns the maximum number of files that can be cached. This is
+	 * `maxSize` rounded up to a multiple of the number of shards.
+	 */
+	unsigned int capacity() const {
+		return SHARD_COUNT * shards[0].entries.size();
+	}
+};
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_CONCURRENT_CACHED_FILE_STAT_HPP_ */
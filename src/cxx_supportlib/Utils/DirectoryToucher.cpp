@@ -0,0 +1,244 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+#include <deque>
+#include <vector>
+#include <string>
+#ifdef __linux__
+	#include <sys/syscall.h>
+#endif
+
+#include <Utils/DirectoryToucher.h>
+#include <Utils/SystemTime.h>
+#include <Utils/StrIntUtils.h>
+
+namespace Passenger {
+
+using namespace std;
+using namespace oxt;
+
+
+namespace {
+
+/**
+ * A walk over a directory tree, shared by all worker threads. Directories
+ * that still have to be read are kept in a queue; each worker pops one,
+ * touches all its entries, and queues its subdirectories.
+ */
+class TreeWalk {
+private:
+	boost::mutex syncher;
+	boost::condition_variable cond;
+	deque<string> queue;
+	/** Number of queued directories plus directories that are being read. */
+	unsigned int pending;
+	DirectoryTouchResult result;
+
+	void recordError(const string &path, int e) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		result.errors++;
+		if (result.firstError.empty()) {
+			result.firstError = "Cannot touch " + path + ": " + strerror(e) +
+				" (errno=" + toString(e) + ")";
+		}
+	}
+
+	bool popDirectory(string &path) {
+		boost::unique_lock<boost::mutex> l(syncher);
+		while (queue.empty() && pending > 0) {
+			cond.wait(l);
+		}
+		if (queue.empty()) {
+			return false;
+		} else {
+			path.swap(queue.front());
+			queue.pop_front();
+			return true;
+		}
+	}
+
+	void finishDirectory(vector<string> &subdirs, unsigned long long touched) {
+		boost::lock_guard<boost::mutex> l(syncher);
+		result.touched += touched;
+		pending += subdirs.size();
+		for (unsigned int i = 0; i < subdirs.size(); i++) {
+			queue.push_back(string());
+			queue.back().swap(subdirs[i]);
+		}
+		subdirs.clear();
+		pending--;
+		cond.notify_all();
+	}
+
+	void walkDirectory(const string &path, vector<string> &subdirs) {
+		unsigned long long touched = 0;
+		int fd, e;
+
+		fd = syscalls::open(path.c_str(), O_RDONLY | O_DIRECTORY | O_NOFOLLOW);
+		if (fd == -1) {
+			e = errno;
+			if (e != ENOENT) {
+				recordError(path, e);
+			}
+			finishDirectory(subdirs, 0);
+			return;
+		}
+
+		DIR *dir = fdopendir(fd);
+		if (dir == NULL) {
+			e = errno;
+			syscalls::close(fd);
+			recordError(path, e);
+			finishDirectory(subdirs, 0);
+			return;
+		}
+
+		struct dirent *entry;
+		while ((entry = readdir(dir)) != NULL) {
+			const char *name = entry->d_name;
+			if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) {
+				continue;
+			}
+
+			if (utimensat(fd, name, NULL, AT_SYMLINK_NOFOLLOW) == 0) {
+				touched++;
+			} else {
+				e = errno;
+				if (e != ENOENT) {
+					recordError(path + "/" + name, e);
+				}
+				continue;
+			}
+
+			bool isDir;
+			if (entry->d_type == DT_UNKNOWN) {
+				struct stat buf;
+				isDir = fstatat(fd, name, &buf, AT_SYMLINK_NOFOLLOW) == 0
+					&& S_ISDIR(buf.st_mode);
+			} else {
+				isDir = entry->d_type == DT_DIR;
+			}
+			if (isDir) {
+				subdirs.push_back(path + "/" + name);
+			}
+		}
+
+		closedir(dir);
+		finishDirectory(subdirs, touched);
+	}
+
+	static void lowerIoPriority() {
+		#if defined(__linux__) && defined(SYS_ioprio_set)
+			// IOPRIO_PRIO_VALUE(IOPRIO_CLASS_IDLE, 0), for the calling thread.
+			const int IOPRIO_WHO_PROCESS = 1;
+			const int IOPRIO_CLASS_IDLE = 3;
+			const int IOPRIO_CLASS_SHIFT = 13;
+			syscall(SYS_ioprio_set, IOPRIO_WHO_PROCESS, 0,
+				IOPRIO_CLASS_IDLE << IOPRIO_CLASS_SHIFT);
+		#endif
+	}
+
+public:
+	TreeWalk(const string &root)
+		: pending(1)
+	{
+		queue.push_back(root);
+	}
+
+	void workerMain(bool lowPriority) {
+		string path;
+		vector<string> subdirs;
+
+		if (lowPriority) {
+			lowerIoPriority();
+		}
+		while (!boost::this_thread::interruption_requested() && popDirectory(path)) {
+			walkDirectory(path, subdirs);
+		}
+	}
+
+	void touchRoot(const string &path) {
+		if (utimensat(AT_FDCWD, path.c_str(), NULL, AT_SYMLINK_NOFOLLOW) == 0) {
+			result.touched++;
+		} else {
+			int e = errno;
+			if (e != ENOENT) {
+				recordError(path, e);
+			}
+		}
+	}
+
+	const DirectoryTouchResult &getResult() const {
+		return result;
+	}
+};
+
+} // anonymous namespace
+
+
+DirectoryTouchResult
+touchDirectoryTree(const string &path, unsigned int concurrency, bool lowPriority) {
+	unsigned long long startTime = SystemTime::getUsec();
+	TreeWalk walk(path);
+	boost::thread_group threads;
+
+	walk.touchRoot(path);
+	if (concurrency == 0) {
+		concurrency = 1;
+	}
+
+	try {
+		for (unsigned int i = 0; i < concurrency; i++) {
+			threads.add_thread(new oxt::thread(
+				boost::bind(&TreeWalk::workerMain, &walk, lowPriority),
+				"Directory toucher " + toString(i + 1),
+				128 * 1024));
+		}
+		threads.join_all();
+	} catch (const boost::thread_interrupted &) {
+		threads.interrupt_all();
+		threads.join_all();
+		throw;
+	}
+
+	DirectoryTouchResult result = walk.getResult();
+	result.duration = SystemTime::getUsec() - startTime;
+	return result;
+}
+
+
+} // namespace Passenger
@@ -0,0 +1,76 @@
+/*
+ *  Phusion Passenger - https://www.phusionpassenger.com/
+ *  Copyright (c) 2016 Phusion Holding B.V.
+ *
+ *  "Passenger", "Phusion Passenger" and "Union Station" are registered
+ *  trademarks of Phusion Holding B.V.
+ *
+ *  Permission is hereby granted, free of charge, to any person obtaining a copy
+ *  of this software and associated documentation files (the "Software"), to deal
+ *  in the Software without restriction, including without limitation the rights
+ *  to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ *  copies of the Software, and to permit persons to whom the Software is
+ *  furnished to do so, subject to the following conditions:
+ *
+ *  The above copyright notice and this permission notice shall be included in
+ *  all copies or substantial portions of the Software.
+ *
+ *  THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ *  IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ *  FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ *  AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ *  LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ *  OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ *  THE SOFTWARE.
+ */
+#ifndef _PASSENGER_DIRECTORY_TOUCHER_H_
+#define _PASSENGER_DIRECTORY_TOUCHER_H_
+
+#include <string>
+
+namespace Passenger {
+
+using namespace std;
+
+
+struct DirectoryTouchResult {
+	/** Number of files and directories whose timestamps were updated. */
+	unsigned long long touched;
+	/** Number of files or directories that could not be touched or read. */
+	unsigned long long errors;
+	/** How long it took, in microseconds. */
+	unsigned long long duration;
+	/** A description of the first error, if any. */
+	string firstError;
+
+	DirectoryTouchResult()
+		: touched(0),
+		  errors(0),
+		  duration(0)
+		{ }
+};
+
+/**
+ * Sets the access and modification times of the given directory, and of
+ * everything below it, to the current time, so that /tmp cleaners leave it
+ * alone. This replaces `find DIR | xargs touch`, without spawning any
+ * processes.
+ *
+ * Symlinks are touched themselves instead of their targets, and are never
+ * followed into other directories. Files that disappear while the tree is
+ * being walked are silently skipped. Other errors are counted and don't stop
+ * the walk.
+ *
+ * Subdirectories are walked by up to `concurrency` threads. If `lowPriority`
+ * is set then those threads are given the idle I/O scheduling class (on Linux),
+ * so that touching a large tree doesn't compete with request handling.
+ *
+ * @throws boost::thread_interrupted
+ */
+DirectoryTouchResult touchDirectoryTree(const string &path, unsigned int concurrency = 4,
+	bool lowPriority = true);
+
+
+} // namespace Passenger
+
+#endif /* _PASSENGER_DIRECTORY_TOUCHER_H_ */
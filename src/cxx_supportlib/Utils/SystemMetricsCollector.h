@@ -40,6 +40,7 @@
 #include <climits>
 #include <cmath>
 #include <ctime>
+#include <cerrno>
 #include <sys/types.h>
 #include <sys/utsname.h>
 #ifdef __linux__
@@ -359,6 +360,13 @@ public:
 	 * -2 if the OS does not support this metric.
 	 */
 	double swapInRate, swapOutRate;
+	/** Percentage of the past 10 seconds in which some (`memoryPressureSome`)
+	 * or all (`memoryPressureFull`) non-idle tasks were stalled on memory,
+	 * as reported by Linux's pressure stall information (PSI).
+	 * -1 if there was an error querying this information.
+	 * -2 if the OS does not support this metric.
+	 */
+	double memoryPressureSome, memoryPressureFull;
 
 	/** Kernel version number, or the empty string if this information cannot be queried. */
 	string kernelVersion;
@@ -380,7 +388,9 @@ public:
 		  boottime(-1),
 		  forkRate(-2),
 		  swapInRate(-2),
-		  swapOutRate(-2)
+		  swapOutRate(-2),
+		  memoryPressureSome(-2),
+		  memoryPressureFull(-2)
 		{ }
 
 	unsigned int ncpus() const {
@@ -647,6 +657,12 @@ public:
 			stream << "Swap used         : " << formatWidth(kbToMb(swapUsed), 6) << " MB ("
 				<< formatPercent0(options, swapUsedPct, 1, 90) << ")" << endl;
 			stream << "Swap free         : " << formatWidth(kbToMb(swapFree()), 6) << " MB" << endl;
+			if (memoryPressureSome != -2) {
+				stream << "Memory pressure   : "
+					<< formatPercent2(options, memoryPressureSome, -1, 10) << " some, "
+					<< formatPercent2(options, memoryPressureFull, -1, 5) << " full (10 sec avg)"
+					<< endl;
+			}
 
 			if (swapInRate != -2) {
 				stream << "Swap in           : ";
@@ -764,6 +780,8 @@ public:
 			stream << "<swap_free>" << swapFree() << "</swap_free>";
 			stream << "<swap_in_rate>" << swapInRate << "</swap_in_rate>";
 			stream << "<swap_out_rate>" << swapOutRate << "</swap_out_rate>";
+			stream << "<memory_pressure_some>" << memoryPressureSome << "</memory_pressure_some>";
+			stream << "<memory_pressure_full>" << memoryPressureFull << "</memory_pressure_full>";
 			stream << "</memory_metrics>";
 		}
 
@@ -1111,6 +1129,52 @@ private:
 			}
 		}
 
+		void queryMemoryPressure(SystemMetrics &metrics) const {
+			string contents;
+			try {
+				contents = readAll("/proc/pressure/memory");
+			} catch (const SystemException &e) {
+				// Kernels before 4.20, or booted with psi=0.
+				if (e.code() == ENOENT || e.code() == EOPNOTSUPP) {
+					metrics.memoryPressureSome = metrics.memoryPressureFull = -2;
+				} else {
+					metrics.memoryPressureSome = metrics.memoryPressureFull = -1;
+				}
+				return;
+			}
+			try {
+				parseMemoryPressure(metrics, contents);
+			} catch (const ParseException &) {
+				throw RuntimeException("Cannot parse information in /proc/pressure/memory");
+			}
+		}
+
+		/* Parses lines like:
+		 *   some avg10=0.12 avg60=0.05 avg300=0.01 total=12345
+		 *   full avg10=0.00 avg60=0.00 avg300=0.00 total=678
+		 */
+		void parseMemoryPressure(SystemMetrics &metrics, const string &data) const {
+			const char *start = data.c_str();
+
+			metrics.memoryPressureSome = metrics.memoryPressureFull = -1;
+			while (start != NULL && *start != '\0') {
+				StaticString kind = readNextWord(&start);
+				StaticString avg10 = readNextWord(&start);
+				if (!startsWith(avg10, "avg10=")) {
+					throw ParseException();
+				}
+				double value = atof(avg10.substr(sizeof("avg10=") - 1).toString().c_str());
+				if (kind == "some") {
+					metrics.memoryPressureSome = value;
+				} else if (kind == "full") {
+					metrics.memoryPressureFull = value;
+				}
+				if (!skipToNextLine(&start)) {
+					start = NULL;
+				}
+			}
+		}
+
 		void queryBoottimeFromSysinfo(SystemMetrics &metrics) const {
 			if (metrics.boottime == -1) {
 				struct sysinfo info;
@@ -1446,6 +1510,7 @@ public:
 			queryMemInfo(metrics);
 			queryProcStat(metrics);
 			queryProcVmstat(metrics);
+			queryMemoryPressure(metrics);
 			queryBoottimeFromSysinfo(metrics);
 			queryLoadAvg(metrics);
 		#elif defined(__APPLE__)
@@ -287,6 +287,78 @@ int generated_cache_location_part(ngx_conf_t *cf, passenger_loc_conf_t *conf) {
 	
 
 	
+		if (conf->request_queue_timeout != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->request_queue_timeout);
+			len += sizeof("!~PASSENGER_REQUEST_QUEUE_TIMEOUT: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
+		if (conf->request_queue_target_delay != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->request_queue_target_delay);
+			len += sizeof("!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
+		if (conf->upload_streaming_threshold != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->upload_streaming_threshold);
+			len += sizeof("!~PASSENGER_UPLOAD_STREAMING_THRESHOLD: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
+		if (conf->oobw_min_spare_concurrency != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->oobw_min_spare_concurrency);
+			len += sizeof("!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
+		if (conf->memory_recycle_limit != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->memory_recycle_limit);
+			len += sizeof("!~PASSENGER_MEMORY_RECYCLE_LIMIT: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
+		if (conf->memory_recycle_pressure_threshold != NGX_CONF_UNSET) {
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->memory_recycle_pressure_threshold);
+			len += sizeof("!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD: ") - 1;
+			len += end - int_buf;
+			len += sizeof("\r\n") - 1;
+		}
+	
+
+	
 		if (conf->request_queue_overflow_status_code != NGX_CONF_UNSET) {
 			end = ngx_snprintf(int_buf,
 				sizeof(int_buf) - 1,
@@ -691,6 +763,90 @@ if (buf == NULL) {
 	
 
 	
+		if (conf->request_queue_timeout != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_REQUEST_QUEUE_TIMEOUT: ",
+				sizeof("!~PASSENGER_REQUEST_QUEUE_TIMEOUT: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->request_queue_timeout);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
+		if (conf->request_queue_target_delay != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY: ",
+				sizeof("!~PASSENGER_REQUEST_QUEUE_TARGET_DELAY: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->request_queue_target_delay);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
+		if (conf->upload_streaming_threshold != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_UPLOAD_STREAMING_THRESHOLD: ",
+				sizeof("!~PASSENGER_UPLOAD_STREAMING_THRESHOLD: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->upload_streaming_threshold);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
+		if (conf->oobw_min_spare_concurrency != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY: ",
+				sizeof("!~PASSENGER_OOBW_MIN_SPARE_CONCURRENCY: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->oobw_min_spare_concurrency);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
+		if (conf->memory_recycle_limit != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_MEMORY_RECYCLE_LIMIT: ",
+				sizeof("!~PASSENGER_MEMORY_RECYCLE_LIMIT: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->memory_recycle_limit);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
+		if (conf->memory_recycle_pressure_threshold != NGX_CONF_UNSET) {
+			pos = ngx_copy(pos,
+				"!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD: ",
+				sizeof("!~PASSENGER_MEMORY_RECYCLE_PRESSURE_THRESHOLD: ") - 1);
+			end = ngx_snprintf(int_buf,
+				sizeof(int_buf) - 1,
+				"%d",
+				conf->memory_recycle_pressure_threshold);
+			pos = ngx_copy(pos, int_buf, end - int_buf);
+			pos = ngx_copy(pos, (const u_char *) "\r\n", sizeof("\r\n") - 1);
+		}
+	
+
+	
 		if (conf->request_queue_overflow_status_code != NGX_CONF_UNSET) {
 			pos = ngx_copy(pos,
 				"!~PASSENGER_REQUEST_QUEUE_OVERFLOW_STATUS_CODE: ",
@@ -85,10 +85,20 @@
 
 	ngx_int_t max_requests;
 
+	ngx_int_t memory_recycle_limit;
+
+	ngx_int_t memory_recycle_pressure_threshold;
+
 	ngx_int_t min_instances;
 
+	ngx_int_t oobw_min_spare_concurrency;
+
 	ngx_int_t request_queue_overflow_status_code;
 
+	ngx_int_t request_queue_target_delay;
+
+	ngx_int_t request_queue_timeout;
+
 	ngx_int_t socket_backlog;
 
 	ngx_int_t start_timeout;
@@ -99,6 +109,8 @@
 
 	ngx_int_t union_station_support;
 
+	ngx_int_t upload_streaming_threshold;
+
 	ngx_str_t app_group_name;
 
 	ngx_str_t app_rights;
@@ -183,6 +183,30 @@ void generated_set_conf_part(passenger_loc_conf_t  *conf) {
 	
 
 	
+		conf->request_queue_timeout = NGX_CONF_UNSET;
+	
+
+	
+		conf->request_queue_target_delay = NGX_CONF_UNSET;
+	
+
+	
+		conf->upload_streaming_threshold = NGX_CONF_UNSET;
+	
+
+	
+		conf->oobw_min_spare_concurrency = NGX_CONF_UNSET;
+	
+
+	
+		conf->memory_recycle_limit = NGX_CONF_UNSET;
+	
+
+	
+		conf->memory_recycle_pressure_threshold = NGX_CONF_UNSET;
+	
+
+	
 		conf->request_queue_overflow_status_code = NGX_CONF_UNSET;
 	
 
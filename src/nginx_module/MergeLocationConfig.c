@@ -241,6 +241,42 @@ int generated_merge_part(passenger_loc_conf_t *conf, passenger_loc_conf_t *prev,
 	
 
 	
+		ngx_conf_merge_value(conf->request_queue_timeout,
+			prev->request_queue_timeout,
+			NGX_CONF_UNSET);
+	
+
+	
+		ngx_conf_merge_value(conf->request_queue_target_delay,
+			prev->request_queue_target_delay,
+			NGX_CONF_UNSET);
+	
+
+	
+		ngx_conf_merge_value(conf->upload_streaming_threshold,
+			prev->upload_streaming_threshold,
+			NGX_CONF_UNSET);
+	
+
+	
+		ngx_conf_merge_value(conf->oobw_min_spare_concurrency,
+			prev->oobw_min_spare_concurrency,
+			NGX_CONF_UNSET);
+	
+
+	
+		ngx_conf_merge_value(conf->memory_recycle_limit,
+			prev->memory_recycle_limit,
+			NGX_CONF_UNSET);
+	
+
+	
+		ngx_conf_merge_value(conf->memory_recycle_pressure_threshold,
+			prev->memory_recycle_pressure_threshold,
+			NGX_CONF_UNSET);
+	
+
+	
 		ngx_conf_merge_value(conf->request_queue_overflow_status_code,
 			prev->request_queue_overflow_status_code,
 			NGX_CONF_UNSET);
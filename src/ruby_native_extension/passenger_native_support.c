@@ -40,6 +40,11 @@
 #ifdef HAVE_RUBY_THREAD_H
 	#include "ruby/thread.h"
 #endif
+#ifdef HAVE_RUBY_ST_H
+	#include "ruby/st.h"
+#else
+	#include "st.h"
+#endif
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <sys/ioctl.h>
@@ -146,6 +151,141 @@ split_by_null_into_hash(VALUE self, VALUE data) {
 	return result;
 }
 
+/* The maximum number of distinct header names that read_session_header
+ * interns. Header names are client-controlled (HTTP_*), so the table
+ * must be bounded; names seen after the table is full are simply not
+ * interned.
+ */
+#define MAX_INTERNED_HEADER_NAMES 512
+
+/* Maps null-terminated header names (owned by the table) to frozen Ruby strings. */
+static st_table *interned_header_names = NULL;
+/* Keeps the frozen strings in interned_header_names alive. */
+static VALUE interned_header_name_objects = Qnil;
+
+/* Returns a frozen String for the given null-terminated header name. Frozen
+ * strings are used by Hash#[]= as-is, whereas non-frozen keys are duplicated
+ * for every request.
+ */
+static VALUE
+intern_header_name(const char *name, long len) {
+	st_data_t value;
+	VALUE str;
+
+	if (st_lookup(interned_header_names, (st_data_t) name, &value)) {
+		return (VALUE) value;
+	}
+
+	str = rb_obj_freeze(rb_str_new(name, len));
+	if (interned_header_names->num_entries < MAX_INTERNED_HEADER_NAMES) {
+		char *name_copy = strdup(name);
+		if (name_copy != NULL) {
+			rb_ary_push(interned_header_name_objects, str);
+			st_insert(interned_header_names, (st_data_t) name_copy, (st_data_t) str);
+		}
+	}
+	return str;
+}
+
+/* Reads exactly `size` bytes from `fd`, yielding to other Ruby threads while
+ * waiting for data. Returns 1 on success and 0 if EOF was reached first, or
+ * if the connection was reset. Raises SystemCallError on other errors.
+ */
+static int
+read_exactly(int fd, char *buf, size_t size) {
+	ssize_t ret;
+
+	while (size > 0) {
+		rb_thread_wait_fd(fd);
+		ret = read(fd, buf, size);
+		if (ret == -1) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK || errno == EINTR) {
+				continue;
+			} else if (errno == ECONNRESET) {
+				return 0;
+			} else {
+				rb_sys_fail("read()");
+			}
+		} else if (ret == 0) {
+			return 0;
+		} else {
+			buf  += ret;
+			size -= ret;
+		}
+	}
+	return 1;
+}
+
+/*
+ * call-seq: read_session_header(fd, buffer, max_size)
+ *
+ * Reads a session protocol header block from the given file descriptor and
+ * parses it into a Hash. The header block is a scalar message (a 32-bit
+ * big-endian size, followed by that many bytes) containing null-terminated
+ * key-value pairs. This is equivalent to MessageChannel#read_scalar followed
+ * by #split_by_null_into_hash, but reads the data directly into +buffer+
+ * (which is reused between calls) and uses frozen, interned strings for keys.
+ *
+ * Exactly the header block is consumed from the file descriptor, so the
+ * request body, if any, can still be read from the socket afterwards.
+ *
+ * Returns nil if EOF is encountered before the header block has been fully
+ * read. Raises SecurityError if the header block is larger than +max_size+.
+ */
+static VALUE
+read_session_header(VALUE self, VALUE fd, VALUE buffer, VALUE max_size) {
+	int fd_num = NUM2INT(fd);
+	unsigned char size_buf[4];
+	unsigned long size;
+	const char *data, *current, *end, *key, *value;
+	long key_len;
+	VALUE result;
+
+	StringValue(buffer);
+	if (!read_exactly(fd_num, (char *) size_buf, sizeof(size_buf))) {
+		return Qnil;
+	}
+	size = ((unsigned long) size_buf[0] << 24)
+		| ((unsigned long) size_buf[1] << 16)
+		| ((unsigned long) size_buf[2] << 8)
+		| (unsigned long) size_buf[3];
+	if (!NIL_P(max_size) && size > NUM2ULONG(max_size)) {
+		rb_raise(rb_eSecurityError, "Scalar message size (%lu) "
+			"exceeds maximum allowed size (%lu).",
+			size, NUM2ULONG(max_size));
+	}
+
+	rb_str_modify(buffer);
+	rb_str_resize(buffer, size);
+	if (!read_exactly(fd_num, RSTRING_PTR(buffer), size)) {
+		return Qnil;
+	}
+
+	result  = rb_hash_new();
+	data    = RSTRING_PTR(buffer);
+	current = data;
+	end     = data + size;
+	while (current < end) {
+		key = current;
+		current = memchr(current, '\0', end - current);
+		if (current == NULL) {
+			break;
+		}
+		key_len = current - key;
+		current++;
+
+		value = current;
+		current = memchr(current, '\0', end - current);
+		if (current == NULL) {
+			break;
+		}
+		rb_hash_aset(result, intern_header_name(key, key_len),
+			rb_str_new(value, current - value));
+		current++;
+	}
+	return result;
+}
+
 typedef struct {
 	/* The IO vectors in this group. */
 	struct iovec *io_vectors;
@@ -975,8 +1115,13 @@ Init_passenger_native_support() {
 
 	S_ProcessTimes = rb_struct_define("ProcessTimes", "utime", "stime", NULL);
 
+	interned_header_names = st_init_strtable();
+	interned_header_name_objects = rb_ary_new();
+	rb_global_variable(&interned_header_name_objects);
+
 	rb_define_singleton_method(mNativeSupport, "disable_stdio_buffering", disable_stdio_buffering, 0);
 	rb_define_singleton_method(mNativeSupport, "split_by_null_into_hash", split_by_null_into_hash, 1);
+	rb_define_singleton_method(mNativeSupport, "read_session_header", read_session_header, 3);
 	rb_define_singleton_method(mNativeSupport, "writev", f_writev, 2);
 	rb_define_singleton_method(mNativeSupport, "writev2", f_writev2, 3);
 	rb_define_singleton_method(mNativeSupport, "writev3", f_writev3, 4);
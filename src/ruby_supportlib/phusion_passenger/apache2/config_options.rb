@@ -151,6 +151,48 @@
     :context   => ["OR_ALL"],
     :desc      => "The maximum number of queued requests."
   },
+  {
+    :name      => "PassengerRequestQueueTimeout",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The maximum time, in milliseconds, that a request may be queued."
+  },
+  {
+    :name      => "PassengerRequestQueueTargetDelay",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The queueing delay, in milliseconds, above which queued requests are shed."
+  },
+  {
+    :name      => "PassengerUploadStreamingThreshold",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The upload rate, in KB per second, above which request bodies are streamed to the application."
+  },
+  {
+    :name      => "PassengerOobwMinSpareConcurrency",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The number of free session slots that must remain when starting out-of-band work."
+  },
+  {
+    :name      => "PassengerMemoryRecycleLimit",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The amount of memory, in MB, above which application processes are replaced."
+  },
+  {
+    :name      => "PassengerMemoryRecyclePressureThreshold",
+    :type      => :integer,
+    :min_value => 0,
+    :context   => ["OR_ALL"],
+    :desc      => "The system memory pressure percentage at which the most grown application process is replaced."
+  },
   {
     :name      => "PassengerMaxPreloaderIdleTime",
     :type      => :integer,
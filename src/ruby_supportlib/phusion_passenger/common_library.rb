@@ -295,6 +295,9 @@ def locate_source_file(path)
   define_component 'Utils/LargeFiles.o',
     :source   => 'Utils/LargeFiles.cpp',
     :category => :other
+  define_component 'Utils/DirectoryToucher.o',
+    :source   => 'Utils/DirectoryToucher.cpp',
+    :category => :other
   define_component 'WatchdogLauncher.o',
     :source   => 'WatchdogLauncher.cpp',
     :category => :other
@@ -60,9 +60,13 @@ module SharedConstants
     DEFAULT_CONCURRENCY_MODEL = "process"
     DEFAULT_STICKY_SESSIONS_COOKIE_NAME = "_passenger_route"
     DEFAULT_APP_THREAD_COUNT = 1
+    DEFAULT_APP_OUTPUT_RATE_LIMIT = 1000
     DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK = 1024 * 1024 * 128
+    DEFAULT_RESPONSE_COMPRESSION_LEVEL = 1
     DEFAULT_MAX_REQUEST_QUEUE_SIZE = 100
+    DEFAULT_OOBW_MIN_SPARE_CONCURRENCY = 0
     DEFAULT_STAT_THROTTLE_RATE = 10
+    DEFAULT_STATS_SEGMENT_INTERVAL = 1000
     DEFAULT_ANALYTICS_LOG_USER = DEFAULT_WEB_APP_USER
     DEFAULT_ANALYTICS_LOG_GROUP = ""
     DEFAULT_ANALYTICS_LOG_PERMISSIONS = "u=rwx,g=rx,o=rx"
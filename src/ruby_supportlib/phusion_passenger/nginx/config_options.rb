@@ -293,6 +293,30 @@
     :name  => 'passenger_max_request_queue_size',
     :type  => :integer
   },
+  {
+    :name  => 'passenger_request_queue_timeout',
+    :type  => :integer
+  },
+  {
+    :name  => 'passenger_request_queue_target_delay',
+    :type  => :integer
+  },
+  {
+    :name  => 'passenger_upload_streaming_threshold',
+    :type  => :integer
+  },
+  {
+    :name  => 'passenger_oobw_min_spare_concurrency',
+    :type  => :integer
+  },
+  {
+    :name  => 'passenger_memory_recycle_limit',
+    :type  => :integer
+  },
+  {
+    :name  => 'passenger_memory_recycle_pressure_threshold',
+    :type  => :integer
+  },
   {
     :name  => 'passenger_request_queue_overflow_status_code',
     :type  => :integer
@@ -131,7 +131,7 @@ def accept_and_process_next_request(socket_wrapper, channel, buffer)
           connection = @last_connection
           channel.io = connection
           @last_connection = nil
-          headers = parse_request(connection, channel, buffer)
+          headers = parse_request(connection, channel, buffer, false)
         else
           connection = socket_wrapper.wrap(@server_socket.accept)
         end
@@ -216,12 +216,21 @@ def accept_and_process_next_request(socket_wrapper, channel, buffer)
         end
       end
 
-      def parse_session_request(connection, channel, buffer)
-        headers_data = channel.read_scalar(buffer, MAX_HEADER_SIZE)
-        if headers_data.nil?
-          return
+      # +fresh_connection+ indicates whether nothing has been read from
+      # +connection+ yet. If so, we can parse the header natively, straight
+      # from the socket. Kept-alive connections may have data in Ruby's
+      # IO buffer (e.g. if the app used #gets on the request body), so
+      # those must be read through +channel+.
+      def parse_session_request(connection, channel, buffer, fresh_connection = true)
+        if fresh_connection
+          headers = Utils::NativeSupportUtils.read_session_header(connection,
+            buffer, MAX_HEADER_SIZE)
+          return if headers.nil?
+        else
+          headers_data = channel.read_scalar(buffer, MAX_HEADER_SIZE)
+          return if headers_data.nil?
+          headers = Utils::NativeSupportUtils.split_by_null_into_hash(headers_data)
         end
-        headers = Utils::NativeSupportUtils.split_by_null_into_hash(headers_data)
         if @connect_password && headers[PASSENGER_CONNECT_PASSWORD] != @connect_password
           warn "*** Passenger RequestHandler warning: " <<
             "someone tried to connect with an invalid connect password."
@@ -238,7 +247,7 @@ def parse_session_request(connection, channel, buffer)
       # Like parse_session_request, but parses an HTTP request. This is a very minimalistic
       # HTTP parser and is not intended to be complete, fast or secure, since the HTTP server
       # socket is intended to be used for debugging purposes only.
-      def parse_http_request(connection, channel, buffer)
+      def parse_http_request(connection, channel, buffer, fresh_connection = true)
         headers = {}
 
         data = ""
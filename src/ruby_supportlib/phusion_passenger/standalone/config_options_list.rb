@@ -400,6 +400,59 @@ module Standalone
         :min       => 0,
         :desc      => "Specify request queue size. Default: #{DEFAULT_MAX_REQUEST_QUEUE_SIZE}"
       },
+      {
+        :name      => :request_queue_timeout,
+        :type      => :integer,
+        :type_desc => "MSEC",
+        :min       => 0,
+        :desc      => "Return 503 for requests that have been\n" \
+                      "queued for longer than this. Default: 0\n" \
+                      "(no timeout)"
+      },
+      {
+        :name      => :request_queue_target_delay,
+        :type      => :integer,
+        :type_desc => "MSEC",
+        :min       => 0,
+        :desc      => "Shed queued requests when the queueing\n" \
+                      "delay stays above this. Default: 0\n" \
+                      "(disabled)"
+      },
+      {
+        :name      => :upload_streaming_threshold,
+        :type      => :integer,
+        :type_desc => "KB/SEC",
+        :min       => 0,
+        :desc      => "Stream request bodies that are uploaded\n" \
+                      "at least this fast to the app if a\n" \
+                      "process is free, buffer them otherwise.\n" \
+                      "Default: 0 (disabled)"
+      },
+      {
+        :name      => :oobw_min_spare_concurrency,
+        :type      => :integer,
+        :min       => 0,
+        :desc      => "Only start out-of-band work if the other\n" \
+                      "processes keep at least this many free\n" \
+                      "session slots. Default: #{DEFAULT_OOBW_MIN_SPARE_CONCURRENCY}"
+      },
+      {
+        :name      => :memory_recycle_limit,
+        :type      => :integer,
+        :type_desc => "MB",
+        :min       => 0,
+        :desc      => "Replace processes that use more than this\n" \
+                      "much memory. Default: 0 (no limit)"
+      },
+      {
+        :name      => :memory_recycle_pressure_threshold,
+        :type      => :integer,
+        :type_desc => "PERCENT",
+        :min       => 0,
+        :desc      => "Under this much system memory pressure,\n" \
+                      "replace the process that grew the most.\n" \
+                      "Default: 0 (disabled)"
+      },
       {
         :name      => :sticky_sessions,
         :type      => :boolean,
@@ -430,6 +483,20 @@ module Standalone
           options[:turbocaching] = false
         end
       },
+      {
+        :name      => :response_compression,
+        :type      => :boolean,
+        :desc      => "Gzip-compress textual app responses for\n" \
+                      'clients that accept it'
+      },
+      {
+        :name      => :response_compression_level,
+        :type      => :integer,
+        :type_desc => 'LEVEL',
+        :min       => 1,
+        :desc      => "Gzip level (1-9) for streamed responses.\n" \
+                      "Default: #{DEFAULT_RESPONSE_COMPRESSION_LEVEL}"
+      },
       {
         :name      => :unlimited_concurrency_paths,
         :type      => :array,
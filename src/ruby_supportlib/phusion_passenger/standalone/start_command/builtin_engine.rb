@@ -146,6 +146,8 @@ def build_daemon_controller_options
           if @options[:turbocaching] == false
             command << " --disable-turbocaching"
           end
+          add_flag_param(command, :response_compression, "--response-compression")
+          add_param(command, :response_compression_level, "--response-compression-level")
           if @options[:abort_websockets_on_process_shutdown] == false
             command << " --no-abort-websockets-on-process-shutdown"
           end
@@ -156,6 +158,12 @@ def build_daemon_controller_options
           add_param(command, :pool_idle_time, "--pool-idle-time")
           add_param(command, :max_preloader_idle_time, "--max-preloader-idle-time")
           add_param(command, :max_request_queue_size, "--max-request-queue-size")
+          add_param(command, :request_queue_timeout, "--request-queue-timeout")
+          add_param(command, :request_queue_target_delay, "--request-queue-target-delay")
+          add_param(command, :upload_streaming_threshold, "--upload-streaming-threshold")
+          add_param(command, :oobw_min_spare_concurrency, "--oobw-min-spare-concurrency")
+          add_param(command, :memory_recycle_limit, "--memory-recycle-limit")
+          add_param(command, :memory_recycle_pressure_threshold, "--memory-recycle-pressure-threshold")
           add_enterprise_param(command, :concurrency_model, "--concurrency-model")
           add_enterprise_param(command, :thread_count, "--app-thread-count")
           add_enterprise_param(command, :max_request_time, "--max-request-time")
@@ -23,6 +23,7 @@
 #  THE SOFTWARE.
 
 PhusionPassenger.require_passenger_lib 'native_support'
+PhusionPassenger.require_passenger_lib 'message_channel'
 
 module PhusionPassenger
   module Utils
@@ -60,6 +61,27 @@ def process_times
             (times.stime * 1_000_000).to_i)
         end
       end
+
+      if defined?(PhusionPassenger::NativeSupport) &&
+         PhusionPassenger::NativeSupport.respond_to?(:read_session_header)
+        # Reads a session protocol header block (a scalar message containing
+        # null-separated keys and values) from the given IO and returns it as
+        # a hash, or nil on EOF. +buffer+ is reused for storing the raw data.
+        # Raises SecurityError if the header block is larger than +max_size+.
+        def read_session_header(io, buffer, max_size)
+          return PhusionPassenger::NativeSupport.read_session_header(io.fileno,
+            buffer, max_size)
+        end
+      else
+        def read_session_header(io, buffer, max_size)
+          data = MessageChannel.new(io).read_scalar(buffer, max_size)
+          if data
+            return split_by_null_into_hash(data)
+          else
+            return nil
+          end
+        end
+      end
     end
 
   end # module Utils
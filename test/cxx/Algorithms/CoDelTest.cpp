@@ -0,0 +1,77 @@
+#include <TestSupport.h>
+#include <Algorithms/CoDel.h>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct Algorithms_CoDelTest {
+		CoDel codel;
+		static const boost::uint64_t TARGET = 5000;
+		static const boost::uint64_t INTERVAL = 100000;
+
+		bool shouldDrop(boost::uint64_t sojournTime, boost::uint64_t now) {
+			return codel.shouldDrop(sojournTime, now, TARGET, INTERVAL);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Algorithms_CoDelTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Nothing is dropped while the delay stays below the target");
+		for (boost::uint64_t now = 1000000; now < 2000000; now += 1000) {
+			ensure(!shouldDrop(TARGET - 1, now));
+		}
+		ensure(!codel.isDropping());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("A burst that lasts shorter than the interval is absorbed");
+		ensure("(1)", !shouldDrop(50000, 1000000));
+		ensure("(2)", !shouldDrop(50000, 1000000 + INTERVAL - 1));
+		ensure("(3)", !shouldDrop(1000, 1000000 + INTERVAL));
+		ensure("(4)", !shouldDrop(50000, 1000000 + INTERVAL + 1));
+		ensure("(5)", !codel.isDropping());
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("A standing queue is dropped from at an increasing rate");
+		boost::uint64_t now = 1000000;
+		ensure("(1)", !shouldDrop(50000, now));
+		now += INTERVAL;
+		ensure("(2)", shouldDrop(50000, now));
+		ensure("(3)", codel.isDropping());
+
+		// The next drop happens one interval later...
+		ensure("(4)", !shouldDrop(50000, now + INTERVAL - 1));
+		now += INTERVAL;
+		ensure("(5)", shouldDrop(50000, now));
+		ensure_equals("(6)", codel.getDropCount(), 2u);
+
+		// ...and the one after that INTERVAL / sqrt(2) later.
+		boost::uint64_t next = now + (boost::uint64_t) (INTERVAL / std::sqrt(2.0));
+		ensure("(7)", !shouldDrop(50000, next - 1));
+		ensure("(8)", shouldDrop(50000, next));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Dropping stops as soon as the delay drops below the target");
+		boost::uint64_t now = 1000000;
+		shouldDrop(50000, now);
+		now += INTERVAL;
+		ensure("(1)", shouldDrop(50000, now));
+		ensure("(2)", !shouldDrop(TARGET - 1, now + INTERVAL));
+		ensure("(3)", !codel.isDropping());
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("reset() leaves the dropping state");
+		boost::uint64_t now = 1000000;
+		shouldDrop(50000, now);
+		now += INTERVAL;
+		ensure("(1)", shouldDrop(50000, now));
+		codel.reset();
+		ensure("(2)", !codel.isDropping());
+		ensure("(3)", !shouldDrop(50000, now + 1));
+	}
+}
@@ -0,0 +1,240 @@
+#include <TestSupport.h>
+#include <Algorithms/Histogram.h>
+#include <Core/Controller/Metrics.h>
+#include <oxt/thread.hpp>
+
+using namespace Passenger;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace tut {
+	struct Algorithms_HistogramTest {
+		Histogram histogram;
+
+		static void recordConcurrently(Histogram *h, unsigned int count) {
+			for (unsigned int i = 0; i < count; i++) {
+				h->recordConcurrently(i % 1000);
+			}
+		}
+	};
+
+	DEFINE_TEST_GROUP(Algorithms_HistogramTest);
+
+	/***** Bucketing *****/
+
+	TEST_METHOD(1) {
+		set_test_name("Small values have their own bucket");
+		for (unsigned int i = 0; i < Histogram::SUB_BUCKET_COUNT; i++) {
+			ensure_equals(Histogram::bucketIndexOf(i), i);
+			ensure_equals<boost::uint64_t>(Histogram::bucketLowerBound(i), i);
+			ensure_equals<boost::uint64_t>(Histogram::bucketUpperBound(i), i);
+		}
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Every value lies within the bounds of its bucket, and "
+			"buckets are contiguous");
+		boost::uint64_t value = 0;
+		while (value < ((boost::uint64_t) 1 << 32)) {
+			unsigned int index = Histogram::bucketIndexOf(value);
+			ensure("(1)", Histogram::bucketLowerBound(index) <= value);
+			ensure("(2)", Histogram::bucketUpperBound(index) >= value);
+			if (index > 0) {
+				ensure_equals("(3)", Histogram::bucketUpperBound(index - 1) + 1,
+					Histogram::bucketLowerBound(index));
+			}
+			value = value * 3 / 2 + 1;
+		}
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("The relative error is bounded by 1/SUB_BUCKET_COUNT");
+		for (unsigned int index = Histogram::SUB_BUCKET_COUNT;
+			index < Histogram::BUCKET_COUNT - 1;
+			index++)
+		{
+			boost::uint64_t lower = Histogram::bucketLowerBound(index);
+			boost::uint64_t upper = Histogram::bucketUpperBound(index);
+			ensure(upper - lower + 1 <= lower / Histogram::SUB_BUCKET_COUNT + 1);
+		}
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Values larger than MAX_VALUE are clamped into the last bucket");
+		ensure_equals(Histogram::bucketIndexOf(Histogram::MAX_VALUE),
+			Histogram::BUCKET_COUNT - 1);
+		ensure_equals(Histogram::bucketIndexOf(Histogram::MAX_VALUE + 1),
+			Histogram::BUCKET_COUNT - 1);
+		ensure_equals(Histogram::bucketIndexOf(~(boost::uint64_t) 0),
+			Histogram::BUCKET_COUNT - 1);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Powers of two minus one are bucket upper bounds");
+		for (unsigned int k = 1; k <= Histogram::MAX_MAGNITUDE; k++) {
+			boost::uint64_t edge = ((boost::uint64_t) 1 << k) - 1;
+			ensure_equals(Histogram::bucketUpperBound(Histogram::bucketIndexOf(edge)), edge);
+		}
+	}
+
+
+	/***** Recording and querying *****/
+
+	TEST_METHOD(10) {
+		set_test_name("Initial state");
+		ensure_equals<boost::uint64_t>(histogram.getCount(), 0);
+		ensure_equals<boost::uint64_t>(histogram.getSum(), 0);
+		ensure_equals<boost::uint64_t>(histogram.getMax(), 0);
+		ensure_equals<boost::uint64_t>(histogram.getValueAtPercentile(50), 0);
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("It tracks the count, sum and maximum");
+		histogram.record(1);
+		histogram.record(10);
+		histogram.record(100);
+		ensure_equals<boost::uint64_t>(histogram.getCount(), 3);
+		ensure_equals<boost::uint64_t>(histogram.getSum(), 111);
+		ensure_equals<boost::uint64_t>(histogram.getMax(), 100);
+		ensure_equals(histogram.getMean(), 37.0);
+	}
+
+	TEST_METHOD(12) {
+		set_test_name("Percentiles");
+		for (unsigned int i = 1; i <= 1000; i++) {
+			histogram.record(i);
+		}
+		boost::uint64_t p50 = histogram.getValueAtPercentile(50);
+		boost::uint64_t p99 = histogram.getValueAtPercentile(99);
+		ensure("p50 lower bound", p50 >= 500);
+		ensure("p50 upper bound", p50 <= 500 + 500 / Histogram::SUB_BUCKET_COUNT);
+		ensure("p99 lower bound", p99 >= 990);
+		ensure("p99 upper bound", p99 <= 1000);
+		ensure_equals<boost::uint64_t>("p100", histogram.getValueAtPercentile(100), 1000);
+		ensure_equals<boost::uint64_t>("p0", histogram.getValueAtPercentile(0), 1);
+	}
+
+	TEST_METHOD(13) {
+		set_test_name("getCountAtOrBelow() is exact at bucket boundaries");
+		for (unsigned int i = 0; i < 100; i++) {
+			histogram.record(i);
+		}
+		ensure_equals<boost::uint64_t>(histogram.getCountAtOrBelow(0), 1);
+		ensure_equals<boost::uint64_t>(histogram.getCountAtOrBelow(7), 8);
+		ensure_equals<boost::uint64_t>(histogram.getCountAtOrBelow(15), 16);
+		ensure_equals<boost::uint64_t>(histogram.getCountAtOrBelow(63), 64);
+		ensure_equals<boost::uint64_t>(histogram.getCountAtOrBelow(1023), 100);
+	}
+
+	TEST_METHOD(14) {
+		set_test_name("Copying and merging");
+		Histogram other;
+		histogram.record(5);
+		other.record(500);
+		other.record(5000);
+
+		Histogram copy(histogram);
+		copy.merge(other);
+		ensure_equals<boost::uint64_t>(copy.getCount(), 3);
+		ensure_equals<boost::uint64_t>(copy.getSum(), 5505);
+		ensure_equals<boost::uint64_t>(copy.getMax(), 5000);
+		ensure_equals<boost::uint64_t>("The original is not modified",
+			histogram.getCount(), 1);
+	}
+
+	TEST_METHOD(15) {
+		set_test_name("recordConcurrently() does not lose updates");
+		boost::thread_group threads;
+		for (unsigned int i = 0; i < 4; i++) {
+			threads.create_thread(boost::bind(recordConcurrently, &histogram, 100000));
+		}
+		threads.join_all();
+		ensure_equals<boost::uint64_t>(histogram.getCount(), 400000);
+		ensure_equals<boost::uint64_t>(histogram.getMax(), 999);
+	}
+
+
+	/***** Coordinated omission correction *****/
+
+	TEST_METHOD(16) {
+		set_test_name("recordMultiple() is equivalent to calling record() multiple times");
+		Histogram other;
+		histogram.recordMultiple(300, 3);
+		histogram.recordMultiple(5, 0);
+		other.record(300);
+		other.record(300);
+		other.record(300);
+		ensure_equals<boost::uint64_t>(histogram.getCount(), 3);
+		ensure_equals<boost::uint64_t>(histogram.getSum(), 900);
+		ensure_equals<boost::uint64_t>(histogram.getMax(), 300);
+		for (unsigned int i = 0; i < Histogram::BUCKET_COUNT; i++) {
+			ensure_equals(histogram.getBucketCount(i), other.getBucketCount(i));
+		}
+	}
+
+	TEST_METHOD(17) {
+		set_test_name("recordWithExpectedInterval() backfills the values that "
+			"a stalled client would have seen");
+		histogram.recordWithExpectedInterval(10, 100);
+		ensure_equals<boost::uint64_t>("Fast values are recorded as-is",
+			histogram.getCount(), 1);
+
+		histogram.reset();
+		histogram.recordWithExpectedInterval(1000, 100);
+		// 1000, 900, 800, ..., 100
+		ensure_equals<boost::uint64_t>(histogram.getCount(), 10);
+		ensure_equals<boost::uint64_t>(histogram.getSum(), 5500);
+		ensure_equals<boost::uint64_t>(histogram.getMax(), 1000);
+
+		histogram.reset();
+		histogram.recordWithExpectedInterval(1000, 0);
+		ensure_equals<boost::uint64_t>("An interval of 0 disables the correction",
+			histogram.getCount(), 1);
+	}
+
+	TEST_METHOD(18) {
+		set_test_name("correctedForCoordinatedOmission() raises the high percentiles "
+			"in proportion to the duration of a stall");
+		// 99 fast requests and one that stalled for a long time.
+		for (unsigned int i = 0; i < 99; i++) {
+			histogram.record(7);
+		}
+		histogram.record(7000);
+		ensure_equals<boost::uint64_t>("The raw p90 hides the stall",
+			histogram.getValueAtPercentile(90), 7);
+
+		Histogram corrected(histogram.correctedForCoordinatedOmission(7));
+		ensure_equals<boost::uint64_t>("The original is not modified",
+			histogram.getCount(), 100);
+		ensure_equals<boost::uint64_t>(corrected.getCount(), 99 + 1000);
+		ensure_equals<boost::uint64_t>(corrected.getMax(), 7000);
+		ensure("The corrected p90 reflects the stall",
+			corrected.getValueAtPercentile(90) >= 5000);
+		ensure_equals<boost::uint64_t>("Values at or below the interval are unaffected",
+			corrected.getCountAtOrBelow(7), 99 + 1);
+	}
+
+
+	/***** Prometheus output *****/
+
+	TEST_METHOD(20) {
+		set_test_name("PrometheusWriter writes cumulative buckets, sum and count");
+		PrometheusWriter writer;
+		histogram.record(0);
+		histogram.record(2);
+		histogram.record(3);
+		histogram.record(100);
+		writer.declare("test_depth", "histogram", "A test.");
+		writer.histogram("test_depth", histogram, 0, 2, 1,
+			PrometheusWriter::label("app_group", "/foo \"bar\""));
+		ensure_equals(writer.str(),
+			"# HELP test_depth A test.\n"
+			"# TYPE test_depth histogram\n"
+			"test_depth_bucket{app_group=\"/foo \\\"bar\\\"\",le=\"0\"} 1\n"
+			"test_depth_bucket{app_group=\"/foo \\\"bar\\\"\",le=\"1\"} 1\n"
+			"test_depth_bucket{app_group=\"/foo \\\"bar\\\"\",le=\"3\"} 3\n"
+			"test_depth_bucket{app_group=\"/foo \\\"bar\\\"\",le=\"+Inf\"} 4\n"
+			"test_depth_sum{app_group=\"/foo \\\"bar\\\"\"} 105\n"
+			"test_depth_count{app_group=\"/foo \\\"bar\\\"\"} 4\n");
+	}
+}
@@ -0,0 +1,524 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <cmath>
+#include <cerrno>
+#include <ctime>
+#include <unistd.h>
+#ifdef __linux__
+	#include <sched.h>
+#endif
+
+#include <Exceptions.h>
+#include <Utils.h>
+#include <Utils/IOUtils.h>
+#include <jsoncpp/json.h>
+
+using namespace std;
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+
+
+struct Statistics {
+	double min;
+	double p50;
+	double p90;
+	double p99;
+	double mean;
+	double stddev;
+};
+
+struct Result {
+	string name;
+	unsigned long long iterationsPerSample;
+	/** Nanoseconds per operation, one entry per sample. */
+	vector<double> samples;
+	Statistics stats;
+};
+
+static struct {
+	vector<string> filters;
+	string jsonFile;
+	unsigned int samples;
+	unsigned int minSampleTimeMsec;
+	unsigned int warmupTimeMsec;
+	bool pin;
+	int cpu;
+	bool list;
+	bool report;
+
+	string baselineFile;
+	string currentFile;
+	double threshold;
+} options;
+
+
+static void
+usage(int exitCode) {
+	printf("Usage: ./benchmark [options]\n");
+	printf("       ./benchmark --compare BASELINE.json CURRENT.json [--threshold PERCENT]\n");
+	printf("Runs the microbenchmarks for the C++ components.\n\n");
+	printf("Options:\n");
+	printf("  -f, --filter TEXT       Only run benchmarks whose name contains TEXT. May be\n");
+	printf("                          specified multiple times.\n");
+	printf("  -l, --list              List available benchmarks and exit.\n");
+	printf("  -r, --report            Run the reports (object sizes, memory usage, etc.)\n");
+	printf("                          instead of the benchmarks. Filters apply.\n");
+	printf("  --json FILE             Also write the results as JSON to FILE.\n");
+	printf("  --samples N             Number of timed samples per benchmark. Default: %u\n",
+		options.samples);
+	printf("  --min-sample-time MSEC  Minimum duration of a single sample. The iteration\n");
+	printf("                          count is calibrated to reach it. Default: %u\n",
+		options.minSampleTimeMsec);
+	printf("  --warmup MSEC           Warmup duration per benchmark. Default: %u\n",
+		options.warmupTimeMsec);
+	printf("  --cpu N                 Pin to CPU N. Default: the CPU we start on.\n");
+	printf("  --no-pin                Do not pin to a CPU.\n");
+	printf("\n");
+	printf("Comparison options:\n");
+	printf("  --compare BASE CURRENT  Compare the medians of two JSON result files and\n");
+	printf("                          exit with status 1 if any benchmark regressed by\n");
+	printf("                          more than the threshold.\n");
+	printf("  --threshold PERCENT     Regression threshold. Default: %.0f\n", options.threshold);
+	printf("\n");
+	printf("  -h, --help              Print this usage information.\n");
+	exit(exitCode);
+}
+
+static const char *
+requireArgument(int argc, char *argv[], int i) {
+	if (i + 1 >= argc) {
+		fprintf(stderr, "*** ERROR: %s must be followed by an argument.\n", argv[i]);
+		exit(1);
+	}
+	return argv[i + 1];
+}
+
+static void
+parseOptions(int argc, char *argv[]) {
+	options.samples = 30;
+	options.minSampleTimeMsec = 10;
+	options.warmupTimeMsec = 100;
+	options.pin = true;
+	options.cpu = -1;
+	options.list = false;
+	options.report = false;
+	options.threshold = 10;
+
+	for (int i = 1; i < argc; i++) {
+		if (strcmp(argv[i], "-h") == 0 || strcmp(argv[i], "--help") == 0) {
+			usage(0);
+		} else if (strcmp(argv[i], "-f") == 0 || strcmp(argv[i], "--filter") == 0) {
+			options.filters.push_back(requireArgument(argc, argv, i));
+			i++;
+		} else if (strcmp(argv[i], "-l") == 0 || strcmp(argv[i], "--list") == 0) {
+			options.list = true;
+		} else if (strcmp(argv[i], "-r") == 0 || strcmp(argv[i], "--report") == 0) {
+			options.report = true;
+		} else if (strcmp(argv[i], "--json") == 0) {
+			options.jsonFile = requireArgument(argc, argv, i);
+			i++;
+		} else if (strcmp(argv[i], "--samples") == 0) {
+			options.samples = std::max(atoi(requireArgument(argc, argv, i)), 1);
+			i++;
+		} else if (strcmp(argv[i], "--min-sample-time") == 0) {
+			options.minSampleTimeMsec = std::max(atoi(requireArgument(argc, argv, i)), 1);
+			i++;
+		} else if (strcmp(argv[i], "--warmup") == 0) {
+			options.warmupTimeMsec = std::max(atoi(requireArgument(argc, argv, i)), 0);
+			i++;
+		} else if (strcmp(argv[i], "--cpu") == 0) {
+			options.cpu = atoi(requireArgument(argc, argv, i));
+			i++;
+		} else if (strcmp(argv[i], "--no-pin") == 0) {
+			options.pin = false;
+		} else if (strcmp(argv[i], "--compare") == 0) {
+			options.baselineFile = requireArgument(argc, argv, i);
+			options.currentFile = requireArgument(argc, argv, i + 1);
+			i += 2;
+		} else if (strcmp(argv[i], "--threshold") == 0) {
+			options.threshold = atof(requireArgument(argc, argv, i));
+			i++;
+		} else {
+			fprintf(stderr, "*** ERROR: Unknown option: %s\n", argv[i]);
+			fprintf(stderr, "Please pass -h for a list of valid options.\n");
+			exit(1);
+		}
+	}
+}
+
+
+/***** Running *****/
+
+static bool
+matchesFilters(const string &name) {
+	if (options.filters.empty()) {
+		return true;
+	}
+	vector<string>::const_iterator it;
+	for (it = options.filters.begin(); it != options.filters.end(); it++) {
+		if (name.find(*it) != string::npos) {
+			return true;
+		}
+	}
+	return false;
+}
+
+/**
+ * Pins the process to a single CPU so that samples aren't disturbed by
+ * migrations, and so that consecutive runs measure the same core. Returns
+ * the CPU number, or -1 if pinning is not possible.
+ */
+static int
+pinToCpu(int cpu) {
+	#ifdef __linux__
+		if (cpu < 0) {
+			cpu = sched_getcpu();
+			if (cpu < 0) {
+				return -1;
+			}
+		}
+
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+			int e = errno;
+			fprintf(stderr, "Warning: cannot pin to CPU %d: %s (errno=%d)\n",
+				cpu, strerror(e), e);
+			return -1;
+		}
+		return cpu;
+	#else
+		fprintf(stderr, "Warning: CPU pinning is not supported on this platform\n");
+		return -1;
+	#endif
+}
+
+static unsigned long long
+timeRun(Benchmark *benchmark, unsigned long long iterations) {
+	unsigned long long startTime = getMonotonicNsec();
+	benchmark->run(iterations);
+	return std::max<unsigned long long>(getMonotonicNsec() - startTime, 1);
+}
+
+/**
+ * Finds an iteration count for which one run takes at least the minimum
+ * sample time, so that timer resolution and overhead become negligible.
+ */
+static unsigned long long
+calibrate(Benchmark *benchmark) {
+	unsigned long long minSampleTime = options.minSampleTimeMsec * 1000000ull;
+	unsigned long long iterations = 1;
+	unsigned long long elapsed;
+
+	while ((elapsed = timeRun(benchmark, iterations)) < minSampleTime) {
+		if (elapsed * 10 < minSampleTime) {
+			iterations *= 10;
+		} else {
+			iterations = (unsigned long long)
+				(iterations * (double) minSampleTime / elapsed * 1.1) + 1;
+		}
+	}
+	return iterations;
+}
+
+static double
+percentile(const vector<double> &sorted, double p) {
+	// Nearest-rank method.
+	size_t rank = (size_t) ceil(p / 100 * sorted.size());
+	return sorted[std::max<size_t>(rank, 1) - 1];
+}
+
+static Statistics
+calculateStatistics(vector<double> samples) {
+	Statistics stats;
+	double sum = 0, squaredDiffSum = 0;
+	vector<double>::const_iterator it;
+
+	std::sort(samples.begin(), samples.end());
+	for (it = samples.begin(); it != samples.end(); it++) {
+		sum += *it;
+	}
+	stats.mean = sum / samples.size();
+	for (it = samples.begin(); it != samples.end(); it++) {
+		squaredDiffSum += (*it - stats.mean) * (*it - stats.mean);
+	}
+	stats.stddev = sqrt(squaredDiffSum / samples.size());
+	stats.min = samples.front();
+	stats.p50 = percentile(samples, 50);
+	stats.p90 = percentile(samples, 90);
+	stats.p99 = percentile(samples, 99);
+	return stats;
+}
+
+static Result
+runBenchmark(const BenchmarkInfo &info) {
+	Benchmark *benchmark = info.factory();
+	Result result;
+	unsigned long long warmupTime = options.warmupTimeMsec * 1000000ull;
+	unsigned long long warmupStart;
+
+	result.name = info.name;
+	benchmark->setUp();
+
+	warmupStart = getMonotonicNsec();
+	result.iterationsPerSample = calibrate(benchmark);
+	while (getMonotonicNsec() - warmupStart < warmupTime) {
+		benchmark->run(result.iterationsPerSample);
+	}
+
+	for (unsigned int i = 0; i < options.samples; i++) {
+		unsigned long long elapsed = timeRun(benchmark, result.iterationsPerSample);
+		result.samples.push_back((double) elapsed / result.iterationsPerSample);
+	}
+
+	benchmark->tearDown();
+	delete benchmark;
+	result.stats = calculateStatistics(result.samples);
+	return result;
+}
+
+static void
+printHeader() {
+	printf("%-40s %12s %10s %10s %10s %10s %10s %10s\n",
+		"Benchmark (ns/op)", "iters/sample",
+		"min", "p50", "p90", "p99", "mean", "stddev");
+}
+
+static void
+printResult(const Result &result) {
+	const Statistics &s = result.stats;
+	printf("%-40s %12llu %10.2f %10.2f %10.2f %10.2f %10.2f %10.2f\n",
+		result.name.c_str(), result.iterationsPerSample,
+		s.min, s.p50, s.p90, s.p99, s.mean, s.stddev);
+	fflush(stdout);
+}
+
+static Json::Value
+resultsToJson(const vector<Result> &results, int cpu) {
+	Json::Value doc, benchmarks(Json::arrayValue);
+	char hostname[256];
+	vector<Result>::const_iterator it;
+
+	if (gethostname(hostname, sizeof(hostname)) != 0) {
+		hostname[0] = '\0';
+	}
+	hostname[sizeof(hostname) - 1] = '\0';
+
+	doc["version"] = 1;
+	doc["timestamp"] = (Json::UInt64) time(NULL);
+	doc["hostname"] = hostname;
+	doc["cpu"] = cpu;
+	#ifdef __OPTIMIZE__
+		doc["optimized"] = true;
+	#else
+		doc["optimized"] = false;
+	#endif
+	doc["samples"] = options.samples;
+	doc["min_sample_time_msec"] = options.minSampleTimeMsec;
+	doc["warmup_time_msec"] = options.warmupTimeMsec;
+
+	for (it = results.begin(); it != results.end(); it++) {
+		Json::Value benchmark, samples(Json::arrayValue);
+		vector<double>::const_iterator s_it;
+
+		benchmark["name"] = it->name;
+		benchmark["iterations_per_sample"] = (Json::UInt64) it->iterationsPerSample;
+		benchmark["ns_per_op"]["min"] = it->stats.min;
+		benchmark["ns_per_op"]["p50"] = it->stats.p50;
+		benchmark["ns_per_op"]["p90"] = it->stats.p90;
+		benchmark["ns_per_op"]["p99"] = it->stats.p99;
+		benchmark["ns_per_op"]["mean"] = it->stats.mean;
+		benchmark["ns_per_op"]["stddev"] = it->stats.stddev;
+		for (s_it = it->samples.begin(); s_it != it->samples.end(); s_it++) {
+			samples.append(*s_it);
+		}
+		benchmark["samples"] = samples;
+		benchmarks.append(benchmark);
+	}
+
+	doc["benchmarks"] = benchmarks;
+	return doc;
+}
+
+static int
+runBenchmarks() {
+	const vector<BenchmarkInfo> &benchmarks = getBenchmarks();
+	vector<BenchmarkInfo>::const_iterator it;
+	vector<Result> results;
+	int cpu = -1;
+
+	if (options.list) {
+		for (it = benchmarks.begin(); it != benchmarks.end(); it++) {
+			printf("%s\n", it->name.c_str());
+		}
+		return 0;
+	}
+
+	#ifndef __OPTIMIZE__
+		fprintf(stderr, "Warning: benchmarks were compiled without optimizations."
+			" Rebuild with OPTIMIZE=1 for meaningful results.\n");
+	#endif
+	if (options.pin) {
+		cpu = pinToCpu(options.cpu);
+		if (cpu >= 0) {
+			printf("Pinned to CPU %d\n", cpu);
+		}
+	}
+
+	printHeader();
+	for (it = benchmarks.begin(); it != benchmarks.end(); it++) {
+		if (matchesFilters(it->name)) {
+			results.push_back(runBenchmark(*it));
+			printResult(results.back());
+		}
+	}
+
+	if (results.empty()) {
+		fprintf(stderr, "*** ERROR: No benchmarks match the given filters.\n");
+		return 1;
+	}
+	if (!options.jsonFile.empty()) {
+		createFile(options.jsonFile, resultsToJson(results, cpu).toStyledString());
+		printf("Results written to %s\n", options.jsonFile.c_str());
+	}
+	return 0;
+}
+
+
+static int
+runReports() {
+	const vector<ReportInfo> &reports = getReports();
+	vector<ReportInfo>::const_iterator it;
+	unsigned int count = 0;
+
+	for (it = reports.begin(); it != reports.end(); it++) {
+		if (!matchesFilters(it->name)) {
+			continue;
+		}
+		if (options.list) {
+			printf("%s\n", it->name.c_str());
+		} else {
+			printf("%s%s\n", (count > 0) ? "\n" : "", it->name.c_str());
+			printf("%s\n", string(it->name.size(), '-').c_str());
+			it->function();
+		}
+		count++;
+	}
+
+	if (count == 0 && !options.list) {
+		fprintf(stderr, "*** ERROR: No reports match the given filters.\n");
+		return 1;
+	}
+	return 0;
+}
+
+
+/***** Comparing *****/
+
+static Json::Value
+loadResults(const string &filename) {
+	Json::Reader reader;
+	Json::Value doc;
+
+	if (!reader.parse(readAll(filename), doc) || !doc.isObject()
+	 || !doc["benchmarks"].isArray())
+	{
+		fprintf(stderr, "*** ERROR: %s is not a valid benchmark results file: %s\n",
+			filename.c_str(), reader.getFormattedErrorMessages().c_str());
+		exit(1);
+	}
+	return doc;
+}
+
+static map<string, double>
+indexMedians(const Json::Value &doc) {
+	map<string, double> result;
+	Json::Value::const_iterator it, end = doc["benchmarks"].end();
+
+	for (it = doc["benchmarks"].begin(); it != end; it++) {
+		result[(*it)["name"].asString()] = (*it)["ns_per_op"]["p50"].asDouble();
+	}
+	return result;
+}
+
+/**
+ * Compares the median ns/op of every benchmark that appears in both files.
+ * The median is used rather than the mean because it is insensitive to the
+ * occasional sample that got interrupted by the OS.
+ */
+static int
+compareResults() {
+	Json::Value baselineDoc = loadResults(options.baselineFile);
+	Json::Value currentDoc = loadResults(options.currentFile);
+	map<string, double> baseline = indexMedians(baselineDoc);
+	map<string, double> current = indexMedians(currentDoc);
+	map<string, double>::const_iterator it;
+	unsigned int regressions = 0;
+
+	if (baselineDoc["hostname"] != currentDoc["hostname"]) {
+		fprintf(stderr, "Warning: the results were recorded on different hosts.\n");
+	}
+	if (!baselineDoc["optimized"].asBool() || !currentDoc["optimized"].asBool()) {
+		fprintf(stderr, "Warning: at least one run was compiled without optimizations.\n");
+	}
+
+	printf("%-40s %14s %14s %9s\n", "Benchmark (median ns/op)", "baseline",
+		"current", "change");
+	for (it = current.begin(); it != current.end(); it++) {
+		map<string, double>::const_iterator base_it = baseline.find(it->first);
+		if (base_it == baseline.end()) {
+			printf("%-40s %14s %14.2f %9s\n", it->first.c_str(), "-", it->second, "new");
+			continue;
+		}
+
+		double change = (it->second - base_it->second) / base_it->second * 100;
+		const char *verdict = "";
+		if (change > options.threshold) {
+			verdict = "  REGRESSION";
+			regressions++;
+		} else if (change < -options.threshold) {
+			verdict = "  improved";
+		}
+		printf("%-40s %14.2f %14.2f %+8.1f%%%s\n", it->first.c_str(),
+			base_it->second, it->second, change, verdict);
+	}
+	for (it = baseline.begin(); it != baseline.end(); it++) {
+		if (current.find(it->first) == current.end()) {
+			printf("%-40s %14.2f %14s %9s\n", it->first.c_str(), it->second, "-", "not run");
+		}
+	}
+
+	if (regressions > 0) {
+		printf("\n%u benchmark(s) regressed by more than %.1f%%\n", regressions,
+			options.threshold);
+		return 1;
+	} else {
+		printf("\nNo regressions beyond %.1f%%\n", options.threshold);
+		return 0;
+	}
+}
+
+
+int
+main(int argc, char *argv[]) {
+	parseOptions(argc, argv);
+	try {
+		if (!options.baselineFile.empty()) {
+			return compareResults();
+		} else if (options.report) {
+			return runReports();
+		} else {
+			return runBenchmarks();
+		}
+	} catch (const tracable_exception &e) {
+		fprintf(stderr, "*** ERROR: %s\n", e.what());
+		return 1;
+	}
+}
@@ -0,0 +1,146 @@
+#ifndef _BENCHMARK_SUPPORT_H_
+#define _BENCHMARK_SUPPORT_H_
+
+#include <sys/time.h>
+#include <time.h>
+#include <string>
+#include <vector>
+#include <oxt/macros.hpp>
+
+/**
+ * A minimal microbenchmark harness for the C++ components. Benchmarks are
+ * classes that derive from `Benchmark` and are registered with
+ * `REGISTER_BENCHMARK`. They are compiled into a separate executable,
+ * `buildout/test/cxx/benchmark`, which is run with `rake benchmark:cxx`.
+ *
+ * The harness calls `run()` with an iteration count that is calibrated so that
+ * each sample takes at least a few milliseconds, after a warmup phase. It
+ * reports nanoseconds per operation as min/median/p90/p99/mean/stddev over
+ * all samples, and can write the results as JSON so that two runs can be
+ * compared. See BenchmarkMain.cpp for the command line options.
+ *
+ * Measurements that aren't about time, such as object sizes or memory usage,
+ * are written as reports: plain functions that print their findings, registered
+ * with `REGISTER_REPORT` and run with `rake benchmark:cxx:report`.
+ */
+
+namespace Passenger {
+namespace Benchmarks {
+
+using namespace std;
+
+
+class Benchmark {
+public:
+	virtual ~Benchmark() { }
+
+	/** Called once before warmup. Not timed. */
+	virtual void setUp() { }
+
+	/** Called once after all samples are taken. Not timed. */
+	virtual void tearDown() { }
+
+	/**
+	 * Must perform the operation under measurement exactly `iterations` times.
+	 * Any per-iteration setup that shouldn't be measured must be amortized
+	 * (e.g. by resetting state once every N iterations).
+	 */
+	virtual void run(unsigned long long iterations) = 0;
+};
+
+typedef Benchmark *(*BenchmarkFactory)();
+
+struct BenchmarkInfo {
+	string name;
+	BenchmarkFactory factory;
+};
+
+inline vector<BenchmarkInfo> &
+getBenchmarks() {
+	static vector<BenchmarkInfo> benchmarks;
+	return benchmarks;
+}
+
+template<typename T>
+struct BenchmarkRegistration {
+	static Benchmark *create() {
+		return new T();
+	}
+
+	BenchmarkRegistration(const char *name) {
+		BenchmarkInfo info;
+		info.name = name;
+		info.factory = create;
+		getBenchmarks().push_back(info);
+	}
+};
+
+/**
+ * Registers a Benchmark subclass under the given name. By convention, names
+ * are of the form "Component.operation", e.g. "HeaderTable.lookup".
+ */
+#define REGISTER_BENCHMARK(ClassName, name) \
+	static Passenger::Benchmarks::BenchmarkRegistration<ClassName> \
+		ClassName ## _registration(name)
+
+
+typedef void (*ReportFunction)();
+
+struct ReportInfo {
+	string name;
+	ReportFunction function;
+};
+
+inline vector<ReportInfo> &
+getReports() {
+	static vector<ReportInfo> reports;
+	return reports;
+}
+
+struct ReportRegistration {
+	ReportRegistration(const char *name, ReportFunction function) {
+		ReportInfo info;
+		info.name = name;
+		info.function = function;
+		getReports().push_back(info);
+	}
+};
+
+/**
+ * Registers a report function under the given name. Reports print their
+ * results to stdout in a human-readable form.
+ */
+#define REGISTER_REPORT(function, name) \
+	static Passenger::Benchmarks::ReportRegistration \
+		function ## _registration(name, function)
+
+
+/**
+ * Prevents the compiler from optimizing away the computation of `value`,
+ * without adding the cost of an actual store.
+ */
+template<typename T>
+OXT_FORCE_INLINE
+inline void
+doNotOptimizeAway(const T &value) {
+	__asm__ __volatile__("" : : "r"(&value) : "memory");
+}
+
+inline unsigned long long
+getMonotonicNsec() {
+	#ifdef CLOCK_MONOTONIC
+		struct timespec ts;
+		clock_gettime(CLOCK_MONOTONIC, &ts);
+		return (unsigned long long) ts.tv_sec * 1000000000ull + ts.tv_nsec;
+	#else
+		struct timeval tv;
+		gettimeofday(&tv, NULL);
+		return (unsigned long long) tv.tv_sec * 1000000000ull + tv.tv_usec * 1000ull;
+	#endif
+}
+
+
+} // namespace Benchmarks
+} // namespace Passenger
+
+#endif /* _BENCHMARK_SUPPORT_H_ */
@@ -0,0 +1,44 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <boost/shared_ptr.hpp>
+#include <boost/make_shared.hpp>
+#include <DataStructures/StringKeyTable.h>
+#include <Core/Controller/Metrics.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace {
+	/**
+	 * Mimics what Controller does for every request: look up the app
+	 * group's metrics, then record the session checkout wait and the
+	 * request duration.
+	 */
+	class RecordRequestMetricsBenchmark: public Benchmark {
+	private:
+		StringKeyTable< boost::shared_ptr<AppGroupMetrics> > table;
+		HashedStaticString appGroupName;
+
+	public:
+		RecordRequestMetricsBenchmark()
+			: appGroupName("/webapps/foo (production)")
+			{ }
+
+		virtual void setUp() {
+			table.insert(appGroupName, boost::make_shared<AppGroupMetrics>());
+			table.insert("/webapps/bar (production)", boost::make_shared<AppGroupMetrics>());
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				boost::shared_ptr<AppGroupMetrics> *metrics;
+				table.lookup(appGroupName, &metrics);
+				(*metrics)->sessionCheckoutWaits.record(i & 1023);
+				(*metrics)->requestDurations.record(i * 7);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(RecordRequestMetricsBenchmark, "Metrics.recordRequest");
@@ -0,0 +1,139 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <boost/make_shared.hpp>
+#include <boost/bind.hpp>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <cstdio>
+#include <cstdlib>
+#include <pwd.h>
+#include <grp.h>
+#include <unistd.h>
+#include <Core/ApplicationPool/Pool.h>
+#include <ResourceLocator.h>
+#include <Utils.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace {
+	/**
+	 * Checks out and releases sessions from a pool with two dummy processes,
+	 * while another thread polls the pool status as fast as it can, like a
+	 * very aggressive monitoring agent would. Compare the results with and
+	 * without snapshot caching to see how much status polling contends with
+	 * session checkouts for the pool lock.
+	 */
+	class PoolGetWhilePollingBenchmark: public Benchmark {
+	private:
+		unsigned long long snapshotMaxAge;
+		string sourceRoot;
+		string appRoot, defaultUser, defaultGroup;
+		ResourceLocator resourceLocator;
+		SpawningKit::ConfigPtr spawningKitConfig;
+		SpawningKit::FactoryPtr spawningKitFactory;
+		PoolPtr pool;
+		Options options;
+		Ticket ticket;
+		oxt::thread *scraper;
+
+		// `rake benchmark:cxx` runs from the source root, while the unit tests
+		// run from the test directory.
+		static string findSourceRoot() {
+			if (fileExists("test/stub/rack/start.rb")) {
+				return absolutizePath(".");
+			} else if (fileExists("stub/rack/start.rb")) {
+				return absolutizePath("..");
+			} else {
+				fprintf(stderr, "*** ERROR: cannot find test/stub/rack. "
+					"Please run the benchmark from the source root\n");
+				abort();
+			}
+		}
+
+		void scrapeStatus() {
+			while (!boost::this_thread::interruption_requested()) {
+				pool->toXml();
+			}
+		}
+
+	protected:
+		PoolGetWhilePollingBenchmark(unsigned long long _snapshotMaxAge)
+			: snapshotMaxAge(_snapshotMaxAge),
+			  sourceRoot(findSourceRoot()),
+			  resourceLocator(sourceRoot),
+			  scraper(NULL)
+			{ }
+
+	public:
+		virtual void setUp() {
+			struct passwd *pw = getpwuid(geteuid());
+			struct group *gr = getgrgid(getegid());
+
+			// The pool interrupts its helper threads on destruction.
+			oxt::setup_syscall_interruption_support();
+
+			spawningKitConfig = boost::make_shared<SpawningKit::Config>();
+			spawningKitConfig->resourceLocator = &resourceLocator;
+			spawningKitConfig->finalize();
+			spawningKitFactory = boost::make_shared<SpawningKit::Factory>(spawningKitConfig);
+			pool = boost::make_shared<Pool>(spawningKitFactory);
+			pool->initialize();
+			pool->setSnapshotMaxAge(snapshotMaxAge);
+
+			options.spawnMethod = "dummy";
+			// Options only refers to these strings, so they must outlive it.
+			appRoot = sourceRoot + "/test/stub/rack";
+			defaultUser = pw->pw_name;
+			defaultGroup = gr->gr_name;
+			options.appRoot = appRoot;
+			options.startCommand = "ruby\t" "start.rb";
+			options.startupFile  = "start.rb";
+			options.loadShellEnvvars = false;
+			options.minProcesses = 2;
+			options.defaultUser = defaultUser;
+			options.defaultGroup = defaultGroup;
+
+			pool->get(options, &ticket);
+			while (pool->getProcessCount() < 2) {
+				syscalls::usleep(1000);
+			}
+
+			scraper = new oxt::thread(
+				boost::bind(&PoolGetWhilePollingBenchmark::scrapeStatus, this),
+				"Status scraper");
+		}
+
+		virtual void tearDown() {
+			scraper->interrupt_and_join();
+			delete scraper;
+			pool->destroy();
+			pool.reset();
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				SessionPtr session = pool->get(options, &ticket);
+				doNotOptimizeAway(session);
+			}
+		}
+	};
+
+	class PoolGetWhilePollingUncachedBenchmark: public PoolGetWhilePollingBenchmark {
+	public:
+		PoolGetWhilePollingUncachedBenchmark()
+			: PoolGetWhilePollingBenchmark(0)
+			{ }
+	};
+
+	class PoolGetWhilePollingCachedBenchmark: public PoolGetWhilePollingBenchmark {
+	public:
+		PoolGetWhilePollingCachedBenchmark()
+			: PoolGetWhilePollingBenchmark(1000000)
+			{ }
+	};
+}
+
+REGISTER_BENCHMARK(PoolGetWhilePollingUncachedBenchmark, "Pool.getWhilePolling");
+REGISTER_BENCHMARK(PoolGetWhilePollingCachedBenchmark, "Pool.getWhilePollingCached");
@@ -0,0 +1,238 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <cstdio>
+#include <vector>
+#include <unistd.h>
+#include <MemoryKit/ObjectSlab.h>
+#include <Core/Controller/Request.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace {
+	const unsigned int CACHE_LINE_SIZE = 64;
+	const unsigned int CONCURRENT_REQUESTS = 20000;
+	const unsigned int LIVE_PARTS = 256;
+
+	typedef MemoryKit::ObjectSlab<Request::BodyBuffer> BodyBufferSlab;
+	typedef MemoryKit::ObjectSlab<Request::StopwatchLogs> StopwatchLogsSlab;
+	typedef MemoryKit::ObjectSlab<Request::TurboCacheCapture> TurboCacheCaptureSlab;
+
+	/**
+	 * The number of cache lines spanned by `size` bytes at `offset`, assuming
+	 * that the object starts at a cache line boundary.
+	 */
+	unsigned int cacheLines(size_t offset, size_t size) {
+		if (size == 0) {
+			return 0;
+		} else {
+			return (offset + size - 1) / CACHE_LINE_SIZE - offset / CACHE_LINE_SIZE + 1;
+		}
+	}
+
+	size_t offsetOf(const Request &req, const void *field) {
+		return (const char *) field - (const char *) &req;
+	}
+
+	/** Returns the resident set size in bytes, or 0 if it can't be determined. */
+	size_t getResidentSetSize() {
+		#ifdef __linux__
+			FILE *f = fopen("/proc/self/statm", "r");
+			unsigned long size, resident;
+			int ret;
+
+			if (f == NULL) {
+				return 0;
+			}
+			ret = fscanf(f, "%lu %lu", &size, &resident);
+			fclose(f);
+			if (ret != 2) {
+				return 0;
+			}
+			return (size_t) resident * sysconf(_SC_PAGESIZE);
+		#else
+			return 0;
+		#endif
+	}
+
+	void printRegion(const char *name, size_t offset, size_t size) {
+		printf("  %-34s %5u bytes at offset %5u, %2u cache lines\n", name,
+			(unsigned int) size, (unsigned int) offset,
+			cacheLines(offset, size));
+	}
+
+	void printPart(const char *name, size_t size) {
+		printf("  %-34s %5u bytes, %2u cache lines\n", name,
+			(unsigned int) size, cacheLines(0, size));
+	}
+
+	void printResidentSize(const char *name, size_t before, size_t after) {
+		if (before == 0 || after == 0) {
+			printf("  %-34s unknown\n", name);
+		} else {
+			size_t delta = (after > before) ? after - before : 0;
+			printf("  %-34s %8.1f MB, %5u bytes per request\n", name,
+				delta / 1024.0 / 1024.0,
+				(unsigned int) (delta / CONCURRENT_REQUESTS));
+		}
+	}
+
+	/**
+	 * Prints the size of Request, how its fields are laid out over cache
+	 * lines, and the sizes of the cold parts that are attached on demand.
+	 */
+	void reportRequestLayout() {
+		Request req;
+		size_t coldPartsSize = sizeof(Request::BodyBuffer)
+			+ sizeof(Request::StopwatchLogs)
+			+ sizeof(Request::TurboCacheCapture);
+		size_t embeddedSize = sizeof(Request) + coldPartsSize - 3 * sizeof(void *);
+
+		printf("sizeof(Request): %u bytes, %u cache lines\n\n",
+			(unsigned int) sizeof(Request), cacheLines(0, sizeof(Request)));
+
+		printf("Hot part, in access order:\n");
+		printRegion("BaseHttpRequest", 0, sizeof(ServerKit::BaseHttpRequest));
+		printRegion("state, session, metrics, host",
+			offsetOf(req, &req.startedAt),
+			offsetOf(req, &req.appSink) - offsetOf(req, &req.startedAt));
+		printRegion("appSink", offsetOf(req, &req.appSink), sizeof(req.appSink));
+		printRegion("appSource", offsetOf(req, &req.appSource), sizeof(req.appSource));
+		printRegion("appResponse", offsetOf(req, &req.appResponse),
+			sizeof(req.appResponse));
+		printRegion("app response/connect timers",
+			offsetOf(req, &req.appResponseTimer),
+			offsetOf(req, &req.cacheKey) - offsetOf(req, &req.appResponseTimer));
+		printRegion("turbocache key, envvars",
+			offsetOf(req, &req.cacheKey),
+			offsetOf(req, &req.options) - offsetOf(req, &req.cacheKey));
+		printRegion("options", offsetOf(req, &req.options), sizeof(req.options));
+		printRegion("cold part pointers", offsetOf(req, &req.bodyBuffer),
+			sizeof(Request) - offsetOf(req, &req.bodyBuffer));
+
+		printf("\nCold parts, attached on demand from per-Controller slabs:\n");
+		printPart("BodyBuffer (body buffering)", sizeof(Request::BodyBuffer));
+		printPart("StopwatchLogs (Union Station)", sizeof(Request::StopwatchLogs));
+		printPart("TurboCacheCapture (turbocaching)", sizeof(Request::TurboCacheCapture));
+
+		printf("\nA request touches %u cache lines of Request, plus those of the\n"
+			"cold parts it needs. With all cold parts embedded, Request would be\n"
+			"%u bytes (%u cache lines).\n",
+			cacheLines(0, sizeof(Request)),
+			(unsigned int) embeddedSize, cacheLines(0, embeddedSize));
+	}
+
+	/**
+	 * Measures the resident memory of 20000 concurrent Request objects, first
+	 * without any cold parts (the common case), then with each cold part
+	 * attached to every request (the worst case). Should be run on its own
+	 * (with a filter), because memory freed by earlier reports would be reused.
+	 */
+	void reportConcurrentRequestMemory() {
+		vector<Request *> requests;
+		BodyBufferSlab bodyBufferSlab;
+		StopwatchLogsSlab stopwatchLogsSlab;
+		TurboCacheCaptureSlab turboCacheCaptureSlab;
+		size_t rss[4];
+		unsigned int i;
+
+		requests.reserve(CONCURRENT_REQUESTS);
+		rss[0] = getResidentSetSize();
+		for (i = 0; i < CONCURRENT_REQUESTS; i++) {
+			requests.push_back(new Request());
+		}
+		rss[1] = getResidentSetSize();
+		for (i = 0; i < CONCURRENT_REQUESTS; i++) {
+			requests[i]->bodyBuffer = bodyBufferSlab.construct();
+		}
+		rss[2] = getResidentSetSize();
+		for (i = 0; i < CONCURRENT_REQUESTS; i++) {
+			requests[i]->stopwatchLogs = stopwatchLogsSlab.construct();
+			requests[i]->turboCacheCapture = turboCacheCaptureSlab.construct();
+		}
+		rss[3] = getResidentSetSize();
+
+		printf("Resident memory of %u concurrent requests:\n", CONCURRENT_REQUESTS);
+		printResidentSize("Request objects", rss[0], rss[1]);
+		printResidentSize("+ BodyBuffer", rss[1], rss[2]);
+		printResidentSize("+ StopwatchLogs, TurboCacheCapture", rss[2], rss[3]);
+		printResidentSize("Total with all cold parts", rss[0], rss[3]);
+		printf("\nSlab memory: %u chunks for BodyBuffer, %u for StopwatchLogs,"
+			" %u for TurboCacheCapture\n",
+			bodyBufferSlab.getChunkCount(), stopwatchLogsSlab.getChunkCount(),
+			turboCacheCaptureSlab.getChunkCount());
+
+		for (i = 0; i < CONCURRENT_REQUESTS; i++) {
+			bodyBufferSlab.destroy(requests[i]->bodyBuffer);
+			stopwatchLogsSlab.destroy(requests[i]->stopwatchLogs);
+			turboCacheCaptureSlab.destroy(requests[i]->turboCacheCapture);
+			delete requests[i];
+		}
+	}
+
+	/**
+	 * One operation = attaching a body buffer to a request and detaching the
+	 * one that was attached LIVE_PARTS operations ago.
+	 */
+	class BodyBufferSlabBenchmark: public Benchmark {
+	private:
+		BodyBufferSlab slab;
+		Request::BodyBuffer *parts[LIVE_PARTS];
+
+	public:
+		virtual void setUp() {
+			for (unsigned int i = 0; i < LIVE_PARTS; i++) {
+				parts[i] = slab.construct();
+			}
+		}
+
+		virtual void tearDown() {
+			for (unsigned int i = 0; i < LIVE_PARTS; i++) {
+				slab.destroy(parts[i]);
+			}
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				Request::BodyBuffer *&part = parts[i % LIVE_PARTS];
+				slab.destroy(part);
+				part = slab.construct();
+				doNotOptimizeAway(part);
+			}
+		}
+	};
+
+	/** Like BodyBufferSlabBenchmark, but with new and delete, for comparison. */
+	class BodyBufferHeapBenchmark: public Benchmark {
+	private:
+		Request::BodyBuffer *parts[LIVE_PARTS];
+
+	public:
+		virtual void setUp() {
+			for (unsigned int i = 0; i < LIVE_PARTS; i++) {
+				parts[i] = new Request::BodyBuffer();
+			}
+		}
+
+		virtual void tearDown() {
+			for (unsigned int i = 0; i < LIVE_PARTS; i++) {
+				delete parts[i];
+			}
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				Request::BodyBuffer *&part = parts[i % LIVE_PARTS];
+				delete part;
+				part = new Request::BodyBuffer();
+				doNotOptimizeAway(part);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(BodyBufferSlabBenchmark, "Request.attach_body_buffer_slab");
+REGISTER_BENCHMARK(BodyBufferHeapBenchmark, "Request.attach_body_buffer_heap");
+REGISTER_REPORT(reportRequestLayout, "Request.layout");
+REGISTER_REPORT(reportConcurrentRequestMemory, "Request.rss_20k_concurrent");
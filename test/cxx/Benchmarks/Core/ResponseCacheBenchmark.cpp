@@ -0,0 +1,205 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <time.h>
+#include <string>
+#include <ServerKit/HttpRequest.h>
+#include <MemoryKit/palloc.h>
+#include <Core/Controller/Request.h>
+#include <Core/Controller/AppResponse.h>
+#include <Core/ResponseCache.h>
+#include <Utils/StrIntUtils.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::Core;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace {
+	typedef ResponseCache<Request> ResponseCacheType;
+
+	const unsigned int NPATHS = ResponseCacheType::MAX_ENTRIES;
+
+	/**
+	 * Sets up a cacheable GET request and response like ResponseCacheTest does.
+	 * Long-lived data (headers, host, path) lives in `fixturePool`. `req.pool`
+	 * is a scratch pool for the allocations that ResponseCache itself makes;
+	 * it is reset periodically so that it doesn't grow without bounds.
+	 */
+	class ResponseCacheBenchmark: public Benchmark {
+	protected:
+		ResponseCacheType responseCache;
+		Request req;
+		psg_pool_t *fixturePool;
+		LString paths[NPATHS];
+		HashedStaticString cacheKeys[NPATHS];
+		time_t now;
+
+		Header *createHeader(const HashedStaticString &key, const StaticString &val) {
+			Header *header = (Header *) psg_palloc(fixturePool, sizeof(Header));
+			psg_lstr_init(&header->key);
+			psg_lstr_init(&header->origKey);
+			psg_lstr_init(&header->val);
+			psg_lstr_append(&header->key, fixturePool, key.data(), key.size());
+			psg_lstr_append(&header->origKey, fixturePool, key.data(), key.size());
+			psg_lstr_append(&header->val, fixturePool, val.data(), val.size());
+			header->hash = key.hash();
+			return header;
+		}
+
+		LString *createLString(const StaticString &value) {
+			LString *str = (LString *) psg_palloc(fixturePool, sizeof(LString));
+			psg_lstr_init(str);
+			psg_lstr_append(str, fixturePool, value.data(), value.size());
+			return str;
+		}
+
+		StaticString createDateString() {
+			struct tm the_tm;
+			gmtime_r(&now, &the_tm);
+			char *buf = (char *) psg_pnalloc(fixturePool, 64);
+			size_t size = strftime(buf, 64, "%a, %d %b %Y %H:%M:%S GMT", &the_tm);
+			return StaticString(buf, size);
+		}
+
+		void initRequest() {
+			req.httpMajor = 1;
+			req.httpMinor = 1;
+			req.httpState = Request::COMPLETE;
+			req.bodyType  = Request::RBT_NO_BODY;
+			req.method    = HTTP_GET;
+			req.https     = false;
+			req.host      = createLString("www.example.com");
+			req.cacheKey  = HashedStaticString();
+			req.cacheControl = NULL;
+			req.varyCookie = NULL;
+			req.hasPragmaHeader = false;
+
+			Header *header = createHeader("accept", "text/html");
+			req.headers.insert(&header, fixturePool);
+			header = createHeader("accept-encoding", "gzip, deflate");
+			req.headers.insert(&header, fixturePool);
+
+			req.appResponse.httpMajor  = 1;
+			req.appResponse.httpMinor  = 1;
+			req.appResponse.httpState  = AppResponse::COMPLETE;
+			req.appResponse.bodyType   = AppResponse::RBT_CONTENT_LENGTH;
+			req.appResponse.aux.bodyInfo.contentLength = 5;
+			req.appResponse.statusCode = 200;
+			req.appResponse.date       = createLString(createDateString());
+			req.appResponse.setCookie  = NULL;
+			req.appResponse.cacheControl  = NULL;
+			req.appResponse.expiresHeader = NULL;
+			req.appResponse.lastModifiedHeader = NULL;
+			header = createHeader("cache-control", "public,max-age=99999");
+			req.appResponse.headers.insert(&header, fixturePool);
+			header = createHeader("content-length", "5");
+			req.appResponse.headers.insert(&header, fixturePool);
+		}
+
+		void usePath(unsigned int i) {
+			req.path = paths[i];
+		}
+
+		void resetScratchPoolEvery(unsigned long long i, unsigned int n) {
+			if (i % n == n - 1) {
+				psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+			}
+		}
+
+	public:
+		StaticString defaultVaryTurbocacheByCookie;
+
+		virtual void setUp() {
+			now = time(NULL);
+			fixturePool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			initRequest();
+
+			for (unsigned int i = 0; i < NPATHS; i++) {
+				string path = "/posts/" + toString(i * 1000 + 1234) + "?page=2";
+				psg_lstr_init(&paths[i]);
+				psg_lstr_append(&paths[i], fixturePool, path.data(), path.size());
+
+				usePath(i);
+				responseCache.prepareRequest(this, &req);
+				cacheKeys[i] = psg_pstrdup(fixturePool, req.cacheKey);
+			}
+		}
+
+		virtual void tearDown() {
+			req.headers.clear();
+			req.appResponse.headers.clear();
+			psg_lstr_init(&req.path);
+			psg_destroy_pool(req.pool);
+			psg_destroy_pool(fixturePool);
+		}
+	};
+
+	/** Generating the cache key and looking up request headers, per request. */
+	class ResponseCachePrepareRequestBenchmark: public ResponseCacheBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				usePath(i % NPATHS);
+				doNotOptimizeAway(responseCache.prepareRequest(this, &req));
+				resetScratchPoolEvery(i, 64);
+			}
+		}
+	};
+
+	class ResponseCacheFetchHitBenchmark: public ResponseCacheBenchmark {
+	public:
+		virtual void setUp() {
+			ResponseCacheBenchmark::setUp();
+			for (unsigned int i = 0; i < NPATHS; i++) {
+				req.cacheKey = cacheKeys[i];
+				responseCache.prepareRequestForStoring(&req);
+				responseCache.store(&req, now, 64, 5);
+			}
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				req.cacheKey = cacheKeys[i % NPATHS];
+				ResponseCacheType::Entry entry(responseCache.fetch(&req, now));
+				doNotOptimizeAway(entry.index);
+			}
+		}
+	};
+
+	class ResponseCacheFetchMissBenchmark: public ResponseCacheBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				req.cacheKey = cacheKeys[i % NPATHS];
+				ResponseCacheType::Entry entry(responseCache.fetch(&req, now));
+				doNotOptimizeAway(entry.index);
+			}
+		}
+	};
+
+	/**
+	 * One operation = checking that the response is cacheable, parsing
+	 * its date and expiry, and storing it.
+	 */
+	class ResponseCacheStoreBenchmark: public ResponseCacheBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				req.cacheKey = cacheKeys[i % NPATHS];
+				req.appResponse.cacheControl = NULL;
+				req.appResponse.expiresHeader = NULL;
+				req.appResponse.lastModifiedHeader = NULL;
+				doNotOptimizeAway(responseCache.prepareRequestForStoring(&req));
+				ResponseCacheType::Entry entry(responseCache.store(&req, now, 64, 5));
+				doNotOptimizeAway(entry.index);
+				resetScratchPoolEvery(i, 64);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(ResponseCachePrepareRequestBenchmark, "ResponseCache.prepareRequest");
+REGISTER_BENCHMARK(ResponseCacheFetchHitBenchmark, "ResponseCache.fetch_hit");
+REGISTER_BENCHMARK(ResponseCacheFetchMissBenchmark, "ResponseCache.fetch_miss");
+REGISTER_BENCHMARK(ResponseCacheStoreBenchmark, "ResponseCache.store");
@@ -0,0 +1,109 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <sys/uio.h>
+#include <ev.h>
+#include <Constants.h>
+#include <Logging.h>
+#include <MemoryKit/palloc.h>
+#include <ServerKit/Context.h>
+#include <Core/Controller.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::Core;
+using namespace std;
+
+namespace Passenger {
+namespace Benchmarks {
+
+
+/**
+ * One operation = constructing the response header buffers for a hello world
+ * response, like ControllerTest's "hello world response header" test does.
+ * Not in an anonymous namespace because Controller befriends it.
+ */
+class ResponseHeaderBenchmark: public Benchmark {
+private:
+	VariantMap options;
+	ServerKit::Context *context;
+	Controller *controller;
+	psg_pool_t *headerPool;
+	Request req;
+
+	ServerKit::Header *createHeader(const HashedStaticString &key, const StaticString &val) {
+		ServerKit::Header *header = (ServerKit::Header *) psg_palloc(headerPool,
+			sizeof(ServerKit::Header));
+		psg_lstr_init(&header->key);
+		psg_lstr_init(&header->origKey);
+		psg_lstr_init(&header->val);
+		psg_lstr_append(&header->key, headerPool, key.data(), key.size());
+		psg_lstr_append(&header->origKey, headerPool, key.data(), key.size());
+		psg_lstr_append(&header->val, headerPool, val.data(), val.size());
+		header->hash = key.hash();
+		return header;
+	}
+
+public:
+	virtual void setUp() {
+		options.setInt("stat_throttle_rate", DEFAULT_STAT_THROTTLE_RATE);
+		options.setInt("response_buffer_high_watermark", DEFAULT_RESPONSE_BUFFER_HIGH_WATERMARK);
+		options.setBool("show_version_in_header", true);
+		options.setBool("sticky_sessions", false);
+		options.setBool("core_graceful_exit", true);
+		options.setBool("multi_app", true);
+		options.set("default_ruby", DEFAULT_RUBY);
+		options.set("default_server_name", "localhost");
+		options.setInt("default_server_port", 80);
+		options.set("server_software", PROGRAM_NAME);
+		options.set("sticky_sessions_cookie_name", DEFAULT_STICKY_SESSIONS_COOKIE_NAME);
+
+		// Don't print the server's shutdown notice between the results.
+		setLogLevel(LVL_WARN);
+		// The Context takes ownership of the loop.
+		context = new ServerKit::Context(ev_loop_new(EVFLAG_AUTO));
+		controller = new Controller(context, &options);
+		headerPool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+		req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		req.httpMajor = 1;
+		req.httpMinor = 1;
+		req.bodyType = Request::RBT_NO_BODY;
+		req.wantKeepAlive = true;
+		req.dechunkResponse = false;
+		req.compressibleResponse = false;
+		req.stickySession = false;
+		req.appResponse.headers.clear();
+		req.appResponse.statusCode = 200;
+		req.appResponse.bodyType = AppResponse::RBT_CONTENT_LENGTH;
+		req.appResponse.aux.bodyInfo.contentLength = sizeof("hello world") - 1;
+		req.appResponse.date = NULL;
+		req.appResponse.setCookie = NULL;
+		ServerKit::Header *contentType = createHeader("content-type", "text/plain");
+		req.appResponse.headers.insert(&contentType, headerPool);
+	}
+
+	virtual void tearDown() {
+		req.appResponse.headers.clear();
+		psg_destroy_pool(req.pool);
+		psg_destroy_pool(headerPool);
+		controller->shutdown(true);
+		delete controller;
+		delete context;
+	}
+
+	virtual void run(unsigned long long iterations) {
+		struct iovec buffers[2];
+		unsigned int dataSize, cacheableSize;
+
+		for (unsigned long long i = 0; i < iterations; i++) {
+			psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+			doNotOptimizeAway(controller->constructHeaderBuffersForResponse(&req,
+				buffers, dataSize, cacheableSize));
+		}
+	}
+};
+
+
+} // namespace Benchmarks
+} // namespace Passenger
+
+REGISTER_BENCHMARK(ResponseHeaderBenchmark, "Controller.constructResponseHeader");
@@ -0,0 +1,105 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <string>
+#include <vector>
+#include <DataStructures/StringKeyTable.h>
+#include <Utils/StrIntUtils.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace std;
+
+namespace {
+	const unsigned int NKEYS = 64;
+
+	class StringKeyTableBenchmark: public Benchmark {
+	protected:
+		StringKeyTable<unsigned int> table;
+		vector<string> keyStrings;
+		vector<HashedStaticString> keys;
+
+	public:
+		virtual void setUp() {
+			// Keys that look like app group names.
+			for (unsigned int i = 0; i < NKEYS; i++) {
+				keyStrings.push_back("/var/www/app" + toString(i) + "/public (production)");
+			}
+			for (unsigned int i = 0; i < NKEYS; i++) {
+				keys.push_back(keyStrings[i]);
+			}
+		}
+
+		void insertAll() {
+			for (unsigned int i = 0; i < NKEYS; i++) {
+				table.insert(keys[i], i);
+			}
+		}
+	};
+
+	class StringKeyTableLookupHitBenchmark: public StringKeyTableBenchmark {
+	public:
+		virtual void setUp() {
+			StringKeyTableBenchmark::setUp();
+			insertAll();
+		}
+
+		virtual void run(unsigned long long iterations) {
+			unsigned int *value;
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(table.lookup(keys[i % NKEYS], &value));
+			}
+		}
+	};
+
+	class StringKeyTableLookupMissBenchmark: public StringKeyTableBenchmark {
+	private:
+		vector<string> missingKeyStrings;
+		vector<HashedStaticString> missingKeys;
+
+	public:
+		virtual void setUp() {
+			StringKeyTableBenchmark::setUp();
+			insertAll();
+			for (unsigned int i = 0; i < NKEYS; i++) {
+				missingKeyStrings.push_back("/var/www/app" + toString(i) + "/public (staging)");
+			}
+			for (unsigned int i = 0; i < NKEYS; i++) {
+				missingKeys.push_back(missingKeyStrings[i]);
+			}
+		}
+
+		virtual void run(unsigned long long iterations) {
+			unsigned int *value;
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(table.lookup(missingKeys[i % NKEYS], &value));
+			}
+		}
+	};
+
+	/** One operation = inserting NKEYS keys into a table and clearing it. */
+	class StringKeyTableInsertBenchmark: public StringKeyTableBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				insertAll();
+				doNotOptimizeAway(table.size());
+				table.clear();
+			}
+		}
+	};
+
+	/** Hashing is done by callers before every lookup, so it's measured separately. */
+	class StringKeyTableHashBenchmark: public StringKeyTableBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				HashedStaticString key(keyStrings[i % NKEYS]);
+				doNotOptimizeAway(key.hash());
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(StringKeyTableLookupHitBenchmark, "StringKeyTable.lookup_hit");
+REGISTER_BENCHMARK(StringKeyTableLookupMissBenchmark, "StringKeyTable.lookup_miss");
+REGISTER_BENCHMARK(StringKeyTableInsertBenchmark, "StringKeyTable.insert_64_keys");
+REGISTER_BENCHMARK(StringKeyTableHashBenchmark, "StringKeyTable.hash_key");
@@ -0,0 +1,63 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <Constants.h>
+#include <MemoryKit/mbuf.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::MemoryKit;
+using namespace std;
+
+namespace {
+	class MbufBenchmark: public Benchmark {
+	protected:
+		struct mbuf_pool pool;
+
+	public:
+		virtual void setUp() {
+			pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+			mbuf_pool_init(&pool);
+		}
+
+		virtual void tearDown() {
+			mbuf_pool_deinit(&pool);
+		}
+	};
+
+	/** Getting a block from the freelist and returning it. */
+	class MbufGetBenchmark: public MbufBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				mbuf buffer(mbuf_get(&pool));
+				doNotOptimizeAway(buffer.start);
+			}
+		}
+	};
+
+	/** Taking a subset of an existing mbuf, which is what parsers do to avoid copying. */
+	class MbufSubsetBenchmark: public MbufBenchmark {
+	private:
+		mbuf buffer;
+
+	public:
+		virtual void setUp() {
+			MbufBenchmark::setUp();
+			buffer = mbuf_get(&pool);
+		}
+
+		virtual void tearDown() {
+			buffer = mbuf();
+			MbufBenchmark::tearDown();
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				mbuf subset(buffer, i & 1023, 64);
+				doNotOptimizeAway(subset.start);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(MbufGetBenchmark, "mbuf.get_and_release");
+REGISTER_BENCHMARK(MbufSubsetBenchmark, "mbuf.subset");
@@ -0,0 +1,72 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <MemoryKit/palloc.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace std;
+
+namespace {
+	class PallocBenchmark: public Benchmark {
+	protected:
+		psg_pool_t *pool;
+
+	public:
+		virtual void setUp() {
+			pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+		}
+
+		virtual void tearDown() {
+			psg_destroy_pool(pool);
+		}
+	};
+
+	/**
+	 * Small allocations that fit in the first pool block. The pool is reset
+	 * every 128 allocations (8 KB), which is included in the measurement but
+	 * amortized.
+	 */
+	class PallocSmallBenchmark: public PallocBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(psg_palloc(pool, 64));
+				if ((i & 127) == 127) {
+					psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+				}
+			}
+		}
+	};
+
+	/**
+	 * One operation = the allocation pattern of a request with 24 headers,
+	 * followed by a pool reset, like HttpServer does between requests.
+	 */
+	class PallocRequestCycleBenchmark: public PallocBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				for (unsigned int j = 0; j < 24; j++) {
+					doNotOptimizeAway(psg_palloc(pool, 48));
+					doNotOptimizeAway(psg_pnalloc(pool, 16 + j * 4));
+				}
+				psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE);
+			}
+		}
+	};
+
+	/** Allocations that are larger than PSG_MAX_ALLOC_FROM_POOL. */
+	class PallocLargeBenchmark: public PallocBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				void *p = psg_palloc(pool, 8192);
+				doNotOptimizeAway(p);
+				psg_pfree(pool, p);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(PallocSmallBenchmark, "psg_palloc.small");
+REGISTER_BENCHMARK(PallocRequestCycleBenchmark, "psg_palloc.request_cycle");
+REGISTER_BENCHMARK(PallocLargeBenchmark, "psg_palloc.large_and_pfree");
@@ -0,0 +1,140 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <vector>
+#include <MemoryKit/palloc.h>
+#include <ServerKit/HeaderTable.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace {
+	// The headers of a typical browser request, downcased like HttpHeaderParser does.
+	const char *HEADERS[][2] = {
+		{ "host", "www.example.com" },
+		{ "connection", "keep-alive" },
+		{ "accept", "text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8" },
+		{ "user-agent", "Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36" },
+		{ "accept-encoding", "gzip, deflate, sdch" },
+		{ "accept-language", "en-US,en;q=0.8" },
+		{ "cookie", "_session_id=5f2b0a9c8d7e6f5a4b3c2d1e0f9a8b7c" },
+		{ "referer", "http://www.example.com/posts" },
+		{ "cache-control", "max-age=0" },
+		{ "upgrade-insecure-requests", "1" },
+		{ "if-none-match", "\"686897696a7c876b7e\"" },
+		{ "x-forwarded-for", "10.0.0.1" }
+	};
+	const unsigned int NHEADERS = sizeof(HEADERS) / sizeof(HEADERS[0]);
+
+	class HeaderTableBenchmark: public Benchmark {
+	protected:
+		psg_pool_t *pool;
+		HeaderTable table;
+		vector<Header *> headers;
+		vector<HashedStaticString> keys;
+
+		Header *createHeader(const HashedStaticString &key, const StaticString &val) {
+			Header *header = (Header *) psg_palloc(pool, sizeof(Header));
+			psg_lstr_init(&header->key);
+			psg_lstr_init(&header->origKey);
+			psg_lstr_init(&header->val);
+			psg_lstr_append(&header->key, pool, key.data(), key.size());
+			psg_lstr_append(&header->origKey, pool, key.data(), key.size());
+			psg_lstr_append(&header->val, pool, val.data(), val.size());
+			header->hash = key.hash();
+			return header;
+		}
+
+		void insertAll() {
+			for (unsigned int i = 0; i < NHEADERS; i++) {
+				Header *header = headers[i];
+				table.insert(&header, pool);
+			}
+		}
+
+	public:
+		virtual void setUp() {
+			pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			for (unsigned int i = 0; i < NHEADERS; i++) {
+				keys.push_back(HEADERS[i][0]);
+				headers.push_back(createHeader(keys.back(), HEADERS[i][1]));
+			}
+		}
+
+		virtual void tearDown() {
+			table.clear();
+			psg_destroy_pool(pool);
+		}
+	};
+
+	class HeaderTableLookupHitBenchmark: public HeaderTableBenchmark {
+	public:
+		virtual void setUp() {
+			HeaderTableBenchmark::setUp();
+			insertAll();
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(table.lookup(keys[i % NHEADERS]));
+			}
+		}
+	};
+
+	class HeaderTableLookupMissBenchmark: public HeaderTableBenchmark {
+	private:
+		vector<HashedStaticString> missingKeys;
+
+	public:
+		virtual void setUp() {
+			HeaderTableBenchmark::setUp();
+			insertAll();
+			missingKeys.push_back("content-length");
+			missingKeys.push_back("transfer-encoding");
+			missingKeys.push_back("x-sendfile");
+			missingKeys.push_back("x-accel-redirect");
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(table.lookup(missingKeys[i % missingKeys.size()]));
+			}
+		}
+	};
+
+	/** One operation = inserting all headers of a request and clearing the table. */
+	class HeaderTableInsertBenchmark: public HeaderTableBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				insertAll();
+				doNotOptimizeAway(table.size());
+				table.clear();
+			}
+		}
+	};
+
+	/** One operation = iterating over all headers of a request. */
+	class HeaderTableIterateBenchmark: public HeaderTableBenchmark {
+	public:
+		virtual void setUp() {
+			HeaderTableBenchmark::setUp();
+			insertAll();
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				HeaderTable::Iterator it(table);
+				while (*it != NULL) {
+					doNotOptimizeAway(it->header->val.size);
+					it.next();
+				}
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(HeaderTableLookupHitBenchmark, "HeaderTable.lookup_hit");
+REGISTER_BENCHMARK(HeaderTableLookupMissBenchmark, "HeaderTable.lookup_miss");
+REGISTER_BENCHMARK(HeaderTableInsertBenchmark, "HeaderTable.insert_request_headers");
+REGISTER_BENCHMARK(HeaderTableIterateBenchmark, "HeaderTable.iterate_request_headers");
@@ -0,0 +1,201 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <algorithm>
+#include <ServerKit/HttpCompression.h>
+#include <Utils.h>
+#include <Utils/IOUtils.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace {
+	const char *CORPUS_FILES[] = {
+		"changelog.html",
+		"bootstrap.min.css",
+		"logger.js",
+		"npm-shrinkwrap.json",
+		"smart_spawning.svg",
+		"random.bin"
+	};
+	const unsigned int NCORPUS_FILES = sizeof(CORPUS_FILES) / sizeof(CORPUS_FILES[0]);
+
+	// The amount of data that the Core controller typically receives from
+	// the app per event: one mbuf.
+	const size_t FEED_SIZE = 480;
+
+	/** See test/stub/compression/README. */
+	string readCorpusFile(const char *name) {
+		// `rake benchmark:cxx` runs from the source root, while the unit tests
+		// run from the test directory.
+		const char *dirs[] = { "test/stub/compression/", "stub/compression/" };
+		for (unsigned int i = 0; i < sizeof(dirs) / sizeof(dirs[0]); i++) {
+			string path = string(dirs[i]) + name;
+			if (fileExists(path)) {
+				return readAll(path);
+			}
+		}
+		fprintf(stderr, "*** ERROR: cannot find the compression corpus file %s. "
+			"Please run the benchmark from the source root\n", name);
+		abort();
+	}
+
+	/**
+	 * Compresses `data` the way the Core controller compresses a streamed
+	 * response: one NO_FLUSH call per FEED_SIZE bytes, then FINISH.
+	 */
+	size_t compressStreaming(GzipCompressor &compressor, int level, const string &data) {
+		char output[1024 * 16];
+		size_t total = 0;
+		bool done;
+
+		compressor.start(level);
+		for (size_t pos = 0; pos < data.size(); pos += FEED_SIZE) {
+			compressor.feed(data.data() + pos, std::min(FEED_SIZE, data.size() - pos));
+			do {
+				total += compressor.compress(output, sizeof(output),
+					GzipCompressor::NO_FLUSH, done);
+			} while (!done);
+		}
+		compressor.feed(NULL, 0);
+		do {
+			total += compressor.compress(output, sizeof(output),
+				GzipCompressor::FINISH, done);
+		} while (!done);
+		return total;
+	}
+
+	/** One operation = compressing a whole corpus file as a streamed response. */
+	template<unsigned int fileIndex, int level>
+	class GzipStreamBenchmark: public Benchmark {
+	private:
+		GzipCompressor compressor;
+		string data;
+
+	public:
+		virtual void setUp() {
+			data = readCorpusFile(CORPUS_FILES[fileIndex]);
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(compressStreaming(compressor, level, data));
+			}
+		}
+	};
+
+	/**
+	 * One operation = compressing a whole corpus file in one call, the way
+	 * the Core controller compresses a response that it stores in the
+	 * turbocache.
+	 */
+	template<unsigned int fileIndex, int level>
+	class GzipCompressAllBenchmark: public Benchmark {
+	private:
+		GzipCompressor compressor;
+		string data, output;
+
+	public:
+		virtual void setUp() {
+			data = readCorpusFile(CORPUS_FILES[fileIndex]);
+			output.resize(data.size() * 2);
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(compressor.compressAll(level, data.data(), data.size(),
+					&output[0], output.size()));
+			}
+		}
+	};
+
+	const char SMALL_RESPONSE[] =
+		"{\"id\":1234,\"title\":\"Hello world\",\"body\":\"Lorem ipsum dolor sit amet, "
+		"consectetur adipiscing elit, sed do eiusmod tempor incididunt ut labore et "
+		"dolore magna aliqua.\",\"tags\":[\"hello\",\"world\"],\"published\":true}";
+
+	/**
+	 * One operation = compressing a small JSON response with a compressor
+	 * that is reused, the way the Core controller reuses idle compressors.
+	 */
+	class GzipReusedCompressorBenchmark: public Benchmark {
+	private:
+		GzipCompressor compressor;
+		char output[1024];
+
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(compressor.compressAll(1, SMALL_RESPONSE,
+					sizeof(SMALL_RESPONSE) - 1, output, sizeof(output)));
+			}
+		}
+	};
+
+	/** Like GzipReusedCompressorBenchmark, but with a new compressor each time. */
+	class GzipNewCompressorBenchmark: public Benchmark {
+	private:
+		char output[1024];
+
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				GzipCompressor compressor;
+				doNotOptimizeAway(compressor.compressAll(1, SMALL_RESPONSE,
+					sizeof(SMALL_RESPONSE) - 1, output, sizeof(output)));
+			}
+		}
+	};
+
+	typedef GzipStreamBenchmark<0, 1> GzipStreamHtmlBenchmark;
+	typedef GzipStreamBenchmark<1, 1> GzipStreamCssBenchmark;
+	typedef GzipStreamBenchmark<3, 1> GzipStreamJsonBenchmark;
+	typedef GzipStreamBenchmark<5, 1> GzipStreamRandomBenchmark;
+	typedef GzipCompressAllBenchmark<0, 9> GzipCompressAllHtmlBenchmark;
+	typedef GzipCompressAllBenchmark<3, 9> GzipCompressAllJsonBenchmark;
+
+	/**
+	 * Prints the compression ratio and throughput for each corpus file at
+	 * levels 1 (the default for streamed responses), 6 and 9 (turbocache).
+	 * Throughput is per core: compression runs on the event loop thread.
+	 */
+	void reportCompressionRatios() {
+		const int levels[] = { 1, 6, 9 };
+		GzipCompressor compressor;
+
+		printf("  %-22s %8s %6s %10s %8s\n", "File", "Size", "Level",
+			"Compressed", "MB/s");
+		for (unsigned int i = 0; i < NCORPUS_FILES; i++) {
+			string data = readCorpusFile(CORPUS_FILES[i]);
+			for (unsigned int j = 0; j < sizeof(levels) / sizeof(levels[0]); j++) {
+				size_t compressed = compressStreaming(compressor, levels[j], data);
+				unsigned long long iterations = 0;
+				unsigned long long startTime = getMonotonicNsec();
+				unsigned long long elapsed;
+				do {
+					doNotOptimizeAway(compressStreaming(compressor, levels[j], data));
+					iterations++;
+					elapsed = getMonotonicNsec() - startTime;
+				} while (elapsed < 100000000ull);
+
+				printf("  %-22s %8u %6d %9.1f%% %8.1f\n", CORPUS_FILES[i],
+					(unsigned int) data.size(), levels[j],
+					compressed * 100.0 / data.size(),
+					data.size() * iterations / (elapsed / 1000000000.0) / 1024 / 1024);
+			}
+		}
+	}
+}
+
+REGISTER_BENCHMARK(GzipStreamHtmlBenchmark, "GzipCompressor.stream_html_level1");
+REGISTER_BENCHMARK(GzipStreamCssBenchmark, "GzipCompressor.stream_css_level1");
+REGISTER_BENCHMARK(GzipStreamJsonBenchmark, "GzipCompressor.stream_json_level1");
+REGISTER_BENCHMARK(GzipStreamRandomBenchmark, "GzipCompressor.stream_random_level1");
+REGISTER_BENCHMARK(GzipCompressAllHtmlBenchmark, "GzipCompressor.compress_all_html_level9");
+REGISTER_BENCHMARK(GzipCompressAllJsonBenchmark, "GzipCompressor.compress_all_json_level9");
+REGISTER_BENCHMARK(GzipReusedCompressorBenchmark, "GzipCompressor.small_response_reused");
+REGISTER_BENCHMARK(GzipNewCompressorBenchmark, "GzipCompressor.small_response_new");
+REGISTER_REPORT(reportCompressionRatios, "GzipCompressor.corpus");
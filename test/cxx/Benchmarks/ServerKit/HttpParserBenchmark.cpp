@@ -0,0 +1,204 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <ev.h>
+#include <Constants.h>
+#include <MemoryKit/mbuf.h>
+#include <MemoryKit/palloc.h>
+#include <ServerKit/Context.h>
+#include <ServerKit/HttpRequest.h>
+#include <ServerKit/HttpHeaderParser.h>
+#include <ServerKit/HttpChunkedBodyParser.h>
+#include <ServerKit/http_parser.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace {
+	const char REQUEST[] =
+		"GET /posts/1234?page=2 HTTP/1.1\r\n"
+		"Host: www.example.com\r\n"
+		"Connection: keep-alive\r\n"
+		"Accept: text/html,application/xhtml+xml,application/xml;q=0.9,*/*;q=0.8\r\n"
+		"User-Agent: Mozilla/5.0 (X11; Linux x86_64) AppleWebKit/537.36 "
+			"(KHTML, like Gecko) Chrome/49.0.2623.87 Safari/537.36\r\n"
+		"Accept-Encoding: gzip, deflate, sdch\r\n"
+		"Accept-Language: en-US,en;q=0.8,nl;q=0.6\r\n"
+		"Cookie: _session_id=5f2b0a9c8d7e6f5a4b3c2d1e0f9a8b7c; locale=en\r\n"
+		"Referer: http://www.example.com/posts\r\n"
+		"Cache-Control: max-age=0\r\n"
+		"Upgrade-Insecure-Requests: 1\r\n"
+		"\r\n";
+	const size_t REQUEST_SIZE = sizeof(REQUEST) - 1;
+
+	/** The raw http_parser with no callbacks, i.e. the tokenizer cost only. */
+	class HttpParserExecuteBenchmark: public Benchmark {
+	private:
+		http_parser parser;
+		http_parser_settings settings;
+
+	public:
+		virtual void setUp() {
+			memset(&settings, 0, sizeof(settings));
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				http_parser_init(&parser, HTTP_REQUEST);
+				doNotOptimizeAway(http_parser_execute(&parser, &settings,
+					REQUEST, REQUEST_SIZE));
+			}
+		}
+	};
+
+	/**
+	 * One operation = parsing the request headers into a request object,
+	 * including the header table, and resetting the request for reuse
+	 * the way HttpServer does.
+	 */
+	class HttpHeaderParserBenchmark: public Benchmark {
+	private:
+		Context *context;
+		HttpHeaderParserState parserState;
+		BaseHttpRequest req;
+		MemoryKit::mbuf buffer;
+
+		void reinitializeRequest() {
+			req.httpMajor = 1;
+			req.httpMinor = 0;
+			req.httpState = BaseHttpRequest::PARSING_HEADERS;
+			req.bodyType  = BaseHttpRequest::RBT_NO_BODY;
+			req.method    = HTTP_GET;
+			req.wantKeepAlive = false;
+			req.parserState.headerParser = &parserState;
+			psg_lstr_init(&req.path);
+			req.queryStringIndex = -1;
+		}
+
+		void deinitializeRequest() {
+			HeaderTable::Iterator it(req.headers);
+			while (*it != NULL) {
+				psg_lstr_deinit(&it->header->key);
+				psg_lstr_deinit(&it->header->origKey);
+				psg_lstr_deinit(&it->header->val);
+				it.next();
+			}
+			psg_lstr_deinit(&req.path);
+			req.headers.clear();
+			req.secureHeaders.clear();
+			psg_reset_pool(req.pool, PSG_DEFAULT_POOL_SIZE);
+		}
+
+	public:
+		virtual void setUp() {
+			// The Context takes ownership of the loop.
+			context = new Context(ev_loop_new(EVFLAG_AUTO));
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			buffer = MemoryKit::mbuf_get_with_size(&context->mbuf_pool, REQUEST_SIZE);
+			memcpy(buffer.start, REQUEST, REQUEST_SIZE);
+
+			run(1);
+			if (req.httpState != BaseHttpRequest::COMPLETE) {
+				fprintf(stderr, "*** ERROR: the request could not be parsed\n");
+				abort();
+			}
+		}
+
+		virtual void tearDown() {
+			buffer = MemoryKit::mbuf();
+			psg_destroy_pool(req.pool);
+			delete context;
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				reinitializeRequest();
+				HttpHeaderParser<BaseHttpRequest> parser(context, &parserState,
+					&req, req.pool);
+				parser.initialize();
+				doNotOptimizeAway(parser.feed(buffer));
+				deinitializeRequest();
+			}
+		}
+	};
+
+	/**
+	 * One operation = dechunking a body of 64 chunks of 16 bytes each, the
+	 * way a streaming API response looks, with one feed() call per event
+	 * like the Controller does.
+	 */
+	template<bool fastPath>
+	class HttpChunkedBodyParserBenchmark: public Benchmark {
+	private:
+		struct MemoryKit::mbuf_pool pool;
+		HttpChunkedBodyParserState state;
+		MemoryKit::mbuf buffer;
+
+		static unsigned int formatLoggingPrefix(char *buf, unsigned int bufsize,
+			void *userData)
+		{
+			return snprintf(buf, bufsize, "ChunkedBodyParser: ");
+		}
+
+		size_t parse() {
+			HttpChunkedBodyParser parser(&state, formatLoggingPrefix, NULL, fastPath);
+			MemoryKit::mbuf remaining(buffer);
+			size_t dataSize = 0;
+
+			parser.initialize();
+			while (!remaining.empty()) {
+				HttpChunkedEvent event(parser.feed(remaining));
+				dataSize += event.data.size();
+				if (event.type == HttpChunkedEvent::END) {
+					break;
+				}
+				remaining = MemoryKit::mbuf(remaining, event.consumed);
+			}
+			return dataSize;
+		}
+
+	public:
+		virtual void setUp() {
+			string body;
+			for (unsigned int i = 0; i < 64; i++) {
+				body.append("10\r\n{\"event\":\"tick\"}\r\n");
+			}
+			body.append("0\r\n\r\n");
+
+			pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+			MemoryKit::mbuf_pool_init(&pool);
+			buffer = MemoryKit::mbuf_get_with_size(&pool, body.size());
+			memcpy(buffer.start, body.data(), body.size());
+
+			if (parse() != 64 * 16) {
+				fprintf(stderr, "*** ERROR: the body could not be parsed\n");
+				abort();
+			}
+		}
+
+		virtual void tearDown() {
+			buffer = MemoryKit::mbuf();
+			MemoryKit::mbuf_pool_deinit(&pool);
+		}
+
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(parse());
+			}
+		}
+	};
+
+	typedef HttpChunkedBodyParserBenchmark<true> HttpChunkedBodyParserFastPathBenchmark;
+	typedef HttpChunkedBodyParserBenchmark<false> HttpChunkedBodyParserStateMachineBenchmark;
+}
+
+REGISTER_BENCHMARK(HttpParserExecuteBenchmark, "http_parser.execute_request");
+REGISTER_BENCHMARK(HttpHeaderParserBenchmark, "HttpHeaderParser.parse_request");
+REGISTER_BENCHMARK(HttpChunkedBodyParserFastPathBenchmark,
+	"HttpChunkedBodyParser.small_chunks");
+REGISTER_BENCHMARK(HttpChunkedBodyParserStateMachineBenchmark,
+	"HttpChunkedBodyParser.small_chunks_state_machine");
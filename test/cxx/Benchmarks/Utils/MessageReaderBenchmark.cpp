@@ -0,0 +1,75 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <string>
+#include <vector>
+#include <boost/cstdint.hpp>
+#include <arpa/inet.h>
+#include <FileDescriptor.h>
+#include <Utils/IOUtils.h>
+#include <Utils/MessageIO.h>
+#include <Utils/BufferedMessageReader.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace std;
+
+namespace {
+	/**
+	 * One operation = writing a batch of 16 small array messages to a
+	 * socket pair in a single write, and reading them back one by one.
+	 */
+	class MessageReaderBenchmark: public Benchmark {
+	protected:
+		static const unsigned int BATCH = 16;
+		SocketPair sockets;
+		string batch;
+
+	public:
+		virtual void setUp() {
+			string body = string("status") + '\0' + "ok" + '\0';
+			boost::uint16_t size = htons(body.size());
+			string message = string((const char *) &size, sizeof(size)) + body;
+
+			sockets = createUnixSocketPair(__FILE__, __LINE__);
+			batch.clear();
+			for (unsigned int i = 0; i < BATCH; i++) {
+				batch.append(message);
+			}
+		}
+
+		virtual void tearDown() {
+			sockets.first.close();
+			sockets.second.close();
+		}
+	};
+
+	/** Using readArrayMessage() from MessageIO.h, which reads byte ranges with separate syscalls. */
+	class UnbufferedReadArrayMessageBenchmark: public MessageReaderBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			vector<string> args;
+			for (unsigned long long i = 0; i < iterations; i++) {
+				writeExact(sockets.second, batch);
+				for (unsigned int j = 0; j < BATCH; j++) {
+					doNotOptimizeAway(readArrayMessage(sockets.first, args));
+				}
+			}
+		}
+	};
+
+	class BufferedReadArrayMessageBenchmark: public MessageReaderBenchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			BufferedMessageReader reader(sockets.first);
+			vector<StaticString> args;
+			for (unsigned long long i = 0; i < iterations; i++) {
+				writeExact(sockets.second, batch);
+				for (unsigned int j = 0; j < BATCH; j++) {
+					doNotOptimizeAway(reader.readArrayMessage(args));
+				}
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(UnbufferedReadArrayMessageBenchmark, "MessageIO.readArrayMessageBatch");
+REGISTER_BENCHMARK(BufferedReadArrayMessageBenchmark, "BufferedMessageReader.readArrayMessageBatch");
@@ -0,0 +1,70 @@
+#include <Benchmarks/BenchmarkSupport.h>
+#include <string>
+#include <Utils/StrIntUtils.h>
+
+using namespace Passenger;
+using namespace Passenger::Benchmarks;
+using namespace std;
+
+namespace {
+	// A mix of sizes like the ones found in Content-Length headers and PIDs.
+	const char *NUMBERS[] = { "0", "5", "1234", "65536", "8388608", "3000000000" };
+	const char *HEX_NUMBERS[] = { "0", "5", "4d2", "10000", "800000", "b2d05e00" };
+	const unsigned int VALUES[] = { 0, 5, 1234, 65536, 8388608, 3000000000u };
+	const unsigned int NVALUES = sizeof(VALUES) / sizeof(VALUES[0]);
+
+	class StringToULLBenchmark: public Benchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(stringToULL(NUMBERS[i % NVALUES]));
+			}
+		}
+	};
+
+	class HexToULLBenchmark: public Benchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(hexToULL(HEX_NUMBERS[i % NVALUES]));
+			}
+		}
+	};
+
+	class UintToStringBenchmark: public Benchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			char buf[sizeof(unsigned int) * 4];
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(uintToString(VALUES[i % NVALUES], buf, sizeof(buf)));
+			}
+		}
+	};
+
+	class IntegerToHexBenchmark: public Benchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			char buf[sizeof(unsigned int) * 2 + 1];
+			for (unsigned long long i = 0; i < iterations; i++) {
+				doNotOptimizeAway(integerToHex(VALUES[i % NVALUES], buf));
+			}
+		}
+	};
+
+	/** The std::string returning variant, for comparison with the buffer-based ones. */
+	class ToStringBenchmark: public Benchmark {
+	public:
+		virtual void run(unsigned long long iterations) {
+			for (unsigned long long i = 0; i < iterations; i++) {
+				string result = toString(VALUES[i % NVALUES]);
+				doNotOptimizeAway(result);
+			}
+		}
+	};
+}
+
+REGISTER_BENCHMARK(StringToULLBenchmark, "StrIntUtils.stringToULL");
+REGISTER_BENCHMARK(HexToULLBenchmark, "StrIntUtils.hexToULL");
+REGISTER_BENCHMARK(UintToStringBenchmark, "StrIntUtils.uintToString");
+REGISTER_BENCHMARK(IntegerToHexBenchmark, "StrIntUtils.integerToHex");
+REGISTER_BENCHMARK(ToStringBenchmark, "StrIntUtils.toString");
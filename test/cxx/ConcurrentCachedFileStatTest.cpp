@@ -0,0 +1,211 @@
+#include "TestSupport.h"
+#include "Utils/ConcurrentCachedFileStat.hpp"
+#include "Utils/SystemTime.h"
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+#include <sys/types.h>
+#include <utime.h>
+
+using namespace std;
+using namespace Passenger;
+
+namespace tut {
+	struct ConcurrentCachedFileStatTest {
+		struct stat buf;
+
+		~ConcurrentCachedFileStatTest() {
+			SystemTime::release();
+			unlink("test.txt");
+			unlink("test2.txt");
+		}
+	};
+
+	DEFINE_TEST_GROUP(ConcurrentCachedFileStatTest);
+
+	static void touch(const char *filename, time_t timestamp = 0) {
+		FILE *f = fopen(filename, "w");
+		fprintf(f, "hi");
+		fclose(f);
+		if (timestamp != 0) {
+			struct utimbuf buf;
+			buf.actime = timestamp;
+			buf.modtime = timestamp;
+			utime(filename, &buf);
+		}
+	}
+
+	TEST_METHOD(1) {
+		set_test_name("It does not re-stat a file until the cache has expired");
+		ConcurrentCachedFileStat stat(16);
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		ensure_equals("(1)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("(2)", (long) buf.st_size, (long) 2);
+
+		touch("test.txt", 1000);
+		ensure_equals("(3)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("Cached value was used", buf.st_mtime, (time_t) 1);
+
+		SystemTime::force(6);
+		ensure_equals("(4)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("Cache has been invalidated", buf.st_mtime, (time_t) 1000);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It caches stat() errors until the cache has expired");
+		ConcurrentCachedFileStat stat(16);
+
+		SystemTime::force(5);
+		ensure_equals("(1)", stat.stat("test.txt", &buf, 1), -1);
+		ensure_equals("(2)", errno, ENOENT);
+
+		errno = EEXIST;
+		touch("test.txt", 1000);
+		ensure_equals("(3)", stat.stat("test.txt", &buf, 1), -1);
+		ensure_equals("(4)", errno, ENOENT);
+		ensure_equals("(5)", buf.st_mtime, (time_t) 0);
+
+		SystemTime::force(6);
+		ensure_equals("(6)", stat.stat("test.txt", &buf, 1), 0);
+		ensure_equals("(7)", buf.st_mtime, (time_t) 1000);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("A throttle rate of 0 bypasses the cache");
+		ConcurrentCachedFileStat stat(16);
+		SystemTime::force(5);
+		ensure_equals("(1)", stat.stat("test.txt", &buf, 0), -1);
+		touch("test.txt");
+		ensure_equals("(2)", stat.stat("test.txt", &buf, 0), 0);
+		ensure("(3)", !stat.knows("test.txt"));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The cache never grows beyond its capacity, and all"
+			" remaining entries can still be found after evictions");
+		ConcurrentCachedFileStat stat(64);
+		unsigned int i;
+
+		SystemTime::force(5);
+		for (i = 0; i < 1000; i++) {
+			stat.stat("nonexistant/" + toString(i), &buf, 1);
+		}
+		ensure("(1)", stat.size() <= stat.capacity());
+		ensure_equals("(2)", stat.capacity(), 64u);
+
+		unsigned int known = 0;
+		for (i = 0; i < 1000; i++) {
+			if (stat.knows("nonexistant/" + toString(i))) {
+				known++;
+			}
+		}
+		ensure_equals("(3)", known, stat.size());
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Entries that are used between evictions are never evicted");
+		ConcurrentCachedFileStat stat(64);
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		stat.stat("test.txt", &buf, 1);
+
+		for (unsigned int i = 0; i < 1000; i++) {
+			stat.stat("nonexistant/" + toString(i), &buf, 1);
+			stat.stat("test.txt", &buf, 1);
+			ensure(stat.knows("test.txt"));
+		}
+		ensure_equals(stat.size(), 64u);
+	}
+
+
+	TEST_METHOD(6) {
+		set_test_name("It counts cache hits and misses");
+		ConcurrentCachedFileStat stat(16);
+
+		SystemTime::force(5);
+		touch("test.txt", 1);
+		stat.stat("test.txt", &buf, 1);
+		ensure_equals("(1)", stat.getHits(), 0ull);
+		ensure_equals("(2)", stat.getMisses(), 1ull);
+
+		stat.stat("test.txt", &buf, 1);
+		stat.stat("test2.txt", &buf, 1);
+		ensure_equals("(3)", stat.getHits(), 1ull);
+		ensure_equals("(4)", stat.getMisses(), 2ull);
+
+		stat.stat("test.txt", &buf, 0);
+		ensure_equals("A throttle rate of 0 is not counted (1)", stat.getHits(), 1ull);
+		ensure_equals("A throttle rate of 0 is not counted (2)", stat.getMisses(), 2ull);
+
+		SystemTime::force(6);
+		stat.stat("test.txt", &buf, 1);
+		ensure_equals("An expired entry is a miss (1)", stat.getHits(), 1ull);
+		ensure_equals("An expired entry is a miss (2)", stat.getMisses(), 3ull);
+	}
+
+
+	/************ Concurrency ************/
+
+	static void statMany(ConcurrentCachedFileStat *stat, const vector<string> *files,
+		unsigned int iterations, time_t expectedMtime, AtomicInt *mismatches)
+	{
+		struct stat buf;
+		for (unsigned int i = 0; i < iterations; i++) {
+			if (stat->stat((*files)[i % files->size()], &buf, 10) != 0
+			 || buf.st_mtime != expectedMtime)
+			{
+				(*mismatches)++;
+			}
+		}
+	}
+
+	static void runThreads(boost::function<void ()> func, unsigned int nthreads) {
+		boost::thread_group threads;
+		for (unsigned int i = 0; i < nthreads; i++) {
+			threads.create_thread(func);
+		}
+		threads.join_all();
+	}
+
+	TEST_METHOD(10) {
+		set_test_name("Concurrent lookups and refreshes from many threads"
+			" keep a single, up-to-date entry per file");
+		const unsigned int NTHREADS = 16;
+		const unsigned int NFILES = 200;
+		const unsigned int ITERATIONS = 2000;
+		TempDir dir("tmp.cstat");
+		ConcurrentCachedFileStat stat(1024);
+		vector<string> files;
+		AtomicInt mismatches;
+
+		for (unsigned int i = 0; i < NFILES; i++) {
+			files.push_back("tmp.cstat/file" + toString(i));
+			touch(files.back().c_str(), 1);
+		}
+
+		SystemTime::force(5);
+		runThreads(boost::bind(statMany, &stat, &files, ITERATIONS, 1,
+			&mismatches), NTHREADS);
+		ensure_equals("(1)", mismatches.get(), 0);
+		ensure_equals("(2)", stat.size(), NFILES);
+		ensure_equals("(3)", stat.getHits() + stat.getMisses(),
+			(unsigned long long) NTHREADS * ITERATIONS);
+		// Threads that look up an uncached file at the same time may all stat() it.
+		ensure("(4)", stat.getMisses() >= NFILES);
+		ensure("(5)", stat.getMisses() <= NFILES * NTHREADS);
+
+		// Let all entries expire while the files change.
+		for (unsigned int i = 0; i < NFILES; i++) {
+			touch(files[i].c_str(), 1000);
+		}
+		unsigned long long oldMisses = stat.getMisses();
+		SystemTime::force(15);
+		runThreads(boost::bind(statMany, &stat, &files, ITERATIONS, 1000,
+			&mismatches), NTHREADS);
+		ensure_equals("(6)", mismatches.get(), 0);
+		ensure_equals("(7)", stat.size(), NFILES);
+		ensure("(8)", stat.getMisses() - oldMisses >= NFILES);
+		ensure("(9)", stat.getMisses() - oldMisses <= NFILES * NTHREADS);
+	}
+}
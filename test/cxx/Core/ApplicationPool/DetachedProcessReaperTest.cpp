@@ -0,0 +1,156 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/DetachedProcessReaper.h>
+#include <Utils/Timer.h>
+#include <boost/bind.hpp>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_DetachedProcessReaperTest {
+		typedef DetachedProcessReaper::CheckResult CheckResult;
+
+		boost::mutex syncher;
+		unsigned int checks;
+		unsigned int lastMaxCleanups;
+		CheckResult nextResult;
+		pid_t child;
+
+		Core_ApplicationPool_DetachedProcessReaperTest()
+			: checks(0),
+			  lastMaxCleanups(0),
+			  nextResult(DetachedProcessReaper::CHECK_DONE),
+			  child(-1)
+			{ }
+
+		~Core_ApplicationPool_DetachedProcessReaperTest() {
+			if (child != -1) {
+				kill(child, SIGKILL);
+				waitpid(child, NULL, 0);
+			}
+		}
+
+		CheckResult check(unsigned int maxCleanups) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			checks++;
+			lastMaxCleanups = maxCleanups;
+			return nextResult;
+		}
+
+		DetachedProcessReaper::CheckFunction checkFunction() {
+			return boost::bind(&Core_ApplicationPool_DetachedProcessReaperTest::check,
+				this, _1);
+		}
+
+		unsigned int checkCount() {
+			boost::lock_guard<boost::mutex> l(syncher);
+			return checks;
+		}
+
+		void setNextResult(CheckResult result) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			nextResult = result;
+		}
+
+		void forkChild() {
+			child = fork();
+			if (child == 0) {
+				while (true) {
+					pause();
+				}
+			}
+			ensure("fork() succeeded", child != -1);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_DetachedProcessReaperTest);
+
+	TEST_METHOD(1) {
+		set_test_name("A scheduled owner is checked, and forgotten once it's done");
+		DetachedProcessReaper reaper(16);
+
+		reaper.schedule(this, checkFunction());
+		reaper.waitUntilIdle();
+		ensure_equals("(1)", checkCount(), 1u);
+		ensure_equals("(2)", lastMaxCleanups, 16u);
+		ensure_equals("(3)", reaper.getOwnerCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("A waiting owner is checked again when it's rescheduled");
+		DetachedProcessReaper reaper(16, 60);
+
+		setNextResult(DetachedProcessReaper::CHECK_WAITING);
+		reaper.schedule(this, checkFunction());
+		EVENTUALLY(5,
+			result = checkCount() == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = checkCount() > 1;
+		);
+		ensure_equals("(1)", reaper.getOwnerCount(), 1u);
+
+		setNextResult(DetachedProcessReaper::CHECK_DONE);
+		reaper.schedule(this, checkFunction());
+		reaper.waitUntilIdle();
+		ensure_equals("(2)", checkCount(), 2u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("An owner that reached its cleanup limit is checked again"
+			" without being rescheduled");
+		DetachedProcessReaper reaper(16, 60);
+
+		setNextResult(DetachedProcessReaper::CHECK_AGAIN);
+		reaper.schedule(this, checkFunction());
+		EVENTUALLY(5,
+			result = checkCount() >= 3;
+		);
+		setNextResult(DetachedProcessReaper::CHECK_DONE);
+		reaper.waitUntilIdle();
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Waiting owners are polled");
+		DetachedProcessReaper reaper(16, 0.01);
+
+		setNextResult(DetachedProcessReaper::CHECK_WAITING);
+		reaper.schedule(this, checkFunction());
+		EVENTUALLY(5,
+			result = checkCount() >= 3;
+		);
+		setNextResult(DetachedProcessReaper::CHECK_DONE);
+		reaper.waitUntilIdle();
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("An owner is checked as soon as a watched process exits");
+		DetachedProcessReaper reaper(16, 60);
+		if (!reaper.usingPidfds()) {
+			return;
+		}
+
+		forkChild();
+		setNextResult(DetachedProcessReaper::CHECK_WAITING);
+		reaper.schedule(this, checkFunction());
+		EVENTUALLY(5,
+			result = checkCount() == 1;
+		);
+		ensure("(1)", reaper.watchPid(this, child));
+		SHOULD_NEVER_HAPPEN(100,
+			result = checkCount() > 1;
+		);
+
+		setNextResult(DetachedProcessReaper::CHECK_DONE);
+		Timer timer;
+		kill(child, SIGKILL);
+		reaper.waitUntilIdle();
+		ensure_equals("(2)", checkCount(), 2u);
+		ensure("(3)", timer.elapsed() < 1000);
+	}
+}
@@ -27,6 +27,9 @@ namespace tut {
 		boost::mutex syncher;
 		list<SessionPtr> sessions;
 		bool retainSessions;
+		GetCallback queueCallback;
+		// The results of get requests made with queueCallback, in order.
+		vector< pair<SessionPtr, ExceptionPtr> > queueResults;
 
 		Core_ApplicationPool_PoolTest() {
 			retainSessions = false;
@@ -38,6 +41,8 @@ namespace tut {
 			pool->initialize();
 			callback.func = _callback;
 			callback.userData = this;
+			queueCallback.func = _queueCallback;
+			queueCallback.userData = this;
 			setLogLevel(LVL_WARN);
 			setPrintAppOutputAsDebuggingMessages(true);
 		}
@@ -57,6 +62,23 @@ namespace tut {
 			SystemTime::releaseAll();
 		}
 
+		void touchRestartFile(const Options &options, const char *filename,
+			time_t timestamp = (time_t) -1)
+		{
+			GroupPtr group;
+			{
+				LockGuard l(pool->syncher);
+				group = pool->getGroup(options.getAppGroupName().toString().c_str());
+			}
+			touchFile(filename, timestamp);
+			if (group != NULL) {
+				// The RestartFileWatcher notices changes asynchronously.
+				EVENTUALLY(5,
+					result = group->restartFileWatch->isRestartRequested();
+				);
+			}
+		}
+
 		void initPoolDebugging() {
 			pool->initDebugging();
 			debug = pool->debugSupport;
@@ -74,6 +96,12 @@ namespace tut {
 			}
 			myCurrentSession.reset();
 			mySessions.clear();
+
+			vector< pair<SessionPtr, ExceptionPtr> > myQueueResults;
+			{
+				LockGuard l(syncher);
+				myQueueResults.swap(queueResults);
+			}
 		}
 
 		Options createOptions() {
@@ -108,6 +136,30 @@ namespace tut {
 			// destroy old session object outside the lock.
 		}
 
+		static void _queueCallback(const AbstractSessionPtr &session, const ExceptionPtr &e,
+			void *userData)
+		{
+			Core_ApplicationPool_PoolTest *self = (Core_ApplicationPool_PoolTest *) userData;
+			LockGuard l(self->syncher);
+			self->queueResults.push_back(make_pair(
+				static_pointer_cast<Session>(session), e));
+		}
+
+		unsigned int queueResultCount() {
+			LockGuard l(syncher);
+			return queueResults.size();
+		}
+
+		// Closes the session that the given get request obtained, if any.
+		void closeQueueResultSession(unsigned int i) {
+			SessionPtr session;
+			{
+				LockGuard l(syncher);
+				session.swap(queueResults[i].first);
+			}
+			session.reset();
+		}
+
 		void sendHeaders(int connection, ...) {
 			va_list ap;
 			const char *arg;
@@ -183,9 +235,37 @@ namespace tut {
 			return options;
 		}
 
+		// Makes the memory-based recycler see the given memory usage, in MB.
+		void setMemoryUsage(const ProcessPtr &process, size_t baseline, size_t usage) {
+			LockGuard l(pool->syncher);
+			process->metrics.pid = process->getPid();
+			process->metrics.privateDirty = usage * 1024;
+			process->metrics.swap = 0;
+			process->memoryBaseline = baseline * 1024;
+		}
+
+		void recycleProcesses(double memoryPressure = -1) {
+			boost::container::vector<Callback> actions;
+			{
+				LockGuard l(pool->syncher);
+				pool->recycleProcessesUsingTooMuchMemory(memoryPressure, actions);
+			}
+			Pool::runAllActions(actions);
+		}
+
+		bool isMemoryRecycling(const ProcessPtr &process) {
+			LockGuard l(pool->syncher);
+			return process->memoryRecycling;
+		}
+
 		void disableProcess(ProcessPtr process, AtomicInt *result) {
 			*result = (int) pool->disableProcess(process->getGupid());
 		}
+
+		void readSnapshot(AtomicInt *done) {
+			pool->getSnapshot();
+			(*done)++;
+		}
 	};
 
 	DEFINE_TEST_GROUP_WITH_LIMIT(Core_ApplicationPool_PoolTest, 100);
@@ -621,7 +701,7 @@ namespace tut {
 		SystemTime::forceAll(1000000);
 		pool->get(options, &ticket);
 		SystemTime::forceAll(20000000);
-		touchFile("tmp.wsgi/tmp/restart.txt", 1);
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt", 1);
 		pool->asyncGet(options, callback);
 		debug->debugger->recv("About to end restarting");
 		debug->messages->send("Finish restarting");
@@ -779,7 +859,7 @@ namespace tut {
 
 		// Get from tmp.wsgi.
 		SystemTime::force(3);
-		touchFile("tmp.wsgi/tmp/restart.txt", 4);
+		touchRestartFile(options1, "tmp.wsgi/tmp/restart.txt", 4);
 		session = pool->get(options1, &ticket);
 		ensure("(2)", session->getPid() != pid1);
 		ensure("(3)", session->getPid() != pid2);
@@ -1514,7 +1594,7 @@ namespace tut {
 		ensure_equals(sendRequest(options, "/"), "front page");
 
 		// Create restart.txt and send request again. The change should now be activated.
-		touchFile("tmp.wsgi/tmp/restart.txt", 1);
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt", 1);
 		ensure_equals(sendRequest(options, "/"), "restarted");
 
 		// Modify application again; it shouldn't have effect yet.
@@ -1525,7 +1605,7 @@ namespace tut {
 		ensure_equals(sendRequest(options, "/"), "restarted");
 
 		// Touch restart.txt and send request again. The change should now be activated.
-		touchFile("tmp.wsgi/tmp/restart.txt", 2);
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt", 2);
 		ensure_equals(sendRequest(options, "/"), "restarted 2");
 	}
 
@@ -1704,7 +1784,7 @@ namespace tut {
 		ensure_equals("(1)", pool->getProcessCount(), 1u);
 
 		// Trigger restart, wait until it's finished.
-		touchFile("tmp.wsgi/tmp/restart.txt", 1);
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt", 1);
 		pool->asyncGet(options, callback);
 		debug->messages->send("Finish restarting");
 		debug->debugger->recv("Restarting done");
@@ -1746,7 +1826,7 @@ namespace tut {
 
 		// Trigger a restart. The creation of the new spawner should take a while.
 		spawningKitConfig->spawnerCreationSleepTime = 20000;
-		touchFile("tmp.wsgi/tmp/restart.txt");
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt");
 		pool->asyncGet(options, callback);
 		GroupPtr group = pool->findOrCreateGroup(options);
 		ensure_equals(pool->getProcessCount(), 0u);
@@ -2005,6 +2085,531 @@ namespace tut {
 	//       when the session's connection has been released by the app.
 
 
+	/*********** Test state inspection ***********/
+
+	TEST_METHOD(80) {
+		// getSnapshot() reuses the previous snapshot as long as the set of
+		// groups and processes hasn't changed, and snapshots are never
+		// modified after creation.
+		Options options = createOptions();
+		pool->setSnapshotMaxAge(60 * 1000000);
+		SessionPtr session = pool->get(options, &ticket);
+		string gupid = session->getProcess()->getGupid().toString();
+
+		PoolSnapshotPtr snapshot1 = pool->getSnapshot();
+		ensure_equals(snapshot1->groups.size(), 1u);
+		ensure_equals(snapshot1->processCount, 1u);
+		ensure_equals(snapshot1->groups[0].processes.size(), 1u);
+		ensure_equals(snapshot1->groups[0].processes[0].gupid, gupid);
+		ensure_equals(snapshot1->groups[0].processes[0].sessions, 1);
+		ensure("Snapshot is reused", pool->getSnapshot() == snapshot1);
+
+		session.reset();
+		ensure("Counter changes alone do not invalidate the snapshot",
+			pool->getSnapshot() == snapshot1);
+
+		pool->detachProcess(gupid);
+		PoolSnapshotPtr snapshot2 = pool->getSnapshot();
+		ensure("Detaching a process invalidates the snapshot", snapshot2 != snapshot1);
+		ensure_equals(snapshot2->processCount, 0u);
+		ensure_equals("The old snapshot is unchanged",
+			snapshot1->groups[0].processes[0].sessions, 1);
+	}
+
+	TEST_METHOD(81) {
+		// inspect() and toXml() serialize from the snapshot, and perform
+		// authorization against it.
+		Options options = createOptions();
+		pool->setSnapshotMaxAge(0);
+		SessionPtr session = pool->get(options, &ticket);
+
+		string xml = pool->toXml();
+		ensure(containsSubstring(xml, "<process_count>1</process_count>"));
+		ensure(containsSubstring(xml, "<gupid>" + session->getProcess()->getGupid().toString() + "</gupid>"));
+		ensure(containsSubstring(xml, "<sessions>1</sessions>"));
+		session.reset();
+		ensure("A snapshot max age of 0 disables caching",
+			containsSubstring(pool->toXml(), "<sessions>0</sessions>"));
+		ensure(containsSubstring(pool->inspect(), "App root: " + options.appRoot.toString()));
+
+		Pool::InspectOptions inspectOptions;
+		inspectOptions.uid = pool->getSnapshot()->groups[0].constants->uid + 1;
+		if (inspectOptions.uid != 0 && inspectOptions.uid != geteuid()) {
+			try {
+				pool->inspect(inspectOptions);
+				fail("SecurityException expected");
+			} catch (const SecurityException &) {
+				// Pass.
+			}
+		}
+
+		// Used by the crash handler, which may run while the lock is held.
+		LockGuard l(pool->syncher);
+		ensure(containsSubstring(pool->inspect(Pool::InspectOptions::makeAuthorized(), false),
+			"App root: " + options.appRoot.toString()));
+	}
+
+	TEST_METHOD(82) {
+		// A cached snapshot can be served while the pool lock is held, so
+		// that status polling doesn't contend with session checkouts. A
+		// stale snapshot is only recreated once the lock is available.
+		Options options = createOptions();
+		pool->setSnapshotMaxAge(60 * 1000000);
+		SessionPtr session = pool->get(options, &ticket);
+		string gupid = session->getProcess()->getGupid().toString();
+		session.reset();
+		PoolSnapshotPtr snapshot1 = pool->getSnapshot();
+		AtomicInt done;
+
+		{
+			LockGuard l(pool->syncher);
+			TempThread thr(boost::bind(&Core_ApplicationPool_PoolTest::readSnapshot,
+				this, &done));
+			EVENTUALLY(5,
+				result = done == 1;
+			);
+		}
+		ensure("The cached snapshot was served", pool->getSnapshot() == snapshot1);
+
+		pool->detachProcess(gupid);
+		{
+			ScopedLock l(pool->syncher);
+			TempThread thr(boost::bind(&Core_ApplicationPool_PoolTest::readSnapshot,
+				this, &done));
+			SHOULD_NEVER_HAPPEN(100,
+				result = done == 2;
+			);
+			l.unlock();
+			EVENTUALLY(5,
+				result = done == 2;
+			);
+		}
+		ensure(pool->getSnapshot()->generation != snapshot1->generation);
+	}
+
+	static void abortLongRunningConnections(const ProcessPtr &process) {
+		// Do nothing.
+	}
+
+	TEST_METHOD(95) {
+		// prepareForShutdown() sets minProcesses to 0, which the next
+		// snapshot must reflect.
+		Options options = createOptions();
+		pool->setSnapshotMaxAge(60 * 1000000);
+		pool->abortLongRunningConnectionsCallback = abortLongRunningConnections;
+		pool->get(options, &ticket).reset();
+		PoolSnapshotPtr snapshot = pool->getSnapshot();
+		ensure(containsSubstring(snapshot->groups[0].constants->optionsXml,
+			"<min_processes>1</min_processes>"));
+
+		pool->prepareForShutdown();
+		snapshot = pool->getSnapshot();
+		ensure(containsSubstring(snapshot->groups[0].constants->optionsXml,
+			"<min_processes>0</min_processes>"));
+	}
+
+	TEST_METHOD(83) {
+		// An OOBW request is held back as long as starting it would leave
+		// the other processes with less than oobwMinSpareConcurrency
+		// free session slots.
+		initPoolDebugging();
+		debug->restarting = false;
+		debug->spawning = false;
+		debug->oobw = true;
+		// The dummy processes don't listen, so the OOBW requests themselves fail.
+		setLogLevel(LVL_CRIT);
+
+		Options options = ensureMinProcesses(2);
+		options.oobwMinSpareConcurrency = 1;
+		SessionPtr session1 = pool->get(options, &ticket);
+		SessionPtr session2 = pool->get(options, &ticket);
+		ensure(session1->getProcess() != session2->getProcess());
+		ProcessPtr process1 = session1->getProcess()->shared_from_this();
+
+		session1->requestOOBW();
+		session1.reset();
+		SHOULD_NEVER_HAPPEN(100,
+			result = debug->debugger->peek("OOBW request about to start") != NULL;
+		);
+		ensure_equals("(1)", pool->getContext()->oobwDeferrals.load(), 1u);
+
+		// Closing the other session frees a slot, so now it may start.
+		session2.reset();
+		debug->debugger->recv("OOBW request about to start");
+		debug->messages->send("Proceed with OOBW request");
+		debug->debugger->recv("OOBW request finished");
+		ensure_equals("(2)", pool->getContext()->oobwDeferrals.load(), 1u);
+
+		LockGuard l(pool->syncher);
+		ensure_equals("(3)", process1->oobwCount, 1u);
+		ensure_equals("(4)", process1->oobwStatus, Process::OOBW_NOT_ACTIVE);
+		ensure_equals("(5)", process1->enabled, Process::ENABLED);
+	}
+
+	TEST_METHOD(84) {
+		// When several processes request OOBW, the one whose last OOBW
+		// request is the oldest goes first.
+		initPoolDebugging();
+		debug->restarting = false;
+		debug->spawning = false;
+		debug->oobw = true;
+		setLogLevel(LVL_CRIT);
+
+		Options options = ensureMinProcesses(3);
+		SessionPtr session1 = pool->get(options, &ticket);
+		SessionPtr session2 = pool->get(options, &ticket);
+		SessionPtr session3 = pool->get(options, &ticket);
+		ProcessPtr process1 = session1->getProcess()->shared_from_this();
+		ProcessPtr process2 = session2->getProcess()->shared_from_this();
+
+		// Give process 1 a recent OOBW.
+		session1->requestOOBW();
+		session1.reset();
+		debug->debugger->recv("OOBW request about to start");
+		debug->messages->send("Proceed with OOBW request");
+		debug->debugger->recv("OOBW request finished");
+		session1 = pool->get(options, &ticket);
+		ensure(session1->getProcess() == process1.get());
+
+		// Both request OOBW, but process 2 is scheduled first even though
+		// process 1's session is closed first.
+		session2->requestOOBW();
+		session1->requestOOBW();
+		session1.reset();
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(1)", process2->oobwStatus, Process::OOBW_IN_PROGRESS);
+			ensure_equals("(2)", process1->oobwStatus, Process::OOBW_REQUESTED);
+		}
+
+		session2.reset();
+		debug->debugger->recv("OOBW request about to start");
+		debug->messages->send("Proceed with OOBW request");
+		debug->debugger->recv("OOBW request finished");
+		debug->debugger->recv("OOBW request about to start");
+		debug->messages->send("Proceed with OOBW request");
+		debug->debugger->recv("OOBW request finished");
+
+		LockGuard l(pool->syncher);
+		ensure_equals("(3)", process1->oobwCount, 2u);
+		ensure_equals("(4)", process2->oobwCount, 1u);
+	}
+
+
+	/*********** Test memory-based recycling ***********/
+
+	TEST_METHOD(86) {
+		// A process that uses more memory than memoryRecycleLimit is
+		// replaced. The replacement is spawned before the old process
+		// is detached.
+		Options options = ensureMinProcesses(1);
+		options.memoryRecycleLimit = 10;
+		SessionPtr session = pool->get(options, &ticket);
+		ProcessPtr process = session->getProcess()->shared_from_this();
+		session.reset();
+
+		setMemoryUsage(process, 5, 20);
+		recycleProcesses();
+		ensure("(1)", isMemoryRecycling(process));
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == 2;
+		);
+		EVENTUALLY(5,
+			recycleProcesses();
+			LockGuard l(pool->syncher);
+			result = process->enabled == Process::DETACHED;
+		);
+		ensure_equals("(2)", pool->getProcessCount(), 1u);
+		ensure_equals("(3)", pool->getContext()->memoryRecycles.load(), 1u);
+	}
+
+	TEST_METHOD(87) {
+		// Under memory pressure, the process that grew the most is replaced,
+		// not the one that is merely the largest.
+		Options options = ensureMinProcesses(2);
+		options.memoryRecyclePressureThreshold = 20;
+		SessionPtr session1 = pool->get(options, &ticket);
+		SessionPtr session2 = pool->get(options, &ticket);
+		ProcessPtr process1 = session1->getProcess()->shared_from_this();
+		ProcessPtr process2 = session2->getProcess()->shared_from_this();
+		ensure(process1 != process2);
+		session1.reset();
+		session2.reset();
+
+		setMemoryUsage(process1, 100, 110);
+		setMemoryUsage(process2, 10, 40);
+		recycleProcesses(10);
+		ensure("(1)", !isMemoryRecycling(process1));
+		ensure("(2)", !isMemoryRecycling(process2));
+
+		recycleProcesses(30);
+		ensure("(3)", !isMemoryRecycling(process1));
+		ensure("(4)", isMemoryRecycling(process2));
+	}
+
+	TEST_METHOD(88) {
+		// If no replacement can be spawned, a process over the memory limit
+		// is detached anyway, but a process that is merely growing under
+		// memory pressure is left alone.
+		pool->setMax(2);
+		Options options = ensureMinProcesses(2);
+		options.memoryRecycleLimit = 50;
+		options.memoryRecyclePressureThreshold = 20;
+		SessionPtr session1 = pool->get(options, &ticket);
+		SessionPtr session2 = pool->get(options, &ticket);
+		ProcessPtr process1 = session1->getProcess()->shared_from_this();
+		ProcessPtr process2 = session2->getProcess()->shared_from_this();
+		ensure(process1 != process2);
+		session1.reset();
+		session2.reset();
+
+		setMemoryUsage(process1, 10, 40);
+		recycleProcesses(30);
+		ensure("(1)", !isMemoryRecycling(process1));
+
+		setMemoryUsage(process2, 60, 60);
+		recycleProcesses(30);
+		LockGuard l(pool->syncher);
+		ensure_equals("(2)", process1->enabled, Process::ENABLED);
+		ensure_equals("(3)", process2->enabled, Process::DETACHED);
+	}
+
+	TEST_METHOD(94) {
+		// A process that is detached or shut down while it's being
+		// replaced no longer counts as being replaced.
+		Options options = ensureMinProcesses(2);
+		options.memoryRecycleLimit = 10;
+		SessionPtr session1 = pool->get(options, &ticket);
+		SessionPtr session2 = pool->get(options, &ticket);
+		ProcessPtr process1 = session1->getProcess()->shared_from_this();
+		ProcessPtr process2 = session2->getProcess()->shared_from_this();
+		ensure(process1 != process2);
+		session1.reset();
+		session2.reset();
+		GroupPtr group = process1->getGroup()->shared_from_this();
+
+		setMemoryUsage(process1, 5, 20);
+		recycleProcesses();
+		ensure("(1)", isMemoryRecycling(process1));
+		pool->detachProcess(process1);
+		{
+			LockGuard l(pool->syncher);
+			ensure("(2)", group->memoryRecyclingProcess == NULL);
+			ensure("(3)", !process1->memoryRecycling);
+		}
+
+		setMemoryUsage(process2, 5, 20);
+		recycleProcesses();
+		ensure("(4)", isMemoryRecycling(process2));
+		pool->detachGroupByName(group->getName());
+		LockGuard l(pool->syncher);
+		ensure("(5)", group->memoryRecyclingProcess == NULL);
+		ensure("(6)", !process2->memoryRecycling);
+	}
+
+
+	/*********** Test request queue deadlines and load shedding ***********/
+
+	TEST_METHOD(89) {
+		// A queued request that passes its deadline is dropped with a
+		// RequestQueueTimeoutException, even if no process becomes available
+		// in the mean time.
+		Options options = createOptions();
+		options.maxProcesses = 1;
+		SessionPtr session = pool->get(options, &ticket);
+
+		options.currentTime = SystemTime::getUsec();
+		options.deadline = options.currentTime + 200000;
+		pool->asyncGet(options, queueCallback);
+		SHOULD_NEVER_HAPPEN(100,
+			result = queueResultCount() > 0;
+		);
+		EVENTUALLY(5,
+			result = queueResultCount() == 1;
+		);
+
+		LockGuard l(syncher);
+		ensure("(1)", queueResults[0].first == NULL);
+		ensure("(2)", dynamic_pointer_cast<RequestQueueTimeoutException>(
+			queueResults[0].second) != NULL);
+		ensure_equals("(3)", pool->getContext()->getWaitlistTimeouts.load(), 1u);
+		LockGuard l2(pool->syncher);
+		GroupPtr group = pool->getGroup("stub/rack");
+		ensure("(4)", group->getWaitlist.empty());
+		// The first get() request waited for the process to be spawned.
+		ensure_equals("(5)", group->getWaitlistSojourns.getCount(), 2u);
+	}
+
+	TEST_METHOD(90) {
+		// A queued request that has passed its deadline by the time that a
+		// process becomes available is dropped instead of being served.
+		Options options = createOptions();
+		options.maxProcesses = 1;
+		SessionPtr session = pool->get(options, &ticket);
+
+		options.currentTime = SystemTime::getUsec();
+		options.deadline = options.currentTime + 1;
+		pool->asyncGet(options, queueCallback);
+		options.deadline = 0;
+		pool->asyncGet(options, queueCallback);
+		usleep(1000);
+		session.reset();
+
+		ensure_equals("(1)", queueResultCount(), 2u);
+		LockGuard l(syncher);
+		ensure("(2)", dynamic_pointer_cast<RequestQueueTimeoutException>(
+			queueResults[0].second) != NULL);
+		ensure("(3)", queueResults[1].first != NULL);
+	}
+
+	TEST_METHOD(91) {
+		// When the queueing delay stays above requestQueueTargetDelay for a
+		// whole CoDel interval, queued requests are shed, but not all of them.
+		Options options = createOptions();
+		options.maxProcesses = 1;
+		options.requestQueueTargetDelay = 1;
+		SessionPtr session = pool->get(options, &ticket);
+
+		pool->asyncGet(options, queueCallback);
+		pool->asyncGet(options, queueCallback);
+		pool->asyncGet(options, queueCallback);
+		usleep(30000);
+
+		// The delay only just went over the target, so the first request
+		// is served.
+		session.reset();
+		ensure_equals("(1)", queueResultCount(), 1u);
+		usleep(30000);
+
+		// The delay stayed above the target for longer than the 20 msec
+		// interval, so the second request is shed, after which the third
+		// one is served.
+		closeQueueResultSession(0);
+		ensure_equals("(2)", queueResultCount(), 3u);
+		{
+			LockGuard l(syncher);
+			ensure("(3)", queueResults[0].second == NULL);
+			ensure("(4)", queueResults[1].first == NULL);
+			ensure("(5)", dynamic_pointer_cast<RequestQueueTimeoutException>(
+				queueResults[1].second) != NULL);
+			ensure("(6)", queueResults[2].first != NULL);
+		}
+		ensure_equals("(7)", pool->getContext()->getWaitlistSheds.load(), 1u);
+	}
+
+	TEST_METHOD(93) {
+		// The garbage collector is scheduled to run no later than the
+		// earliest queued deadline, and the group forgets about the deadline
+		// once the queued requests have been served.
+		Options options = createOptions();
+		options.maxProcesses = 1;
+		SessionPtr session = pool->get(options, &ticket);
+
+		options.currentTime = SystemTime::getUsec();
+		unsigned long long deadline = options.currentTime + 10000000;
+		options.deadline = deadline;
+		pool->asyncGet(options, queueCallback);
+		options.deadline = deadline + 10000000;
+		pool->asyncGet(options, queueCallback);
+		{
+			LockGuard l(pool->syncher);
+			GroupPtr group = pool->getGroup("stub/rack");
+			ensure_equals("(1)", group->nextGetWaiterDeadline, deadline);
+			ensure("(2)", pool->nextGcRunTime <= deadline);
+		}
+
+		session.reset();
+		ensure_equals("(3)", queueResultCount(), 1u);
+		closeQueueResultSession(0);
+		ensure_equals("(4)", queueResultCount(), 2u);
+		LockGuard l(pool->syncher);
+		GroupPtr group = pool->getGroup("stub/rack");
+		ensure("(5)", group->getWaitlist.empty());
+		ensure_equals("(6)", group->nextGetWaiterDeadline, 0ull);
+	}
+
+	TEST_METHOD(96) {
+		// Requests on the top-level getWaitlist are also dropped once they
+		// pass their deadline.
+		Options options = createOptions();
+		pool->setMax(1);
+		SessionPtr session = pool->get(options, &ticket);
+
+		Options options2 = createOptions();
+		options2.appRoot = "stub/wsgi";
+		options2.currentTime = SystemTime::getUsec();
+		options2.deadline = options2.currentTime + 200000;
+		pool->asyncGet(options2, queueCallback);
+		{
+			LockGuard l(pool->syncher);
+			ensure_equals("(1)", pool->getWaitlist.size(), 1u);
+			ensure_equals("(2)", pool->getWaitlist[0].enqueueTime, options2.currentTime);
+			ensure("(3)", pool->nextGcRunTime <= options2.deadline);
+		}
+		SHOULD_NEVER_HAPPEN(100,
+			result = queueResultCount() > 0;
+		);
+		EVENTUALLY(5,
+			result = queueResultCount() == 1;
+		);
+
+		LockGuard l(syncher);
+		ensure("(4)", queueResults[0].first == NULL);
+		ensure("(5)", dynamic_pointer_cast<RequestQueueTimeoutException>(
+			queueResults[0].second) != NULL);
+		ensure_equals("(6)", pool->getContext()->getWaitlistTimeouts.load(), 1u);
+		LockGuard l2(pool->syncher);
+		ensure("(7)", pool->getWaitlist.empty());
+	}
+
+	TEST_METHOD(92) {
+		// Out-of-band work requests never wait for a worker thread while
+		// their processes are disabled, no matter how many of them block
+		// at the same time.
+		// One process is kept out of it, because the last enabled process
+		// in a group can't be disabled while the pool is full.
+		const unsigned int count = 20;
+		initPoolDebugging();
+		debug->restarting = false;
+		debug->spawning = false;
+		debug->oobw = true;
+		setLogLevel(LVL_CRIT);
+
+		pool->setMax(count + 1);
+		Options options = createOptions();
+		options.minProcesses = count + 1;
+		options.maxOutOfBandWorkInstances = count;
+		pool->asyncGet(options, callback);
+		EVENTUALLY(5,
+			result = number == 1;
+		);
+		EVENTUALLY(5,
+			result = pool->getProcessCount() == count + 1;
+		);
+		currentSession.reset();
+
+		vector<SessionPtr> sessions;
+		for (unsigned int i = 0; i < count; i++) {
+			sessions.push_back(pool->get(options, &ticket));
+		}
+		for (unsigned int i = 0; i < count; i++) {
+			sessions[i]->requestOOBW();
+			sessions[i].reset();
+		}
+
+		for (unsigned int i = 0; i < count; i++) {
+			debug->debugger->recv("OOBW request about to start");
+		}
+		ensure_equals(pool->getContext()->oobwWorkerPool.getQueueSize(), 0u);
+		for (unsigned int i = 0; i < count; i++) {
+			debug->messages->send("Proceed with OOBW request");
+		}
+		for (unsigned int i = 0; i < count; i++) {
+			debug->debugger->recv("OOBW request finished");
+		}
+	}
+
+
 	/*********** Test previously discovered bugs ***********/
 
 	TEST_METHOD(85) {
@@ -2021,7 +2626,7 @@ namespace tut {
 		string gupid = session->getProcess()->getGupid().toString();
 		session.reset();
 		pool->detachProcess(gupid);
-		touchFile("tmp.wsgi/tmp/restart.txt", 1);
+		touchRestartFile(options, "tmp.wsgi/tmp/restart.txt", 1);
 		pool->get(options, &ticket).reset();
 	}
 
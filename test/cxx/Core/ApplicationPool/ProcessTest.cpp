@@ -7,6 +7,8 @@ using namespace Passenger::ApplicationPool2;
 using namespace std;
 
 namespace tut {
+	static unsigned int initiateFailures;
+
 	struct Core_ApplicationPool_ProcessTest {
 		Context context;
 		BasicGroupInfo groupInfo;
@@ -39,7 +41,7 @@ namespace tut {
 			server1.assign(createTcpServer("127.0.0.1", 0, 0, __FILE__, __LINE__), NULL, 0);
 			getsockname(server1, (struct sockaddr *) &addr, &len);
 			socket["name"] = "main1";
-			socket["address"] = "tcp://127.0.0.1:" + toString(addr.sin_port);
+			socket["address"] = "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
 			socket["protocol"] = "session";
 			socket["concurrency"] = 3;
 			sockets.append(socket);
@@ -48,7 +50,7 @@ namespace tut {
 			getsockname(server2, (struct sockaddr *) &addr, &len);
 			socket = Json::Value();
 			socket["name"] = "main2";
-			socket["address"] = "tcp://127.0.0.1:" + toString(addr.sin_port);
+			socket["address"] = "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
 			socket["protocol"] = "session";
 			socket["concurrency"] = 3;
 			sockets.append(socket);
@@ -57,7 +59,7 @@ namespace tut {
 			getsockname(server3, (struct sockaddr *) &addr, &len);
 			socket = Json::Value();
 			socket["name"] = "main3";
-			socket["address"] = "tcp://127.0.0.1:" + toString(addr.sin_port);
+			socket["address"] = "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
 			socket["protocol"] = "session";
 			socket["concurrency"] = 3;
 			sockets.append(socket);
@@ -79,6 +81,10 @@ namespace tut {
 		}
 
 		ProcessPtr createProcess() {
+			return createProcess(sockets);
+		}
+
+		ProcessPtr createProcess(const Json::Value &sockets) {
 			SpawningKit::Result result;
 
 			result["type"] = "dummy";
@@ -95,6 +101,38 @@ namespace tut {
 			process->shutdownNotRequired();
 			return process;
 		}
+
+		/**
+		 * Creates a process whose only socket is a Unix socket that never
+		 * accepts connections, and whose listen backlog is full.
+		 */
+		ProcessPtr createUnresponsiveProcess(FileDescriptor &server,
+			vector<FileDescriptor> &pendingConnections)
+		{
+			server.assign(createUnixServer("tmp.unresponsive", 1, true, __FILE__, __LINE__),
+				NULL, 0);
+			while (true) {
+				NUnix_State state;
+				setupNonBlockingUnixSocket(state, "tmp.unresponsive", __FILE__, __LINE__);
+				if (!connectToUnixServer(state)) {
+					break;
+				}
+				pendingConnections.push_back(state.fd);
+				ensure("Listen backlog fills up", pendingConnections.size() < 100);
+			}
+
+			Json::Value sockets, socket;
+			socket["name"] = "main";
+			socket["address"] = "unix:tmp.unresponsive";
+			socket["protocol"] = "session";
+			socket["concurrency"] = 1;
+			sockets.append(socket);
+			return createProcess(sockets);
+		}
+
+		static void onInitiateFailure(Session *session) {
+			initiateFailures++;
+		}
 	};
 
 	DEFINE_TEST_GROUP(Core_ApplicationPool_ProcessTest);
@@ -204,4 +242,73 @@ namespace tut {
 				&& gatheredOutput.find("errorPipe 2\n") != string::npos;
 		);
 	}
+
+	TEST_METHOD(6) {
+		set_test_name("initiateNonBlocking() connects to a TCP socket without blocking");
+		ProcessPtr process = createProcess();
+		SessionPtr session = process->newSession();
+		AbstractSession::InitiateResult result = session->initiateNonBlocking();
+		while (result == AbstractSession::INITIATE_WAIT_WRITABLE) {
+			unsigned long long timeout = 5000000;
+			ensure("(1)", waitUntilWritable(session->fd(), &timeout));
+			result = session->initiateNonBlocking();
+		}
+		ensure_equals("(2)", result, AbstractSession::INITIATE_DONE);
+		ensure("(3)", session->initiated());
+		ensure_equals("(4)", session->getSocket()->totalConnections, 1);
+
+		Socket *socket = session->getSocket();
+		process->sessionClosed(session.get());
+		session->close(true);
+		ensure_equals("(5)", socket->totalConnections, 0);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("initiateNonBlocking() does not block if the listen backlog"
+			" is full, and completes once the app accepts connections again");
+		FileDescriptor server;
+		vector<FileDescriptor> pendingConnections;
+		ProcessPtr process = createUnresponsiveProcess(server, pendingConnections);
+		SessionPtr session = process->newSession();
+
+		ensure_equals("(1)", session->initiateNonBlocking(),
+			AbstractSession::INITIATE_RETRY_LATER);
+		ensure_equals("(2)", session->initiateNonBlocking(),
+			AbstractSession::INITIATE_RETRY_LATER);
+		ensure("(3)", !session->initiated());
+		ensure_equals("(4)", session->getSocket()->totalConnections, 1);
+
+		FileDescriptor accepted(syscalls::accept(server, NULL, NULL), NULL, 0);
+		ensure_equals("(5)", session->initiateNonBlocking(),
+			AbstractSession::INITIATE_DONE);
+		ensure("(6)", session->initiated());
+
+		Socket *socket = session->getSocket();
+		process->sessionClosed(session.get());
+		session->close(false);
+		ensure_equals("(7)", socket->totalConnections, 0);
+		unlink("tmp.unresponsive");
+	}
+
+	TEST_METHOD(8) {
+		set_test_name("abortInitiate() gives up connecting to an unresponsive socket"
+			" and reports an initiation failure");
+		FileDescriptor server;
+		vector<FileDescriptor> pendingConnections;
+		ProcessPtr process = createUnresponsiveProcess(server, pendingConnections);
+		SessionPtr session = process->newSession();
+		session->onInitiateFailure = onInitiateFailure;
+		initiateFailures = 0;
+
+		ensure_equals("(1)", session->initiateNonBlocking(),
+			AbstractSession::INITIATE_RETRY_LATER);
+		session->abortInitiate();
+		ensure_equals("(2)", initiateFailures, 1u);
+		ensure("(3)", !session->initiated());
+		ensure_equals("(4)", session->getSocket()->totalConnections, 0);
+
+		process->sessionClosed(session.get());
+		session->close(false);
+		unlink("tmp.unresponsive");
+	}
 }
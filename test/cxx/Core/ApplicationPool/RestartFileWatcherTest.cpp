@@ -0,0 +1,127 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/RestartFileWatcher.h>
+#include <unistd.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_RestartFileWatcherTest {
+		RestartFileWatcher watcher;
+		TempDir tmpDir;
+
+		Core_ApplicationPool_RestartFileWatcherTest()
+			: tmpDir("tmp.restartwatch")
+			{ }
+
+		RestartFileWatchPtr watch(const string &dir = "tmp.restartwatch",
+			unsigned int statThrottleRate = 10)
+		{
+			return watcher.watch(dir + "/restart.txt", dir + "/always_restart.txt",
+				statThrottleRate);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_RestartFileWatcherTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Creating restart.txt requests a restart exactly once");
+		RestartFileWatchPtr w = watch();
+		ensure("(1)", !w->isRestartRequested());
+		touchFile("tmp.restartwatch/restart.txt", 1);
+		EVENTUALLY(5,
+			result = w->isRestartRequested();
+		);
+		ensure("(2)", w->consumeRestartRequest());
+		ensure("(3)", !w->consumeRestartRequest());
+		ensure("(4)", !w->alwaysRestart());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("An already existing restart.txt only requests a restart"
+			" once its mtime changes");
+		touchFile("tmp.restartwatch/restart.txt", 1);
+		RestartFileWatchPtr w = watch();
+		SHOULD_NEVER_HAPPEN(100,
+			result = w->isRestartRequested();
+		);
+		touchFile("tmp.restartwatch/restart.txt", 2);
+		EVENTUALLY(5,
+			result = w->consumeRestartRequest();
+		);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Deleting restart.txt does not request a restart");
+		touchFile("tmp.restartwatch/restart.txt", 1);
+		RestartFileWatchPtr w = watch();
+		unlink("tmp.restartwatch/restart.txt");
+		SHOULD_NEVER_HAPPEN(100,
+			result = w->isRestartRequested();
+		);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("alwaysRestart() reflects whether always_restart.txt exists");
+		RestartFileWatchPtr w = watch();
+		ensure("(1)", !w->alwaysRestart());
+		touchFile("tmp.restartwatch/always_restart.txt");
+		EVENTUALLY(5,
+			result = w->alwaysRestart();
+		);
+		unlink("tmp.restartwatch/always_restart.txt");
+		EVENTUALLY(5,
+			result = !w->alwaysRestart();
+		);
+		ensure("(2)", !w->isRestartRequested());
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("always_restart.txt that already exists is noticed immediately");
+		touchFile("tmp.restartwatch/always_restart.txt");
+		RestartFileWatchPtr w = watch();
+		ensure(w->alwaysRestart());
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Changes are noticed if the directory is created later");
+		RestartFileWatchPtr w = watch("tmp.restartwatch/tmp", 1);
+		TempDir dir("tmp.restartwatch/tmp");
+		touchFile("tmp.restartwatch/tmp/restart.txt", 1);
+		EVENTUALLY(5,
+			result = w->isRestartRequested();
+		);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("Changes that are made through a different path are"
+			" noticed by polling");
+		TempDir dir1("tmp.restartwatch/release1");
+		TempDir dir2("tmp.restartwatch/release2");
+		ensure(symlink("release1", "tmp.restartwatch/current") == 0);
+
+		RestartFileWatchPtr w = watch("tmp.restartwatch/current", 1);
+		ensure(rename("tmp.restartwatch/current", "tmp.restartwatch/old") == 0);
+		ensure(symlink("release2", "tmp.restartwatch/current") == 0);
+		touchFile("tmp.restartwatch/release2/restart.txt", 1);
+		EVENTUALLY(5,
+			result = w->isRestartRequested();
+		);
+	}
+
+	TEST_METHOD(8) {
+		set_test_name("Unwatched files are no longer watched");
+		RestartFileWatchPtr w1 = watch();
+		RestartFileWatchPtr w2 = watch();
+		ensure_equals("(1)", watcher.getWatchCount(), 2u);
+
+		watcher.unwatch(w1);
+		ensure_equals("(2)", watcher.getWatchCount(), 1u);
+		touchFile("tmp.restartwatch/restart.txt", 1);
+		EVENTUALLY(5,
+			result = w2->isRestartRequested();
+		);
+		ensure("(3)", !w1->isRestartRequested());
+	}
+}
@@ -0,0 +1,118 @@
+#include <TestSupport.h>
+#include <Core/ApplicationPool/WorkerPool.h>
+
+using namespace Passenger;
+using namespace Passenger::ApplicationPool2;
+using namespace std;
+
+namespace tut {
+	struct Core_ApplicationPool_WorkerPoolTest {
+		boost::mutex syncher;
+		boost::condition_variable cond;
+		bool released;
+		AtomicInt started;
+		AtomicInt finished;
+
+		Core_ApplicationPool_WorkerPoolTest()
+			: released(false)
+			{ }
+
+		void blockingJob() {
+			started++;
+			{
+				boost::unique_lock<boost::mutex> l(syncher);
+				while (!released) {
+					cond.wait(l);
+				}
+			}
+			finished++;
+		}
+
+		void release() {
+			boost::lock_guard<boost::mutex> l(syncher);
+			released = true;
+			cond.notify_all();
+		}
+
+		WorkerPool::Job job() {
+			return boost::bind(&Core_ApplicationPool_WorkerPoolTest::blockingJob, this);
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_ApplicationPool_WorkerPoolTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Jobs are run on threads that are created on demand");
+		WorkerPool pool("Test worker", 4);
+		ensure_equals("(1)", pool.getThreadCount(), 0u);
+		pool.submit(job());
+		pool.submit(job());
+		EVENTUALLY(5,
+			result = started == 2;
+		);
+		ensure_equals("(2)", pool.getThreadCount(), 2u);
+		release();
+		EVENTUALLY(5,
+			result = finished == 2;
+		);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("No more than maxThreads threads are created; other jobs are queued");
+		WorkerPool pool("Test worker", 2);
+		for (int i = 0; i < 5; i++) {
+			pool.submit(job());
+		}
+		EVENTUALLY(5,
+			result = started == 2;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = started > 2;
+		);
+		ensure_equals("(1)", pool.getThreadCount(), 2u);
+		ensure_equals("(2)", pool.getQueueSize(), 3u);
+		release();
+		EVENTUALLY(5,
+			result = finished == 5;
+		);
+		ensure_equals("(3)", pool.getThreadCount(), 2u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Idle threads are reused, and exit after the idle timeout");
+		WorkerPool pool("Test worker", 4, 1);
+		release();
+		pool.submit(job());
+		EVENTUALLY(5,
+			result = finished == 1;
+		);
+		pool.submit(job());
+		EVENTUALLY(5,
+			result = finished == 2;
+		);
+		ensure_equals("(1)", pool.getThreadCount(), 1u);
+		EVENTUALLY(5,
+			result = pool.getThreadCount() == 0;
+		);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("interruptAndJoinAll() interrupts running jobs and discards queued ones");
+		WorkerPool pool("Test worker", 1);
+		ensure("(1)", pool.submit(job()));
+		ensure("(2)", pool.submit(job()));
+		EVENTUALLY(5,
+			result = started == 1;
+		);
+		pool.interruptAndJoinAll();
+		ensure_equals("(3)", pool.getThreadCount(), 0u);
+		ensure_equals("(4)", pool.getQueueSize(), 0u);
+		ensure_equals("(5)", (int) started, 1);
+		ensure_equals("(6)", (int) finished, 0);
+
+		ensure("Jobs are rejected after shutdown", !pool.submit(job()));
+		SHOULD_NEVER_HAPPEN(100,
+			result = started > 1;
+		);
+	}
+}
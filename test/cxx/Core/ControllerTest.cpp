@@ -3,8 +3,10 @@
 #include <Utils/IOUtils.h>
 #include <Utils/BufferedIO.h>
 #include <Utils/MessageIO.h>
+#include <MemoryKit/palloc.h>
 #include <Core/ApplicationPool/TestSession.h>
 #include <Core/Controller.h>
+#include <zlib.h>
 
 using namespace std;
 using namespace boost;
@@ -19,15 +21,23 @@ namespace tut {
 				ApplicationPool2::GetCallback callback)
 			{
 				callback(sessionToReturn, exceptionToReturn);
-				sessionToReturn.reset();
+				sessionToReturn = sessionToReturnOnRetry;
+				sessionToReturnOnRetry.reset();
+			}
+
+			virtual bool appGroupHasFreeProcess(Request *req) {
+				return freeProcess;
 			}
 
 		public:
 			ApplicationPool2::AbstractSessionPtr sessionToReturn;
+			ApplicationPool2::AbstractSessionPtr sessionToReturnOnRetry;
 			ApplicationPool2::ExceptionPtr exceptionToReturn;
+			bool freeProcess;
 
 			MyController(ServerKit::Context *context, const VariantMap *agentsOptions)
-				: Core::Controller(context, agentsOptions)
+				: Core::Controller(context, agentsOptions),
+				  freeProcess(true)
 				{ }
 		};
 
@@ -37,6 +47,7 @@ namespace tut {
 		VariantMap options;
 		int serverSocket;
 		TestSession testSession;
+		TestSession unresponsiveSession;
 		FileDescriptor clientConnection;
 		BufferedIO clientConnectionIO;
 		string peerRequestHeader;
@@ -64,6 +75,12 @@ namespace tut {
 			options.setInt("min_instances", 1);
 			options.setInt("max_preloader_idle_time", DEFAULT_MAX_PRELOADER_IDLE_TIME);
 			options.setInt("max_request_queue_size", DEFAULT_MAX_REQUEST_QUEUE_SIZE);
+			options.setInt("oobw_min_spare_concurrency", DEFAULT_OOBW_MIN_SPARE_CONCURRENCY);
+			options.setInt("memory_recycle_limit", 0);
+			options.setInt("request_queue_timeout", 0);
+			options.setInt("request_queue_target_delay", 0);
+			options.setInt("upload_streaming_threshold", 0);
+			options.setInt("memory_recycle_pressure_threshold", 0);
 			options.setBool("abort_websockets_on_process_shutdown", true);
 			options.setInt("force_max_concurrent_requests_per_process", -1);
 			options.set("spawn_method", DEFAULT_SPAWN_METHOD);
@@ -136,6 +153,17 @@ namespace tut {
 			controller->sessionToReturn.reset(&testSession, false);
 		}
 
+		void useUnresponsiveSessionObjectFirst() {
+			unresponsiveSession.setUnresponsive(true);
+			bg.safe->runSync(boost::bind(
+				&Core_ControllerTest::_setUnresponsiveSessionObjectFirst, this));
+		}
+
+		void _setUnresponsiveSessionObjectFirst() {
+			controller->sessionToReturn.reset(&unresponsiveSession, false);
+			controller->sessionToReturnOnRetry.reset(&testSession, false);
+		}
+
 		MyController::State getServerState() {
 			Controller::State result;
 			bg.safe->runSync(boost::bind(&Core_ControllerTest::_getServerState,
@@ -221,12 +249,35 @@ namespace tut {
 			);
 		}
 
+		void ensureSessionNeverInitiated() {
+			SHOULD_NEVER_HAPPEN(100,
+				result = testSession.fd() != -1;
+			);
+		}
+
 		void waitUntilSessionClosed() {
 			EVENTUALLY(5,
 				result = testSession.isClosed();
 			);
 		}
 
+		string readPeerRequestBody(unsigned int size) {
+			string result(size, '\0');
+			unsigned long long timeout = 5000000;
+			ensure_equals("The entire request body is forwarded",
+				readExact(testSession.peerFd(), &result[0], size, &timeout),
+				size);
+			return result;
+		}
+
+		AppGroupMetrics getAppGroupMetrics() {
+			ControllerMetrics metrics;
+			bg.safe->runSync(boost::bind(&MyController::collectMetrics,
+				controller, boost::ref(metrics)));
+			ensure_equals("There is one app group", metrics.appGroups.size(), 1u);
+			return metrics.appGroups.begin()->second;
+		}
+
 		string readHeader(BufferedIO &io) {
 			string result;
 			do {
@@ -246,9 +297,120 @@ namespace tut {
 		string readResponseBody() {
 			return clientConnectionIO.readAll();
 		}
+
+		static string dechunk(const string &body) {
+			string result;
+			string::size_type pos = 0;
+			while (true) {
+				string::size_type lineEnd = body.find("\r\n", pos);
+				ensure("Valid chunk header", lineEnd != string::npos);
+				unsigned long long size = hexToULL(body.substr(pos, lineEnd - pos));
+				if (size == 0) {
+					ensure_equals("Body ends after the last chunk",
+						body.substr(lineEnd), "\r\n\r\n");
+					return result;
+				}
+				result.append(body, lineEnd + 2, size);
+				pos = lineEnd + 2 + size;
+				ensure_equals("Chunk ends with CRLF", body.substr(pos, 2), "\r\n");
+				pos += 2;
+			}
+		}
+
+		static string gunzip(const string &data) {
+			z_stream stream;
+			char buf[1024 * 16];
+			string result;
+			int ret;
+
+			memset(&stream, 0, sizeof(stream));
+			ensure_equals("inflateInit2", inflateInit2(&stream, 16 + MAX_WBITS), Z_OK);
+			stream.next_in = (Bytef *) data.data();
+			stream.avail_in = data.size();
+			do {
+				stream.next_out = (Bytef *) buf;
+				stream.avail_out = sizeof(buf);
+				ret = inflate(&stream, Z_NO_FLUSH);
+				result.append(buf, sizeof(buf) - stream.avail_out);
+			} while (ret == Z_OK);
+			inflateEnd(&stream);
+			ensure_equals("The gzip stream is complete", ret, Z_STREAM_END);
+			ensure_equals("There is no data after the gzip stream", stream.avail_in, 0u);
+			return result;
+		}
+
+		static unsigned int countOccurrences(const string &str, const string &substr) {
+			unsigned int result = 0;
+			string::size_type pos = str.find(substr);
+			while (pos != string::npos) {
+				result++;
+				pos = str.find(substr, pos + substr.size());
+			}
+			return result;
+		}
+
+		ServerKit::Header *createHeader(psg_pool_t *pool, const HashedStaticString &key,
+			const StaticString &val)
+		{
+			ServerKit::Header *header = (ServerKit::Header *) psg_palloc(pool,
+				sizeof(ServerKit::Header));
+			psg_lstr_init(&header->key);
+			psg_lstr_init(&header->origKey);
+			psg_lstr_init(&header->val);
+			psg_lstr_append(&header->key, pool, key.data(), key.size());
+			psg_lstr_append(&header->origKey, pool, key.data(), key.size());
+			psg_lstr_append(&header->val, pool, val.data(), val.size());
+			header->hash = key.hash();
+			return header;
+		}
+
+		void _constructHelloWorldHeaders(string *header, unsigned int *nbuffers,
+			string *dateHeader)
+		{
+			psg_pool_t *headerPool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			Request req;
+			struct iovec buffers[2];
+			unsigned int dataSize, cacheableSize;
+
+			req.pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+			req.httpMajor = 1;
+			req.httpMinor = 1;
+			req.bodyType = Request::RBT_NO_BODY;
+			req.wantKeepAlive = true;
+			req.dechunkResponse = false;
+			req.compressibleResponse = false;
+			req.stickySession = false;
+			req.appResponse.headers.clear();
+			req.appResponse.statusCode = 200;
+			req.appResponse.bodyType = AppResponse::RBT_CONTENT_LENGTH;
+			req.appResponse.aux.bodyInfo.contentLength = sizeof("hello world") - 1;
+			req.appResponse.date = NULL;
+			req.appResponse.setCookie = NULL;
+			ServerKit::Header *contentType = createHeader(headerPool,
+				"content-type", "text/plain");
+			req.appResponse.headers.insert(&contentType, headerPool);
+
+			*nbuffers = controller->constructHeaderBuffersForResponse(&req,
+				buffers, dataSize, cacheableSize);
+			*dateHeader = controller->getDateHeader();
+
+			header->clear();
+			for (unsigned int i = 0; i < *nbuffers; i++) {
+				header->append((const char *) buffers[i].iov_base, buffers[i].iov_len);
+			}
+
+			req.appResponse.headers.clear();
+			psg_destroy_pool(req.pool);
+			psg_destroy_pool(headerPool);
+		}
+
+		void _getDateHeader(StaticString *result, time_t *formattedAt) {
+			*result = controller->getDateHeader();
+			*formattedAt = controller->dateHeaderTime;
+		}
 	};
 
-	DEFINE_TEST_GROUP(Core_ControllerTest);
+	DEFINE_TEST_GROUP_WITH_LIMIT(Core_ControllerTest, 60);
 
 
 	/***** Passing request information to the app *****/
@@ -743,4 +905,620 @@ namespace tut {
 		ensure("(1)", testSession.isSuccessful());
 		ensure("(2)", !testSession.wantsKeepAlive());
 	}
+
+
+	/***** Response header construction *****/
+
+	TEST_METHOD(40) {
+		set_test_name("It adds a single Date header and the X-Powered-By trailer");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+
+		string header = readResponseHeader();
+		string body = readResponseBody();
+		ensure("(1)", startsWith(header, "HTTP/1.1 200 OK\r\nStatus: 200 OK\r\n"));
+		ensure("(2)", containsSubstring(header, "Content-Type: text/plain\r\n"));
+		ensure("(3)", containsSubstring(header, "Content-Length: 5\r\n"));
+		ensure_equals("(4)", countOccurrences(header, "Date: "), 1u);
+		ensure("(5)", containsSubstring(header, " GMT\r\n"));
+		ensure("(6)", containsSubstring(header,
+			"Connection: close\r\n"
+			"X-Powered-By: " PROGRAM_NAME));
+		ensure("(7)", containsSubstring(header, " " PASSENGER_VERSION "\r\n"));
+		ensure_equals(body, "hello");
+	}
+
+	TEST_METHOD(41) {
+		set_test_name("It does not add a Date header if the app already sent one");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"));
+		ensure_equals("(2)", countOccurrences(header, "Date: "), 1u);
+	}
+
+	TEST_METHOD(42) {
+		set_test_name("The Date header is formatted at most once per second");
+
+		init();
+		StaticString date1, date2;
+		time_t formattedAt1, formattedAt2;
+		bg.safe->runSync(boost::bind(&Core_ControllerTest::_getDateHeader,
+			this, &date1, &formattedAt1));
+		bg.safe->runSync(boost::bind(&Core_ControllerTest::_getDateHeader,
+			this, &date2, &formattedAt2));
+
+		ensure("(1)", startsWith(date1, "Date: "));
+		ensure("(2)", date1.size() == sizeof("Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n") - 1);
+		ensure_equals("(3)", (const void *) date1.data(), (const void *) date2.data());
+		if (formattedAt1 == formattedAt2) {
+			ensure_equals("(4)", date1, date2);
+		}
+	}
+
+	TEST_METHOD(43) {
+		set_test_name("A hello world response header is sent in 2 buffers");
+
+		init();
+		string header, dateHeader;
+		unsigned int nbuffers;
+		bg.safe->runSync(boost::bind(&Core_ControllerTest::_constructHelloWorldHeaders,
+			this, &header, &nbuffers, &dateHeader));
+
+		ensure_equals("(1)", nbuffers, 2u);
+		ensure_equals("(2)", header,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"content-type: text/plain\r\n"
+			+ dateHeader +
+			"Content-Length: 11\r\n"
+			"X-Powered-By: " PROGRAM_NAME " " PASSENGER_VERSION "\r\n"
+			"\r\n");
+	}
+
+	TEST_METHOD(44) {
+		set_test_name("If the app does not accept the connection in time, then the"
+			" session initiation is aborted and retried with another session");
+
+		init();
+		Json::Value config;
+		config["app_connect_timeout"] = 0.1;
+		bg.safe->runSync(boost::bind(&MyController::configure, controller, config));
+		useUnresponsiveSessionObjectFirst();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		ensure("(1)", unresponsiveSession.isInitiateAborted());
+
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 2\r\n\r\n"
+			"ok");
+
+		string header = readResponseHeader();
+		string body = readResponseBody();
+		ensure("(2)", containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+		ensure_equals("(3)", body, "ok");
+	}
+
+
+	/***** Adaptive request body buffering *****/
+
+	TEST_METHOD(45) {
+		set_test_name("If the client uploads fast enough and a process is free, then"
+			" the request body is streamed to the app before it is complete");
+
+		options.setInt("upload_streaming_threshold", 1);
+		init();
+		useTestSessionObject();
+
+		string body1(150000, 'a');
+		string body2(50000, 'b');
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 200000\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		writeExact(clientConnection, body1);
+		waitUntilSessionInitiated();
+
+		ensure("(1)", containsSubstring(readPeerRequestHeader(), "200000"));
+		writeExact(clientConnection, body2);
+		ensure("(2)", readPeerRequestBody(body1.size() + body2.size()) == body1 + body2);
+
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 2\r\n\r\n"
+			"ok");
+		ensure("(3)", containsSubstring(readResponseHeader(), "HTTP/1.1 200 OK\r\n"));
+		ensure_equals("(4)", readResponseBody(), "ok");
+
+		AppGroupMetrics metrics = getAppGroupMetrics();
+		ensure_equals<boost::uint64_t>("(5)", metrics.streamedBodyTimesToApp.getCount(), 1u);
+		ensure_equals<boost::uint64_t>("(6)", metrics.bufferedBodyTimesToApp.getCount(), 0u);
+	}
+
+	TEST_METHOD(46) {
+		set_test_name("If no process is free, then the entire request body is"
+			" buffered before checking out a session");
+
+		options.setInt("upload_streaming_threshold", 1);
+		init();
+		controller->freeProcess = false;
+		useTestSessionObject();
+
+		string body1(150000, 'a');
+		string body2(50000, 'b');
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 200000\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		writeExact(clientConnection, body1);
+		ensureSessionNeverInitiated();
+
+		writeExact(clientConnection, body2);
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		ensure("(1)", readPeerRequestBody(body1.size() + body2.size()) == body1 + body2);
+
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Length: 2\r\n\r\n"
+			"ok");
+		ensure("(2)", containsSubstring(readResponseHeader(), "HTTP/1.1 200 OK\r\n"));
+		ensure_equals("(3)", readResponseBody(), "ok");
+
+		AppGroupMetrics metrics = getAppGroupMetrics();
+		ensure_equals<boost::uint64_t>("(4)", metrics.bufferedBodyTimesToApp.getCount(), 1u);
+		ensure_equals<boost::uint64_t>("(5)", metrics.streamedBodyTimesToApp.getCount(), 0u);
+	}
+
+	TEST_METHOD(47) {
+		set_test_name("If the client uploads too slowly, then the entire request"
+			" body is buffered before checking out a session");
+
+		options.setInt("upload_streaming_threshold", 1000000);
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 6\r\n"
+			"Connection: close\r\n"
+			"\r\n"
+			"he");
+		syscalls::usleep(150000);
+		writeExact(clientConnection, "ll");
+		ensureSessionNeverInitiated();
+
+		writeExact(clientConnection, "o!");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		ensure_equals("(1)", readPeerRequestBody(6), "hello!");
+
+		AppGroupMetrics metrics = getAppGroupMetrics();
+		ensure_equals<boost::uint64_t>("(2)", metrics.bufferedBodyTimesToApp.getCount(), 1u);
+	}
+
+	TEST_METHOD(48) {
+		set_test_name("Adaptive buffering does not apply to chunked request bodies");
+
+		options.setInt("upload_streaming_threshold", 1);
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Transfer-Encoding: chunked\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+
+		AppGroupMetrics metrics = getAppGroupMetrics();
+		ensure_equals<boost::uint64_t>(metrics.streamedBodyTimesToApp.getCount(), 1u);
+	}
+
+	TEST_METHOD(53) {
+		set_test_name("Adaptive buffering does not apply to requests for which the"
+			" web server asked to buffer the body");
+
+		options.setInt("upload_streaming_threshold", 1);
+		init();
+		useTestSessionObject();
+
+		string body1(150000, 'a');
+		string body2(50000, 'b');
+		connectToServer();
+		sendRequest(
+			"POST /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Content-Length: 200000\r\n"
+			"Connection: close\r\n"
+			"!~: \r\n"
+			"!~FLAGS: B\r\n"
+			"\r\n");
+		writeExact(clientConnection, body1);
+		ensureSessionNeverInitiated();
+
+		writeExact(clientConnection, body2);
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		ensure("(1)", readPeerRequestBody(body1.size() + body2.size()) == body1 + body2);
+
+		AppGroupMetrics metrics = getAppGroupMetrics();
+		ensure_equals<boost::uint64_t>("(2)", metrics.streamedBodyTimesToApp.getCount(), 0u);
+	}
+
+	TEST_METHOD(49) {
+		set_test_name("If response compression is enabled, then textual responses are"
+			" gzip-compressed for clients that accept it");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/changelog.html");
+		string chunkedBody;
+		for (string::size_type pos = 0; pos < body.size(); pos += 1000) {
+			string chunk = body.substr(pos, 1000);
+			chunkedBody.append(integerToHex(chunk.size()) + "\r\n" + chunk + "\r\n");
+		}
+		chunkedBody.append("0\r\n\r\n");
+
+		connectToServer();
+		sendRequest(
+			"GET /changelog HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: deflate, gzip\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/html; charset=utf-8\r\n"
+			"ETag: \"abc\"\r\n"
+			"Transfer-Encoding: chunked\r\n\r\n"
+			+ chunkedBody);
+
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+		ensure("(2)", containsSubstring(header, "Content-Encoding: gzip\r\n"));
+		ensure("(3)", containsSubstring(header, "Vary: Accept-Encoding\r\n"));
+		ensure("(4)", containsSubstring(header, "Transfer-Encoding: chunked\r\n"));
+		ensure("(5)", containsSubstring(header, "ETag: W/\"abc\"\r\n"));
+		ensure("(6)", !containsSubstring(header, "Content-Length"));
+
+		string compressedBody = dechunk(readResponseBody());
+		ensure("(7)", compressedBody.size() < body.size() / 2);
+		ensure("(8)", gunzip(compressedBody) == body);
+	}
+
+	TEST_METHOD(54) {
+		set_test_name("If response compression is enabled, then Accept-Encoding is"
+			" appended to the Vary header that the app sent");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/changelog.html");
+		connectToServer();
+		sendRequest(
+			"GET /changelog HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: gzip\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/html\r\n"
+			"Vary: Cookie\r\n"
+			"Content-Length: " + toString(body.size()) + "\r\n\r\n"
+			+ body);
+
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "Content-Encoding: gzip\r\n"));
+		ensure("(2)", containsSubstring(header, "Vary: Cookie, Accept-Encoding\r\n"));
+		ensure("(3)", header.find("Vary:") == header.rfind("Vary:"));
+		ensure("(4)", gunzip(dechunk(readResponseBody())) == body);
+	}
+
+	TEST_METHOD(55) {
+		set_test_name("If response compression is enabled, then a Vary header that"
+			" already lists Accept-Encoding is left alone");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/changelog.html");
+		connectToServer();
+		sendRequest(
+			"GET /changelog HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: gzip\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/html\r\n"
+			"Vary: accept-encoding, Cookie\r\n"
+			"Content-Length: " + toString(body.size()) + "\r\n\r\n"
+			+ body);
+
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "Content-Encoding: gzip\r\n"));
+		ensure("(2)", containsSubstring(header, "Vary: accept-encoding, Cookie\r\n"));
+		ensure("(3)", header.find("Vary:") == header.rfind("Vary:"));
+		ensure("(4)", gunzip(dechunk(readResponseBody())) == body);
+	}
+
+	TEST_METHOD(57) {
+		set_test_name("If response compression is enabled, then the ETag of a"
+			" response that is not compressed is left strong");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/changelog.html");
+		connectToServer();
+		sendRequest(
+			"GET /changelog HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/html\r\n"
+			"ETag: \"abc\"\r\n"
+			"Content-Length: " + toString(body.size()) + "\r\n\r\n"
+			+ body);
+
+		string header = readResponseHeader();
+		ensure("(1)", !containsSubstring(header, "Content-Encoding"));
+		ensure("(2)", containsSubstring(header, "Vary: Accept-Encoding\r\n"));
+		ensure("(3)", containsSubstring(header, "ETag: \"abc\"\r\n"));
+		ensure("(4)", readResponseBody() == body);
+	}
+
+	TEST_METHOD(58) {
+		set_test_name("If response compression is enabled, then the turbocache does not"
+			" store a precompressed variant of a response with a strong ETag");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/npm-shrinkwrap.json");
+		connectToServer();
+		sendRequest(
+			"GET /shrinkwrap HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: application/json\r\n"
+			"Cache-Control: public, max-age=60\r\n"
+			"ETag: \"abc\"\r\n"
+			"Content-Length: " + toString(body.size()) + "\r\n\r\n"
+			+ body);
+		ensure("(1)", containsSubstring(readResponseHeader(), "ETag: \"abc\"\r\n"));
+		ensure("(2)", readResponseBody() == body);
+
+		// Served from the turbocache, with the strong ETag and the identity body.
+		connectToServer();
+		sendRequest(
+			"GET /shrinkwrap HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: gzip\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		string header = readResponseHeader();
+		ensure("(3)", containsSubstring(header, "Age: "));
+		ensure("(4)", !containsSubstring(header, "Content-Encoding"));
+		ensure("(5)", containsSubstring(header, "ETag: \"abc\"\r\n"));
+		ensure("(6)", readResponseBody() == body);
+	}
+
+	TEST_METHOD(50) {
+		set_test_name("If response compression is enabled, then the turbocache stores"
+			" a precompressed variant and serves it to clients that accept gzip");
+
+		options.setBool("response_compression", true);
+		init();
+		useTestSessionObject();
+
+		string body = readAll("stub/compression/npm-shrinkwrap.json");
+		connectToServer();
+		sendRequest(
+			"GET /shrinkwrap HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: application/json\r\n"
+			"Cache-Control: public, max-age=60\r\n"
+			"Content-Length: " + toString(body.size()) + "\r\n\r\n"
+			+ body);
+
+		string header = readResponseHeader();
+		ensure("(1)", containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+		ensure("(2)", containsSubstring(header, "Vary: Accept-Encoding\r\n"));
+		ensure("(3)", !containsSubstring(header, "Content-Encoding"));
+		ensure("(4)", readResponseBody() == body);
+
+		// Served from the turbocache: the app is not contacted again.
+		connectToServer();
+		sendRequest(
+			"GET /shrinkwrap HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: gzip\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		header = readResponseHeader();
+		string compressedBody = readResponseBody();
+		ensure("(5)", containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+		ensure("(6)", containsSubstring(header, "Age: "));
+		ensure("(7)", containsSubstring(header, "Content-Encoding: gzip\r\n"));
+		ensure("(8)", containsSubstring(header, "Vary: Accept-Encoding\r\n"));
+		ensure("(9)", containsSubstring(header,
+			"Content-Length: " + toString(compressedBody.size()) + "\r\n"));
+		ensure("(10)", compressedBody.size() < body.size() / 2);
+		ensure("(11)", gunzip(compressedBody) == body);
+
+		connectToServer();
+		sendRequest(
+			"GET /shrinkwrap HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Accept-Encoding: identity\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		header = readResponseHeader();
+		ensure("(12)", containsSubstring(header, "Age: "));
+		ensure("(13)", !containsSubstring(header, "Content-Encoding"));
+		ensure("(14)", containsSubstring(header, "Vary: Accept-Encoding\r\n"));
+		ensure("(15)", containsSubstring(header,
+			"Content-Length: " + toString(body.size()) + "\r\n"));
+		ensure("(16)", readResponseBody() == body);
+	}
+
+	TEST_METHOD(51) {
+		set_test_name("Turbocache hits that are pipelined after a request that is"
+			" forwarded to the app are answered in order, on the same connection");
+
+		init();
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /pipelined HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"\r\n"
+			"GET /pipelined HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"\r\n"
+			"GET /pipelined HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+		sendPeerResponse(
+			"HTTP/1.1 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Cache-Control: public, max-age=60\r\n"
+			"Content-Length: 5\r\n\r\n"
+			"hello");
+
+		for (unsigned int i = 0; i < 3; i++) {
+			string header = readResponseHeader();
+			char body[5];
+
+			ensure("(1)", containsSubstring(header, "HTTP/1.1 200 OK\r\n"));
+			ensure_equals("(2)", containsSubstring(header, "Age: "), i > 0);
+			ensure_equals("(3)", clientConnectionIO.read(body, sizeof(body)), sizeof(body));
+			ensure_equals("(4)", StaticString(body, sizeof(body)), StaticString("hello"));
+		}
+		ensure_equals("(5)", readResponseBody(), "");
+	}
+
+
+	/***** Timeouts *****/
+
+	TEST_METHOD(52) {
+		set_test_name("If the app does not begin its response within app_response_timeout,"
+			" then a 504 response is sent");
+
+		init();
+		Json::Value config;
+		config["app_response_timeout"] = 0.1;
+		bg.safe->runSync(boost::bind(&MyController::configure, controller, config));
+		useTestSessionObject();
+
+		connectToServer();
+		sendRequest(
+			"GET /hello HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"Connection: close\r\n"
+			"\r\n");
+		waitUntilSessionInitiated();
+		readPeerRequestHeader();
+
+		string header = readResponseHeader();
+		string body = readResponseBody();
+		ensure("(1)", containsSubstring(header, "HTTP/1.1 504 Gateway Timeout\r\n"));
+		ensure("(2)", containsSubstring(body, "Application response timeout"));
+		waitUntilSessionClosed();
+	}
+
+	TEST_METHOD(56) {
+		set_test_name("The client header read and keep-alive timeouts are enabled");
+
+		init();
+		ensure_equals("(1)", controller->headerReadTimeout, 60.0);
+		ensure_equals("(2)", controller->keepAliveTimeout, 300.0);
+	}
 }
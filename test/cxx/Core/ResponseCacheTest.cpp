@@ -63,7 +63,6 @@ namespace tut {
 			req.strip100ContinueHeader = false;
 			req.hasPragmaHeader = false;
 			req.host = createHostString();
-			req.bodyBytesBuffered = 0;
 			req.cacheKey = HashedStaticString();
 			req.cacheControl = NULL;
 			req.varyCookie = NULL;
@@ -84,9 +83,6 @@ namespace tut {
 			req.appResponse.cacheControl  = NULL;
 			req.appResponse.expiresHeader = NULL;
 			req.appResponse.lastModifiedHeader = NULL;
-			req.appResponse.headerCacheBuffers = NULL;
-			req.appResponse.nHeaderCacheBuffers = 0;
-			psg_lstr_init(&req.appResponse.bodyCacheBuffer);
 
 			insertAppResponseHeader(createHeader(
 				"date", createTodayString(req.pool)),
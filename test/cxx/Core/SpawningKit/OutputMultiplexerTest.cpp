@@ -0,0 +1,155 @@
+#include <TestSupport.h>
+#include <Core/SpawningKit/OutputMultiplexer.h>
+#include <Core/SpawningKit/PipeWatcher.h>
+#include <FileDescriptor.h>
+#include <Utils/IOUtils.h>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <string>
+
+using namespace Passenger;
+using namespace Passenger::SpawningKit;
+using namespace std;
+
+namespace tut {
+	struct Core_SpawningKit_OutputMultiplexerTest {
+		boost::mutex syncher;
+		string gatheredOutput;
+
+		Core_SpawningKit_OutputMultiplexerTest() {
+			setLogLevel(LVL_ERROR);
+			setPrintAppOutputAsDebuggingMessages(true);
+		}
+
+		~Core_SpawningKit_OutputMultiplexerTest() {
+			setLogLevel(DEFAULT_LOG_LEVEL);
+			setPrintAppOutputAsDebuggingMessages(false);
+		}
+
+		void gatherOutput(const char *data, unsigned int size) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			gatheredOutput.append(data, size);
+		}
+
+		OutputMultiplexer::DataHandler dataHandler() {
+			return boost::bind(&Core_SpawningKit_OutputMultiplexerTest::gatherOutput,
+				this, _1, _2);
+		}
+
+		string lines(unsigned int count) {
+			string result;
+			for (unsigned int i = 0; i < count; i++) {
+				result.append("abc\n");
+			}
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Core_SpawningKit_OutputMultiplexerTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It forwards the output of many channels from a single thread,"
+			" until they reach EOF");
+		OutputMultiplexer multiplexer(0);
+		Pipe pipes[10];
+
+		for (unsigned int i = 0; i < 10; i++) {
+			pipes[i] = createPipe(__FILE__, __LINE__);
+			multiplexer.add(pipes[i].first, "stdout", 1000 + i, dataHandler());
+		}
+		ensure_equals("(1)", multiplexer.getChannelCount(), 10u);
+
+		for (unsigned int i = 0; i < 10; i++) {
+			writeExact(pipes[i].second, "hello\n");
+		}
+		EVENTUALLY(5,
+			boost::lock_guard<boost::mutex> l(syncher);
+			result = gatheredOutput.size() == 10 * sizeof("hello\n") - 10;
+		);
+
+		for (unsigned int i = 0; i < 10; i++) {
+			pipes[i].second.close();
+		}
+		EVENTUALLY(5,
+			result = multiplexer.getChannelCount() == 0;
+		);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Lines beyond the rate limit are not logged, but are still"
+			" passed to the data handler");
+		// 1 line per second, so the burst allowance is 10 lines.
+		OutputMultiplexer multiplexer(1);
+		Pipe p = createPipe(__FILE__, __LINE__);
+		multiplexer.add(p.first, "stdout", 1000, dataHandler());
+
+		writeExact(p.second, lines(50));
+		EVENTUALLY(5,
+			boost::lock_guard<boost::mutex> l(syncher);
+			result = gatheredOutput.size() == 200;
+		);
+		unsigned long long suppressed = multiplexer.getSuppressedLineCount();
+		ensure("At least 38 lines suppressed", suppressed >= 38);
+		ensure("At most 40 lines suppressed", suppressed <= 40);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("A rate limit of 0 means unlimited");
+		OutputMultiplexer multiplexer(0);
+		Pipe p = createPipe(__FILE__, __LINE__);
+		multiplexer.add(p.first, "stdout", 1000, dataHandler());
+
+		writeExact(p.second, lines(500));
+		EVENTUALLY(5,
+			boost::lock_guard<boost::mutex> l(syncher);
+			result = gatheredOutput.size() == 2000;
+		);
+		ensure_equals(multiplexer.getSuppressedLineCount(), 0ull);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The rate limit applies to all channels of a process together");
+		OutputMultiplexer multiplexer(1);
+		Pipe p1 = createPipe(__FILE__, __LINE__);
+		Pipe p2 = createPipe(__FILE__, __LINE__);
+		Pipe p3 = createPipe(__FILE__, __LINE__);
+		multiplexer.add(p1.first, "stdout", 1000, dataHandler());
+		multiplexer.add(p2.first, "stderr", 1000, dataHandler());
+		multiplexer.add(p3.first, "stdout", 1001, dataHandler());
+
+		writeExact(p1.second, lines(8));
+		writeExact(p2.second, lines(8));
+		writeExact(p3.second, lines(8));
+		EVENTUALLY(5,
+			boost::lock_guard<boost::mutex> l(syncher);
+			result = gatheredOutput.size() == 96;
+		);
+		unsigned long long suppressed = multiplexer.getSuppressedLineCount();
+		ensure("At least 5 lines suppressed", suppressed >= 5);
+		ensure("At most 6 lines suppressed", suppressed <= 6);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("PipeWatcher forwards output through the Config's multiplexer,"
+			" even after the PipeWatcher object is destroyed");
+		ConfigPtr config = boost::make_shared<Config>();
+		config->resourceLocator = resourceLocator;
+		config->outputHandler = dataHandler();
+		config->finalize();
+
+		Pipe p = createPipe(__FILE__, __LINE__);
+		{
+			PipeWatcherPtr watcher = boost::make_shared<PipeWatcher>(config,
+				p.first, "stdout", 1000);
+			watcher->initialize();
+			watcher->start();
+		}
+
+		writeExact(p.second, "hello\nworld\n");
+		EVENTUALLY(5,
+			boost::lock_guard<boost::mutex> l(syncher);
+			result = gatheredOutput == "hello\nworld\n";
+		);
+		ensure_equals(config->outputMultiplexer->getChannelCount(), 1u);
+	}
+}
@@ -0,0 +1,166 @@
+#include "TestSupport.h"
+#include "../../src/apache2_module/DirectoryMapperCache.h"
+#include <boost/make_shared.hpp>
+#include <boost/thread.hpp>
+#include <boost/bind.hpp>
+
+using namespace std;
+using namespace Passenger;
+
+namespace tut {
+	struct DirectoryMapperCacheTest {
+		DirectoryMapperCache cache;
+		int server;
+
+		DirectoryMapperCacheTest() {
+			SystemTime::force(100);
+		}
+
+		~DirectoryMapperCacheTest() {
+			SystemTime::release();
+		}
+
+		// Builds the key the way DirectoryMapper does for a DirConfig
+		// that sets only PassengerAppRoot.
+		DirectoryMapperCache::Key makeKey(const char *appRoot,
+			const char *baseURI = "/foo")
+		{
+			DirectoryMapperCache::Key key;
+			key.server = &server;
+			key.docRoot = "/webapps/site/public";
+			key.baseURI = baseURI;
+			key.setAppRoot(appRoot);
+			return key;
+		}
+
+		DirectoryMappingPtr makeMapping(const char *appRoot,
+			const char *baseURI = "/foo")
+		{
+			boost::shared_ptr<DirectoryMapping> mapping =
+				boost::make_shared<DirectoryMapping>();
+			mapping->publicDir = string("/webapps/site/public") + baseURI;
+			mapping->appRoot = appRoot;
+			mapping->appGroupName = appRoot;
+			mapping->baseURI = baseURI;
+			mapping->appType = PAT_RACK;
+			return mapping;
+		}
+	};
+
+	DEFINE_TEST_GROUP(DirectoryMapperCacheTest);
+
+	TEST_METHOD(1) {
+		// A stored result is returned for a key with the same contents,
+		// even if it was built from a different DirConfig.
+		cache.store(makeKey("/webapps/a"), makeMapping("/webapps/a"), 1);
+		DirectoryMappingPtr mapping = cache.lookup(makeKey("/webapps/a"));
+		ensure(mapping != NULL);
+		ensure_equals(mapping->appRoot, "/webapps/a");
+		ensure_equals(mapping->baseURI, "/foo");
+	}
+
+	TEST_METHOD(2) {
+		// Two DirConfigs that map the same URI to different applications
+		// get separate entries.
+		cache.store(makeKey("/webapps/a"), makeMapping("/webapps/a"), 1);
+		ensure(cache.lookup(makeKey("/webapps/b")) == NULL);
+
+		cache.store(makeKey("/webapps/b"), makeMapping("/webapps/b"), 1);
+		ensure_equals(cache.size(), 2u);
+		ensure_equals(cache.lookup(makeKey("/webapps/a"))->appRoot, "/webapps/a");
+		ensure_equals(cache.lookup(makeKey("/webapps/b"))->appRoot, "/webapps/b");
+	}
+
+	TEST_METHOD(3) {
+		// Every option that the mapper reads is part of the key.
+		DirectoryMapperCache::Key key = makeKey("/webapps/a");
+		cache.store(key, makeMapping("/webapps/a"), 1);
+
+		DirectoryMapperCache::Key other = key;
+		other.baseURI = "/bar";
+		ensure("baseURI", cache.lookup(other) == NULL);
+
+		other = key;
+		other.docRoot = "/webapps/other/public";
+		ensure("docRoot", cache.lookup(other) == NULL);
+
+		other = key;
+		other.setAppType("rack");
+		ensure("appType", cache.lookup(other) == NULL);
+
+		other = key;
+		other.setAppGroupName("a");
+		ensure("appGroupName", cache.lookup(other) == NULL);
+
+		other = key;
+		other.setAppEnv("staging");
+		ensure("appEnv", cache.lookup(other) == NULL);
+
+		other = key;
+		other.resolveSymlinksInDocRoot = 1;
+		ensure("resolveSymlinksInDocRoot", cache.lookup(other) == NULL);
+
+		int otherServer;
+		other = key;
+		other.server = &otherServer;
+		ensure("server", cache.lookup(other) == NULL);
+
+		ensure("same key", cache.lookup(key) != NULL);
+	}
+
+	TEST_METHOD(4) {
+		// An unset option and an option set to the empty string are
+		// different keys.
+		DirectoryMapperCache::Key key = makeKey(NULL);
+		cache.store(key, makeMapping(""), 1);
+		ensure(cache.lookup(makeKey("")) == NULL);
+		ensure(cache.lookup(makeKey(NULL)) != NULL);
+	}
+
+	TEST_METHOD(5) {
+		// Results expire after the throttle rate.
+		cache.store(makeKey("/webapps/a"), makeMapping("/webapps/a"), 2);
+		SystemTime::force(101);
+		ensure(cache.lookup(makeKey("/webapps/a")) != NULL);
+		SystemTime::force(102);
+		ensure(cache.lookup(makeKey("/webapps/a")) == NULL);
+	}
+
+	TEST_METHOD(6) {
+		// Nothing is cached with a throttle rate of 0.
+		cache.store(makeKey("/webapps/a"), makeMapping("/webapps/a"), 0);
+		ensure(cache.lookup(makeKey("/webapps/a")) == NULL);
+		ensure_equals(cache.size(), 0u);
+	}
+
+	static void lookupMany(DirectoryMapperCache *cache, DirectoryMapperCache::Key key,
+		AtomicInt *mismatches)
+	{
+		for (unsigned int i = 0; i < 10000; i++) {
+			DirectoryMappingPtr mapping = cache->lookup(key);
+			if (mapping == NULL || mapping->appRoot != key.appRoot) {
+				(*mismatches)++;
+			}
+		}
+	}
+
+	TEST_METHOD(7) {
+		// Cache hits from many threads at the same time, while other
+		// results are being stored, return the stored results.
+		AtomicInt mismatches;
+		cache.store(makeKey("/webapps/a"), makeMapping("/webapps/a"), 10);
+		cache.store(makeKey("/webapps/b"), makeMapping("/webapps/b"), 10);
+
+		boost::thread_group threads;
+		for (unsigned int i = 0; i < 8; i++) {
+			threads.create_thread(boost::bind(lookupMany, &cache,
+				makeKey((i % 2 == 0) ? "/webapps/a" : "/webapps/b"), &mismatches));
+		}
+		for (unsigned int i = 0; i < 1000; i++) {
+			cache.store(makeKey("/webapps/other", ("/" + toString(i)).c_str()),
+				makeMapping("/webapps/other"), 10);
+		}
+		threads.join_all();
+		ensure_equals(mismatches.get(), 0);
+	}
+}
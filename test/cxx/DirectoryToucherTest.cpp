@@ -0,0 +1,107 @@
+#include "TestSupport.h"
+#include "Utils/DirectoryToucher.h"
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <utime.h>
+#include <unistd.h>
+
+using namespace std;
+using namespace Passenger;
+
+namespace tut {
+	struct DirectoryToucherTest {
+		TempDir tmpDir;
+
+		DirectoryToucherTest()
+			: tmpDir("tmp.toucher")
+			{ }
+
+		void makeOld(const char *path) {
+			struct utimbuf buf;
+			buf.actime = 1000;
+			buf.modtime = 1000;
+			ensure(string("utime ") + path, utime(path, &buf) == 0);
+		}
+
+		time_t mtime(const char *path) {
+			struct stat buf;
+			ensure(string("lstat ") + path, lstat(path, &buf) == 0);
+			return buf.st_mtime;
+		}
+	};
+
+	DEFINE_TEST_GROUP(DirectoryToucherTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It touches the directory and everything below it");
+		mkdir("tmp.toucher/root", 0700);
+		mkdir("tmp.toucher/root/a", 0700);
+		mkdir("tmp.toucher/root/a/b", 0700);
+		mkdir("tmp.toucher/root/c", 0700);
+		touchFile("tmp.toucher/root/1.txt");
+		touchFile("tmp.toucher/root/a/2.txt");
+		touchFile("tmp.toucher/root/a/b/3.txt");
+		touchFile("tmp.toucher/root/c/4.txt");
+
+		const char *paths[] = {
+			"tmp.toucher/root/1.txt", "tmp.toucher/root/a/2.txt",
+			"tmp.toucher/root/a/b/3.txt", "tmp.toucher/root/c/4.txt",
+			"tmp.toucher/root/a/b", "tmp.toucher/root/a", "tmp.toucher/root/c",
+			"tmp.toucher/root"
+		};
+		unsigned int i, count = sizeof(paths) / sizeof(const char *);
+		for (i = 0; i < count; i++) {
+			makeOld(paths[i]);
+		}
+
+		DirectoryTouchResult result = touchDirectoryTree("tmp.toucher/root", 2);
+		ensure_equals("(1)", result.touched, (unsigned long long) count);
+		ensure_equals("(2)", result.errors, 0ull);
+		for (i = 0; i < count; i++) {
+			ensure(string(paths[i]) + " is touched", mtime(paths[i]) > 1000);
+		}
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It touches symlinks themselves instead of following them");
+		mkdir("tmp.toucher/root", 0700);
+		mkdir("tmp.toucher/outside", 0700);
+		touchFile("tmp.toucher/outside/file.txt");
+		ensure(symlink("../outside", "tmp.toucher/root/dirlink") == 0);
+		ensure(symlink("../outside/file.txt", "tmp.toucher/root/filelink") == 0);
+		makeOld("tmp.toucher/outside");
+		makeOld("tmp.toucher/outside/file.txt");
+
+		DirectoryTouchResult result = touchDirectoryTree("tmp.toucher/root");
+		ensure_equals("(1)", result.touched, 3ull);
+		ensure_equals("(2)", result.errors, 0ull);
+		ensure_equals("(3)", mtime("tmp.toucher/outside"), (time_t) 1000);
+		ensure_equals("(4)", mtime("tmp.toucher/outside/file.txt"), (time_t) 1000);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("A nonexistant directory is not an error");
+		DirectoryTouchResult result = touchDirectoryTree("tmp.toucher/nonexistant");
+		ensure_equals("(1)", result.touched, 0ull);
+		ensure_equals("(2)", result.errors, 0ull);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Unreadable directories are reported as errors but"
+			" don't stop the walk");
+		if (geteuid() == 0) {
+			// Root can read everything.
+			return;
+		}
+		mkdir("tmp.toucher/root", 0700);
+		mkdir("tmp.toucher/root/locked", 0700);
+		touchFile("tmp.toucher/root/file.txt");
+		chmod("tmp.toucher/root/locked", 0);
+
+		DirectoryTouchResult result = touchDirectoryTree("tmp.toucher/root");
+		chmod("tmp.toucher/root/locked", 0700);
+		ensure_equals("(1)", result.errors, 1ull);
+		ensure("(2)", !result.firstError.empty());
+		ensure_equals("(3)", result.touched, 3ull);
+	}
+}
@@ -0,0 +1,341 @@
+#include <TestSupport.h>
+#include <LoadGenerator/LoadGenerator.h>
+#include <Utils/IOUtils.h>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/thread.hpp>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <unistd.h>
+#include <string>
+#include <vector>
+
+using namespace Passenger;
+using namespace Passenger::LoadGenerator;
+using namespace std;
+
+namespace tut {
+	/**
+	 * A minimal blocking HTTP server with one thread per connection.
+	 * Requests must not have a body.
+	 */
+	struct LoadGeneratorTestServer {
+		enum ResponseType {
+			CONTENT_LENGTH,
+			CHUNKED,
+			CONNECTION_CLOSE,
+			UNTIL_EOF,
+			GARBAGE
+		};
+
+		int fd;
+		ResponseType responseType;
+		boost::atomic<bool> stopping;
+		boost::atomic<unsigned int> requests;
+		boost::mutex syncher;
+		string firstRequest;
+		boost::thread *acceptThread;
+		vector<boost::thread *> clientThreads;
+
+		LoadGeneratorTestServer(int _fd, ResponseType _responseType)
+			: fd(_fd),
+			  responseType(_responseType),
+			  stopping(false),
+			  requests(0)
+		{
+			acceptThread = new boost::thread(boost::bind(
+				&LoadGeneratorTestServer::acceptMain, this));
+		}
+
+		~LoadGeneratorTestServer() {
+			stopping = true;
+			acceptThread->join();
+			delete acceptThread;
+			for (unsigned int i = 0; i < clientThreads.size(); i++) {
+				clientThreads[i]->join();
+				delete clientThreads[i];
+			}
+			close(fd);
+		}
+
+		bool waitReadable(int fd) {
+			struct pollfd pfd;
+			pfd.fd = fd;
+			pfd.events = POLLIN;
+			while (!stopping) {
+				if (poll(&pfd, 1, 10) == 1) {
+					return true;
+				}
+			}
+			return false;
+		}
+
+		void acceptMain() {
+			while (waitReadable(fd)) {
+				int client = accept(fd, NULL, NULL);
+				if (client != -1) {
+					clientThreads.push_back(new boost::thread(boost::bind(
+						&LoadGeneratorTestServer::clientMain, this, client)));
+				}
+			}
+		}
+
+		void clientMain(int client) {
+			string buffer;
+			char buf[1024];
+			bool done = false;
+
+			while (!done && waitReadable(client)) {
+				ssize_t ret = read(client, buf, sizeof(buf));
+				if (ret <= 0) {
+					break;
+				}
+				buffer.append(buf, ret);
+
+				string::size_type pos;
+				while (!done && (pos = buffer.find("\r\n\r\n")) != string::npos) {
+					{
+						boost::lock_guard<boost::mutex> l(syncher);
+						if (firstRequest.empty()) {
+							firstRequest = buffer.substr(0, pos + 4);
+						}
+					}
+					buffer.erase(0, pos + 4);
+					requests++;
+					try {
+						writeExact(client, getResponse());
+					} catch (const SystemException &) {
+						// The load generator closed the connection.
+						done = true;
+						break;
+					}
+					done = responseType == CONNECTION_CLOSE
+						|| responseType == UNTIL_EOF;
+				}
+			}
+			close(client);
+		}
+
+		StaticString getResponse() const {
+			switch (responseType) {
+			case CONTENT_LENGTH:
+				return "HTTP/1.1 200 OK\r\nContent-Length: 5\r\n\r\nhello";
+			case CHUNKED:
+				return "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n"
+					"2\r\nhe\r\n3\r\nllo\r\n0\r\n\r\n";
+			case CONNECTION_CLOSE:
+				return "HTTP/1.1 200 OK\r\nContent-Length: 5\r\nConnection: close\r\n\r\nhello";
+			case UNTIL_EOF:
+				return "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\nhello";
+			default:
+				return "garbage\r\n\r\n";
+			}
+		}
+	};
+
+	struct LoadGenerator_LoadGeneratorTest {
+		TempDir tmpDir;
+		Options options;
+		LoadGeneratorTestServer *server;
+
+		LoadGenerator_LoadGeneratorTest()
+			: tmpDir("tmp.loadgen"),
+			  server(NULL)
+		{
+			options.address = "unix:tmp.loadgen/server.sock";
+			options.connections = 4;
+			options.threads = 2;
+			options.duration = 0;
+		}
+
+		~LoadGenerator_LoadGeneratorTest() {
+			delete server;
+			setLogLevel(DEFAULT_LOG_LEVEL);
+		}
+
+		void startServer(LoadGeneratorTestServer::ResponseType responseType) {
+			int fd = createUnixServer("tmp.loadgen/server.sock");
+			server = new LoadGeneratorTestServer(fd, responseType);
+		}
+
+		void startTcpServer(LoadGeneratorTestServer::ResponseType responseType) {
+			int fd = createTcpServer("127.0.0.1", 0);
+			struct sockaddr_in addr;
+			socklen_t len = sizeof(addr);
+			getsockname(fd, (struct sockaddr *) &addr, &len);
+			options.address = "tcp://127.0.0.1:" + toString(ntohs(addr.sin_port));
+			server = new LoadGeneratorTestServer(fd, responseType);
+		}
+
+		Results run() {
+			Generator generator(options);
+			return generator.run();
+		}
+	};
+
+	DEFINE_TEST_GROUP(LoadGenerator_LoadGeneratorTest);
+
+	TEST_METHOD(1) {
+		set_test_name("The request is built from the options");
+		options.method = "POST";
+		options.path = "/foo?bar=1";
+		options.headers.push_back("X-Foo: bar");
+		options.bodySize = 3;
+		ensure_equals(options.buildRequest(),
+			"POST /foo?bar=1 HTTP/1.1\r\n"
+			"Host: localhost\r\n"
+			"X-Foo: bar\r\n"
+			"Content-Length: 3\r\n"
+			"\r\n"
+			"xxx");
+
+		options.address = "tcp://127.0.0.1:3000";
+		options.bodySize = 0;
+		options.headers.clear();
+		options.method = "GET";
+		options.path = "/";
+		ensure_equals(options.buildRequest(),
+			"GET / HTTP/1.1\r\n"
+			"Host: 127.0.0.1:3000\r\n"
+			"\r\n");
+	}
+
+
+	/***** Closed-loop mode *****/
+
+	TEST_METHOD(5) {
+		set_test_name("Closed-loop mode sends requests over keep-alive connections "
+			"until the request limit is reached");
+		startServer(LoadGeneratorTestServer::CONTENT_LENGTH);
+		options.maxRequests = 200;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 200);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure_equals<boost::uint64_t>("reconnects", results.reconnects, 0);
+		ensure_equals<boost::uint64_t>("2xx", results.statusClasses[2], 200);
+		ensure_equals<boost::uint64_t>("service times", results.serviceTime.getCount(), 200);
+		ensure("corrected latencies", results.latency.getCount() >= 200);
+		ensure_equals<boost::uint64_t>("bytes", results.bytesReceived,
+			200 * server->getResponse().size());
+		ensure_equals("server requests", server->requests.load(), 200u);
+		ensure("The request was sent",
+			containsSubstring(server->firstRequest, "GET / HTTP/1.1\r\nHost: localhost\r\n"));
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("It parses chunked responses");
+		startServer(LoadGeneratorTestServer::CHUNKED);
+		options.maxRequests = 100;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 100);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure_equals<boost::uint64_t>("reconnects", results.reconnects, 0);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("It reconnects if the server does not keep the connection alive");
+		startServer(LoadGeneratorTestServer::CONNECTION_CLOSE);
+		options.maxRequests = 50;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 50);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure("reconnects", results.reconnects >= 50 - options.connections);
+	}
+
+	TEST_METHOD(8) {
+		set_test_name("It supports responses whose body ends at end-of-stream");
+		startServer(LoadGeneratorTestServer::UNTIL_EOF);
+		options.maxRequests = 50;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 50);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+	}
+
+	TEST_METHOD(9) {
+		set_test_name("Unparseable responses are counted as errors");
+		startServer(LoadGeneratorTestServer::GARBAGE);
+		options.maxRequests = 10;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 0);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 10);
+	}
+
+	TEST_METHOD(10) {
+		set_test_name("It supports TCP servers");
+		startTcpServer(LoadGeneratorTestServer::CONTENT_LENGTH);
+		options.maxRequests = 100;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 100);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure("The Host header is derived from the address",
+			containsSubstring(server->firstRequest, "Host: 127.0.0.1:"));
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("It stops after the given duration");
+		startServer(LoadGeneratorTestServer::CONTENT_LENGTH);
+		options.duration = 100;
+		Results results = run();
+		ensure("requests", results.requests > 0);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure("elapsed", results.elapsed >= 100000);
+	}
+
+	TEST_METHOD(12) {
+		set_test_name("It throws an exception if it cannot connect");
+		setLogLevel(LVL_ERROR);
+		try {
+			run();
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &) {
+			// Pass.
+		}
+	}
+
+
+	/***** Open-loop mode *****/
+
+	TEST_METHOD(20) {
+		set_test_name("Open-loop mode sends requests at the given rate");
+		startServer(LoadGeneratorTestServer::CONTENT_LENGTH);
+		options.rate = 500;
+		options.duration = 200;
+		Results results = run();
+		// 100 requests are scheduled; allow for a slow test machine.
+		ensure("requests lower bound", results.requests >= 50);
+		ensure("requests upper bound", results.requests <= 101);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure_equals("Every request has a latency", results.latency.getCount(),
+			results.requests);
+		ensure_equals(results.serviceTime.getCount(), results.requests);
+	}
+
+	TEST_METHOD(21) {
+		set_test_name("Open-loop mode stops after the request limit is reached");
+		startServer(LoadGeneratorTestServer::CONTENT_LENGTH);
+		options.rate = 2000;
+		options.maxRequests = 40;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 40);
+		ensure_equals<boost::uint64_t>("errors", results.errors, 0);
+		ensure_equals<boost::uint64_t>("unsent", results.unsent, 0);
+	}
+
+	TEST_METHOD(22) {
+		set_test_name("In open-loop mode, latency includes the time spent waiting "
+			"for a connection");
+		startServer(LoadGeneratorTestServer::CONNECTION_CLOSE);
+		options.connections = 1;
+		options.threads = 1;
+		// Far more than one connection can handle, so requests queue up.
+		options.rate = 100000;
+		options.maxRequests = 200;
+		Results results = run();
+		ensure_equals<boost::uint64_t>("requests", results.requests, 200);
+		ensure("delayed", results.delayed > 0);
+		ensure("Latency is larger than the service time",
+			results.latency.getMax() > results.serviceTime.getMax());
+	}
+}
@@ -0,0 +1,157 @@
+#include <TestSupport.h>
+#include <MemoryKit/ObjectSlab.h>
+#include <boost/cstdint.hpp>
+#include <stdexcept>
+#include <vector>
+
+using namespace Passenger;
+using namespace Passenger::MemoryKit;
+using namespace std;
+
+namespace tut {
+	struct MemoryKit_ObjectSlabTest_Object {
+		static int constructed;
+		static int destructed;
+		static bool throwOnConstruction;
+
+		double value;
+		char data[40];
+
+		MemoryKit_ObjectSlabTest_Object()
+			: value(1.5)
+		{
+			if (throwOnConstruction) {
+				throw std::runtime_error("construction failed");
+			}
+			constructed++;
+		}
+
+		~MemoryKit_ObjectSlabTest_Object() {
+			destructed++;
+		}
+	};
+
+	int MemoryKit_ObjectSlabTest_Object::constructed = 0;
+	int MemoryKit_ObjectSlabTest_Object::destructed = 0;
+	bool MemoryKit_ObjectSlabTest_Object::throwOnConstruction = false;
+
+	typedef MemoryKit_ObjectSlabTest_Object Object;
+	typedef ObjectSlab<Object, 1024> Slab;
+
+	struct MemoryKit_ObjectSlabTest {
+		Slab slab;
+		vector<Object *> objects;
+
+		MemoryKit_ObjectSlabTest() {
+			Object::constructed = 0;
+			Object::destructed = 0;
+			Object::throwOnConstruction = false;
+		}
+
+		~MemoryKit_ObjectSlabTest() {
+			destroyAll();
+		}
+
+		void constructMany(unsigned int count) {
+			for (unsigned int i = 0; i < count; i++) {
+				objects.push_back(slab.construct());
+			}
+		}
+
+		void destroyAll() {
+			for (unsigned int i = 0; i < objects.size(); i++) {
+				slab.destroy(objects[i]);
+			}
+			objects.clear();
+		}
+	};
+
+	DEFINE_TEST_GROUP(MemoryKit_ObjectSlabTest);
+
+	TEST_METHOD(1) {
+		set_test_name("construct() and destroy() call the constructor and destructor");
+		Object *object = slab.construct();
+		ensure_equals(Object::constructed, 1);
+		ensure_equals(object->value, 1.5);
+		ensure_equals(slab.getLiveCount(), 1u);
+		slab.destroy(object);
+		ensure_equals(Object::destructed, 1);
+		ensure_equals(slab.getLiveCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Objects are distinct and suitably aligned");
+		constructMany(Slab::SLOTS_PER_CHUNK * 3);
+		for (unsigned int i = 0; i < objects.size(); i++) {
+			ensure_equals<boost::uintmax_t>("Aligned",
+				(boost::uintmax_t) objects[i] % boost::alignment_of<Object>::value, 0);
+			objects[i]->data[0] = (char) i;
+			if (i > 0) {
+				ensure("Distinct", objects[i] != objects[i - 1]);
+			}
+		}
+		for (unsigned int i = 0; i < objects.size(); i++) {
+			ensure_equals(objects[i]->data[0], (char) i);
+		}
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("The most recently destroyed slot is reused first");
+		constructMany(3);
+		Object *object = objects[1];
+		slab.destroy(object);
+		objects.erase(objects.begin() + 1);
+		objects.push_back(slab.construct());
+		ensure_equals(objects.back(), object);
+		ensure_equals(slab.getChunkCount(), 1u);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("A new chunk is allocated when all chunks are full");
+		constructMany(Slab::SLOTS_PER_CHUNK);
+		ensure_equals(slab.getChunkCount(), 1u);
+		constructMany(1);
+		ensure_equals(slab.getChunkCount(), 2u);
+		ensure_equals(slab.getAllocatedSize(), 2u * 1024);
+		ensure_equals(slab.getLiveCount(), Slab::SLOTS_PER_CHUNK + 1);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Empty chunks are freed, except for one");
+		constructMany(Slab::SLOTS_PER_CHUNK * 4);
+		ensure_equals(slab.getChunkCount(), 4u);
+		destroyAll();
+		ensure_equals(slab.getChunkCount(), 1u);
+		ensure_equals(slab.getLiveCount(), 0u);
+
+		constructMany(Slab::SLOTS_PER_CHUNK);
+		ensure_equals("The spare chunk is reused", slab.getChunkCount(), 1u);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("Slots freed in a full chunk become available again");
+		constructMany(Slab::SLOTS_PER_CHUNK * 2);
+		Object *object = objects[0];
+		slab.destroy(object);
+		objects.erase(objects.begin());
+		objects.push_back(slab.construct());
+		ensure_equals(objects.back(), object);
+		ensure_equals(slab.getChunkCount(), 2u);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("If the constructor throws, the slot is released");
+		Object::throwOnConstruction = true;
+		try {
+			slab.construct();
+			fail("Exception expected");
+		} catch (const std::runtime_error &) {
+			// Pass.
+		}
+		ensure_equals(slab.getLiveCount(), 0u);
+		Object::throwOnConstruction = false;
+		constructMany(1);
+		ensure_equals(slab.getLiveCount(), 1u);
+		ensure_equals(slab.getChunkCount(), 1u);
+	}
+}
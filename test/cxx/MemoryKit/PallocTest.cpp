@@ -439,4 +439,29 @@ namespace tut {
 		ensure("psg_reset_pool fails",
 			!psg_reset_pool(pool, PSG_DEFAULT_POOL_SIZE));
 	}
+
+	TEST_METHOD(21) {
+		set_test_name("psg_pool_usage");
+		size_t reserved, used, nlarge;
+		pool = psg_create_pool(PSG_DEFAULT_POOL_SIZE);
+
+		psg_pool_usage(pool, &reserved, &used, &nlarge);
+		ensure_equals<size_t>("(1)", reserved, PSG_DEFAULT_POOL_SIZE);
+		ensure_equals<size_t>("(2)", used, sizeof(psg_pool_t));
+		ensure_equals<size_t>("(3)", nlarge, 0);
+
+		psg_pnalloc(pool, 100);
+		psg_pnalloc(pool, PSG_MAX_ALLOC_FROM_POOL + 1);
+		psg_pool_usage(pool, &reserved, &used, &nlarge);
+		ensure_equals<size_t>("(4)", reserved, PSG_DEFAULT_POOL_SIZE);
+		ensure("(5)", used >= sizeof(psg_pool_t) + 100);
+		ensure_equals<size_t>("(6)", nlarge, 1);
+
+		for (unsigned i = 0; i < PSG_DEFAULT_POOL_SIZE / 64; i++) {
+			psg_pnalloc(pool, 64);
+		}
+		psg_pool_usage(pool, &reserved, &used, &nlarge);
+		ensure_equals<size_t>("(7)", reserved, 2 * PSG_DEFAULT_POOL_SIZE);
+		ensure("(8)", used <= reserved);
+	}
 }
@@ -0,0 +1,329 @@
+#include <TestSupport.h>
+#include <Constants.h>
+#include <MemoryKit/mbuf.h>
+#include <ServerKit/Errors.h>
+#include <ServerKit/HttpChunkedBodyParser.h>
+#include <boost/cstdint.hpp>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+using namespace Passenger;
+using namespace Passenger::MemoryKit;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace tut {
+	struct ServerKit_HttpChunkedBodyParserTest {
+		struct Outcome {
+			HttpChunkedEvent::Type type;
+			int errcode;
+			/** Offset in the input right after the last consumed byte. */
+			size_t consumed;
+			string data;
+			unsigned int feedCalls;
+		};
+
+		struct mbuf_pool pool;
+		boost::uint32_t randomState;
+
+		ServerKit_HttpChunkedBodyParserTest()
+			: randomState(1)
+		{
+			pool.mbuf_block_chunk_size = DEFAULT_MBUF_CHUNK_SIZE;
+			mbuf_pool_init(&pool);
+		}
+
+		~ServerKit_HttpChunkedBodyParserTest() {
+			mbuf_pool_deinit(&pool);
+		}
+
+		static unsigned int formatLoggingPrefix(char *buf, unsigned int bufsize,
+			void *userData)
+		{
+			return snprintf(buf, bufsize, "ChunkedBodyParser: ");
+		}
+
+		/** A deterministic LCG, so that failures are reproducible. */
+		unsigned int random(unsigned int max) {
+			randomState = randomState * 1103515245 + 12345;
+			return (randomState >> 8) % max;
+		}
+
+		/**
+		 * Feeds `input` to a parser in pieces whose sizes are given by `splits`
+		 * (the last piece contains the rest), the way HttpServer and Controller
+		 * do: each piece is fed repeatedly until it is fully consumed or until
+		 * the end of the body or an error is reached.
+		 */
+		Outcome parse(const string &input, const vector<size_t> &splits,
+			bool fastPath, bool outputDataEvents = true)
+		{
+			HttpChunkedBodyParserState state;
+			HttpChunkedBodyParser parser(&state, formatLoggingPrefix, NULL, fastPath);
+			Outcome outcome;
+			size_t pos = 0;
+			unsigned int i = 0;
+
+			parser.initialize();
+			outcome.type = HttpChunkedEvent::NONE;
+			outcome.errcode = 0;
+			outcome.feedCalls = 0;
+
+			while (pos < input.size()) {
+				size_t pieceSize = input.size() - pos;
+				if (i < splits.size()) {
+					pieceSize = std::min(pieceSize, splits[i]);
+				}
+				i++;
+
+				mbuf piece = mbuf_get_with_size(&pool, pieceSize);
+				memcpy(piece.start, input.data() + pos, pieceSize);
+				while (!piece.empty()) {
+					HttpChunkedEvent event(parser.feed(piece, outputDataEvents));
+					outcome.feedCalls++;
+					ensure("Never consumes more than given", event.consumed <= piece.size());
+					if (event.type == HttpChunkedEvent::DATA) {
+						ensure("Data lies within the buffer",
+							event.data.start >= piece.start
+							&& event.data.end <= piece.start + event.consumed);
+						ensure("Data events are never empty", !event.data.empty());
+						outcome.data.append(event.data.start, event.data.size());
+					} else if (event.type != HttpChunkedEvent::END
+						&& event.type != HttpChunkedEvent::ERROR)
+					{
+						ensure("Makes progress", event.consumed > 0);
+					}
+					pos += event.consumed;
+					if (event.type == HttpChunkedEvent::END
+					 || event.type == HttpChunkedEvent::ERROR)
+					{
+						outcome.type = event.type;
+						outcome.errcode = event.errcode;
+						outcome.consumed = pos;
+						return outcome;
+					}
+					piece = mbuf(piece, event.consumed);
+				}
+			}
+
+			outcome.consumed = pos;
+			return outcome;
+		}
+
+		Outcome parse(const string &input, bool fastPath = true) {
+			return parse(input, vector<size_t>(), fastPath);
+		}
+
+		string randomChunkedBody(string &data) {
+			string result;
+			unsigned int nchunks = random(20);
+
+			for (unsigned int i = 0; i < nchunks; i++) {
+				unsigned int size;
+				switch (random(4)) {
+				case 0:
+					size = 1 + random(4);
+					break;
+				case 1:
+					size = 1 + random(64);
+					break;
+				default:
+					size = 1 + random(600);
+					break;
+				}
+
+				char sizeStr[16];
+				snprintf(sizeStr, sizeof(sizeStr), random(2) == 0 ? "%x" : "%X", size);
+				result.append(random(8), '0');
+				result.append(sizeStr);
+				if (random(10) == 0) {
+					result.append(";name=value");
+				}
+				result.append("\r\n");
+
+				string chunk;
+				for (unsigned int j = 0; j < size; j++) {
+					// Include CRs and LFs in the data to trip up a careless parser.
+					chunk.append(1, "ab\r\n0123456789xyz"[random(17)]);
+				}
+				result.append(chunk);
+				data.append(chunk);
+				result.append("\r\n");
+			}
+			result.append(random(3) == 0 ? "00" : "0");
+			result.append("\r\n\r\n");
+			// Data that belongs to the next request.
+			if (random(2) == 0) {
+				result.append("GET / HTTP/1.1\r\n");
+			}
+			return result;
+		}
+
+		void mutate(string &input) {
+			if (input.empty()) {
+				return;
+			}
+			switch (random(5)) {
+			case 0:
+				input[random(input.size())] = (char) random(256);
+				break;
+			case 1:
+				input.insert(random(input.size()), 1, "\r\n;0fFgG \t"[random(10)]);
+				break;
+			case 2:
+				input.erase(random(input.size()), 1);
+				break;
+			case 3:
+				input.resize(random(input.size()));
+				break;
+			default:
+				// Overly long chunk sizes.
+				input.insert(0, string(1 + random(12), "0f8"[random(3)]) + "\r\n");
+				break;
+			}
+		}
+
+		vector<size_t> randomSplits(const string &input) {
+			vector<size_t> splits;
+			size_t total = 0;
+			while (total < input.size()) {
+				size_t size;
+				switch (random(3)) {
+				case 0:
+					size = 1 + random(3);
+					break;
+				case 1:
+					size = 1 + random(40);
+					break;
+				default:
+					size = 1 + random(2000);
+					break;
+				}
+				splits.push_back(size);
+				total += size;
+			}
+			return splits;
+		}
+
+		void ensureSameOutcome(const string &input, const vector<size_t> &splits,
+			bool outputDataEvents)
+		{
+			Outcome expected = parse(input, splits, false, outputDataEvents);
+			Outcome actual = parse(input, splits, true, outputDataEvents);
+			if (actual.type != expected.type
+			 || actual.errcode != expected.errcode
+			 || actual.consumed != expected.consumed
+			 || actual.data != expected.data)
+			{
+				fail(("The fast path behaves differently for input \""
+					+ cEscapeString(input) + "\" (split into "
+					+ toString(splits.size()) + " pieces): type "
+					+ toString((int) actual.type) + " vs " + toString((int) expected.type)
+					+ ", errcode " + toString(actual.errcode) + " vs "
+					+ toString(expected.errcode) + ", consumed "
+					+ toString(actual.consumed) + " vs " + toString(expected.consumed)).c_str());
+			}
+			ensure("The fast path never needs more feed() calls",
+				actual.feedCalls <= expected.feedCalls);
+		}
+	};
+
+	DEFINE_TEST_GROUP(ServerKit_HttpChunkedBodyParserTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It parses a chunked body");
+		Outcome outcome = parse("5\r\nhello\r\nA\r\n0123456789\r\n0\r\n\r\nGET");
+		ensure_equals(outcome.type, HttpChunkedEvent::END);
+		ensure_equals(outcome.data, "hello0123456789");
+		ensure_equals<size_t>("It stops at the end of the body", outcome.consumed,
+			strlen("5\r\nhello\r\nA\r\n0123456789\r\n0\r\n\r\n"));
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("A data event that completes a chunk also consumes the next chunk header");
+		HttpChunkedBodyParserState state;
+		HttpChunkedBodyParser parser(&state, formatLoggingPrefix, NULL);
+		const char input[] = "5\r\nhello\r\n3\r\nabc\r\n0\r\n\r\n";
+		mbuf buffer = mbuf_get_with_size(&pool, sizeof(input) - 1);
+		memcpy(buffer.start, input, sizeof(input) - 1);
+
+		parser.initialize();
+		HttpChunkedEvent event(parser.feed(buffer));
+		ensure_equals(event.type, HttpChunkedEvent::DATA);
+		ensure_equals(string(event.data.start, event.data.size()), "hello");
+		ensure_equals(event.consumed, (unsigned int) strlen("5\r\nhello\r\n3\r\n"));
+
+		buffer = mbuf(buffer, event.consumed);
+		event = parser.feed(buffer);
+		ensure_equals(event.type, HttpChunkedEvent::DATA);
+		ensure_equals(string(event.data.start, event.data.size()), "abc");
+		ensure_equals(event.consumed, (unsigned int) strlen("abc\r\n0\r\n"));
+
+		buffer = mbuf(buffer, event.consumed);
+		event = parser.feed(buffer);
+		ensure_equals(event.type, HttpChunkedEvent::END);
+		ensure_equals(event.consumed, 2u);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It supports chunk extensions, uppercase digits and leading zeros");
+		Outcome outcome = parse("00000005;foo=bar\r\nhello\r\n0a\r\n0123456789\r\n"
+			"000000000B\r\nhello world\r\n0;last\r\n\r\n");
+		ensure_equals(outcome.type, HttpChunkedEvent::END);
+		ensure_equals(outcome.data, "hello0123456789hello world");
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It reports errors");
+		Outcome outcome = parse("5\r\nhelloX\r\n0\r\n\r\n");
+		ensure_equals(outcome.type, HttpChunkedEvent::ERROR);
+		ensure_equals(outcome.errcode, CHUNK_FOOTER_PARSE_ERROR);
+		ensure_equals<size_t>(outcome.consumed, strlen("5\r\nhello"));
+
+		outcome = parse("5x\r\nhello\r\n0\r\n\r\n");
+		ensure_equals(outcome.type, HttpChunkedEvent::ERROR);
+		ensure_equals(outcome.errcode, CHUNK_SIZE_PARSE_ERROR);
+
+		outcome = parse("5\r\nhello\r\n0\r\nX");
+		ensure_equals(outcome.type, HttpChunkedEvent::ERROR);
+		ensure_equals(outcome.errcode, CHUNK_FINALIZER_PARSE_ERROR);
+
+		outcome = parse("fffffffff\r\n");
+		ensure_equals(outcome.type, HttpChunkedEvent::ERROR);
+		ensure_equals(outcome.errcode, CHUNK_SIZE_TOO_LARGE);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("The fast path behaves like the state machine on valid input (fuzzed)");
+		for (unsigned int i = 0; i < 3000; i++) {
+			string data;
+			string input = randomChunkedBody(data);
+			vector<size_t> splits = randomSplits(input);
+
+			Outcome outcome = parse(input, splits, true);
+			ensure_equals(outcome.type, HttpChunkedEvent::END);
+			ensure_equals(outcome.data, data);
+			ensureSameOutcome(input, splits, true);
+			ensureSameOutcome(input, splits, false);
+			ensureSameOutcome(input, vector<size_t>(), true);
+		}
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("The fast path behaves like the state machine on invalid input (fuzzed)");
+		for (unsigned int i = 0; i < 10000; i++) {
+			string data;
+			string input = randomChunkedBody(data);
+			unsigned int nmutations = 1 + random(3);
+			for (unsigned int j = 0; j < nmutations; j++) {
+				mutate(input);
+			}
+			vector<size_t> splits = randomSplits(input);
+
+			ensureSameOutcome(input, splits, true);
+			ensureSameOutcome(input, splits, false);
+			ensureSameOutcome(input, vector<size_t>(), true);
+		}
+	}
+}
@@ -0,0 +1,294 @@
+#include <TestSupport.h>
+#include <ServerKit/HttpCompression.h>
+#include <Utils/IOUtils.h>
+#include <zlib.h>
+#include <algorithm>
+#include <string>
+
+using namespace Passenger;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace tut {
+	struct ServerKit_HttpCompressionTest {
+		GzipCompressor compressor;
+
+		static string readCorpusFile(const string &name) {
+			return readAll("stub/compression/" + name);
+		}
+
+		/**
+		 * Decompresses as much of the given gzip data as possible. Sets
+		 * `complete` to whether the end of the gzip stream was reached.
+		 */
+		static string gunzip(const string &data, bool &complete) {
+			z_stream stream;
+			char buf[1024 * 16];
+			string result;
+			int ret;
+
+			memset(&stream, 0, sizeof(stream));
+			ensure_equals("inflateInit2", inflateInit2(&stream, 16 + MAX_WBITS), Z_OK);
+			stream.next_in = (Bytef *) data.data();
+			stream.avail_in = data.size();
+			do {
+				stream.next_out = (Bytef *) buf;
+				stream.avail_out = sizeof(buf);
+				ret = inflate(&stream, Z_SYNC_FLUSH);
+				result.append(buf, sizeof(buf) - stream.avail_out);
+			} while (ret == Z_OK && (stream.avail_in > 0 || stream.avail_out == 0));
+			inflateEnd(&stream);
+
+			ensure("Valid gzip data", ret == Z_OK || ret == Z_STREAM_END || ret == Z_BUF_ERROR);
+			complete = ret == Z_STREAM_END && stream.avail_in == 0;
+			return result;
+		}
+
+		static string gunzip(const string &data) {
+			bool complete;
+			string result = gunzip(data, complete);
+			ensure("The gzip stream is complete", complete);
+			return result;
+		}
+
+		/**
+		 * Compresses `data` by feeding it in pieces of `feedSize` bytes and
+		 * collecting the output in pieces of at most `outputSize` bytes, the way
+		 * the Core controller does.
+		 */
+		string compressStreaming(int level, const string &data, size_t feedSize,
+			size_t outputSize)
+		{
+			char output[1024 * 16];
+			string result;
+			bool done;
+
+			ensure(outputSize <= sizeof(output));
+			ensure("start", compressor.start(level));
+			for (size_t pos = 0; pos < data.size(); pos += feedSize) {
+				compressor.feed(data.data() + pos, std::min(feedSize, data.size() - pos));
+				do {
+					result.append(output, compressor.compress(output, outputSize,
+						GzipCompressor::NO_FLUSH, done));
+				} while (!done);
+			}
+			compressor.feed(NULL, 0);
+			do {
+				result.append(output, compressor.compress(output, outputSize,
+					GzipCompressor::FINISH, done));
+			} while (!done);
+			ensure("The stream is finished", compressor.isFinished());
+			return result;
+		}
+	};
+
+	DEFINE_TEST_GROUP(ServerKit_HttpCompressionTest);
+
+
+	/***** Negotiation *****/
+
+	TEST_METHOD(1) {
+		set_test_name("acceptEncodingAllowsGzip() accepts gzip in any list position and case");
+		ensure(acceptEncodingAllowsGzip("gzip"));
+		ensure(acceptEncodingAllowsGzip("gzip, deflate, sdch"));
+		ensure(acceptEncodingAllowsGzip("deflate,gzip"));
+		ensure(acceptEncodingAllowsGzip("  br ,  GZip  "));
+		ensure(acceptEncodingAllowsGzip("x-gzip"));
+		ensure(acceptEncodingAllowsGzip("gzip;q=0.5, identity;q=1"));
+		ensure(acceptEncodingAllowsGzip("gzip ; q=1.0"));
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("acceptEncodingAllowsGzip() rejects absent gzip and q=0");
+		ensure(!acceptEncodingAllowsGzip(""));
+		ensure(!acceptEncodingAllowsGzip("identity"));
+		ensure(!acceptEncodingAllowsGzip("deflate, br"));
+		ensure(!acceptEncodingAllowsGzip("gzipped"));
+		ensure(!acceptEncodingAllowsGzip("gzip;q=0"));
+		ensure(!acceptEncodingAllowsGzip("gzip;q=0.000"));
+		ensure(!acceptEncodingAllowsGzip("gzip; Q=0, deflate"));
+		ensure(acceptEncodingAllowsGzip("gzip;q=0.001"));
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("acceptEncodingAllowsGzip() lets an explicit gzip element win over *");
+		ensure(acceptEncodingAllowsGzip("*"));
+		ensure(acceptEncodingAllowsGzip("identity, *;q=0.1"));
+		ensure(!acceptEncodingAllowsGzip("*;q=0"));
+		ensure(!acceptEncodingAllowsGzip("gzip;q=0, *"));
+		ensure(acceptEncodingAllowsGzip("*;q=0, gzip"));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("contentTypeIsCompressible() accepts textual media types");
+		ensure(contentTypeIsCompressible("text/html"));
+		ensure(contentTypeIsCompressible("text/html; charset=utf-8"));
+		ensure(contentTypeIsCompressible("Text/CSS"));
+		ensure(contentTypeIsCompressible(" text/plain ;charset=us-ascii"));
+		ensure(contentTypeIsCompressible("application/json"));
+		ensure(contentTypeIsCompressible("application/javascript"));
+		ensure(contentTypeIsCompressible("application/xml"));
+		ensure(contentTypeIsCompressible("application/vnd.api+json"));
+		ensure(contentTypeIsCompressible("application/atom+xml; charset=utf-8"));
+		ensure(contentTypeIsCompressible("image/svg+xml"));
+		ensure(contentTypeIsCompressible("image/x-icon"));
+		ensure(contentTypeIsCompressible("font/ttf"));
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("contentTypeIsCompressible() rejects compressed and streaming media types");
+		ensure(!contentTypeIsCompressible(""));
+		ensure(!contentTypeIsCompressible("text/"));
+		ensure(!contentTypeIsCompressible("text/event-stream"));
+		ensure(!contentTypeIsCompressible("text/event-stream; charset=utf-8"));
+		ensure(!contentTypeIsCompressible("image/png"));
+		ensure(!contentTypeIsCompressible("image/jpeg"));
+		ensure(!contentTypeIsCompressible("video/mp4"));
+		ensure(!contentTypeIsCompressible("application/zip"));
+		ensure(!contentTypeIsCompressible("application/gzip"));
+		ensure(!contentTypeIsCompressible("application/octet-stream"));
+		ensure(!contentTypeIsCompressible("font/woff2"));
+		ensure(!contentTypeIsCompressible("+json"));
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("cacheControlForbidsTransform() looks for the no-transform directive");
+		ensure(cacheControlForbidsTransform("no-transform"));
+		ensure(cacheControlForbidsTransform("public, max-age=60, No-Transform"));
+		ensure(cacheControlForbidsTransform("private=\"a, no-transform\", no-transform"));
+		ensure(!cacheControlForbidsTransform(""));
+		ensure(!cacheControlForbidsTransform("public, max-age=60"));
+		ensure(!cacheControlForbidsTransform("no-transformation"));
+		ensure(!cacheControlForbidsTransform("private=\"no-transform\""));
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("varyCoversAcceptEncoding() looks for Accept-Encoding or *");
+		ensure(varyCoversAcceptEncoding("Accept-Encoding"));
+		ensure(varyCoversAcceptEncoding("Cookie, accept-encoding"));
+		ensure(varyCoversAcceptEncoding(" Origin ,ACCEPT-ENCODING , Cookie"));
+		ensure(varyCoversAcceptEncoding("*"));
+		ensure(!varyCoversAcceptEncoding(""));
+		ensure(!varyCoversAcceptEncoding("Cookie"));
+		ensure(!varyCoversAcceptEncoding("Accept-Encodings, Accept"));
+	}
+
+
+	/***** GzipCompressor *****/
+
+	TEST_METHOD(10) {
+		set_test_name("compressAll() compresses the textual corpus files by more than half");
+		const char *names[] = { "changelog.html", "bootstrap.min.css", "logger.js",
+			"npm-shrinkwrap.json", "smart_spawning.svg" };
+		for (unsigned int i = 0; i < sizeof(names) / sizeof(names[0]); i++) {
+			string data = readCorpusFile(names[i]);
+			string output(data.size(), '\0');
+			size_t size = compressor.compressAll(9, data.data(), data.size(),
+				&output[0], output.size());
+			ensure(names[i], size > 0);
+			ensure(names[i], size < data.size() / 2);
+			ensure(names[i], gunzip(output.substr(0, size)) == data);
+		}
+	}
+
+	TEST_METHOD(11) {
+		set_test_name("compressAll() returns 0 if the output does not fit");
+		string data = readCorpusFile("random.bin");
+		string output(data.size() - 1, '\0');
+		ensure_equals(compressor.compressAll(9, data.data(), data.size(),
+			&output[0], output.size()), 0u);
+
+		// The compressor is still usable afterwards.
+		data = readCorpusFile("logger.js");
+		output.assign(data.size(), '\0');
+		size_t size = compressor.compressAll(9, data.data(), data.size(),
+			&output[0], output.size());
+		ensure(size > 0);
+		ensure(gunzip(output.substr(0, size)) == data);
+	}
+
+	TEST_METHOD(12) {
+		set_test_name("Streaming compression with small input and output pieces round-trips");
+		string data = readCorpusFile("changelog.html");
+		ensure(gunzip(compressStreaming(1, data, 480, 100)) == data);
+		ensure_equals(compressor.getTotalIn(), data.size());
+		ensure(gunzip(compressStreaming(6, data, 7, 16 * 1024)) == data);
+		data = readCorpusFile("random.bin");
+		ensure(gunzip(compressStreaming(1, data, 4096, 1000)) == data);
+	}
+
+	TEST_METHOD(13) {
+		set_test_name("SYNC_FLUSH makes all input so far decompressible");
+		string part1 = "{\"event\":\"tick\",\"sequence\":1}\n";
+		string part2 = "{\"event\":\"tick\",\"sequence\":2}\n";
+		char output[1024];
+		string result;
+		bool done, complete;
+
+		ensure(compressor.start(1));
+		compressor.feed(part1.data(), part1.size());
+		result.append(output, compressor.compress(output, sizeof(output),
+			GzipCompressor::NO_FLUSH, done));
+		ensure(done);
+		ensure(compressor.hasUnflushedInput());
+
+		result.append(output, compressor.compress(output, sizeof(output),
+			GzipCompressor::SYNC_FLUSH, done));
+		ensure(done);
+		ensure(!compressor.hasUnflushedInput());
+		ensure_equals(gunzip(result, complete), part1);
+		ensure(!complete);
+
+		// A second flush without new input produces nothing.
+		ensure_equals(compressor.compress(output, sizeof(output),
+			GzipCompressor::SYNC_FLUSH, done), 0u);
+		ensure(done);
+
+		compressor.feed(part2.data(), part2.size());
+		result.append(output, compressor.compress(output, sizeof(output),
+			GzipCompressor::FINISH, done));
+		ensure(done);
+		ensure_equals(gunzip(result), part1 + part2);
+	}
+
+	TEST_METHOD(14) {
+		set_test_name("start() reuses the compressor with other levels and size hints");
+		string data = readCorpusFile("npm-shrinkwrap.json");
+		string output(data.size(), '\0');
+		size_t size;
+
+		size = compressor.compressAll(1, data.data(), data.size(), &output[0], output.size());
+		ensure(size > 0);
+		ensure("level 1", gunzip(output.substr(0, size)) == data);
+
+		size = compressor.compressAll(9, data.data(), data.size(), &output[0], output.size());
+		ensure(size > 0);
+		ensure("level 9", gunzip(output.substr(0, size)) == data);
+
+		// A size hint that is too small shrinks the window, which must
+		// only cost compression ratio.
+		ensure(compressor.start(6, 300));
+		compressor.feed(data.data(), data.size());
+		bool done;
+		size = compressor.compress(&output[0], output.size(), GzipCompressor::FINISH, done);
+		ensure(done);
+		ensure("small window", gunzip(output.substr(0, size)) == data);
+	}
+
+	TEST_METHOD(15) {
+		set_test_name("compress() after FINISH produces nothing");
+		char output[64];
+		bool done = false;
+
+		ensure(compressor.start(1));
+		compressor.feed("hello", 5);
+		string result(output, compressor.compress(output, sizeof(output),
+			GzipCompressor::FINISH, done));
+		ensure(done);
+		ensure(compressor.isFinished());
+		ensure_equals(compressor.compress(output, sizeof(output),
+			GzipCompressor::FINISH, done), 0u);
+		ensure(done);
+		ensure_equals(gunzip(result), "hello");
+	}
+}
@@ -143,6 +143,25 @@ namespace tut {
 			// Continues in onRequestEarlyHalfClose()
 		}
 
+		void testDelayedResponse(MyClient *client, MyRequest *req) {
+			refRequest(req, __FILE__, __LINE__);
+			requestsWaitingForResponse.push_back(req);
+			// Continues in respondToWaitingRequests()
+		}
+
+		void respondToWaitingRequest(MyClient *client, MyRequest *req) {
+			if (psg_lstr_cmp(&req->path, "/delayed_response_and_close")) {
+				HeaderTable headers;
+				headers.insert(req->pool, "connection", "close");
+				writeSimpleResponse(client, 200, &headers, "closing");
+				if (!req->ended()) {
+					endRequest(&client, &req);
+				}
+			} else {
+				testRequest(client, req);
+			}
+		}
+
 		void testEarlyReadErrorDetection(MyClient *client, MyRequest *req) {
 			req->nextRequestEarlyReadError = ENOSPC;
 			writeSimpleResponse(client, 200, NULL, "OK");
@@ -174,6 +193,10 @@ namespace tut {
 				testHalfClose(client, req);
 			} else if (psg_lstr_cmp(&req->path, "/early_read_error_detection_test")) {
 				testEarlyReadErrorDetection(client, req);
+			} else if (psg_lstr_cmp(&req->path, "/delayed_response")
+				|| psg_lstr_cmp(&req->path, "/delayed_response_and_close"))
+			{
+				testDelayedResponse(client, req);
 			} else {
 				testRequest(client, req);
 			}
@@ -233,6 +256,14 @@ namespace tut {
 					break;
 				}
 			}
+			for (i = 0; i < requestsWaitingForResponse.size(); i++) {
+				if (requestsWaitingForResponse[i] == req) {
+					requestsWaitingForResponse.erase(
+						requestsWaitingForResponse.begin() + i);
+					unrefRequest(req, __FILE__, __LINE__);
+					break;
+				}
+			}
 			ParentClass::deinitializeRequest(client, req);
 		}
 
@@ -244,6 +275,7 @@ namespace tut {
 		bool allowUpgrades;
 
 		vector<MyRequest *> requestsWaitingToStartAcceptingBody;
+		vector<MyRequest *> requestsWaitingForResponse;
 		unsigned int bodyBytesRead;
 		unsigned int halfCloseDetected;
 		unsigned int clientDataErrors;
@@ -268,6 +300,18 @@ namespace tut {
 				unrefRequest(req, __FILE__, __LINE__);
 			}
 		}
+
+		void respondToWaitingRequests() {
+			MyRequest *req;
+			vector<MyRequest *> requestsWaitingForResponse;
+
+			requestsWaitingForResponse.swap(this->requestsWaitingForResponse);
+
+			foreach (req, requestsWaitingForResponse) {
+				respondToWaitingRequest(static_cast<MyClient *>(req->client), req);
+				unrefRequest(req, __FILE__, __LINE__);
+			}
+		}
 	};
 
 	struct ServerKit_HttpServerTest {
@@ -442,6 +486,43 @@ namespace tut {
 			server->startAcceptingBody();
 		}
 
+		void respondToWaitingRequests() {
+			bg.safe->runLater(boost::bind(
+				&ServerKit_HttpServerTest::_respondToWaitingRequests, this));
+		}
+
+		void _respondToWaitingRequests() {
+			server->respondToWaitingRequests();
+		}
+
+		unsigned int getNumRequestsWaitingForResponse() {
+			unsigned int result;
+			bg.safe->runSync(boost::bind(
+				&ServerKit_HttpServerTest::_getNumRequestsWaitingForResponse,
+				this, &result));
+			return result;
+		}
+
+		void _getNumRequestsWaitingForResponse(unsigned int *result) {
+			*result = server->requestsWaitingForResponse.size();
+		}
+
+		unsigned int getPipelinedRequestCount() {
+			unsigned int result;
+			bg.safe->runSync(boost::bind(
+				&ServerKit_HttpServerTest::_getPipelinedRequestCount,
+				this, &result));
+			return result;
+		}
+
+		void _getPipelinedRequestCount(unsigned int *result) {
+			MyClient *client;
+			*result = 0;
+			TAILQ_FOREACH (client, &server->activeClients, nextClient.activeOrDisconnectedClient) {
+				*result += client->pipelinedRequestCount;
+			}
+		}
+
 		void shutdownServer() {
 			bg.safe->runLater(boost::bind(&ServerKit_HttpServerTest::_shutdownServer,
 				this));
@@ -480,7 +561,7 @@ namespace tut {
 		}
 	};
 
-	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_HttpServerTest, 100);
+	DEFINE_TEST_GROUP_WITH_LIMIT(ServerKit_HttpServerTest, 120);
 
 
 	/***** Valid HTTP header parsing *****/
@@ -1727,4 +1808,449 @@ namespace tut {
 			result = getActiveClientCount() == 0;
 		);
 	}
+
+
+	/***** Timeouts *****/
+
+	TEST_METHOD(100) {
+		set_test_name("It disconnects clients that don't send a request header "
+			"within the header read timeout");
+
+		Json::Value config;
+		config["header_read_timeout"] = 0.1;
+		server->configure(config);
+		context.timerWheel.setResolution(0.01);
+		setLogLevel(LVL_ERROR);
+		connectToServer();
+		sendRequest("GET / HTTP/1.1\r\n");
+		ensure_equals(readAll(fd), "");
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 0;
+		);
+	}
+
+	TEST_METHOD(101) {
+		set_test_name("It disconnects idle keep-alive connections "
+			"after the keep-alive timeout");
+
+		Json::Value config;
+		config["keepalive_timeout"] = 0.1;
+		server->configure(config);
+		context.timerWheel.setResolution(0.01);
+		connectToServer();
+		sendRequest(
+			"GET / HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n");
+		string response = readAll(fd);
+		ensure(containsSubstring(response, "Connection: keep-alive"));
+		ensure(containsSubstring(response, "hello /"));
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 0;
+		);
+	}
+
+	TEST_METHOD(102) {
+		set_test_name("Clients that keep sending requests are not disconnected "
+			"by the keep-alive timeout");
+
+		Json::Value config;
+		config["keepalive_timeout"] = 0.3;
+		server->configure(config);
+		context.timerWheel.setResolution(0.01);
+		connectToServer();
+		for (unsigned int i = 0; i < 5; i++) {
+			sendRequest(
+				"GET / HTTP/1.1\r\n"
+				"Connection: keep-alive\r\n"
+				"Host: foo\r\n\r\n");
+			ensure(containsSubstring(readResponseHeader(), "Connection: keep-alive"));
+			char body[7];
+			ensure_equals(io.read(body, sizeof(body)), 7u);
+			ensure_equals(StaticString(body, sizeof(body)), StaticString("hello /"));
+			syscalls::usleep(100000);
+		}
+		ensure_equals(getActiveClientCount(), 1u);
+	}
+
+	TEST_METHOD(103) {
+		set_test_name("The header read and keep-alive timeouts are disabled by default");
+
+		context.timerWheel.setResolution(0.01);
+		connectToServer();
+		sendRequest("GET / HTTP/1.1\r\n");
+		SHOULD_NEVER_HAPPEN(200,
+			result = getActiveClientCount() == 0;
+		);
+	}
+
+
+	/***** Pipelining *****/
+
+	TEST_METHOD(110) {
+		set_test_name("Requests that are pipelined after a request in progress are "
+			"parsed ahead, and begun in order after that request has ended");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /foo HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /bar HTTP/1.1\r\n"
+			"Connection: close\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 2;
+		);
+		ensure_equals(getTotalRequestsBegun(), 1u);
+		ensure(!hasResponseData());
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure_equals(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /foo"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /bar");
+		ensure_equals(getTotalRequestsBegun(), 3u);
+	}
+
+	TEST_METHOD(111) {
+		set_test_name("Pipelined requests that are also in progress are answered in order");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /foo HTTP/1.1\r\n"
+			"Connection: close\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 2;
+		);
+
+		respondToWaitingRequests();
+		EVENTUALLY(5,
+			result = getNumRequestsWaitingForResponse() == 1;
+		);
+		ensure_equals(getPipelinedRequestCount(), 1u);
+		ensure_equals(getTotalRequestsBegun(), 2u);
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure_equals(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /foo");
+	}
+
+	TEST_METHOD(112) {
+		set_test_name("Parsing ahead stops after a pipelined request with a body, "
+			"whose body is read once it has begun");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"POST /body_test HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n"
+			"Content-Length: 2\r\n\r\n"
+			"ok"
+			"GET /foo HTTP/1.1\r\n"
+			"Connection: close\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getPipelinedRequestCount() > 1 || getBodyBytesRead() > 0;
+		);
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure(startsWith(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"));
+		ensure(containsSubstring(response,
+			"Connection: keep-alive\r\n"
+			"Content-Length: 11\r\n\r\n"
+			"2 bytes: ok"
+			"HTTP/1.1 200 OK\r\n"));
+		string lastResponse =
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /foo";
+		ensure_equals(response.substr(response.size() - lastResponse.size()), lastResponse);
+		ensure_equals(getBodyBytesRead(), 2u);
+	}
+
+	TEST_METHOD(113) {
+		set_test_name("The number of requests that are parsed ahead is limited "
+			"by max_pipelined_requests");
+
+		Json::Value config;
+		config["max_pipelined_requests"] = 2;
+		server->configure(config);
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /a HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /b HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /c HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /d HTTP/1.1\r\n"
+			"Connection: close\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 2;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getPipelinedRequestCount() > 2;
+		);
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure_equals(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 8\r\n\r\n"
+			"hello /a"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 8\r\n\r\n"
+			"hello /b"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 8\r\n\r\n"
+			"hello /c"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 8\r\n\r\n"
+			"hello /d");
+	}
+
+	TEST_METHOD(114) {
+		set_test_name("If max_pipelined_requests is 0, then pipelined requests "
+			"are not parsed ahead");
+
+		Json::Value config;
+		config["max_pipelined_requests"] = 0;
+		server->configure(config);
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /foo HTTP/1.1\r\n"
+			"Connection: close\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getNumRequestsWaitingForResponse() == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getPipelinedRequestCount() > 0;
+		);
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure_equals(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /foo");
+	}
+
+	TEST_METHOD(115) {
+		set_test_name("A pipelined request header that is only partially received "
+			"is completed after the requests before it have ended");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /foo HTTP/1.1\r\n"
+			"Connec");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 1;
+		);
+
+		respondToWaitingRequests();
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 0;
+		);
+		sendRequest(
+			"tion: close\r\n"
+			"Host: foo\r\n\r\n");
+		string response = readAll(fd);
+		ensure_equals(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: close\r\n"
+			"Content-Length: 10\r\n\r\n"
+			"hello /foo");
+	}
+
+	TEST_METHOD(116) {
+		set_test_name("A half-close after pipelined requests is detected as the "
+			"last pipelined request's next request early read error");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /half_close_test HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 1;
+		);
+		shutdown(fd, SHUT_WR);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getHalfCloseDetected() > 0;
+		);
+
+		respondToWaitingRequests();
+		EVENTUALLY(5,
+			result = getHalfCloseDetected() == 1;
+		);
+		string response = readAll(fd);
+		ensure(startsWith(response,
+			"HTTP/1.1 200 OK\r\n"
+			"Status: 200 OK\r\n"
+			"Content-Type: text/plain\r\n"
+			"Date: Thu, 11 Sep 2014 12:54:09 GMT\r\n"
+			"Connection: keep-alive\r\n"
+			"Content-Length: 23\r\n\r\n"
+			"hello /delayed_response"));
+	}
+
+	TEST_METHOD(117) {
+		set_test_name("Pipelined requests are discarded if the connection is not "
+			"kept alive after the request before them");
+
+		connectToServer();
+		sendRequest(
+			"GET /delayed_response_and_close HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /foo HTTP/1.1\r\n"
+			"Connection: keep-alive\r\n"
+			"Host: foo\r\n\r\n"
+			"GET /bar HTTP/1.1\r\n"
+			"Connec");
+		EVENTUALLY(5,
+			result = getPipelinedRequestCount() == 2;
+		);
+
+		respondToWaitingRequests();
+		string response = readAll(fd);
+		ensure(containsSubstring(response, "Connection: close\r\n"));
+		ensure(containsSubstring(response, "\r\n\r\nclosing"));
+		EVENTUALLY(5,
+			result = getActiveClientCount() == 0;
+		);
+		ensure_equals(getTotalRequestsBegun(), 1u);
+	}
 }
@@ -0,0 +1,222 @@
+#include <TestSupport.h>
+#include <BackgroundEventLoop.h>
+#include <ServerKit/TimerWheel.h>
+#include <SafeLibev.h>
+#include <Utils/SystemTime.h>
+#include <boost/bind.hpp>
+
+using namespace Passenger;
+using namespace Passenger::ServerKit;
+using namespace std;
+
+namespace tut {
+	struct ServerKit_TimerWheelTest {
+		BackgroundEventLoop bg;
+		TimerWheel wheel;
+		TimerWheel::Entry entries[3];
+		boost::mutex syncher;
+		unsigned int fired[3];
+		unsigned long long firedAt[3];
+		unsigned long long armedAt;
+
+		ServerKit_TimerWheelTest()
+			: bg(false, false),
+			  wheel(bg.libev_loop, 0.01)
+		{
+			for (unsigned int i = 0; i < 3; i++) {
+				entries[i].callback = onTimeout;
+				entries[i].userData = this;
+				fired[i] = 0;
+				firedAt[i] = 0;
+			}
+			armedAt = 0;
+			bg.start();
+		}
+
+		~ServerKit_TimerWheelTest() {
+			bg.safe->runSync(boost::bind(&ServerKit_TimerWheelTest::cancelAll, this));
+			bg.stop();
+		}
+
+		static void onTimeout(TimerWheel::Entry *entry) {
+			ServerKit_TimerWheelTest *self = static_cast<ServerKit_TimerWheelTest *>(
+				entry->userData);
+			unsigned int i = entry - self->entries;
+			boost::lock_guard<boost::mutex> l(self->syncher);
+			self->fired[i]++;
+			self->firedAt[i] = SystemTime::getUsec();
+		}
+
+		void arm(unsigned int i, ev_tstamp timeout) {
+			bg.safe->runSync(boost::bind(&ServerKit_TimerWheelTest::realArm,
+				this, i, timeout));
+		}
+
+		void realArm(unsigned int i, ev_tstamp timeout) {
+			ev_now_update(bg.libev_loop);
+			armedAt = SystemTime::getUsec();
+			wheel.arm(&entries[i], timeout);
+		}
+
+		void cancel(unsigned int i) {
+			bg.safe->runSync(boost::bind(&TimerWheel::cancel, &wheel, &entries[i]));
+		}
+
+		void cancelAll() {
+			for (unsigned int i = 0; i < 3; i++) {
+				wheel.cancel(&entries[i]);
+			}
+		}
+
+		unsigned int armedCount() {
+			unsigned int result;
+			bg.safe->runSync(boost::bind(&ServerKit_TimerWheelTest::realArmedCount,
+				this, &result));
+			return result;
+		}
+
+		void realArmedCount(unsigned int *result) {
+			*result = wheel.getArmedCount();
+		}
+
+		void inspect(Json::Value *doc) {
+			*doc = wheel.inspectStateAsJson();
+		}
+
+		unsigned int getFired(unsigned int i) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			return fired[i];
+		}
+	};
+
+	DEFINE_TEST_GROUP(ServerKit_TimerWheelTest);
+
+	TEST_METHOD(1) {
+		set_test_name("Armed entries are triggered after their timeout, but not earlier");
+		arm(0, 0.05);
+		EVENTUALLY(2,
+			result = getFired(0) == 1;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure(firedAt[0] - armedAt >= 50000);
+		ensure_equals(armedCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Cancelled entries are not triggered");
+		arm(0, 0.03);
+		arm(1, 0.03);
+		cancel(0);
+		ensure_equals(armedCount(), 1u);
+		EVENTUALLY(2,
+			result = getFired(1) == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getFired(0) > 0;
+		);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("Rearming an armed entry reschedules it");
+		arm(0, 0.03);
+		arm(0, 0.2);
+		ensure_equals(armedCount(), 1u);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getFired(0) > 0;
+		);
+		EVENTUALLY(2,
+			result = getFired(0) == 1;
+		);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("Timeouts longer than a full revolution of the wheel");
+		// 256 slots at 0.01 sec per slot = 2.56 sec per revolution.
+		arm(1, 0.05);
+		arm(0, 2.7);
+		EVENTUALLY(2,
+			result = getFired(1) == 1;
+		);
+		SHOULD_NEVER_HAPPEN(2000,
+			result = getFired(0) > 0;
+		);
+		EVENTUALLY(3,
+			result = getFired(0) == 1;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure(firedAt[0] - armedAt >= 2700000);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Entries may be rearmed from within their callback");
+		struct Rearmer {
+			static void callback(TimerWheel::Entry *entry) {
+				ServerKit_TimerWheelTest *self = static_cast<ServerKit_TimerWheelTest *>(
+					entry->userData);
+				onTimeout(entry);
+				if (self->getFired(0) < 3) {
+					self->wheel.arm(entry, 0.01);
+				}
+			}
+		};
+		entries[0].callback = Rearmer::callback;
+		arm(0, 0.01);
+		EVENTUALLY(2,
+			result = getFired(0) == 3;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getFired(0) > 3;
+		);
+		ensure_equals(armedCount(), 0u);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("inspectStateAsJson()");
+		arm(0, 10);
+		arm(1, 0.01);
+		EVENTUALLY(2,
+			result = getFired(1) == 1;
+		);
+		Json::Value doc;
+		bg.safe->runSync(boost::bind(&ServerKit_TimerWheelTest::inspect, this, &doc));
+		ensure_equals(doc["armed"].asUInt(), 1u);
+		ensure_equals(doc["triggered"].asUInt(), 1u);
+		ensure_equals(doc["resolution"].asDouble(), 0.01);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("Callbacks may cancel or rearm other entries that expired in the same tick");
+		struct SiblingModifier {
+			static void callback(TimerWheel::Entry *entry) {
+				ServerKit_TimerWheelTest *self = static_cast<ServerKit_TimerWheelTest *>(
+					entry->userData);
+				onTimeout(entry);
+				self->wheel.cancel(&self->entries[1]);
+				// One full revolution, so that entry 2 goes back into the
+				// slot that is being processed right now.
+				self->wheel.arm(&self->entries[2], 2.56);
+			}
+
+			static void armAll(ServerKit_TimerWheelTest *self) {
+				// Arm all entries at the same time so that they end up in
+				// the same slot. Entry 0 is first in line.
+				for (unsigned int i = 0; i < 3; i++) {
+					self->wheel.arm(&self->entries[i], 0.02);
+				}
+			}
+		};
+		entries[0].callback = SiblingModifier::callback;
+		bg.safe->runSync(boost::bind(SiblingModifier::armAll, this));
+		EVENTUALLY(2,
+			result = getFired(0) == 1;
+		);
+		ensure_equals("Entry 2 was rearmed", armedCount(), 1u);
+		EVENTUALLY(4,
+			result = getFired(2) == 1;
+		);
+		SHOULD_NEVER_HAPPEN(100,
+			result = getFired(1) > 0 || getFired(0) > 1 || getFired(2) > 1;
+		);
+		ensure_equals(armedCount(), 0u);
+	}
+}
@@ -0,0 +1,237 @@
+#include <TestSupport.h>
+#include <StatsSegment.h>
+#include <Utils/IOUtils.h>
+#include <boost/atomic.hpp>
+#include <boost/bind.hpp>
+#include <boost/scoped_ptr.hpp>
+#include <boost/thread.hpp>
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstring>
+#include <string>
+
+using namespace Passenger;
+using namespace std;
+
+namespace tut {
+	struct StatsSegmentTest {
+		TempDir tmpDir;
+		string path;
+		boost::scoped_ptr<StatsSegmentData> data;
+
+		StatsSegmentTest()
+			: tmpDir("tmp.stats_segment"),
+			  path("tmp.stats_segment/core_stats"),
+			  data(new StatsSegmentData())
+		{
+			memset(data.get(), 0, sizeof(StatsSegmentData));
+		}
+
+		/** Sets every counter to `value`. */
+		static void fillWith(StatsSegmentData &data, boost::uint32_t value) {
+			data.poolMax = value;
+			data.poolProcessCount = value;
+			data.poolCapacityUsed = value;
+			data.poolGetWaitlistSize = value;
+			data.totalRequestsBegun = value;
+			data.activeClients = value;
+			data.groupCount = STATS_SEGMENT_MAX_GROUPS;
+			data.processCount = STATS_SEGMENT_MAX_PROCESSES;
+			for (unsigned int i = 0; i < STATS_SEGMENT_MAX_GROUPS; i++) {
+				data.groups[i].getWaitlistSize = value;
+				data.groups[i].requestsHandled = value;
+			}
+			for (unsigned int i = 0; i < STATS_SEGMENT_MAX_PROCESSES; i++) {
+				data.processes[i].sessions = value;
+				data.processes[i].processed = value;
+			}
+		}
+
+		/** Returns whether every counter has the same value. */
+		static bool isConsistent(const StatsSegmentData &data) {
+			boost::uint32_t value = data.poolMax;
+			if (data.poolProcessCount != value
+			 || data.poolCapacityUsed != value
+			 || data.poolGetWaitlistSize != value
+			 || data.totalRequestsBegun != value
+			 || data.activeClients != value)
+			{
+				return false;
+			}
+			for (unsigned int i = 0; i < STATS_SEGMENT_MAX_GROUPS; i++) {
+				if (data.groups[i].getWaitlistSize != value
+				 || data.groups[i].requestsHandled != value)
+				{
+					return false;
+				}
+			}
+			for (unsigned int i = 0; i < STATS_SEGMENT_MAX_PROCESSES; i++) {
+				if (data.processes[i].sessions != (boost::int32_t) value
+				 || data.processes[i].processed != value)
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		static void publishContinuously(StatsSegmentWriter *writer,
+			boost::atomic<bool> *stop)
+		{
+			boost::scoped_ptr<StatsSegmentData> data(new StatsSegmentData());
+			memset(data.get(), 0, sizeof(StatsSegmentData));
+			boost::uint32_t i = 1;
+			while (!stop->load(boost::memory_order_relaxed)) {
+				fillWith(*data, i);
+				writer->publish(*data);
+				i++;
+			}
+		}
+
+		void corruptHeader(size_t offset, const void *value, size_t size) {
+			int fd = open(path.c_str(), O_WRONLY);
+			ensure(fd != -1);
+			ensure_equals(pwrite(fd, value, size, offset), (ssize_t) size);
+			close(fd);
+		}
+	};
+
+	DEFINE_TEST_GROUP(StatsSegmentTest);
+
+	TEST_METHOD(1) {
+		set_test_name("A reader sees the data that the writer published");
+		StatsSegmentWriter writer(path);
+		StatsSegmentReader reader(path);
+
+		ensure("Nothing is published yet", reader.read(*data));
+		ensure_equals<boost::uint64_t>(data->updateCount, 0);
+		ensure_equals((pid_t) reader.getWriterPid(), getpid());
+
+		fillWith(*data, 42);
+		data->groupCount = 1;
+		data->processCount = 1;
+		setStatsSegmentGroupName(data->groups[0], "/apps/foo (production)");
+		writer.publish(*data);
+		memset(data.get(), 0, sizeof(StatsSegmentData));
+
+		ensure(reader.read(*data));
+		ensure_equals(data->poolMax, 42u);
+		ensure_equals<boost::uint64_t>(data->totalRequestsBegun, 42);
+		ensure_equals(data->groupCount, 1u);
+		ensure_equals(string(data->groups[0].name), "/apps/foo (production)");
+		ensure_equals(data->processes[0].processed, 42u);
+		ensure_equals<boost::uint64_t>(data->updateCount, 1);
+		ensure("updatedAt is set", data->updatedAt > 0);
+
+		writer.publish(*data);
+		ensure(reader.read(*data));
+		ensure_equals<boost::uint64_t>(data->updateCount, 2);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("Group names that are too long are truncated");
+		string name(STATS_SEGMENT_GROUP_NAME_SIZE * 2, 'x');
+		setStatsSegmentGroupName(data->groups[0], name);
+		ensure_equals(string(data->groups[0].name),
+			name.substr(0, STATS_SEGMENT_GROUP_NAME_SIZE - 1));
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("The file only exists while the writer does, and is not world-readable");
+		{
+			StatsSegmentWriter writer(path);
+			ensure_equals(getFileType(path), FT_REGULAR);
+			ensure_equals(getFileType(path + ".tmp"), FT_NONEXISTANT);
+
+			struct stat buf;
+			ensure_equals(stat(path.c_str(), &buf), 0);
+			ensure_equals(buf.st_mode & 0777, (mode_t) 0600);
+			ensure_equals(buf.st_size, (off_t) sizeof(StatsSegment));
+		}
+		ensure_equals(getFileType(path), FT_NONEXISTANT);
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("The reader rejects files that are not stats segments");
+		createFile(path, string(sizeof(StatsSegment), 'x'));
+		try {
+			StatsSegmentReader reader(path);
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &e) {
+			ensure(containsSubstring(e.what(), "is not a stats segment file"));
+		}
+
+		createFile(path, "");
+		try {
+			StatsSegmentReader reader(path);
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &e) {
+			ensure(containsSubstring(e.what(), "is not a stats segment file"));
+		}
+
+		unlink(path.c_str());
+		try {
+			StatsSegmentReader reader(path);
+			fail("FileSystemException expected");
+		} catch (const FileSystemException &) {
+			// Pass.
+		}
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("The reader rejects stats segments with a different layout version");
+		StatsSegmentWriter writer(path);
+		boost::uint32_t version = STATS_SEGMENT_VERSION + 1;
+		corruptHeader(offsetof(StatsSegmentHeader, version), &version, sizeof(version));
+		try {
+			StatsSegmentReader reader(path);
+			fail("RuntimeException expected");
+		} catch (const RuntimeException &e) {
+			ensure(containsSubstring(e.what(), "has layout version "
+				+ toString(STATS_SEGMENT_VERSION + 1)));
+		}
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("The reader gives up if the writer never finishes an update");
+		StatsSegmentWriter writer(path);
+		StatsSegmentReader reader(path);
+		fillWith(*data, 1);
+		writer.publish(*data);
+		writer.beginPublishingForever();
+		ensure("No consistent snapshot", !reader.read(*data, 1000));
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("Snapshots are consistent while the writer publishes concurrently");
+		StatsSegmentWriter writer(path);
+		StatsSegmentReader reader(path);
+		boost::atomic<bool> stop(false);
+		unsigned int reads = 0, changes = 0, inconsistencies = 0;
+		boost::uint32_t lastValue = 0;
+
+		boost::thread thr(boost::bind(publishContinuously, &writer, &stop));
+		unsigned long long deadline = SystemTime::getUsec() + 300000;
+		while (SystemTime::getUsec() < deadline || changes < 10) {
+			if (!reader.read(*data)) {
+				continue;
+			}
+			reads++;
+			if (!isConsistent(*data)) {
+				inconsistencies++;
+			}
+			if (data->poolMax != lastValue) {
+				ensure("Values never go back in time", data->poolMax > lastValue);
+				lastValue = data->poolMax;
+				changes++;
+			}
+		}
+		stop = true;
+		thr.join();
+
+		ensure_equals(("No inconsistent snapshots out of " + toString(reads)).c_str(),
+			inconsistencies, 0u);
+	}
+}
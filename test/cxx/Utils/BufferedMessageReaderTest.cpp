@@ -0,0 +1,170 @@
+#include <TestSupport.h>
+#include <Utils/IOUtils.h>
+#include <Utils/MessageIO.h>
+#include <Utils/BufferedMessageReader.h>
+#include <Utils/SystemTime.h>
+
+using namespace Passenger;
+using namespace std;
+using namespace boost;
+
+namespace tut {
+	struct BufferedMessageReaderTest {
+		Pipe pipes;
+		BufferedMessageReader reader;
+
+		BufferedMessageReaderTest()
+			: pipes(createPipe(__FILE__, __LINE__)),
+			  reader(pipes[0])
+			{ }
+
+		static string arrayMessage(const char *first, const char *second) {
+			string body = string(first) + '\0' + second + '\0';
+			boost::uint16_t size = htons(body.size());
+			return string((const char *) &size, sizeof(size)) + body;
+		}
+	};
+
+	DEFINE_TEST_GROUP(BufferedMessageReaderTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It reads array messages written by writeArrayMessage()");
+		vector<StaticString> args;
+
+		writeArrayMessage(pipes[1], "hello", "world", "!", NULL);
+		ensure("(1)", reader.readArrayMessage(args));
+		ensure_equals("(2)", args.size(), 3u);
+		ensure_equals("(3)", args[0], "hello");
+		ensure_equals("(4)", args[1], "world");
+		ensure_equals("(5)", args[2], "!");
+		ensure_equals("(6)", reader.getBufferedSize(), 0u);
+
+		writeArrayMessage(pipes[1], vector<string>());
+		ensure("(7)", reader.readArrayMessage(args));
+		ensure("(8)", args.empty());
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It parses multiple pipelined messages from a single read");
+		vector<string> args;
+		StaticString scalar;
+
+		writeExact(pipes[1], arrayMessage("a", "1") + arrayMessage("b", "2"));
+		writeScalarMessage(pipes[1], "scalar");
+
+		ensure("(1)", reader.readArrayMessage(args));
+		ensure_equals("(2)", args.size(), 2u);
+		ensure_equals("(3)", args[0], "a");
+		ensure_equals("(4)", args[1], "1");
+		ensure("(5)", reader.getBufferedSize() > 0);
+
+		// Nothing more is read from the pipe.
+		pipes[0].close(false);
+		ensure("(6)", reader.readArrayMessage(args));
+		ensure_equals("(7)", args[0], "b");
+		ensure_equals("(8)", args[1], "2");
+		ensure("(9)", reader.readScalarMessage(scalar));
+		ensure_equals("(10)", scalar, "scalar");
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It reads scalar messages and enforces the size limit");
+		StaticString output;
+
+		writeScalarMessage(pipes[1], "hello world");
+		writeScalarMessage(pipes[1], "");
+		writeScalarMessage(pipes[1], "too large");
+		ensure("(1)", reader.readScalarMessage(output, 11));
+		ensure_equals("(2)", output, "hello world");
+		ensure("(3)", reader.readScalarMessage(output));
+		ensure_equals("(4)", output, "");
+		try {
+			reader.readScalarMessage(output, 3);
+			fail("SecurityException expected");
+		} catch (const SecurityException &) {
+			// Pass.
+		}
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It returns false on end-of-file, including in the middle of a message");
+		vector<StaticString> args;
+		StaticString output;
+
+		writeExact(pipes[1], arrayMessage("a", "1").substr(0, 4));
+		pipes[1].close();
+		ensure("(1)", !reader.readArrayMessage(args));
+		ensure("(2)", !reader.readScalarMessage(output));
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("It grows the buffer for messages that are larger than it");
+		BufferedMessageReader smallReader(pipes[0], 16);
+		string data(10000, 'x');
+		StaticString output;
+		vector<StaticString> args;
+
+		writeScalarMessage(pipes[1], data);
+		writeArrayMessage(pipes[1], "after", NULL);
+		ensure("(1)", smallReader.readScalarMessage(output));
+		ensure_equals("(2)", output.size(), data.size());
+		ensure("(3)", output == data);
+		ensure("(4)", smallReader.getCapacity() >= data.size() + 4);
+		ensure("(5)", smallReader.readArrayMessage(args));
+		ensure_equals("(6)", args.size(), 1u);
+		ensure_equals("(7)", args[0], "after");
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("It throws TimeoutException if a full message does not arrive in time,"
+			" and deducts the time spent from the timeout");
+		vector<StaticString> args;
+		unsigned long long timeout = 30000;
+
+		writeExact(pipes[1], arrayMessage("a", "1").substr(0, 3));
+		unsigned long long startTime = SystemTime::getUsec();
+		try {
+			reader.readArrayMessage(args, &timeout);
+			fail("TimeoutException expected");
+		} catch (const TimeoutException &) {
+			unsigned long long elapsed = SystemTime::getUsec() - startTime;
+			ensure("(1)", elapsed >= 25000 && elapsed <= 1000000);
+			ensure("(2)", timeout <= 5000);
+		}
+
+		writeExact(pipes[1], arrayMessage("a", "1").substr(3));
+		timeout = 1000000;
+		ensure("(3)", reader.readArrayMessage(args, &timeout));
+		ensure_equals("(4)", args.size(), 2u);
+		ensure("(5)", timeout > 0);
+	}
+
+	TEST_METHOD(7) {
+		set_test_name("It reads batches of messages that arrive in a single write,"
+			" over a socket pair");
+		SocketPair sockets = createUnixSocketPair(__FILE__, __LINE__);
+		BufferedMessageReader socketReader(sockets.first);
+		const unsigned int BATCH = 16;
+		vector<StaticString> args;
+		string batch;
+		unsigned long long timeout;
+
+		for (unsigned int i = 0; i < BATCH; i++) {
+			batch.append(arrayMessage("status", toString(i).c_str()));
+		}
+
+		for (unsigned int i = 0; i < 3; i++) {
+			writeExact(sockets.second, batch);
+			for (unsigned int j = 0; j < BATCH; j++) {
+				timeout = 1000000;
+				ensure("(1)", socketReader.readArrayMessage(args, &timeout));
+				ensure_equals("(2)", args.size(), 2u);
+				ensure_equals("(3)", args[0], "status");
+				ensure_equals("(4)", args[1], toString(j));
+			}
+		}
+
+		sockets.second.close();
+		ensure("(5)", !socketReader.readArrayMessage(args));
+	}
+}
@@ -0,0 +1,317 @@
+#include <TestSupport.h>
+#include <Watchdog/ChildReaper.h>
+#include <Constants.h>
+#include <FileDescriptor.h>
+#include <Logging.h>
+#include <Exceptions.h>
+#include <Utils.h>
+#include <Utils/Timer.h>
+#include <Utils/ScopeGuard.h>
+#include <Utils/IOUtils.h>
+#include <Utils/MessageIO.h>
+#include <Utils/VariantMap.h>
+#include <oxt/thread.hpp>
+#include <oxt/system_calls.hpp>
+#include <boost/bind.hpp>
+#include <boost/make_shared.hpp>
+#include <boost/enable_shared_from_this.hpp>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <sys/wait.h>
+#include <signal.h>
+#include <unistd.h>
+#include <cstring>
+
+using namespace std;
+using namespace boost;
+using namespace oxt;
+using namespace Passenger;
+
+// The parts of the Watchdog's environment that AgentWatcher uses.
+namespace Passenger {
+namespace WatchdogAgent {
+	struct WorkingObjects {
+		EventFd errorEvent;
+		ChildReaper childReaper;
+
+		WorkingObjects()
+			: errorEvent(__FILE__, __LINE__, "WorkingObjects: errorEvent")
+			{ }
+	};
+
+	typedef boost::shared_ptr<WorkingObjects> WorkingObjectsPtr;
+}
+}
+
+using namespace Passenger::WatchdogAgent;
+
+static string oldOomScore;
+
+static void
+setOomScore(const StaticString &score) {
+	// Do nothing.
+}
+
+#include <Watchdog/AgentWatcher.cpp>
+
+namespace tut {
+	struct Watchdog_ChildReaperTest {
+		boost::mutex syncher;
+		vector< pair<pid_t, int> > exits;
+		TempDir tmpDir;
+
+		Watchdog_ChildReaperTest()
+			: tmpDir("tmp.reaper")
+			{ }
+
+		~Watchdog_ChildReaperTest() {
+			setLogLevel(DEFAULT_LOG_LEVEL);
+		}
+
+		pid_t forkChild(int exitCode = -1) {
+			pid_t pid = fork();
+			if (pid == 0) {
+				if (exitCode == -1) {
+					while (true) {
+						pause();
+					}
+				}
+				_exit(exitCode);
+			}
+			ensure("fork() succeeded", pid != -1);
+			return pid;
+		}
+
+		void onExit(pid_t pid, int status) {
+			boost::lock_guard<boost::mutex> l(syncher);
+			exits.push_back(make_pair(pid, status));
+		}
+
+		ChildReaper::ExitCallback callback() {
+			return boost::bind(&Watchdog_ChildReaperTest::onExit, this, _1, _2);
+		}
+
+		unsigned int exitCount() {
+			boost::lock_guard<boost::mutex> l(syncher);
+			return exits.size();
+		}
+
+		static void prepareAddress(struct sockaddr_un &addr, const char *path) {
+			memset(&addr, 0, sizeof(addr));
+			addr.sun_family = AF_UNIX;
+			strncpy(addr.sun_path, path, sizeof(addr.sun_path) - 1);
+		}
+
+		static void shutdownWatchers(vector<AgentWatcherPtr> *watchers) {
+			AgentWatcher::stopWatching(*watchers);
+			for (unsigned int i = 0; i < watchers->size(); i++) {
+				(*watchers)[i]->forceShutdown();
+			}
+		}
+
+		static bool canConnect(const struct sockaddr_un &addr) {
+			int fd = socket(AF_UNIX, SOCK_STREAM, 0);
+			bool result = ::connect(fd, (const struct sockaddr *) &addr, sizeof(addr)) == 0;
+			close(fd);
+			return result;
+		}
+	};
+
+	/**
+	 * An agent that starts listening on the given address once it has
+	 * received its startup arguments. It doesn't exec() anything: the forked
+	 * child only uses async-signal-safe calls.
+	 */
+	class FakeAgentWatcher: public AgentWatcher {
+	private:
+		struct sockaddr_un addr;
+
+	protected:
+		virtual string getExeFilename() const {
+			return "fake-agent";
+		}
+
+		virtual void execProgram() const {
+			static const char INITIALIZED_MESSAGE[] = "\x00\x0c" "initialized";
+			char x;
+			int fd;
+
+			if (read(FEEDBACK_FD, &x, 1) != 1) {
+				_exit(1);
+			}
+			unlink(addr.sun_path);
+			fd = socket(AF_UNIX, SOCK_STREAM, 0);
+			if (fd == -1
+			 || ::bind(fd, (const struct sockaddr *) &addr, sizeof(addr)) == -1
+			 || listen(fd, 16) == -1
+			 || write(FEEDBACK_FD, INITIALIZED_MESSAGE, sizeof(INITIALIZED_MESSAGE))
+				!= (ssize_t) sizeof(INITIALIZED_MESSAGE))
+			{
+				_exit(1);
+			}
+			while (true) {
+				pause();
+			}
+		}
+
+		virtual void sendStartupArguments(pid_t pid, FileDescriptor &fd) {
+			writeExact(fd, "x", 1);
+		}
+
+		virtual bool processStartupInfo(pid_t pid, FileDescriptor &fd,
+			const vector<string> &args)
+		{
+			return args[0] == "initialized";
+		}
+
+		virtual bool shouldPrefork() const {
+			return true;
+		}
+
+	public:
+		AtomicInt starts;
+
+		FakeAgentWatcher(const WorkingObjectsPtr &wo, const struct sockaddr_un &_addr)
+			: AgentWatcher(wo),
+			  addr(_addr)
+			{ }
+
+		virtual const char *name() const {
+			return "fake agent";
+		}
+
+		virtual void reportAgentsInformation(VariantMap &report) { }
+
+		/** Only called again if the standby process is unusable. */
+		virtual pid_t start() {
+			starts++;
+			return AgentWatcher::start();
+		}
+
+		pid_t getPid() const {
+			boost::lock_guard<boost::mutex> l(lock);
+			return pid;
+		}
+	};
+
+	DEFINE_TEST_GROUP(Watchdog_ChildReaperTest);
+
+	TEST_METHOD(1) {
+		set_test_name("It reports the exit status of a watched child");
+		ChildReaper reaper;
+		pid_t pid = forkChild(3);
+
+		reaper.watch(pid, callback());
+		EVENTUALLY(5,
+			result = exitCount() == 1;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure_equals("(1)", exits[0].first, pid);
+		ensure("(2)", WIFEXITED(exits[0].second));
+		ensure_equals("(3)", WEXITSTATUS(exits[0].second), 3);
+		ensure_equals("(4)", reaper.getWatchCount(), 0u);
+	}
+
+	TEST_METHOD(2) {
+		set_test_name("It reports children that are killed by a signal");
+		ChildReaper reaper;
+		pid_t pid1 = forkChild();
+		pid_t pid2 = forkChild();
+
+		reaper.watch(pid1, callback());
+		reaper.watch(pid2, callback());
+		SHOULD_NEVER_HAPPEN(100,
+			result = exitCount() > 0;
+		);
+		kill(pid2, SIGKILL);
+		EVENTUALLY(5,
+			result = exitCount() == 1;
+		);
+		{
+			boost::lock_guard<boost::mutex> l(syncher);
+			ensure_equals("(1)", exits[0].first, pid2);
+			ensure("(2)", WIFSIGNALED(exits[0].second));
+			ensure_equals("(3)", WTERMSIG(exits[0].second), SIGKILL);
+		}
+		ensure_equals("(4)", reaper.getWatchCount(), 1u);
+
+		kill(pid1, SIGKILL);
+		EVENTUALLY(5,
+			result = exitCount() == 2;
+		);
+	}
+
+	TEST_METHOD(3) {
+		set_test_name("It works without pidfds too");
+		ChildReaper reaper(false);
+		pid_t pid = forkChild();
+
+		reaper.watch(pid, callback());
+		ensure("(1)", !reaper.usingPidfds());
+		kill(pid, SIGTERM);
+		EVENTUALLY(5,
+			result = exitCount() == 1;
+		);
+		boost::lock_guard<boost::mutex> l(syncher);
+		ensure("(2)", WIFSIGNALED(exits[0].second));
+	}
+
+	TEST_METHOD(4) {
+		set_test_name("It doesn't reap children that it doesn't watch");
+		ChildReaper reaper;
+		pid_t unwatched = forkChild(0);
+		pid_t watched = forkChild(0);
+		int status;
+
+		reaper.watch(watched, callback());
+		EVENTUALLY(5,
+			result = exitCount() == 1;
+		);
+		ensure_equals("(1)", waitpid(unwatched, &status, 0), unwatched);
+	}
+
+	TEST_METHOD(5) {
+		set_test_name("Unwatched children are no longer reported");
+		ChildReaper reaper;
+		pid_t pid = forkChild();
+
+		reaper.watch(pid, callback());
+		reaper.unwatch(pid);
+		ensure_equals("(1)", reaper.getWatchCount(), 0u);
+		kill(pid, SIGKILL);
+		SHOULD_NEVER_HAPPEN(100,
+			result = exitCount() > 0;
+		);
+		ensure_equals("(2)", waitpid(pid, NULL, 0), pid);
+	}
+
+	TEST_METHOD(6) {
+		set_test_name("An agent watcher replaces a killed agent with its"
+			" standby process, which then accepts connections");
+		WorkingObjectsPtr wo = boost::make_shared<WorkingObjects>();
+		struct sockaddr_un addr;
+		vector<AgentWatcherPtr> watchers;
+
+		prepareAddress(addr, "tmp.reaper/socket");
+		boost::shared_ptr<FakeAgentWatcher> watcher =
+			boost::make_shared<FakeAgentWatcher>(wo, addr);
+		watchers.push_back(watcher);
+		ScopeGuard guard(boost::bind(shutdownWatchers, &watchers));
+
+		pid_t original = watcher->start();
+		watcher->beginWatching();
+		ensure("(1)", canConnect(addr));
+
+		// Expected: "fake agent crashed with signal SIGKILL, restarting it..."
+		setLogLevel(LVL_ERROR);
+		kill(original, SIGKILL);
+		EVENTUALLY(5,
+			pid_t pid = watcher->getPid();
+			result = pid != 0 && pid != original;
+		);
+		ensure("(2)", canConnect(addr));
+		ensure_equals("The standby process was used", watcher->starts.get(), 1);
+		ensure_equals("(3)", watcher->getErrorMessage(), "");
+	}
+}
@@ -35,6 +35,84 @@ module PhusionPassenger
     split_by_null_into_hash("\0\0").should == { "" => "" }
   end
 
+  describe "#read_session_header" do
+    before :each do
+      @reader, @writer = UNIXSocket.pair
+      @buffer = ''
+      @buffer.force_encoding('binary') if @buffer.respond_to?(:force_encoding)
+    end
+
+    after :each do
+      @reader.close if !@reader.closed?
+      @writer.close if !@writer.closed?
+    end
+
+    def write_scalar(data)
+      MessageChannel.new(@writer).write_scalar(data)
+    end
+
+    it "reads and parses a header block" do
+      write_scalar("REQUEST_METHOD\0GET\0PATH_INFO\0/foo\0EMPTY\0\0")
+      headers = read_session_header(@reader, @buffer, 1024)
+      headers.should == {
+        "REQUEST_METHOD" => "GET",
+        "PATH_INFO" => "/foo",
+        "EMPTY" => ""
+      }
+    end
+
+    it "leaves the request body on the socket" do
+      write_scalar("CONTENT_LENGTH\0005\0")
+      @writer.write("hello")
+      headers = read_session_header(@reader, @buffer, 1024)
+      headers.should == { "CONTENT_LENGTH" => "5" }
+      @reader.read(5).should == "hello"
+    end
+
+    it "can be called multiple times with the same buffer" do
+      write_scalar("A\0001\0")
+      write_scalar("B\0002\0")
+      read_session_header(@reader, @buffer, 1024).should == { "A" => "1" }
+      headers = read_session_header(@reader, @buffer, 1024)
+      headers.should == { "B" => "2" }
+      headers["B"].should_not equal(@buffer)
+    end
+
+    it "handles data that arrives in multiple pieces" do
+      data = [16].pack('N') + "FOO\0bar\0BAZ\0qux\0"
+      thread = Thread.new do
+        data.each_char do |c|
+          @writer.write(c)
+          sleep 0.001
+        end
+      end
+      begin
+        read_session_header(@reader, @buffer, 1024).should == {
+          "FOO" => "bar",
+          "BAZ" => "qux"
+        }
+      ensure
+        thread.join
+      end
+    end
+
+    it "returns nil on EOF" do
+      @writer.close
+      read_session_header(@reader, @buffer, 1024).should be_nil
+    end
+
+    it "returns nil if EOF is encountered in the middle of the header block" do
+      @writer.write([100].pack('N') + "FOO\0")
+      @writer.close
+      read_session_header(@reader, @buffer, 1024).should be_nil
+    end
+
+    it "raises SecurityError if the header block is larger than the given maximum" do
+      write_scalar("FOO\0" + ("x" * 100) + "\0")
+      lambda { read_session_header(@reader, @buffer, 50) }.should raise_error(SecurityError)
+    end
+  end
+
   ######################
 end
 